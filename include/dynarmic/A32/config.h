@@ -57,6 +57,11 @@ struct UserCallbacks {
     // Memory must be interpreted as little endian.
     virtual std::uint32_t MemoryReadCode(VAddr vaddr) { return MemoryRead32(vaddr); }
 
+    // If this callback returns a non-null pointer, instructions in the 4KiB page starting at vaddr
+    // are read directly from that host memory instead of through MemoryReadCode. vaddr is always
+    // page-aligned. The pointer only needs to remain valid for the duration of the translation.
+    virtual const void* GetCodePagePointer(VAddr /*vaddr*/) { return nullptr; }
+
     // Reads through these callbacks may not be aligned.
     // Memory must be interpreted as if ENDIANSTATE == 0, endianness will be corrected by the JIT.
     virtual std::uint8_t MemoryRead8(VAddr vaddr) = 0;
@@ -144,9 +149,19 @@ struct UserConfig {
     /// To detect any access, use: 8 | 16 | 32 | 64.
     std::uint8_t detect_misaligned_access_via_page_table = 0;
     /// Determines if the above option only triggers when the misalignment straddles a
-    /// page boundary.
+    /// page boundary. In this case the access is performed directly against both pages,
+    /// and only falls back to the relevant memory callback if either page is unmapped.
     bool only_detect_misalignment_via_page_table_on_page_boundary = false;
 
+    /// This option relates to IR optimizations. If true, the JIT assumes that guest memory
+    /// is not modified by other cores or devices between memory barriers, and that memory
+    /// callbacks behave like ordinary RAM. This allows values written to memory to be
+    /// forwarded to subsequent reads of the same address within a block, and allows
+    /// redundant reads to be eliminated. Barriers, exclusive accesses, exceptions and
+    /// supervisor calls end the forwarding window.
+    /// This is only used if the ConstProp optimization is enabled.
+    bool memory_not_concurrently_modified = false;
+
     // Fastmem Pointer
     // This should point to the beginning of a 4GB address space which is in arranged just like
     // what you wish for emulated memory to be. If the host page faults on an address, the JIT
@@ -178,6 +193,13 @@ struct UserConfig {
     /// NOTE: Calling Jit::SetCpsr with CPSR.E=1 while this option is enabled may result
     ///       in unusual behavior.
     bool always_little_endian = false;
+
+    /// This option relates to execution tiering. When nonzero, blocks are first executed by
+    /// an IR interpreter and are only compiled once they have been executed this many times.
+    /// Blocks containing IR the interpreter does not implement are compiled immediately.
+    /// Zero disables the interpreter tier. Single-stepping always uses the interpreter where
+    /// possible, regardless of this setting, so that single-step blocks do not fill the code cache.
+    std::size_t interpreter_tier_threshold = 0;
 };
 
 } // namespace A32
@@ -8,6 +8,7 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <map>
 #include <memory>
 #include <string>
 
@@ -130,6 +131,14 @@ public:
      */
     std::string Disassemble() const;
 
+    /**
+     * Debugging: Execution counts of instructions which have no IR translation.
+     * These are either executed by the built-in fallback interpreter or passed to
+     * UserCallbacks::InterpreterFallback.
+     * @return A map from instruction encoding to the number of times it was executed.
+     */
+    std::map<std::uint32_t, std::uint64_t> GetInterpretedInstructionCounts() const;
+
 private:
     struct Impl;
     std::unique_ptr<Impl> impl;
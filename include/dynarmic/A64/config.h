@@ -75,6 +75,11 @@ struct UserCallbacks {
     // Memory must be interpreted as little endian.
     virtual std::uint32_t MemoryReadCode(VAddr vaddr) { return MemoryRead32(vaddr); }
 
+    // If this callback returns a non-null pointer, instructions in the 4KiB page starting at vaddr
+    // are read directly from that host memory instead of through MemoryReadCode. vaddr is always
+    // page-aligned. The pointer only needs to remain valid for the duration of the translation.
+    virtual const void* GetCodePagePointer(VAddr /*vaddr*/) { return nullptr; }
+
     // Reads through these callbacks may not be aligned.
     virtual std::uint8_t MemoryRead8(VAddr vaddr) = 0;
     virtual std::uint16_t MemoryRead16(VAddr vaddr) = 0;
@@ -157,6 +162,14 @@ struct UserConfig {
     /// instruction is executed.
     bool hook_hint_instructions = false;
 
+    /// Pointer authentication and branch target identification are not emulated. Instructions
+    /// that add a pointer authentication code leave the pointer unchanged and BTI is a NOP.
+    /// Instructions that authenticate or strip a pointer (AUT*, XPAC*, and the authenticating
+    /// branches and loads) instead replace the bits of the pointer selected by this mask with
+    /// copies of bit 55. This allows running code that was given pointers signed elsewhere;
+    /// when no such pointers exist this can be left as zero, in which case they are no-ops.
+    std::uint64_t pointer_authentication_strip_mask = 0;
+
     /// Counter-timer frequency register. The value of the register is not interpreted by
     /// dynarmic.
     std::uint32_t cntfrq_el0 = 600000000;
@@ -208,9 +221,19 @@ struct UserConfig {
     /// To detect any access, use: 8 | 16 | 32 | 64 | 128.
     std::uint8_t detect_misaligned_access_via_page_table = 0;
     /// Determines if the above option only triggers when the misalignment straddles a
-    /// page boundary.
+    /// page boundary. In this case the access is performed directly against both pages,
+    /// and only falls back to the relevant memory callback if either page is unmapped.
     bool only_detect_misalignment_via_page_table_on_page_boundary = false;
 
+    /// This option relates to IR optimizations. If true, the JIT assumes that guest memory
+    /// is not modified by other cores or devices between memory barriers, and that memory
+    /// callbacks behave like ordinary RAM. This allows values written to memory to be
+    /// forwarded to subsequent reads of the same address within a block, and allows
+    /// redundant reads to be eliminated. Barriers, exclusive accesses, exceptions and
+    /// supervisor calls end the forwarding window.
+    /// This is only used if the ConstProp optimization is enabled.
+    bool memory_not_concurrently_modified = false;
+
     /// This option relates to translation. Generally when we run into an unpredictable
     /// instruction the ExceptionRaised callback is called. If this is true, we define
     /// definite behaviour for some unpredictable instructions.
@@ -221,6 +244,13 @@ struct UserConfig {
     /// to avoid writting certain unnecessary code only needed for cycle timers.
     bool wall_clock_cntpct = false;
 
+    /// This option relates to execution tiering. When nonzero, blocks are first executed by
+    /// an IR interpreter and are only compiled once they have been executed this many times.
+    /// Blocks containing IR the interpreter does not implement are compiled immediately.
+    /// Zero disables the interpreter tier. Single-stepping always uses the interpreter where
+    /// possible, regardless of this setting, so that single-step blocks do not fill the code cache.
+    std::size_t interpreter_tier_threshold = 0;
+
     // Determines whether AddTicks and GetTicksRemaining are called.
     // If false, execution will continue until soon after Jit::HaltExecution is called.
     // bool enable_ticks = true; // TODO
@@ -60,6 +60,20 @@ public:
         return result;
     }
 
+    /// Executes an atomic read-modify-write operation on the region containing
+    /// [address, address+size), clearing the exclusive state of every processor
+    /// whose exclusive region contains it.
+    template <typename T, typename Function>
+    T DoAtomicOperation(VAddr address, Function op) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        LockAndClear(address, sizeof(T));
+
+        const T result = op();
+
+        Unlock();
+        return result;
+    }
+
     /// Unmark everything.
     void Clear();
     /// Unmark processor id
@@ -67,6 +81,7 @@ public:
 
 private:
     bool CheckAndClear(size_t processor_id, VAddr address);
+    void LockAndClear(VAddr address, size_t size);
 
     void Lock();
     void Unlock();
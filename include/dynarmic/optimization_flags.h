@@ -39,6 +39,11 @@ enum class OptimizationFlag : std::uint32_t {
     /// This is an UNSAFE optimization that reduces accuracy of certain floating-point instructions.
     /// This allows results of FRECPE and FRSQRTE to have **less** error than spec allows.
     Unsafe_ReducedErrorFP   = 0x00020000,
+    /// This is an UNSAFE optimization that causes floating-point instructions to not produce correct NaNs.
+    /// NaN results may have a different sign or payload than the ARM architecture specifies (for example,
+    /// the x64 default NaN is negative and x64 does not prefer signalling NaN operands), and default NaN
+    /// mode is not honoured by arithmetic. Results that are not NaN are unaffected.
+    Unsafe_InaccurateNaN    = 0x00040000,
 };
 
 constexpr OptimizationFlag no_optimizations = static_cast<OptimizationFlag>(0);
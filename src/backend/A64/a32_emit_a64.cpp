@@ -184,6 +184,17 @@ void A32EmitA64::EmitCondPrelude(const A32EmitContext& ctx) {
     code.SetJumpTarget(pass);
 }
 
+std::optional<FixupBranch> A32EmitA64::EmitSkipIfConditionFails(IR::Cond cond) {
+    if (cond == IR::Cond::AL) {
+        return std::nullopt;
+    }
+
+    FixupBranch pass = EmitCond(cond);
+    const FixupBranch skip = code.B();
+    code.SetJumpTarget(pass);
+    return skip;
+}
+
 void A32EmitA64::ClearFastDispatchTable() {
     if (config.HasOptimization(OptimizationFlag::FastDispatch)) {
         fast_dispatch_table.fill({});
@@ -682,7 +693,8 @@ void A32EmitA64::EmitA32BXWritePC(A32EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
     auto& arg = args[0];
 
-    const u32 upper_without_t = (ctx.Location().SetSingleStepping(false).UniqueHash() >> 32) & 0xFFFFFFFE;
+    // Branching always leaves any IT block, so the IT bits are cleared along with T.
+    const u32 upper_without_t = (ctx.Location().SetSingleStepping(false).UniqueHash() >> 32) & 0xFFFF00FE;
 
     // Pseudocode:
     // if (new_pc & 1) {
@@ -720,6 +732,15 @@ void A32EmitA64::EmitA32BXWritePC(A32EmitContext& ctx, IR::Inst* inst) {
     }
 }
 
+void A32EmitA64::EmitA32UpdateUpperLocationDescriptor(A32EmitContext& ctx, IR::Inst*) {
+    for (auto& inst : ctx.block) {
+        if (inst.GetOpcode() == IR::Opcode::A32BXWritePC) {
+            return;
+        }
+    }
+    EmitSetUpperLocationDescriptor(ctx.block.EndLocation(), ctx.Location());
+}
+
 void A32EmitA64::EmitA32CallSupervisor(A32EmitContext& ctx, IR::Inst* inst) {
     ctx.reg_alloc.HostCall(nullptr);
 
@@ -834,6 +855,7 @@ void A32EmitA64::ReadMemory(A32EmitContext& ctx, IR::Inst* inst, const CodePtr c
     ARM64Reg tmp = code.ABI_RETURN;
 
     const auto do_not_fastmem_marker = GenerateDoNotFastmemMarker(ctx, inst);
+    auto skip = EmitSkipIfConditionFails(args[1].GetImmediateCond());
 
     const auto page_table_lookup = [this, result, vaddr, tmp, callback_fn](FixupBranch& end) {
         constexpr size_t bit_size = Common::BitSize<T>();
@@ -915,6 +937,9 @@ void A32EmitA64::ReadMemory(A32EmitContext& ctx, IR::Inst* inst, const CodePtr c
                         }
                 });
 
+        if (skip) {
+            code.SetJumpTarget(*skip);
+        }
         ctx.reg_alloc.DefineValue(inst, result);
         return;
     }
@@ -922,6 +947,9 @@ void A32EmitA64::ReadMemory(A32EmitContext& ctx, IR::Inst* inst, const CodePtr c
     if (!config.page_table) {
         code.BL(callback_fn);
         code.MOV(result, code.ABI_RETURN);
+        if (skip) {
+            code.SetJumpTarget(*skip);
+        }
         ctx.reg_alloc.DefineValue(inst, result);
         return;
     }
@@ -929,6 +957,9 @@ void A32EmitA64::ReadMemory(A32EmitContext& ctx, IR::Inst* inst, const CodePtr c
     FixupBranch end{};
     page_table_lookup(end);
     code.SetJumpTarget(end);
+    if (skip) {
+        code.SetJumpTarget(*skip);
+    }
 
     ctx.reg_alloc.DefineValue(inst, result);
 }
@@ -948,6 +979,7 @@ void A32EmitA64::WriteMemory(A32EmitContext& ctx, IR::Inst* inst, const CodePtr
     ARM64Reg addr = ctx.reg_alloc.ScratchGpr();
 
     const auto do_not_fastmem_marker = GenerateDoNotFastmemMarker(ctx, inst);
+    auto skip = EmitSkipIfConditionFails(args[2].GetImmediateCond());
 
     const auto page_table_lookup = [this, vaddr, value, page_index, addr, callback_fn](FixupBranch& end) {
         constexpr size_t bit_size = Common::BitSize<T>();
@@ -1025,17 +1057,26 @@ void A32EmitA64::WriteMemory(A32EmitContext& ctx, IR::Inst* inst, const CodePtr
                             DoNotFastmem(do_not_fastmem_marker);
                         }
                 });
+        if (skip) {
+            code.SetJumpTarget(*skip);
+        }
         return;
     }
 
     if (!config.page_table) {
         code.BL(callback_fn);
+        if (skip) {
+            code.SetJumpTarget(*skip);
+        }
         return;
     }
 
     FixupBranch end{};
     page_table_lookup(end);
     code.SetJumpTarget(end);
+    if (skip) {
+        code.SetJumpTarget(*skip);
+    }
 }
 
 void A32EmitA64::EmitA32ReadMemory8(A32EmitContext& ctx, IR::Inst* inst) {
@@ -1436,6 +1477,8 @@ void A32EmitA64::EmitTerminalImpl(IR::Term::Interpret terminal, IR::LocationDesc
     ASSERT_MSG(A32::LocationDescriptor{terminal.next}.TFlag() == A32::LocationDescriptor{initial_location}.TFlag(), "Unimplemented");
     ASSERT_MSG(A32::LocationDescriptor{terminal.next}.EFlag() == A32::LocationDescriptor{initial_location}.EFlag(), "Unimplemented");
 
+    EmitSetUpperLocationDescriptor(terminal.next, initial_location);
+
     code.MOVI2R(DecodeReg(code.ABI_PARAM2), A32::LocationDescriptor{terminal.next}.PC());
     code.MOVI2R(DecodeReg(code.ABI_PARAM3), terminal.num_instructions);
     code.STR(INDEX_UNSIGNED, DecodeReg(code.ABI_PARAM2), X28, MJitStateReg(A32::Reg::PC));
@@ -62,6 +62,7 @@ protected:
     ExceptionHandler exception_handler;
 
     void EmitCondPrelude(const A32EmitContext& ctx);
+    std::optional<FixupBranch> EmitSkipIfConditionFails(IR::Cond cond);
 
     struct FastDispatchEntry {
         u64 location_descriptor = 0xFFFF'FFFF'FFFF'FFFFull;
@@ -154,7 +154,9 @@ private:
             PerformCacheInvalidation();
         }
 
-        IR::Block ir_block = A32::Translate(A32::LocationDescriptor{descriptor}, [this](u32 vaddr) { return config.callbacks->MemoryReadCode(vaddr); }, {config.define_unpredictable_behaviour, config.hook_hint_instructions});
+        const auto get_code = [this](u32 vaddr) { return config.callbacks->MemoryReadCode(vaddr); };
+        const A32::TranslationOptions options{config.define_unpredictable_behaviour, config.hook_hint_instructions};
+        IR::Block ir_block = A32::Translate(A32::LocationDescriptor{descriptor}, get_code, options);
         if (config.HasOptimization(OptimizationFlag::GetSetElimination)) {
             Optimization::A32GetSetElimination(ir_block);
             Optimization::DeadCodeElimination(ir_block);
@@ -163,7 +165,7 @@ private:
             Optimization::A32ConstantMemoryReads(ir_block, config.callbacks);
             Optimization::ConstantPropagation(ir_block);
             Optimization::DeadCodeElimination(ir_block);
-            Optimization::A32MergeInterpretBlocksPass(ir_block, config.callbacks);
+            Optimization::A32MergeInterpretBlocksPass(ir_block, get_code, options);
         }
         Optimization::VerificationPass(ir_block);
         return emitter.Emit(ir_block);
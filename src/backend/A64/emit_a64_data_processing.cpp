@@ -178,6 +178,10 @@ static void EmitConditionalSelect(BlockOfCode& code, EmitContext& ctx, IR::Inst*
     ctx.reg_alloc.DefineValue(inst, else_);
 }
 
+void EmitA64::EmitConditionalSelect1(EmitContext& ctx, IR::Inst* inst) {
+    EmitConditionalSelect(code, ctx, inst, 32);
+}
+
 void EmitA64::EmitConditionalSelect32(EmitContext& ctx, IR::Inst* inst) {
     EmitConditionalSelect(code, ctx, inst, 32);
 }
@@ -4,6 +4,7 @@
  */
 
 #include <algorithm>
+#include <iterator>
 #include <optional>
 #include <utility>
 
@@ -20,6 +21,7 @@
 #include "backend/x64/block_of_code.h"
 #include "backend/x64/devirtualize.h"
 #include "backend/x64/emit_x64.h"
+#include "backend/x64/emit_x64_memory.h"
 #include "backend/x64/nzcv_util.h"
 #include "backend/x64/perf_map.h"
 #include "common/assert.h"
@@ -78,7 +80,14 @@ FP::FPCR A32EmitContext::FPCR(bool fpcr_controlled) const {
 
 A32EmitX64::A32EmitX64(BlockOfCode& code, A32::UserConfig conf, A32::Jit* jit_interface)
         : EmitX64(code), conf(std::move(conf)), jit_interface(jit_interface) {
-    GenFastmemFallbacks();
+    gpr_order = any_gpr;
+    if (this->conf.page_table) {
+        gpr_order.erase(std::find(gpr_order.begin(), gpr_order.end(), HostLoc::R14));
+    }
+    if (this->conf.fastmem_pointer) {
+        gpr_order.erase(std::find(gpr_order.begin(), gpr_order.end(), HostLoc::R13));
+    }
+
     GenTerminalHandlers();
     code.PreludeComplete();
     ClearFastDispatchTable();
@@ -94,17 +103,6 @@ A32EmitX64::BlockDescriptor A32EmitX64::Emit(IR::Block& block) {
     code.EnableWriting();
     SCOPE_EXIT { code.DisableWriting(); };
 
-    static const std::vector<HostLoc> gpr_order = [this]{
-        std::vector<HostLoc> gprs{any_gpr};
-        if (conf.page_table) {
-            gprs.erase(std::find(gprs.begin(), gprs.end(), HostLoc::R14));
-        }
-        if (conf.fastmem_pointer) {
-            gprs.erase(std::find(gprs.begin(), gprs.end(), HostLoc::R13));
-        }
-        return gprs;
-    }();
-
     RegAlloc reg_alloc{code, A32JitState::SpillCount, SpillToOpArg<A32JitState>, gpr_order, any_xmm};
     A32EmitContext ctx{conf, reg_alloc, block};
 
@@ -140,6 +138,13 @@ A32EmitX64::BlockDescriptor A32EmitX64::Emit(IR::Block& block) {
         }
 
         reg_alloc.EndOfAllocScope();
+
+        if (ctx.in_standard_asimd) {
+            const auto next = std::next(iter);
+            if (next == block.end() || !EmitContext::CanRemainInStandardASIMD(*next)) {
+                ctx.LeaveStandardASIMD(code);
+            }
+        }
     }
 
     reg_alloc.AssertNoMoreUses();
@@ -164,6 +169,8 @@ void A32EmitX64::ClearCache() {
     block_ranges.ClearCache();
     ClearFastDispatchTable();
     fastmem_patch_info.clear();
+    read_fallbacks.clear();
+    write_fallbacks.clear();
 }
 
 void A32EmitX64::InvalidateCacheRanges(const boost::icl::interval_set<u32>& ranges) {
@@ -190,65 +197,93 @@ void A32EmitX64::ClearFastDispatchTable() {
     }
 }
 
-void A32EmitX64::GenFastmemFallbacks() {
-    const std::initializer_list<int> idxes{0, 1, 2, 3, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14};
-    const std::array<std::pair<size_t, ArgCallback>, 4> read_callbacks{{
-        {8, Devirtualize<&A32::UserCallbacks::MemoryRead8>(conf.callbacks)},
-        {16, Devirtualize<&A32::UserCallbacks::MemoryRead16>(conf.callbacks)},
-        {32, Devirtualize<&A32::UserCallbacks::MemoryRead32>(conf.callbacks)},
-        {64, Devirtualize<&A32::UserCallbacks::MemoryRead64>(conf.callbacks)},
-    }};
-    const std::array<std::pair<size_t, ArgCallback>, 4> write_callbacks{{
-        {8, Devirtualize<&A32::UserCallbacks::MemoryWrite8>(conf.callbacks)},
-        {16, Devirtualize<&A32::UserCallbacks::MemoryWrite16>(conf.callbacks)},
-        {32, Devirtualize<&A32::UserCallbacks::MemoryWrite32>(conf.callbacks)},
-        {64, Devirtualize<&A32::UserCallbacks::MemoryWrite64>(conf.callbacks)},
-    }};
-
-    for (int vaddr_idx : idxes) {
-        for (int value_idx : idxes) {
-            for (const auto& [bitsize, callback] : read_callbacks) {
-                code.align();
-                read_fallbacks[std::make_tuple(bitsize, vaddr_idx, value_idx)] = code.getCurr<void(*)()>();
-                ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, HostLocRegIdx(value_idx));
-                if (vaddr_idx != code.ABI_PARAM2.getIdx()) {
-                    code.mov(code.ABI_PARAM2, Xbyak::Reg64{vaddr_idx});
-                }
-                callback.EmitCall(code);
-                if (value_idx != code.ABI_RETURN.getIdx()) {
-                    code.mov(Xbyak::Reg64{value_idx}, code.ABI_RETURN);
-                }
-                ABI_PopCallerSaveRegistersAndAdjustStackExcept(code, HostLocRegIdx(value_idx));
-                code.ret();
-                PerfMapRegister(read_fallbacks[std::make_tuple(bitsize, vaddr_idx, value_idx)], code.getCurr(), fmt::format("a32_read_fallback_{}", bitsize));
-            }
+A32EmitX64::FastmemFallback A32EmitX64::GetReadFallback(size_t bitsize, int vaddr_idx, int value_idx) {
+    const auto key = std::make_tuple(bitsize, vaddr_idx, value_idx);
+    if (const auto iter = read_fallbacks.find(key); iter != read_fallbacks.end()) {
+        return iter->second;
+    }
 
-            for (const auto& [bitsize, callback] : write_callbacks) {
-                code.align();
-                write_fallbacks[std::make_tuple(bitsize, vaddr_idx, value_idx)] = code.getCurr<void(*)()>();
-                ABI_PushCallerSaveRegistersAndAdjustStack(code);
-                if (vaddr_idx == code.ABI_PARAM3.getIdx() && value_idx == code.ABI_PARAM2.getIdx()) {
-                    code.xchg(code.ABI_PARAM2, code.ABI_PARAM3);
-                } else if (vaddr_idx == code.ABI_PARAM3.getIdx()) {
-                    code.mov(code.ABI_PARAM2, Xbyak::Reg64{vaddr_idx});
-                    if (value_idx != code.ABI_PARAM3.getIdx()) {
-                        code.mov(code.ABI_PARAM3, Xbyak::Reg64{value_idx});
-                    }
-                } else {
-                    if (value_idx != code.ABI_PARAM3.getIdx()) {
-                        code.mov(code.ABI_PARAM3, Xbyak::Reg64{value_idx});
-                    }
-                    if (vaddr_idx != code.ABI_PARAM2.getIdx()) {
-                        code.mov(code.ABI_PARAM2, Xbyak::Reg64{vaddr_idx});
-                    }
-                }
-                callback.EmitCall(code);
-                ABI_PopCallerSaveRegistersAndAdjustStack(code);
-                code.ret();
-                PerfMapRegister(write_fallbacks[std::make_tuple(bitsize, vaddr_idx, value_idx)], code.getCurr(), fmt::format("a32_write_fallback_{}", bitsize));
-            }
+    const ArgCallback callback = [&] {
+        switch (bitsize) {
+        case 8:
+            return Devirtualize<&A32::UserCallbacks::MemoryRead8>(conf.callbacks);
+        case 16:
+            return Devirtualize<&A32::UserCallbacks::MemoryRead16>(conf.callbacks);
+        case 32:
+            return Devirtualize<&A32::UserCallbacks::MemoryRead32>(conf.callbacks);
+        case 64:
+            return Devirtualize<&A32::UserCallbacks::MemoryRead64>(conf.callbacks);
+        }
+        UNREACHABLE();
+    }();
+
+    code.SwitchToFarCode();
+    code.align();
+    const auto fn = code.getCurr<FastmemFallback>();
+    ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, HostLocRegIdx(value_idx));
+    if (vaddr_idx != code.ABI_PARAM2.getIdx()) {
+        code.mov(code.ABI_PARAM2, Xbyak::Reg64{vaddr_idx});
+    }
+    callback.EmitCall(code);
+    if (value_idx != code.ABI_RETURN.getIdx()) {
+        code.mov(Xbyak::Reg64{value_idx}, code.ABI_RETURN);
+    }
+    ABI_PopCallerSaveRegistersAndAdjustStackExcept(code, HostLocRegIdx(value_idx));
+    code.ret();
+    PerfMapRegister(fn, code.getCurr(), fmt::format("a32_read_fallback_{}", bitsize));
+    code.SwitchToNearCode();
+
+    read_fallbacks.emplace(key, fn);
+    return fn;
+}
+
+A32EmitX64::FastmemFallback A32EmitX64::GetWriteFallback(size_t bitsize, int vaddr_idx, int value_idx) {
+    const auto key = std::make_tuple(bitsize, vaddr_idx, value_idx);
+    if (const auto iter = write_fallbacks.find(key); iter != write_fallbacks.end()) {
+        return iter->second;
+    }
+
+    const ArgCallback callback = [&] {
+        switch (bitsize) {
+        case 8:
+            return Devirtualize<&A32::UserCallbacks::MemoryWrite8>(conf.callbacks);
+        case 16:
+            return Devirtualize<&A32::UserCallbacks::MemoryWrite16>(conf.callbacks);
+        case 32:
+            return Devirtualize<&A32::UserCallbacks::MemoryWrite32>(conf.callbacks);
+        case 64:
+            return Devirtualize<&A32::UserCallbacks::MemoryWrite64>(conf.callbacks);
+        }
+        UNREACHABLE();
+    }();
+
+    code.SwitchToFarCode();
+    code.align();
+    const auto fn = code.getCurr<FastmemFallback>();
+    ABI_PushCallerSaveRegistersAndAdjustStack(code);
+    if (vaddr_idx == code.ABI_PARAM3.getIdx() && value_idx == code.ABI_PARAM2.getIdx()) {
+        code.xchg(code.ABI_PARAM2, code.ABI_PARAM3);
+    } else if (vaddr_idx == code.ABI_PARAM3.getIdx()) {
+        code.mov(code.ABI_PARAM2, Xbyak::Reg64{vaddr_idx});
+        if (value_idx != code.ABI_PARAM3.getIdx()) {
+            code.mov(code.ABI_PARAM3, Xbyak::Reg64{value_idx});
+        }
+    } else {
+        if (value_idx != code.ABI_PARAM3.getIdx()) {
+            code.mov(code.ABI_PARAM3, Xbyak::Reg64{value_idx});
+        }
+        if (vaddr_idx != code.ABI_PARAM2.getIdx()) {
+            code.mov(code.ABI_PARAM2, Xbyak::Reg64{vaddr_idx});
         }
     }
+    callback.EmitCall(code);
+    ABI_PopCallerSaveRegistersAndAdjustStack(code);
+    code.ret();
+    PerfMapRegister(fn, code.getCurr(), fmt::format("a32_write_fallback_{}", bitsize));
+    code.SwitchToNearCode();
+
+    write_fallbacks.emplace(key, fn);
+    return fn;
 }
 
 void A32EmitX64::GenTerminalHandlers() {
@@ -296,9 +331,21 @@ void A32EmitX64::GenTerminalHandlers() {
         code.jne(fast_dispatch_cache_miss);
         code.jmp(ptr[rbp + offsetof(FastDispatchEntry, code_ptr)]);
         code.L(fast_dispatch_cache_miss);
-        code.mov(qword[rbp + offsetof(FastDispatchEntry, location_descriptor)], rbx);
-        code.LookupBlock();
-        code.mov(ptr[rbp + offsetof(FastDispatchEntry, code_ptr)], rax);
+        if (conf.interpreter_tier_threshold == 0) {
+            code.mov(qword[rbp + offsetof(FastDispatchEntry, location_descriptor)], rbx);
+            code.LookupBlock();
+            code.mov(ptr[rbp + offsetof(FastDispatchEntry, code_ptr)], rax);
+        } else {
+            // Lookups of blocks which are still interpreted return to the interpreter, and must not be cached.
+            Xbyak::Label skip_cache;
+            code.LookupBlock();
+            code.mov(rcx, reinterpret_cast<u64>(code.GetForceReturnFromRunCodeAddress()));
+            code.cmp(rax, rcx);
+            code.je(skip_cache);
+            code.mov(qword[rbp + offsetof(FastDispatchEntry, location_descriptor)], rbx);
+            code.mov(ptr[rbp + offsetof(FastDispatchEntry, code_ptr)], rax);
+            code.L(skip_cache);
+        }
         code.jmp(rax);
         PerfMapRegister(terminal_handler_fast_dispatch_hint, code.getCurr(), "a32_terminal_handler_fast_dispatch_hint");
 
@@ -741,7 +788,8 @@ void A32EmitX64::EmitA32BXWritePC(A32EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
     auto& arg = args[0];
 
-    const u32 upper_without_t = (ctx.Location().SetSingleStepping(false).UniqueHash() >> 32) & 0xFFFFFFFE;
+    // Branching always leaves any IT block, so the IT bits are cleared along with T.
+    const u32 upper_without_t = (ctx.Location().SetSingleStepping(false).UniqueHash() >> 32) & 0xFFFF00FE;
 
     // Pseudocode:
     // if (new_pc & 1) {
@@ -775,6 +823,15 @@ void A32EmitX64::EmitA32BXWritePC(A32EmitContext& ctx, IR::Inst* inst) {
     }
 }
 
+void A32EmitX64::EmitA32UpdateUpperLocationDescriptor(A32EmitContext& ctx, IR::Inst*) {
+    for (auto& inst : ctx.block) {
+        if (inst.GetOpcode() == IR::Opcode::A32BXWritePC) {
+            return;
+        }
+    }
+    EmitSetUpperLocationDescriptor(ctx.block.EndLocation(), ctx.Location());
+}
+
 void A32EmitX64::EmitA32CallSupervisor(A32EmitContext& ctx, IR::Inst* inst) {
     ctx.reg_alloc.HostCall(nullptr);
 
@@ -894,7 +951,7 @@ constexpr size_t page_bits = 12;
 constexpr size_t page_size = 1 << page_bits;
 constexpr size_t page_mask = (1 << page_bits) - 1;
 
-void EmitDetectMisaignedVAddr(BlockOfCode& code, A32EmitContext& ctx, size_t bitsize, Xbyak::Label& abort, Xbyak::Reg32 vaddr, Xbyak::Reg32 tmp) {
+void EmitDetectMisaignedVAddr(BlockOfCode& code, A32EmitContext& ctx, size_t bitsize, Xbyak::Label& abort, Xbyak::Reg32 vaddr, Xbyak::Reg32 tmp, Xbyak::Label* straddle) {
     if (bitsize == 8 || (ctx.conf.detect_misaligned_access_via_page_table & bitsize) == 0) {
         return;
     }
@@ -931,15 +988,39 @@ void EmitDetectMisaignedVAddr(BlockOfCode& code, A32EmitContext& ctx, size_t bit
     code.and_(tmp, page_align_mask);
     code.cmp(tmp, page_align_mask);
     code.jne(resume, code.T_NEAR);
-    // NOTE: We expect to fallthrough into abort code here.
+    if (straddle) {
+        code.jmp(*straddle, code.T_NEAR);
+    }
+    // NOTE: Otherwise we expect to fallthrough into abort code here.
     code.SwitchToNearCode();
 }
 
-Xbyak::RegExp EmitVAddrLookup(BlockOfCode& code, A32EmitContext& ctx, size_t bitsize, Xbyak::Label& abort, Xbyak::Reg64 vaddr) {
+/// Page-straddling accesses of this size can be performed inline against both pages
+/// instead of being handed to the memory callbacks.
+bool ShouldInlinePageStraddle(const A32EmitContext& ctx, size_t bitsize) {
+    return bitsize != 8
+        && (ctx.conf.detect_misaligned_access_via_page_table & bitsize) != 0
+        && ctx.conf.only_detect_misalignment_via_page_table_on_page_boundary;
+}
+
+/// Scratch registers used by EmitVAddrLookup. These are allocated before any code of the access
+/// is emitted, so that a predicated access can branch around all of it.
+struct VAddrLookupScratch {
+    Xbyak::Reg64 page;
+    Xbyak::Reg32 tmp;
+};
+
+VAddrLookupScratch ScratchVAddrLookup(A32EmitContext& ctx) {
     const Xbyak::Reg64 page = ctx.reg_alloc.ScratchGpr();
     const Xbyak::Reg32 tmp = ctx.conf.absolute_offset_page_table ? page.cvt32() : ctx.reg_alloc.ScratchGpr().cvt32();
+    return {page, tmp};
+}
+
+Xbyak::RegExp EmitVAddrLookup(BlockOfCode& code, A32EmitContext& ctx, size_t bitsize, Xbyak::Label& abort, Xbyak::Reg64 vaddr, VAddrLookupScratch scratch, Xbyak::Label* straddle = nullptr) {
+    const Xbyak::Reg64 page = scratch.page;
+    const Xbyak::Reg32 tmp = scratch.tmp;
 
-    EmitDetectMisaignedVAddr(code, ctx, bitsize, abort, vaddr.cvt32(), tmp);
+    EmitDetectMisaignedVAddr(code, ctx, bitsize, abort, vaddr.cvt32(), tmp, straddle);
 
     // TODO: This code assumes vaddr has been zext from 32-bits to 64-bits.
 
@@ -956,6 +1037,27 @@ Xbyak::RegExp EmitVAddrLookup(BlockOfCode& code, A32EmitContext& ctx, size_t bit
     return page + tmp.cvt64();
 }
 
+/// Register-preserving version of EmitVAddrLookup for use in far code.
+void EmitHostPointerLookup(BlockOfCode& code, A32EmitContext& ctx, Xbyak::Label& fail, Xbyak::Reg64 host_ptr, Xbyak::Reg64 vaddr, Xbyak::Reg64 tmp) {
+    code.mov(tmp.cvt32(), vaddr.cvt32());
+    code.shr(tmp.cvt32(), static_cast<int>(page_bits));
+    code.mov(host_ptr, qword[r14 + tmp * sizeof(void*)]);
+    code.test(host_ptr, host_ptr);
+    code.jz(fail, code.T_NEAR);
+    code.mov(tmp.cvt32(), vaddr.cvt32());
+    if (!ctx.conf.absolute_offset_page_table) {
+        code.and_(tmp.cvt32(), static_cast<u32>(page_mask));
+    }
+    code.add(host_ptr, tmp);
+}
+
+void EmitDetectPageStraddle(BlockOfCode& code, size_t bytes, Xbyak::Label& abort, Xbyak::Reg32 vaddr, Xbyak::Reg32 tmp) {
+    code.mov(tmp, vaddr);
+    code.and_(tmp, static_cast<u32>(page_mask));
+    code.cmp(tmp, static_cast<u32>(page_size - bytes));
+    code.ja(abort, code.T_NEAR);
+}
+
 template<std::size_t bitsize>
 void EmitReadMemoryMov(BlockOfCode& code, const Xbyak::Reg64& value, const Xbyak::RegExp& addr) {
     switch (bitsize) {
@@ -998,22 +1100,42 @@ void EmitWriteMemoryMov(BlockOfCode& code, const Xbyak::RegExp& addr, const Xbya
 
 } // anonymous namespace
 
+/// Branches to skip unless cond passes. This clobbers RAX, and must be emitted after all register
+/// allocation for the access so that the skipped code contains no spills.
+void A32EmitX64::EmitSkipIfConditionFails(IR::Cond cond, Xbyak::Label& skip) {
+    if (cond == IR::Cond::AL) {
+        return;
+    }
+
+    Xbyak::Label pass = EmitCond(cond);
+    code.jmp(skip, code.T_NEAR);
+    code.L(pass);
+}
+
 template<std::size_t bitsize, auto callback>
 void A32EmitX64::ReadMemory(A32EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const IR::Cond cond = args[1].GetImmediateCond();
+    Xbyak::Label end;
 
     if (!conf.page_table) {
         ctx.reg_alloc.HostCall(inst, {}, args[0]);
+        EmitSkipIfConditionFails(cond, end);
         Devirtualize<callback>(conf.callbacks).EmitCall(code);
+        code.L(end);
         return;
     }
 
+    if (cond != IR::Cond::AL) {
+        ctx.reg_alloc.ScratchGpr(HostLoc::RAX);
+    }
     const Xbyak::Reg64 vaddr = ctx.reg_alloc.UseGpr(args[0]);
     const Xbyak::Reg64 value = ctx.reg_alloc.ScratchGpr();
 
-    const auto wrapped_fn = read_fallbacks[std::make_tuple(bitsize, vaddr.getIdx(), value.getIdx())];
+    const auto wrapped_fn = GetReadFallback(bitsize, vaddr.getIdx(), value.getIdx());
 
     if (const auto marker = ShouldFastmem(ctx, inst)) {
+        EmitSkipIfConditionFails(cond, end);
         const auto location = code.getCurr();
         EmitReadMemoryMov<bitsize>(code, value, r13 + vaddr);
 
@@ -1025,18 +1147,28 @@ void A32EmitX64::ReadMemory(A32EmitContext& ctx, IR::Inst* inst) {
                 *marker,
             }
         );
+        code.L(end);
 
         ctx.reg_alloc.DefineValue(inst, value);
         return;
     }
 
-    Xbyak::Label abort, end;
+    Xbyak::Label abort, straddle;
+    const bool inline_straddle = ShouldInlinePageStraddle(ctx, bitsize);
 
-    const auto src_ptr = EmitVAddrLookup(code, ctx, bitsize, abort, vaddr);
+    const auto scratch = ScratchVAddrLookup(ctx);
+    EmitSkipIfConditionFails(cond, end);
+    const auto src_ptr = EmitVAddrLookup(code, ctx, bitsize, abort, vaddr, scratch, inline_straddle ? &straddle : nullptr);
     EmitReadMemoryMov<bitsize>(code, value, src_ptr);
     code.L(end);
 
     code.SwitchToFarCode();
+    if (inline_straddle) {
+        code.L(straddle);
+        EmitStraddledMemoryRead(code, bitsize, abort, end, vaddr, value, [&](auto host_ptr, auto addr, auto tmp, Xbyak::Label& fail) {
+            EmitHostPointerLookup(code, ctx, fail, host_ptr, addr, tmp);
+        });
+    }
     code.L(abort);
     code.call(wrapped_fn);
     code.jmp(end, code.T_NEAR);
@@ -1048,19 +1180,27 @@ void A32EmitX64::ReadMemory(A32EmitContext& ctx, IR::Inst* inst) {
 template<std::size_t bitsize, auto callback>
 void A32EmitX64::WriteMemory(A32EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const IR::Cond cond = args[2].GetImmediateCond();
+    Xbyak::Label end;
 
     if (!conf.page_table) {
         ctx.reg_alloc.HostCall(nullptr, {}, args[0], args[1]);
+        EmitSkipIfConditionFails(cond, end);
         Devirtualize<callback>(conf.callbacks).EmitCall(code);
+        code.L(end);
         return;
     }
 
+    if (cond != IR::Cond::AL) {
+        ctx.reg_alloc.ScratchGpr(HostLoc::RAX);
+    }
     const Xbyak::Reg64 vaddr = ctx.reg_alloc.UseGpr(args[0]);
     const Xbyak::Reg64 value = ctx.reg_alloc.UseGpr(args[1]);
 
-    const auto wrapped_fn = write_fallbacks[std::make_tuple(bitsize, vaddr.getIdx(), value.getIdx())];
+    const auto wrapped_fn = GetWriteFallback(bitsize, vaddr.getIdx(), value.getIdx());
 
     if (const auto marker = ShouldFastmem(ctx, inst)) {
+        EmitSkipIfConditionFails(cond, end);
         const auto location = code.getCurr();
         EmitWriteMemoryMov<bitsize>(code, r13 + vaddr, value);
 
@@ -1072,17 +1212,27 @@ void A32EmitX64::WriteMemory(A32EmitContext& ctx, IR::Inst* inst) {
                 *marker,
             }
         );
+        code.L(end);
 
         return;
     }
 
-    Xbyak::Label abort, end;
+    Xbyak::Label abort, straddle;
+    const bool inline_straddle = ShouldInlinePageStraddle(ctx, bitsize);
 
-    const auto dest_ptr = EmitVAddrLookup(code, ctx, bitsize, abort, vaddr);
+    const auto scratch = ScratchVAddrLookup(ctx);
+    EmitSkipIfConditionFails(cond, end);
+    const auto dest_ptr = EmitVAddrLookup(code, ctx, bitsize, abort, vaddr, scratch, inline_straddle ? &straddle : nullptr);
     EmitWriteMemoryMov<bitsize>(code, dest_ptr, value);
     code.L(end);
 
     code.SwitchToFarCode();
+    if (inline_straddle) {
+        code.L(straddle);
+        EmitStraddledMemoryWrite(code, bitsize, abort, end, vaddr, value, [&](auto host_ptr, auto addr, auto tmp, Xbyak::Label& fail) {
+            EmitHostPointerLookup(code, ctx, fail, host_ptr, addr, tmp);
+        });
+    }
     code.L(abort);
     code.call(wrapped_fn);
     code.jmp(end, code.T_NEAR);
@@ -1121,6 +1271,149 @@ void A32EmitX64::EmitA32WriteMemory64(A32EmitContext& ctx, IR::Inst* inst) {
     WriteMemory<64, &A32::UserCallbacks::MemoryWrite64>(ctx, inst);
 }
 
+void A32EmitX64::EmitA32ReadMemoryPair32(A32EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const IR::Cond cond = args[1].GetImmediateCond();
+    Xbyak::Label end;
+
+    if (cond != IR::Cond::AL) {
+        ctx.reg_alloc.ScratchGpr(HostLoc::RAX);
+    }
+    const Xbyak::Reg64 vaddr = ctx.reg_alloc.UseScratchGpr(args[0]);
+    const Xbyak::Reg64 value = ctx.reg_alloc.ScratchGpr();
+    const Xbyak::Reg64 value_lo = ctx.reg_alloc.ScratchGpr();
+
+    const auto read_lo_fn = GetReadFallback(32, vaddr.getIdx(), value_lo.getIdx());
+    const auto read_hi_fn = GetReadFallback(32, vaddr.getIdx(), value.getIdx());
+
+    // Out-of-line fallback performing both word accesses through the memory callbacks.
+    Xbyak::Label fallback;
+    code.SwitchToFarCode();
+    code.L(fallback);
+    code.sub(rsp, 8);
+    code.call(read_lo_fn);
+    code.add(vaddr.cvt32(), 4);
+    code.call(read_hi_fn);
+    code.add(rsp, 8);
+    code.shl(value, 32);
+    code.mov(value_lo.cvt32(), value_lo.cvt32());
+    code.or_(value, value_lo);
+    code.ret();
+    code.SwitchToNearCode();
+
+    if (!conf.page_table) {
+        EmitSkipIfConditionFails(cond, end);
+        code.call(fallback);
+        code.L(end);
+        ctx.reg_alloc.DefineValue(inst, value);
+        return;
+    }
+
+    if (const auto marker = ShouldFastmem(ctx, inst)) {
+        EmitSkipIfConditionFails(cond, end);
+        const auto location = code.getCurr();
+        code.mov(value, qword[r13 + vaddr]);
+
+        fastmem_patch_info.emplace(
+            Common::BitCast<u64>(location),
+            FastmemPatchInfo{
+                Common::BitCast<u64>(code.getCurr()),
+                Common::BitCast<u64>(fallback.getAddress()),
+                *marker,
+            }
+        );
+        code.L(end);
+
+        ctx.reg_alloc.DefineValue(inst, value);
+        return;
+    }
+
+    Xbyak::Label abort;
+
+    const auto scratch = ScratchVAddrLookup(ctx);
+    EmitSkipIfConditionFails(cond, end);
+    EmitDetectPageStraddle(code, 8, abort, vaddr.cvt32(), value.cvt32());
+    const auto src_ptr = EmitVAddrLookup(code, ctx, 32, abort, vaddr, scratch);
+    code.mov(value, qword[src_ptr]);
+    code.L(end);
+
+    code.SwitchToFarCode();
+    code.L(abort);
+    code.call(fallback);
+    code.jmp(end, code.T_NEAR);
+    code.SwitchToNearCode();
+
+    ctx.reg_alloc.DefineValue(inst, value);
+}
+
+void A32EmitX64::EmitA32WriteMemoryPair32(A32EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const IR::Cond cond = args[2].GetImmediateCond();
+    Xbyak::Label end;
+
+    if (cond != IR::Cond::AL) {
+        ctx.reg_alloc.ScratchGpr(HostLoc::RAX);
+    }
+    const Xbyak::Reg64 vaddr = ctx.reg_alloc.UseScratchGpr(args[0]);
+    const Xbyak::Reg64 value = ctx.reg_alloc.UseScratchGpr(args[1]);
+
+    const auto write_fn = GetWriteFallback(32, vaddr.getIdx(), value.getIdx());
+
+    // Out-of-line fallback performing both word accesses through the memory callbacks.
+    Xbyak::Label fallback;
+    code.SwitchToFarCode();
+    code.L(fallback);
+    code.sub(rsp, 8);
+    code.call(write_fn);
+    code.add(vaddr.cvt32(), 4);
+    code.shr(value, 32);
+    code.call(write_fn);
+    code.add(rsp, 8);
+    code.ret();
+    code.SwitchToNearCode();
+
+    if (!conf.page_table) {
+        EmitSkipIfConditionFails(cond, end);
+        code.call(fallback);
+        code.L(end);
+        return;
+    }
+
+    if (const auto marker = ShouldFastmem(ctx, inst)) {
+        EmitSkipIfConditionFails(cond, end);
+        const auto location = code.getCurr();
+        code.mov(qword[r13 + vaddr], value);
+
+        fastmem_patch_info.emplace(
+            Common::BitCast<u64>(location),
+            FastmemPatchInfo{
+                Common::BitCast<u64>(code.getCurr()),
+                Common::BitCast<u64>(fallback.getAddress()),
+                *marker,
+            }
+        );
+        code.L(end);
+
+        return;
+    }
+
+    Xbyak::Label abort;
+
+    const Xbyak::Reg32 tmp = ctx.reg_alloc.ScratchGpr().cvt32();
+    const auto scratch = ScratchVAddrLookup(ctx);
+    EmitSkipIfConditionFails(cond, end);
+    EmitDetectPageStraddle(code, 8, abort, vaddr.cvt32(), tmp);
+    const auto dest_ptr = EmitVAddrLookup(code, ctx, 32, abort, vaddr, scratch);
+    code.mov(qword[dest_ptr], value);
+    code.L(end);
+
+    code.SwitchToFarCode();
+    code.L(abort);
+    code.call(fallback);
+    code.jmp(end, code.T_NEAR);
+    code.SwitchToNearCode();
+}
+
 template <size_t bitsize, auto callback>
 void A32EmitX64::ExclusiveReadMemory(A32EmitContext& ctx, IR::Inst* inst) {
     using T = mp::unsigned_integer_of_size<bitsize>;
@@ -1487,10 +1780,11 @@ std::string A32EmitX64::LocationDescriptorToFriendlyName(const IR::LocationDescr
 void A32EmitX64::EmitTerminalImpl(IR::Term::Interpret terminal, IR::LocationDescriptor initial_location, bool) {
     ASSERT_MSG(A32::LocationDescriptor{terminal.next}.TFlag() == A32::LocationDescriptor{initial_location}.TFlag(), "Unimplemented");
     ASSERT_MSG(A32::LocationDescriptor{terminal.next}.EFlag() == A32::LocationDescriptor{initial_location}.EFlag(), "Unimplemented");
-    ASSERT_MSG(terminal.num_instructions == 1, "Unimplemented");
+
+    EmitSetUpperLocationDescriptor(terminal.next, initial_location);
 
     code.mov(code.ABI_PARAM2.cvt32(), A32::LocationDescriptor{terminal.next}.PC());
-    code.mov(code.ABI_PARAM3.cvt32(), 1);
+    code.mov(code.ABI_PARAM3.cvt32(), terminal.num_instructions);
     code.mov(MJitStateReg(A32::Reg::PC), code.ABI_PARAM2.cvt32());
     code.SwitchMxcsrOnExit();
     Devirtualize<&A32::UserCallbacks::InterpreterFallback>(conf.callbacks).EmitCall(code);
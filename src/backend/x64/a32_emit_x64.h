@@ -62,6 +62,8 @@ protected:
     A32::UserConfig conf;
     A32::Jit* jit_interface;
     BlockRangeInformation<u32> block_ranges;
+    /// Host GPRs available to the register allocator, excluding those pinned by this configuration.
+    std::vector<HostLoc> gpr_order;
 
     void EmitCondPrelude(const A32EmitContext& ctx);
 
@@ -75,9 +77,12 @@ protected:
     std::array<FastDispatchEntry, fast_dispatch_table_size> fast_dispatch_table;
     void ClearFastDispatchTable();
 
-    std::map<std::tuple<size_t, int, int>, void(*)()> read_fallbacks;
-    std::map<std::tuple<size_t, int, int>, void(*)()> write_fallbacks;
-    void GenFastmemFallbacks();
+    // Fallback thunks are generated into far code on first use and are discarded on cache clear.
+    using FastmemFallback = void(*)();
+    std::map<std::tuple<size_t, int, int>, FastmemFallback> read_fallbacks;
+    std::map<std::tuple<size_t, int, int>, FastmemFallback> write_fallbacks;
+    FastmemFallback GetReadFallback(size_t bitsize, int vaddr_idx, int value_idx);
+    FastmemFallback GetWriteFallback(size_t bitsize, int vaddr_idx, int value_idx);
 
     const void* terminal_handler_pop_rsb_hint;
     const void* terminal_handler_fast_dispatch_hint = nullptr;
@@ -109,6 +114,7 @@ protected:
     FakeCall FastmemCallback(u64 rip);
 
     // Memory access helpers
+    void EmitSkipIfConditionFails(IR::Cond cond, Xbyak::Label& skip);
     template<std::size_t bitsize, auto callback>
     void ReadMemory(A32EmitContext& ctx, IR::Inst* inst);
     template<std::size_t bitsize, auto callback>
@@ -3,8 +3,11 @@
  * SPDX-License-Identifier: 0BSD
  */
 
+#include <cstring>
 #include <functional>
 #include <memory>
+#include <optional>
+#include <unordered_map>
 
 #include <boost/icl/interval_set.hpp>
 #include <fmt/format.h>
@@ -13,6 +16,7 @@
 #include <dynarmic/A32/context.h>
 
 #include "backend/x64/a32_emit_x64.h"
+#include "backend/x64/a32_interpreter.h"
 #include "backend/x64/a32_jitstate.h"
 #include "backend/x64/block_of_code.h"
 #include "backend/x64/callback.h"
@@ -56,6 +60,7 @@ struct Jit::Impl {
             : block_of_code(GenRunCodeCallbacks(conf.callbacks, &GetCurrentBlockThunk, this), JitStateInfo{jit_state}, GenRCP(conf))
             , emitter(block_of_code, conf, jit)
             , conf(std::move(conf))
+            , interpreter(jit_state, this->conf, jit)
             , jit_interface(jit)
     {}
 
@@ -65,27 +70,58 @@ struct Jit::Impl {
 
     A32::UserConfig conf;
 
+    // Blocks which have not yet been executed often enough to be compiled.
+    struct ColdBlock {
+        IR::Block ir_block;
+        size_t execution_count = 0;
+    };
+    A32Interpreter interpreter;
+    std::unordered_map<u64, ColdBlock> cold_blocks;
+    bool return_to_interpreter = false;
+
     // Requests made during execution to invalidate the cache are queued up here.
     size_t invalid_cache_generation = 0;
     boost::icl::interval_set<u32> invalid_cache_ranges;
     bool invalidate_entire_cache = false;
 
     void Execute() {
-        const CodePtr current_codeptr = [this]{
-            // RSB optimization
-            const u32 new_rsb_ptr = (jit_state.rsb_ptr - 1) & A32JitState::RSBPtrMask;
-            if (jit_state.GetUniqueHash() == jit_state.rsb_location_descriptors[new_rsb_ptr]) {
-                jit_state.rsb_ptr = new_rsb_ptr;
-                return reinterpret_cast<CodePtr>(jit_state.rsb_codeptrs[new_rsb_ptr]);
+        do {
+            return_to_interpreter = false;
+
+            if (InterpretColdBlocks()) {
+                return;
             }
 
-            return GetCurrentBlock();
-        }();
+            const CodePtr current_codeptr = [this]{
+                // RSB optimization
+                const u32 new_rsb_ptr = (jit_state.rsb_ptr - 1) & A32JitState::RSBPtrMask;
+                if (jit_state.GetUniqueHash() == jit_state.rsb_location_descriptors[new_rsb_ptr]) {
+                    jit_state.rsb_ptr = new_rsb_ptr;
+                    return reinterpret_cast<CodePtr>(jit_state.rsb_codeptrs[new_rsb_ptr]);
+                }
 
-        block_of_code.RunCode(&jit_state, current_codeptr);
+                return GetCurrentBlock();
+            }();
+
+            block_of_code.RunCode(&jit_state, current_codeptr);
+        } while (return_to_interpreter && !jit_state.halt_requested);
     }
 
     void Step() {
+        const IR::LocationDescriptor descriptor = A32::LocationDescriptor{GetCurrentLocation()}.SetSingleStepping(true);
+        if (!emitter.GetBasicBlock(descriptor)) {
+            // Single-step blocks are interpreted without being cached.
+            IR::Block ir_block = TranslateBlock(descriptor);
+            if (interpreter.CanInterpret(ir_block)) {
+                jit_state.cycles_to_run = jit_state.cycles_remaining = 1;
+                interpreter.Execute(ir_block);
+                conf.callbacks->AddTicks(jit_state.cycles_to_run - jit_state.cycles_remaining);
+                return;
+            }
+            block_of_code.StepCode(&jit_state, EmitBlock(ir_block).entrypoint);
+            return;
+        }
+
         block_of_code.StepCode(&jit_state, GetCurrentSingleStep());
     }
 
@@ -118,6 +154,7 @@ struct Jit::Impl {
             jit_state.ResetRSB();
             block_of_code.ClearCache();
             emitter.ClearCache();
+            cold_blocks.clear();
 
             invalid_cache_ranges.clear();
             invalidate_entire_cache = false;
@@ -131,6 +168,7 @@ struct Jit::Impl {
 
         jit_state.ResetRSB();
         emitter.InvalidateCacheRanges(invalid_cache_ranges);
+        InvalidateColdBlocks(invalid_cache_ranges);
         invalid_cache_ranges.clear();
         invalid_cache_generation++;
     }
@@ -149,6 +187,10 @@ private:
 
     static CodePtr GetCurrentBlockThunk(void* this_voidptr) {
         Jit::Impl& this_ = *static_cast<Jit::Impl*>(this_voidptr);
+        if (this_.GetColdBlock(this_.GetCurrentLocation())) {
+            this_.return_to_interpreter = true;
+            return this_.block_of_code.GetForceReturnFromRunCodeAddress();
+        }
         return this_.GetCurrentBlock();
     }
 
@@ -169,13 +211,31 @@ private:
         if (block)
             return *block;
 
-        constexpr size_t MINIMUM_REMAINING_CODESIZE = 1 * 1024 * 1024;
-        if (block_of_code.SpaceRemaining() < MINIMUM_REMAINING_CODESIZE) {
-            invalidate_entire_cache = true;
-            PerformCacheInvalidation();
-        }
+        IR::Block ir_block = TranslateBlock(descriptor);
+        return EmitBlock(ir_block);
+    }
+
+    IR::Block TranslateBlock(IR::LocationDescriptor descriptor) {
+        // Instructions are read directly from the host code page when the user provides one.
+        constexpr u32 code_page_mask = 0xFFF;
+        std::optional<u32> code_page_vaddr;
+        const u8* code_page = nullptr;
+        const auto get_code = [&](u32 vaddr) {
+            const u32 page_vaddr = vaddr & ~code_page_mask;
+            if (code_page_vaddr != page_vaddr) {
+                code_page_vaddr = page_vaddr;
+                code_page = static_cast<const u8*>(conf.callbacks->GetCodePagePointer(page_vaddr));
+            }
+            if (!code_page) {
+                return conf.callbacks->MemoryReadCode(vaddr);
+            }
+            u32 instruction;
+            std::memcpy(&instruction, code_page + (vaddr & code_page_mask), sizeof(instruction));
+            return instruction;
+        };
 
-        IR::Block ir_block = A32::Translate(A32::LocationDescriptor{descriptor}, [this](u32 vaddr) { return conf.callbacks->MemoryReadCode(vaddr); }, {conf.define_unpredictable_behaviour, conf.hook_hint_instructions});
+        const A32::TranslationOptions options{conf.define_unpredictable_behaviour, conf.hook_hint_instructions};
+        IR::Block ir_block = A32::Translate(A32::LocationDescriptor{descriptor}, get_code, options);
         if (conf.HasOptimization(OptimizationFlag::GetSetElimination)) {
             Optimization::A32GetSetElimination(ir_block);
             Optimization::DeadCodeElimination(ir_block);
@@ -183,11 +243,92 @@ private:
         if (conf.HasOptimization(OptimizationFlag::ConstProp)) {
             Optimization::A32ConstantMemoryReads(ir_block, conf.callbacks);
             Optimization::ConstantPropagation(ir_block);
+            if (conf.memory_not_concurrently_modified) {
+                Optimization::MemoryForwardingPass(ir_block);
+            }
+            Optimization::DeadCodeElimination(ir_block);
+        }
+        if (conf.HasOptimization(OptimizationFlag::MiscIROpt)) {
+            Optimization::A32MergeInterpretBlocksPass(ir_block, get_code, options);
+            Optimization::MemoryPairingPass(ir_block);
             Optimization::DeadCodeElimination(ir_block);
         }
         Optimization::VerificationPass(ir_block);
+        return ir_block;
+    }
+
+    A32EmitX64::BlockDescriptor EmitBlock(IR::Block& ir_block) {
+        constexpr size_t MINIMUM_REMAINING_CODESIZE = 1 * 1024 * 1024;
+        if (block_of_code.SpaceRemaining() < MINIMUM_REMAINING_CODESIZE) {
+            invalidate_entire_cache = true;
+            PerformCacheInvalidation();
+        }
+
+        cold_blocks.erase(ir_block.Location().Value());
         return emitter.Emit(ir_block);
     }
+
+    /// Returns the interpretable cold block at location, or nullptr if the block at location
+    /// is to be run as compiled code. Blocks are compiled here once they become hot.
+    ColdBlock* GetColdBlock(IR::LocationDescriptor location) {
+        if (conf.interpreter_tier_threshold == 0 || emitter.GetBasicBlock(location)) {
+            return nullptr;
+        }
+
+        auto iter = cold_blocks.find(location.Value());
+        if (iter == cold_blocks.end()) {
+            IR::Block ir_block = TranslateBlock(location);
+            if (!interpreter.CanInterpret(ir_block)) {
+                EmitBlock(ir_block);
+                return nullptr;
+            }
+            iter = cold_blocks.emplace(location.Value(), ColdBlock{std::move(ir_block)}).first;
+        }
+
+        if (iter->second.execution_count >= conf.interpreter_tier_threshold) {
+            IR::Block ir_block = std::move(iter->second.ir_block);
+            cold_blocks.erase(iter);
+            EmitBlock(ir_block);
+            return nullptr;
+        }
+
+        return &iter->second;
+    }
+
+    /// Interprets blocks for as long as execution remains in cold code.
+    /// Returns true if execution should not continue into compiled code.
+    bool InterpretColdBlocks() {
+        ColdBlock* cold_block = GetColdBlock(GetCurrentLocation());
+        if (!cold_block) {
+            return false;
+        }
+
+        jit_state.cycles_to_run = jit_state.cycles_remaining = static_cast<s64>(conf.callbacks->GetTicksRemaining());
+        do {
+            cold_block->execution_count++;
+            interpreter.Execute(cold_block->ir_block);
+            if (jit_state.halt_requested || jit_state.cycles_remaining <= 0) {
+                break;
+            }
+            cold_block = GetColdBlock(GetCurrentLocation());
+        } while (cold_block);
+        conf.callbacks->AddTicks(jit_state.cycles_to_run - jit_state.cycles_remaining);
+
+        return jit_state.halt_requested || jit_state.cycles_remaining <= 0;
+    }
+
+    void InvalidateColdBlocks(const boost::icl::interval_set<u32>& ranges) {
+        for (auto iter = cold_blocks.begin(); iter != cold_blocks.end();) {
+            const A32::LocationDescriptor descriptor{iter->second.ir_block.Location()};
+            const A32::LocationDescriptor end_location{iter->second.ir_block.EndLocation()};
+            const auto range = boost::icl::discrete_interval<u32>::closed(descriptor.PC(), end_location.PC() - 1);
+            if (boost::icl::intersects(ranges, range)) {
+                iter = cold_blocks.erase(iter);
+            } else {
+                ++iter;
+            }
+        }
+    }
 };
 
 Jit::Jit(UserConfig conf) : impl(std::make_unique<Impl>(this, std::move(conf))) {}
@@ -0,0 +1,464 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include <type_traits>
+
+#include <dynarmic/exclusive_monitor.h>
+
+#include "backend/x64/a32_interpreter.h"
+#include "backend/x64/nzcv_util.h"
+#include "common/assert.h"
+#include "common/bit_util.h"
+#include "common/variant_util.h"
+#include "frontend/A32/location_descriptor.h"
+#include "frontend/A32/types.h"
+#include "frontend/ir/basic_block.h"
+#include "frontend/ir/microinstruction.h"
+#include "frontend/ir/opcodes.h"
+
+namespace Dynarmic::Backend::X64 {
+
+A32Interpreter::A32Interpreter(A32JitState& jit_state, const A32::UserConfig& conf, A32::Jit* jit_interface)
+        : jit_state(jit_state), conf(conf), jit_interface(jit_interface) {}
+
+void A32Interpreter::Execute(IR::Block& block) {
+    current_block = &block;
+
+    if (block.GetCondition() != IR::Cond::AL && !ConditionPassed(block.GetCondition(), GetNZCV())) {
+        jit_state.cycles_remaining -= static_cast<s64>(block.ConditionFailedCycleCount());
+        ExecuteTerminal(IR::Term::LinkBlock{block.ConditionFailedLocation()}, block.Location());
+        return;
+    }
+
+    ExecuteInstructions(block);
+    jit_state.cycles_remaining -= static_cast<s64>(block.CycleCount());
+    ExecuteTerminal(block.GetTerminal(), block.Location());
+}
+
+bool A32Interpreter::CanInterpretArch(const IR::Inst& inst) const {
+    switch (inst.GetOpcode()) {
+    case IR::Opcode::A32SetCheckBit:
+    case IR::Opcode::A32GetRegister:
+    case IR::Opcode::A32GetExtendedRegister32:
+    case IR::Opcode::A32GetExtendedRegister64:
+    case IR::Opcode::A32GetVector:
+    case IR::Opcode::A32SetRegister:
+    case IR::Opcode::A32SetExtendedRegister32:
+    case IR::Opcode::A32SetExtendedRegister64:
+    case IR::Opcode::A32SetVector:
+    case IR::Opcode::A32GetCpsr:
+    case IR::Opcode::A32SetCpsr:
+    case IR::Opcode::A32SetCpsrNZCVRaw:
+    case IR::Opcode::A32SetCpsrNZCVQ:
+    case IR::Opcode::A32GetNFlag:
+    case IR::Opcode::A32SetNFlag:
+    case IR::Opcode::A32GetZFlag:
+    case IR::Opcode::A32SetZFlag:
+    case IR::Opcode::A32GetCFlag:
+    case IR::Opcode::A32SetCFlag:
+    case IR::Opcode::A32GetVFlag:
+    case IR::Opcode::A32SetVFlag:
+    case IR::Opcode::A32OrQFlag:
+    case IR::Opcode::A32GetGEFlags:
+    case IR::Opcode::A32SetGEFlags:
+    case IR::Opcode::A32SetGEFlagsCompressed:
+    case IR::Opcode::A32GetFpscrNZCV:
+    case IR::Opcode::A32SetFpscrNZCV:
+    case IR::Opcode::A32BXWritePC:
+    case IR::Opcode::A32UpdateUpperLocationDescriptor:
+    case IR::Opcode::A32CallSupervisor:
+    case IR::Opcode::A32ExceptionRaised:
+    case IR::Opcode::A32DataSynchronizationBarrier:
+    case IR::Opcode::A32DataMemoryBarrier:
+    case IR::Opcode::A32InstructionSynchronizationBarrier:
+    case IR::Opcode::A32ClearExclusive:
+    case IR::Opcode::A32ReadMemory8:
+    case IR::Opcode::A32ReadMemory16:
+    case IR::Opcode::A32ReadMemory32:
+    case IR::Opcode::A32ReadMemory64:
+    case IR::Opcode::A32ReadMemoryPair32:
+    case IR::Opcode::A32WriteMemory8:
+    case IR::Opcode::A32WriteMemory16:
+    case IR::Opcode::A32WriteMemory32:
+    case IR::Opcode::A32WriteMemory64:
+    case IR::Opcode::A32WriteMemoryPair32:
+        return true;
+    case IR::Opcode::A32ExclusiveReadMemory8:
+    case IR::Opcode::A32ExclusiveReadMemory16:
+    case IR::Opcode::A32ExclusiveReadMemory32:
+    case IR::Opcode::A32ExclusiveReadMemory64:
+    case IR::Opcode::A32ExclusiveWriteMemory8:
+    case IR::Opcode::A32ExclusiveWriteMemory16:
+    case IR::Opcode::A32ExclusiveWriteMemory32:
+    case IR::Opcode::A32ExclusiveWriteMemory64:
+        return conf.global_monitor != nullptr;
+    default:
+        return false;
+    }
+}
+
+u32 A32Interpreter::GetNZCV() const {
+    return NZCV::FromX64(jit_state.cpsr_nzcv);
+}
+
+FP::FPCR A32Interpreter::GetFPCR(IR::LocationDescriptor location) const {
+    return FP::FPCR{A32::LocationDescriptor{location}.FPSCR().Value()};
+}
+
+u32& A32Interpreter::FPSRExceptions() {
+    return jit_state.fpsr_exc;
+}
+
+void A32Interpreter::ExecuteArch(IR::Inst* inst) {
+    const auto arg = [inst](size_t i) { return inst->GetArg(i); };
+
+    const auto get_flag = [&](size_t flag_bit) {
+        Set(inst, Common::Bit(flag_bit, jit_state.cpsr_nzcv));
+    };
+    const auto set_flag = [&](size_t flag_bit) {
+        jit_state.cpsr_nzcv &= ~(1u << flag_bit);
+        jit_state.cpsr_nzcv |= Get(arg(0)) != 0 ? 1u << flag_bit : 0;
+    };
+
+    const auto exclusive_read = [&](auto callback) {
+        using T = std::invoke_result_t<decltype(callback), A32::VAddr>;
+        const u32 vaddr = static_cast<u32>(Get(arg(0)));
+        jit_state.exclusive_state = 1;
+        Set(inst, conf.global_monitor->ReadAndMark<T>(conf.processor_id, vaddr, [&]() -> T {
+            return callback(vaddr);
+        }));
+    };
+    const auto exclusive_write = [&](auto callback, auto value) {
+        using T = decltype(value);
+        const u32 vaddr = static_cast<u32>(Get(arg(0)));
+        if (jit_state.exclusive_state == 0) {
+            Set(inst, 1);
+            return;
+        }
+        jit_state.exclusive_state = 0;
+        const bool success = conf.global_monitor->DoExclusiveOperation<T>(conf.processor_id, vaddr, [&](T expected) -> bool {
+            return callback(vaddr, value, expected);
+        });
+        Set(inst, success ? 0 : 1);
+    };
+
+    // Accesses of predicated instructions are skipped when their condition fails.
+    // Only selects on that condition consume the value of a skipped read.
+    if (inst->IsSharedMemoryReadOrWrite() && !ConditionPassed(arg(inst->NumArgs() - 1).GetCond(), GetNZCV())) {
+        Set(inst, 0);
+        return;
+    }
+
+    A32::UserCallbacks* cb = conf.callbacks;
+
+    switch (inst->GetOpcode()) {
+    case IR::Opcode::A32SetCheckBit:
+        jit_state.check_bit = Get(arg(0)) != 0;
+        break;
+    case IR::Opcode::A32GetRegister:
+        Set(inst, jit_state.Reg[static_cast<size_t>(arg(0).GetA32RegRef())]);
+        break;
+    case IR::Opcode::A32GetExtendedRegister32: {
+        const size_t index = static_cast<size_t>(arg(0).GetA32ExtRegRef()) - static_cast<size_t>(A32::ExtReg::S0);
+        Set(inst, jit_state.ExtReg[index]);
+        break;
+    }
+    case IR::Opcode::A32GetExtendedRegister64: {
+        const size_t index = static_cast<size_t>(arg(0).GetA32ExtRegRef()) - static_cast<size_t>(A32::ExtReg::D0);
+        Set(inst, jit_state.ExtReg[index * 2] | (u64(jit_state.ExtReg[index * 2 + 1]) << 32));
+        break;
+    }
+    case IR::Opcode::A32GetVector: {
+        const A32::ExtReg reg = arg(0).GetA32ExtRegRef();
+        ASSERT(A32::IsDoubleExtReg(reg) || A32::IsQuadExtReg(reg));
+        if (A32::IsDoubleExtReg(reg)) {
+            const size_t index = static_cast<size_t>(reg) - static_cast<size_t>(A32::ExtReg::D0);
+            SetVector(inst, {jit_state.ExtReg[index * 2] | (u64(jit_state.ExtReg[index * 2 + 1]) << 32), 0});
+        } else {
+            const size_t index = static_cast<size_t>(reg) - static_cast<size_t>(A32::ExtReg::Q0);
+            SetVector(inst, {jit_state.ExtReg[index * 4] | (u64(jit_state.ExtReg[index * 4 + 1]) << 32),
+                             jit_state.ExtReg[index * 4 + 2] | (u64(jit_state.ExtReg[index * 4 + 3]) << 32)});
+        }
+        break;
+    }
+    case IR::Opcode::A32SetRegister:
+        jit_state.Reg[static_cast<size_t>(arg(0).GetA32RegRef())] = static_cast<u32>(Get(arg(1)));
+        break;
+    case IR::Opcode::A32SetExtendedRegister32: {
+        const size_t index = static_cast<size_t>(arg(0).GetA32ExtRegRef()) - static_cast<size_t>(A32::ExtReg::S0);
+        jit_state.ExtReg[index] = static_cast<u32>(Get(arg(1)));
+        break;
+    }
+    case IR::Opcode::A32SetExtendedRegister64: {
+        const size_t index = static_cast<size_t>(arg(0).GetA32ExtRegRef()) - static_cast<size_t>(A32::ExtReg::D0);
+        const u64 value = Get(arg(1));
+        jit_state.ExtReg[index * 2] = static_cast<u32>(value);
+        jit_state.ExtReg[index * 2 + 1] = static_cast<u32>(value >> 32);
+        break;
+    }
+    case IR::Opcode::A32SetVector: {
+        const A32::ExtReg reg = arg(0).GetA32ExtRegRef();
+        ASSERT(A32::IsDoubleExtReg(reg) || A32::IsQuadExtReg(reg));
+        const Vector value = GetVector(arg(1));
+        const size_t words = A32::IsDoubleExtReg(reg) ? 2 : 4;
+        const size_t index = static_cast<size_t>(reg) - static_cast<size_t>(A32::IsDoubleExtReg(reg) ? A32::ExtReg::D0 : A32::ExtReg::Q0);
+        for (size_t i = 0; i < words; i++) {
+            jit_state.ExtReg[index * words + i] = static_cast<u32>(value[i / 2] >> (i % 2 * 32));
+        }
+        break;
+    }
+    case IR::Opcode::A32GetCpsr: {
+        // Unlike A32JitState::Cpsr, the IT bits are not included.
+        u32 cpsr = 0;
+        cpsr |= Common::Bit<0>(jit_state.upper_location_descriptor) ? 1 << 5 : 0;
+        cpsr |= Common::Bit<1>(jit_state.upper_location_descriptor) ? 1 << 9 : 0;
+        cpsr |= Common::Bit<31>(jit_state.cpsr_ge) ? 1 << 19 : 0;
+        cpsr |= Common::Bit<23>(jit_state.cpsr_ge) ? 1 << 18 : 0;
+        cpsr |= Common::Bit<15>(jit_state.cpsr_ge) ? 1 << 17 : 0;
+        cpsr |= Common::Bit<7>(jit_state.cpsr_ge) ? 1 << 16 : 0;
+        cpsr |= jit_state.cpsr_q ? 1 << 27 : 0;
+        cpsr |= NZCV::FromX64(jit_state.cpsr_nzcv);
+        cpsr |= jit_state.cpsr_jaifm;
+        Set(inst, cpsr);
+        break;
+    }
+    case IR::Opcode::A32SetCpsr: {
+        u32 cpsr = static_cast<u32>(Get(arg(0)));
+        if (conf.always_little_endian) {
+            cpsr &= 0xFFFFFDFF;
+        }
+        jit_state.cpsr_q = Common::Bit<27>(cpsr) ? 1 : 0;
+        jit_state.cpsr_nzcv = NZCV::ToX64(cpsr);
+        jit_state.cpsr_jaifm = cpsr & 0x07F0FDDF;
+        jit_state.upper_location_descriptor &= 0xFFFF0000;
+        jit_state.upper_location_descriptor |= Common::Bit<9>(cpsr) ? 2 : 0;
+        jit_state.upper_location_descriptor |= Common::Bit<5>(cpsr) ? 1 : 0;
+        jit_state.cpsr_ge = 0;
+        jit_state.cpsr_ge |= Common::Bit<19>(cpsr) ? 0xFF000000 : 0;
+        jit_state.cpsr_ge |= Common::Bit<18>(cpsr) ? 0x00FF0000 : 0;
+        jit_state.cpsr_ge |= Common::Bit<17>(cpsr) ? 0x0000FF00 : 0;
+        jit_state.cpsr_ge |= Common::Bit<16>(cpsr) ? 0x000000FF : 0;
+        break;
+    }
+    case IR::Opcode::A32SetCpsrNZCVRaw:
+        jit_state.cpsr_nzcv = NZCV::ToX64(static_cast<u32>(Get(arg(0))));
+        break;
+    case IR::Opcode::A32SetCpsrNZCVQ: {
+        const u32 value = static_cast<u32>(Get(arg(0)));
+        jit_state.cpsr_nzcv = NZCV::ToX64(value);
+        jit_state.cpsr_q = Common::Bit<27>(value) ? 1 : 0;
+        break;
+    }
+    case IR::Opcode::A32GetNFlag:
+        get_flag(NZCV::x64_n_flag_bit);
+        break;
+    case IR::Opcode::A32SetNFlag:
+        set_flag(NZCV::x64_n_flag_bit);
+        break;
+    case IR::Opcode::A32GetZFlag:
+        get_flag(NZCV::x64_z_flag_bit);
+        break;
+    case IR::Opcode::A32SetZFlag:
+        set_flag(NZCV::x64_z_flag_bit);
+        break;
+    case IR::Opcode::A32GetCFlag:
+        get_flag(NZCV::x64_c_flag_bit);
+        break;
+    case IR::Opcode::A32SetCFlag:
+        set_flag(NZCV::x64_c_flag_bit);
+        break;
+    case IR::Opcode::A32GetVFlag:
+        get_flag(NZCV::x64_v_flag_bit);
+        break;
+    case IR::Opcode::A32SetVFlag:
+        set_flag(NZCV::x64_v_flag_bit);
+        break;
+    case IR::Opcode::A32OrQFlag:
+        jit_state.cpsr_q |= Get(arg(0)) != 0 ? 1 : 0;
+        break;
+    case IR::Opcode::A32GetGEFlags:
+        Set(inst, jit_state.cpsr_ge);
+        break;
+    case IR::Opcode::A32SetGEFlags:
+        jit_state.cpsr_ge = static_cast<u32>(Get(arg(0)));
+        break;
+    case IR::Opcode::A32SetGEFlagsCompressed: {
+        const u32 value = static_cast<u32>(Get(arg(0)));
+        jit_state.cpsr_ge = 0;
+        jit_state.cpsr_ge |= Common::Bit<19>(value) ? 0xFF000000 : 0;
+        jit_state.cpsr_ge |= Common::Bit<18>(value) ? 0x00FF0000 : 0;
+        jit_state.cpsr_ge |= Common::Bit<17>(value) ? 0x0000FF00 : 0;
+        jit_state.cpsr_ge |= Common::Bit<16>(value) ? 0x000000FF : 0;
+        break;
+    }
+    case IR::Opcode::A32GetFpscrNZCV:
+        Set(inst, jit_state.fpsr_nzcv);
+        break;
+    case IR::Opcode::A32SetFpscrNZCV:
+        jit_state.fpsr_nzcv = static_cast<u32>(Get(arg(0))) & 0xF0000000;
+        break;
+    case IR::Opcode::A32BXWritePC: {
+        // Branching always leaves any IT block, so the IT bits are cleared along with T.
+        const u32 upper_without_t = static_cast<u32>(A32::LocationDescriptor{current_block->Location()}.SetSingleStepping(false).UniqueHash() >> 32) & 0xFFFF00FE;
+        const u32 new_pc = static_cast<u32>(Get(arg(0)));
+        const bool thumb = Common::Bit<0>(new_pc);
+        jit_state.Reg[15] = new_pc & (thumb ? 0xFFFFFFFE : 0xFFFFFFFC);
+        jit_state.upper_location_descriptor = upper_without_t | (thumb ? 1 : 0);
+        break;
+    }
+    case IR::Opcode::A32UpdateUpperLocationDescriptor:
+        for (const auto& block_inst : *current_block) {
+            if (block_inst.GetOpcode() == IR::Opcode::A32BXWritePC) {
+                return;
+            }
+        }
+        SetUpperLocationDescriptor(current_block->EndLocation(), current_block->Location());
+        break;
+    case IR::Opcode::A32CallSupervisor:
+        cb->AddTicks(jit_state.cycles_to_run - jit_state.cycles_remaining);
+        cb->CallSVC(static_cast<u32>(Get(arg(0))));
+        jit_state.cycles_to_run = jit_state.cycles_remaining = static_cast<s64>(cb->GetTicksRemaining());
+        break;
+    case IR::Opcode::A32ExceptionRaised:
+        cb->ExceptionRaised(static_cast<u32>(Get(arg(0))), static_cast<A32::Exception>(Get(arg(1))));
+        break;
+    case IR::Opcode::A32DataSynchronizationBarrier:
+    case IR::Opcode::A32DataMemoryBarrier:
+        break;
+    case IR::Opcode::A32InstructionSynchronizationBarrier:
+        jit_interface->ClearCache();
+        break;
+    case IR::Opcode::A32ClearExclusive:
+        jit_state.exclusive_state = 0;
+        break;
+    case IR::Opcode::A32ReadMemory8:
+        Set(inst, cb->MemoryRead8(static_cast<u32>(Get(arg(0)))));
+        break;
+    case IR::Opcode::A32ReadMemory16:
+        Set(inst, cb->MemoryRead16(static_cast<u32>(Get(arg(0)))));
+        break;
+    case IR::Opcode::A32ReadMemory32:
+        Set(inst, cb->MemoryRead32(static_cast<u32>(Get(arg(0)))));
+        break;
+    case IR::Opcode::A32ReadMemory64:
+        Set(inst, cb->MemoryRead64(static_cast<u32>(Get(arg(0)))));
+        break;
+    case IR::Opcode::A32ReadMemoryPair32: {
+        const u32 vaddr = static_cast<u32>(Get(arg(0)));
+        const u64 lo = cb->MemoryRead32(vaddr);
+        const u64 hi = cb->MemoryRead32(vaddr + 4);
+        Set(inst, lo | (hi << 32));
+        break;
+    }
+    case IR::Opcode::A32WriteMemory8:
+        cb->MemoryWrite8(static_cast<u32>(Get(arg(0))), static_cast<u8>(Get(arg(1))));
+        break;
+    case IR::Opcode::A32WriteMemory16:
+        cb->MemoryWrite16(static_cast<u32>(Get(arg(0))), static_cast<u16>(Get(arg(1))));
+        break;
+    case IR::Opcode::A32WriteMemory32:
+        cb->MemoryWrite32(static_cast<u32>(Get(arg(0))), static_cast<u32>(Get(arg(1))));
+        break;
+    case IR::Opcode::A32WriteMemory64:
+        cb->MemoryWrite64(static_cast<u32>(Get(arg(0))), Get(arg(1)));
+        break;
+    case IR::Opcode::A32WriteMemoryPair32: {
+        const u32 vaddr = static_cast<u32>(Get(arg(0)));
+        const u64 value = Get(arg(1));
+        cb->MemoryWrite32(vaddr, static_cast<u32>(value));
+        cb->MemoryWrite32(vaddr + 4, static_cast<u32>(value >> 32));
+        break;
+    }
+    case IR::Opcode::A32ExclusiveReadMemory8:
+        exclusive_read([cb](u32 vaddr) { return cb->MemoryRead8(vaddr); });
+        break;
+    case IR::Opcode::A32ExclusiveReadMemory16:
+        exclusive_read([cb](u32 vaddr) { return cb->MemoryRead16(vaddr); });
+        break;
+    case IR::Opcode::A32ExclusiveReadMemory32:
+        exclusive_read([cb](u32 vaddr) { return cb->MemoryRead32(vaddr); });
+        break;
+    case IR::Opcode::A32ExclusiveReadMemory64:
+        exclusive_read([cb](u32 vaddr) { return cb->MemoryRead64(vaddr); });
+        break;
+    case IR::Opcode::A32ExclusiveWriteMemory8:
+        exclusive_write([cb](u32 vaddr, u8 value, u8 expected) { return cb->MemoryWriteExclusive8(vaddr, value, expected); }, static_cast<u8>(Get(arg(1))));
+        break;
+    case IR::Opcode::A32ExclusiveWriteMemory16:
+        exclusive_write([cb](u32 vaddr, u16 value, u16 expected) { return cb->MemoryWriteExclusive16(vaddr, value, expected); }, static_cast<u16>(Get(arg(1))));
+        break;
+    case IR::Opcode::A32ExclusiveWriteMemory32:
+        exclusive_write([cb](u32 vaddr, u32 value, u32 expected) { return cb->MemoryWriteExclusive32(vaddr, value, expected); }, static_cast<u32>(Get(arg(1))));
+        break;
+    case IR::Opcode::A32ExclusiveWriteMemory64:
+        exclusive_write([cb](u32 vaddr, u64 value, u64 expected) { return cb->MemoryWriteExclusive64(vaddr, value, expected); }, Get(arg(1)));
+        break;
+    default:
+        ASSERT_FALSE("Invalid opcode: {}", inst->GetOpcode());
+    }
+}
+
+void A32Interpreter::SetUpperLocationDescriptor(IR::LocationDescriptor new_location, IR::LocationDescriptor old_location) {
+    const auto get_upper = [](const IR::LocationDescriptor& desc) -> u32 {
+        return static_cast<u32>(A32::LocationDescriptor{desc}.SetSingleStepping(false).UniqueHash() >> 32);
+    };
+
+    const u32 old_upper = get_upper(old_location);
+    const u32 new_upper = get_upper(new_location) & ~u32(conf.always_little_endian ? 0x2 : 0);
+
+    if (old_upper != new_upper) {
+        jit_state.upper_location_descriptor = new_upper;
+    }
+}
+
+void A32Interpreter::ExecuteTerminal(const IR::Terminal& terminal, IR::LocationDescriptor initial_location) {
+    Common::VisitVariant<void>(terminal, [this, initial_location](const auto& x) {
+        using T = std::decay_t<decltype(x)>;
+        if constexpr (!std::is_same_v<T, IR::Term::Invalid>) {
+            this->ExecuteTerminalImpl(x, initial_location);
+        } else {
+            ASSERT_MSG(false, "Invalid terminal");
+        }
+    });
+}
+
+void A32Interpreter::ExecuteTerminalImpl(const IR::Term::Interpret& terminal, IR::LocationDescriptor initial_location) {
+    SetUpperLocationDescriptor(terminal.next, initial_location);
+    jit_state.Reg[15] = A32::LocationDescriptor{terminal.next}.PC();
+    conf.callbacks->InterpreterFallback(jit_state.Reg[15], terminal.num_instructions);
+}
+
+void A32Interpreter::ExecuteTerminalImpl(const IR::Term::ReturnToDispatch&, IR::LocationDescriptor) {}
+
+void A32Interpreter::ExecuteTerminalImpl(const IR::Term::LinkBlock& terminal, IR::LocationDescriptor initial_location) {
+    SetUpperLocationDescriptor(terminal.next, initial_location);
+    jit_state.Reg[15] = A32::LocationDescriptor{terminal.next}.PC();
+}
+
+void A32Interpreter::ExecuteTerminalImpl(const IR::Term::LinkBlockFast& terminal, IR::LocationDescriptor initial_location) {
+    SetUpperLocationDescriptor(terminal.next, initial_location);
+    jit_state.Reg[15] = A32::LocationDescriptor{terminal.next}.PC();
+}
+
+void A32Interpreter::ExecuteTerminalImpl(const IR::Term::PopRSBHint&, IR::LocationDescriptor) {}
+
+void A32Interpreter::ExecuteTerminalImpl(const IR::Term::FastDispatchHint&, IR::LocationDescriptor) {}
+
+void A32Interpreter::ExecuteTerminalImpl(const IR::Term::If& terminal, IR::LocationDescriptor initial_location) {
+    ExecuteTerminal(ConditionPassed(terminal.if_, GetNZCV()) ? terminal.then_ : terminal.else_, initial_location);
+}
+
+void A32Interpreter::ExecuteTerminalImpl(const IR::Term::CheckBit& terminal, IR::LocationDescriptor initial_location) {
+    ExecuteTerminal(jit_state.check_bit ? terminal.then_ : terminal.else_, initial_location);
+}
+
+void A32Interpreter::ExecuteTerminalImpl(const IR::Term::CheckHalt& terminal, IR::LocationDescriptor initial_location) {
+    if (jit_state.halt_requested) {
+        return;
+    }
+    ExecuteTerminal(terminal.else_, initial_location);
+}
+
+} // namespace Dynarmic::Backend::X64
@@ -0,0 +1,53 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#pragma once
+
+#include <dynarmic/A32/a32.h>
+#include <dynarmic/A32/config.h>
+
+#include "backend/x64/a32_jitstate.h"
+#include "backend/x64/interpreter.h"
+#include "frontend/ir/location_descriptor.h"
+#include "frontend/ir/terminal.h"
+
+namespace Dynarmic::Backend::X64 {
+
+class A32Interpreter final : public Interpreter {
+public:
+    A32Interpreter(A32JitState& jit_state, const A32::UserConfig& conf, A32::Jit* jit_interface);
+
+    /// Executes block, including its condition and terminal, and updates cycles_remaining.
+    void Execute(IR::Block& block);
+
+protected:
+    bool CanInterpretArch(const IR::Inst& inst) const override;
+    void ExecuteArch(IR::Inst* inst) override;
+    u32 GetNZCV() const override;
+    FP::FPCR GetFPCR(IR::LocationDescriptor location) const override;
+    u32& FPSRExceptions() override;
+
+private:
+    void ExecuteTerminal(const IR::Terminal& terminal, IR::LocationDescriptor initial_location);
+    void ExecuteTerminalImpl(const IR::Term::Interpret& terminal, IR::LocationDescriptor initial_location);
+    void ExecuteTerminalImpl(const IR::Term::ReturnToDispatch& terminal, IR::LocationDescriptor initial_location);
+    void ExecuteTerminalImpl(const IR::Term::LinkBlock& terminal, IR::LocationDescriptor initial_location);
+    void ExecuteTerminalImpl(const IR::Term::LinkBlockFast& terminal, IR::LocationDescriptor initial_location);
+    void ExecuteTerminalImpl(const IR::Term::PopRSBHint& terminal, IR::LocationDescriptor initial_location);
+    void ExecuteTerminalImpl(const IR::Term::FastDispatchHint& terminal, IR::LocationDescriptor initial_location);
+    void ExecuteTerminalImpl(const IR::Term::If& terminal, IR::LocationDescriptor initial_location);
+    void ExecuteTerminalImpl(const IR::Term::CheckBit& terminal, IR::LocationDescriptor initial_location);
+    void ExecuteTerminalImpl(const IR::Term::CheckHalt& terminal, IR::LocationDescriptor initial_location);
+
+    void SetUpperLocationDescriptor(IR::LocationDescriptor new_location, IR::LocationDescriptor old_location);
+
+    A32JitState& jit_state;
+    const A32::UserConfig& conf;
+    A32::Jit* jit_interface;
+
+    const IR::Block* current_block = nullptr;
+};
+
+} // namespace Dynarmic::Backend::X64
@@ -3,7 +3,11 @@
  * SPDX-License-Identifier: 0BSD
  */
 
+#include <algorithm>
 #include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <vector>
 
 #include <fmt/format.h>
 #include <fmt/ostream.h>
@@ -17,6 +21,7 @@
 #include "backend/x64/block_of_code.h"
 #include "backend/x64/devirtualize.h"
 #include "backend/x64/emit_x64.h"
+#include "backend/x64/emit_x64_memory.h"
 #include "backend/x64/nzcv_util.h"
 #include "backend/x64/perf_map.h"
 #include "common/assert.h"
@@ -27,6 +32,7 @@
 #include "frontend/A64/types.h"
 #include "frontend/ir/basic_block.h"
 #include "frontend/ir/cond.h"
+#include "frontend/ir/ir_emitter.h"
 #include "frontend/ir/microinstruction.h"
 #include "frontend/ir/opcodes.h"
 
@@ -54,8 +60,12 @@ FP::FPCR A64EmitContext::FPCR(bool fpcr_controlled) const {
 
 A64EmitX64::A64EmitX64(BlockOfCode& code, A64::UserConfig conf, A64::Jit* jit_interface)
         : EmitX64(code), conf(conf), jit_interface{jit_interface} {
+    gpr_order = any_gpr;
+    if (this->conf.page_table) {
+        gpr_order.erase(std::find(gpr_order.begin(), gpr_order.end(), HostLoc::R14));
+    }
+
     GenMemory128Accessors();
-    GenFastmemFallbacks();
     GenTerminalHandlers();
     code.PreludeComplete();
     ClearFastDispatchTable();
@@ -67,14 +77,6 @@ A64EmitX64::BlockDescriptor A64EmitX64::Emit(IR::Block& block) {
     code.EnableWriting();
     SCOPE_EXIT { code.DisableWriting(); };
 
-    static const std::vector<HostLoc> gpr_order = [this]{
-        std::vector<HostLoc> gprs{any_gpr};
-        if (conf.page_table) {
-            gprs.erase(std::find(gprs.begin(), gprs.end(), HostLoc::R14));
-        }
-        return gprs;
-    }();
-
     RegAlloc reg_alloc{code, A64JitState::SpillCount, SpillToOpArg<A64JitState>, gpr_order, any_xmm};
     A64EmitContext ctx{conf, reg_alloc, block};
 
@@ -110,6 +112,13 @@ A64EmitX64::BlockDescriptor A64EmitX64::Emit(IR::Block& block) {
         }
 
         ctx.reg_alloc.EndOfAllocScope();
+
+        if (ctx.in_standard_asimd) {
+            const auto next = std::next(iter);
+            if (next == block.end() || !EmitContext::CanRemainInStandardASIMD(*next)) {
+                ctx.LeaveStandardASIMD(code);
+            }
+        }
     }
 
     reg_alloc.AssertNoMoreUses();
@@ -133,6 +142,8 @@ void A64EmitX64::ClearCache() {
     EmitX64::ClearCache();
     block_ranges.ClearCache();
     ClearFastDispatchTable();
+    read_fallbacks.clear();
+    write_fallbacks.clear();
 }
 
 void A64EmitX64::InvalidateCacheRanges(const boost::icl::interval_set<u64>& ranges) {
@@ -198,101 +209,115 @@ void A64EmitX64::GenMemory128Accessors() {
     PerfMapRegister(memory_read_128, code.getCurr(), "a64_memory_write_128");
 }
 
-void A64EmitX64::GenFastmemFallbacks() {
-    const std::initializer_list<int> idxes{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
-    const std::array<std::pair<size_t, ArgCallback>, 4> read_callbacks{{
-        {8, Devirtualize<&A64::UserCallbacks::MemoryRead8>(conf.callbacks)},
-        {16, Devirtualize<&A64::UserCallbacks::MemoryRead16>(conf.callbacks)},
-        {32, Devirtualize<&A64::UserCallbacks::MemoryRead32>(conf.callbacks)},
-        {64, Devirtualize<&A64::UserCallbacks::MemoryRead64>(conf.callbacks)},
-    }};
-    const std::array<std::pair<size_t, ArgCallback>, 4> write_callbacks{{
-        {8, Devirtualize<&A64::UserCallbacks::MemoryWrite8>(conf.callbacks)},
-        {16, Devirtualize<&A64::UserCallbacks::MemoryWrite16>(conf.callbacks)},
-        {32, Devirtualize<&A64::UserCallbacks::MemoryWrite32>(conf.callbacks)},
-        {64, Devirtualize<&A64::UserCallbacks::MemoryWrite64>(conf.callbacks)},
-    }};
-
-    for (int vaddr_idx : idxes) {
-        if (vaddr_idx == 4 || vaddr_idx == 15) {
-            continue;
-        }
+A64EmitX64::FastmemFallback A64EmitX64::GetReadFallback(size_t bitsize, int vaddr_idx, int value_idx) {
+    const auto key = std::make_tuple(bitsize, vaddr_idx, value_idx);
+    if (const auto iter = read_fallbacks.find(key); iter != read_fallbacks.end()) {
+        return iter->second;
+    }
 
-        for (int value_idx : idxes) {
-            code.align();
-            read_fallbacks[std::make_tuple(128, vaddr_idx, value_idx)] = code.getCurr<void(*)()>();
-            ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, HostLocXmmIdx(value_idx));
-            if (vaddr_idx != code.ABI_PARAM2.getIdx()) {
-                code.mov(code.ABI_PARAM2, Xbyak::Reg64{vaddr_idx});
-            }
-            code.call(memory_read_128);
-            if (value_idx != 1) {
-                code.movaps(Xbyak::Xmm{value_idx}, xmm1);
+    code.SwitchToFarCode();
+    code.align();
+    const auto fn = code.getCurr<FastmemFallback>();
+    if (bitsize == 128) {
+        ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, HostLocXmmIdx(value_idx));
+        if (vaddr_idx != code.ABI_PARAM2.getIdx()) {
+            code.mov(code.ABI_PARAM2, Xbyak::Reg64{vaddr_idx});
+        }
+        code.call(memory_read_128);
+        if (value_idx != 1) {
+            code.movaps(Xbyak::Xmm{value_idx}, xmm1);
+        }
+        ABI_PopCallerSaveRegistersAndAdjustStackExcept(code, HostLocXmmIdx(value_idx));
+    } else {
+        const ArgCallback callback = [&] {
+            switch (bitsize) {
+            case 8:
+                return Devirtualize<&A64::UserCallbacks::MemoryRead8>(conf.callbacks);
+            case 16:
+                return Devirtualize<&A64::UserCallbacks::MemoryRead16>(conf.callbacks);
+            case 32:
+                return Devirtualize<&A64::UserCallbacks::MemoryRead32>(conf.callbacks);
+            case 64:
+                return Devirtualize<&A64::UserCallbacks::MemoryRead64>(conf.callbacks);
             }
-            ABI_PopCallerSaveRegistersAndAdjustStackExcept(code, HostLocXmmIdx(value_idx));
-            code.ret();
-            PerfMapRegister(read_fallbacks[std::make_tuple(128, vaddr_idx, value_idx)], code.getCurr(), "a64_read_fallback_128");
+            UNREACHABLE();
+        }();
 
-            code.align();
-            write_fallbacks[std::make_tuple(128, vaddr_idx, value_idx)] = code.getCurr<void(*)()>();
-            ABI_PushCallerSaveRegistersAndAdjustStack(code);
-            if (vaddr_idx != code.ABI_PARAM2.getIdx()) {
-                code.mov(code.ABI_PARAM2, Xbyak::Reg64{vaddr_idx});
-            }
-            if (value_idx != 1) {
-                code.movaps(xmm1, Xbyak::Xmm{value_idx});
-            }
-            code.call(memory_write_128);
-            ABI_PopCallerSaveRegistersAndAdjustStack(code);
-            code.ret();
-            PerfMapRegister(write_fallbacks[std::make_tuple(128, vaddr_idx, value_idx)], code.getCurr(), "a64_write_fallback_128");
+        ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, HostLocRegIdx(value_idx));
+        if (vaddr_idx != code.ABI_PARAM2.getIdx()) {
+            code.mov(code.ABI_PARAM2, Xbyak::Reg64{vaddr_idx});
+        }
+        callback.EmitCall(code);
+        if (value_idx != code.ABI_RETURN.getIdx()) {
+            code.mov(Xbyak::Reg64{value_idx}, code.ABI_RETURN);
+        }
+        ABI_PopCallerSaveRegistersAndAdjustStackExcept(code, HostLocRegIdx(value_idx));
+    }
+    code.ret();
+    PerfMapRegister(fn, code.getCurr(), fmt::format("a64_read_fallback_{}", bitsize));
+    code.SwitchToNearCode();
 
-            if (value_idx == 4 || value_idx == 15) {
-                continue;
-            }
+    read_fallbacks.emplace(key, fn);
+    return fn;
+}
 
-            for (const auto& [bitsize, callback] : read_callbacks) {
-                code.align();
-                read_fallbacks[std::make_tuple(bitsize, vaddr_idx, value_idx)] = code.getCurr<void(*)()>();
-                ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, HostLocRegIdx(value_idx));
-                if (vaddr_idx != code.ABI_PARAM2.getIdx()) {
-                    code.mov(code.ABI_PARAM2, Xbyak::Reg64{vaddr_idx});
-                }
-                callback.EmitCall(code);
-                if (value_idx != code.ABI_RETURN.getIdx()) {
-                    code.mov(Xbyak::Reg64{value_idx}, code.ABI_RETURN);
-                }
-                ABI_PopCallerSaveRegistersAndAdjustStackExcept(code, HostLocRegIdx(value_idx));
-                code.ret();
-                PerfMapRegister(read_fallbacks[std::make_tuple(bitsize, vaddr_idx, value_idx)], code.getCurr(), fmt::format("a64_read_fallback_{}", bitsize));
-            }
+A64EmitX64::FastmemFallback A64EmitX64::GetWriteFallback(size_t bitsize, int vaddr_idx, int value_idx) {
+    const auto key = std::make_tuple(bitsize, vaddr_idx, value_idx);
+    if (const auto iter = write_fallbacks.find(key); iter != write_fallbacks.end()) {
+        return iter->second;
+    }
 
-            for (const auto& [bitsize, callback] : write_callbacks) {
-                code.align();
-                write_fallbacks[std::make_tuple(bitsize, vaddr_idx, value_idx)] = code.getCurr<void(*)()>();
-                ABI_PushCallerSaveRegistersAndAdjustStack(code);
-                if (vaddr_idx == code.ABI_PARAM3.getIdx() && value_idx == code.ABI_PARAM2.getIdx()) {
-                    code.xchg(code.ABI_PARAM2, code.ABI_PARAM3);
-                } else if (vaddr_idx == code.ABI_PARAM3.getIdx()) {
-                    code.mov(code.ABI_PARAM2, Xbyak::Reg64{vaddr_idx});
-                    if (value_idx != code.ABI_PARAM3.getIdx()) {
-                        code.mov(code.ABI_PARAM3, Xbyak::Reg64{value_idx});
-                    }
-                } else {
-                    if (value_idx != code.ABI_PARAM3.getIdx()) {
-                        code.mov(code.ABI_PARAM3, Xbyak::Reg64{value_idx});
-                    }
-                    if (vaddr_idx != code.ABI_PARAM2.getIdx()) {
-                        code.mov(code.ABI_PARAM2, Xbyak::Reg64{vaddr_idx});
-                    }
-                }
-                callback.EmitCall(code);
-                ABI_PopCallerSaveRegistersAndAdjustStack(code);
-                code.ret();
-                PerfMapRegister(write_fallbacks[std::make_tuple(bitsize, vaddr_idx, value_idx)], code.getCurr(), fmt::format("a64_write_fallback_{}", bitsize));
+    code.SwitchToFarCode();
+    code.align();
+    const auto fn = code.getCurr<FastmemFallback>();
+    ABI_PushCallerSaveRegistersAndAdjustStack(code);
+    if (bitsize == 128) {
+        if (vaddr_idx != code.ABI_PARAM2.getIdx()) {
+            code.mov(code.ABI_PARAM2, Xbyak::Reg64{vaddr_idx});
+        }
+        if (value_idx != 1) {
+            code.movaps(xmm1, Xbyak::Xmm{value_idx});
+        }
+        code.call(memory_write_128);
+    } else {
+        const ArgCallback callback = [&] {
+            switch (bitsize) {
+            case 8:
+                return Devirtualize<&A64::UserCallbacks::MemoryWrite8>(conf.callbacks);
+            case 16:
+                return Devirtualize<&A64::UserCallbacks::MemoryWrite16>(conf.callbacks);
+            case 32:
+                return Devirtualize<&A64::UserCallbacks::MemoryWrite32>(conf.callbacks);
+            case 64:
+                return Devirtualize<&A64::UserCallbacks::MemoryWrite64>(conf.callbacks);
+            }
+            UNREACHABLE();
+        }();
+
+        if (vaddr_idx == code.ABI_PARAM3.getIdx() && value_idx == code.ABI_PARAM2.getIdx()) {
+            code.xchg(code.ABI_PARAM2, code.ABI_PARAM3);
+        } else if (vaddr_idx == code.ABI_PARAM3.getIdx()) {
+            code.mov(code.ABI_PARAM2, Xbyak::Reg64{vaddr_idx});
+            if (value_idx != code.ABI_PARAM3.getIdx()) {
+                code.mov(code.ABI_PARAM3, Xbyak::Reg64{value_idx});
+            }
+        } else {
+            if (value_idx != code.ABI_PARAM3.getIdx()) {
+                code.mov(code.ABI_PARAM3, Xbyak::Reg64{value_idx});
+            }
+            if (vaddr_idx != code.ABI_PARAM2.getIdx()) {
+                code.mov(code.ABI_PARAM2, Xbyak::Reg64{vaddr_idx});
             }
         }
+        callback.EmitCall(code);
     }
+    ABI_PopCallerSaveRegistersAndAdjustStack(code);
+    code.ret();
+    PerfMapRegister(fn, code.getCurr(), fmt::format("a64_write_fallback_{}", bitsize));
+    code.SwitchToNearCode();
+
+    write_fallbacks.emplace(key, fn);
+    return fn;
 }
 
 void A64EmitX64::GenTerminalHandlers() {
@@ -343,9 +368,21 @@ void A64EmitX64::GenTerminalHandlers() {
         code.jne(fast_dispatch_cache_miss);
         code.jmp(ptr[rbp + offsetof(FastDispatchEntry, code_ptr)]);
         code.L(fast_dispatch_cache_miss);
-        code.mov(qword[rbp + offsetof(FastDispatchEntry, location_descriptor)], rbx);
-        code.LookupBlock();
-        code.mov(ptr[rbp + offsetof(FastDispatchEntry, code_ptr)], rax);
+        if (conf.interpreter_tier_threshold == 0) {
+            code.mov(qword[rbp + offsetof(FastDispatchEntry, location_descriptor)], rbx);
+            code.LookupBlock();
+            code.mov(ptr[rbp + offsetof(FastDispatchEntry, code_ptr)], rax);
+        } else {
+            // Lookups of blocks which are still interpreted return to the interpreter, and must not be cached.
+            Xbyak::Label skip_cache;
+            code.LookupBlock();
+            code.mov(rcx, reinterpret_cast<u64>(code.GetForceReturnFromRunCodeAddress()));
+            code.cmp(rax, rcx);
+            code.je(skip_cache);
+            code.mov(qword[rbp + offsetof(FastDispatchEntry, location_descriptor)], rbx);
+            code.mov(ptr[rbp + offsetof(FastDispatchEntry, code_ptr)], rax);
+            code.L(skip_cache);
+        }
         code.jmp(rax);
         PerfMapRegister(terminal_handler_fast_dispatch_hint, code.getCurr(), "a64_terminal_handler_fast_dispatch_hint");
 
@@ -734,7 +771,7 @@ constexpr size_t page_bits = 12;
 constexpr size_t page_size = 1 << page_bits;
 constexpr size_t page_mask = (1 << page_bits) - 1;
 
-void EmitDetectMisaignedVAddr(BlockOfCode& code, A64EmitContext& ctx, size_t bitsize, Xbyak::Label& abort, Xbyak::Reg64 vaddr, Xbyak::Reg64 tmp) {
+void EmitDetectMisaignedVAddr(BlockOfCode& code, A64EmitContext& ctx, size_t bitsize, Xbyak::Label& abort, Xbyak::Reg64 vaddr, Xbyak::Reg64 tmp, Xbyak::Label* straddle) {
     if (bitsize == 8 || (ctx.conf.detect_misaligned_access_via_page_table & bitsize) == 0) {
         return;
     }
@@ -773,18 +810,29 @@ void EmitDetectMisaignedVAddr(BlockOfCode& code, A64EmitContext& ctx, size_t bit
     code.and_(tmp, page_align_mask);
     code.cmp(tmp, page_align_mask);
     code.jne(resume, code.T_NEAR);
-    // NOTE: We expect to fallthrough into abort code here.
+    if (straddle) {
+        code.jmp(*straddle, code.T_NEAR);
+    }
+    // NOTE: Otherwise we expect to fallthrough into abort code here.
     code.SwitchToNearCode();
 }
 
-Xbyak::RegExp EmitVAddrLookup(BlockOfCode& code, A64EmitContext& ctx, size_t bitsize, Xbyak::Label& abort, Xbyak::Reg64 vaddr) {
+/// Page-straddling accesses of this size can be performed inline against both pages
+/// instead of being handed to the memory callbacks.
+bool ShouldInlinePageStraddle(const A64EmitContext& ctx, size_t bitsize) {
+    return bitsize != 8
+        && (ctx.conf.detect_misaligned_access_via_page_table & bitsize) != 0
+        && ctx.conf.only_detect_misalignment_via_page_table_on_page_boundary;
+}
+
+Xbyak::RegExp EmitVAddrLookup(BlockOfCode& code, A64EmitContext& ctx, size_t bitsize, Xbyak::Label& abort, Xbyak::Reg64 vaddr, Xbyak::Label* straddle = nullptr) {
     const size_t valid_page_index_bits = ctx.conf.page_table_address_space_bits - page_bits;
     const size_t unused_top_bits = 64 - ctx.conf.page_table_address_space_bits;
 
     const Xbyak::Reg64 page = ctx.reg_alloc.ScratchGpr();
     const Xbyak::Reg64 tmp = ctx.conf.absolute_offset_page_table ? page : ctx.reg_alloc.ScratchGpr();
 
-    EmitDetectMisaignedVAddr(code, ctx, bitsize, abort, vaddr, tmp);
+    EmitDetectMisaignedVAddr(code, ctx, bitsize, abort, vaddr, tmp, straddle);
 
     if (unused_top_bits == 0) {
         code.mov(tmp, vaddr);
@@ -825,6 +873,46 @@ Xbyak::RegExp EmitVAddrLookup(BlockOfCode& code, A64EmitContext& ctx, size_t bit
     return page + tmp;
 }
 
+/// Register-preserving version of EmitVAddrLookup for use in far code.
+void EmitHostPointerLookup(BlockOfCode& code, A64EmitContext& ctx, Xbyak::Label& fail, Xbyak::Reg64 host_ptr, Xbyak::Reg64 vaddr, Xbyak::Reg64 tmp) {
+    const size_t valid_page_index_bits = ctx.conf.page_table_address_space_bits - page_bits;
+    const size_t unused_top_bits = 64 - ctx.conf.page_table_address_space_bits;
+
+    code.mov(tmp, vaddr);
+    if (unused_top_bits == 0) {
+        code.shr(tmp, int(page_bits));
+    } else if (ctx.conf.silently_mirror_page_table) {
+        if (valid_page_index_bits >= 32) {
+            code.shl(tmp, int(unused_top_bits));
+            code.shr(tmp, int(unused_top_bits + page_bits));
+        } else {
+            code.shr(tmp, int(page_bits));
+            code.and_(tmp, u32((1 << valid_page_index_bits) - 1));
+        }
+    } else {
+        code.shr(tmp, int(page_bits));
+        code.test(tmp, u32(-(1 << valid_page_index_bits)));
+        code.jnz(fail, code.T_NEAR);
+    }
+    code.mov(host_ptr, qword[r14 + tmp * sizeof(void*)]);
+    code.test(host_ptr, host_ptr);
+    code.jz(fail, code.T_NEAR);
+    if (ctx.conf.absolute_offset_page_table) {
+        code.add(host_ptr, vaddr);
+        return;
+    }
+    code.mov(tmp, vaddr);
+    code.and_(tmp, static_cast<u32>(page_mask));
+    code.add(host_ptr, tmp);
+}
+
+void EmitDetectPageStraddle(BlockOfCode& code, size_t bytes, Xbyak::Label& abort, Xbyak::Reg64 vaddr, Xbyak::Reg64 tmp) {
+    code.mov(tmp.cvt32(), vaddr.cvt32());
+    code.and_(tmp.cvt32(), static_cast<u32>(page_mask));
+    code.cmp(tmp.cvt32(), static_cast<u32>(page_size - bytes));
+    code.ja(abort, code.T_NEAR);
+}
+
 template<std::size_t bitsize>
 void EmitReadMemoryMov(BlockOfCode& code, const Xbyak::Reg64& value, const Xbyak::RegExp& addr) {
     switch (bitsize) {
@@ -874,15 +962,22 @@ void A64EmitX64::EmitDirectPageTableMemoryRead(A64EmitContext& ctx, IR::Inst* in
     const Xbyak::Reg64 vaddr = ctx.reg_alloc.UseGpr(args[0]);
     const Xbyak::Reg64 value = ctx.reg_alloc.ScratchGpr();
 
-    const auto wrapped_fn = read_fallbacks[std::make_tuple(bitsize, vaddr.getIdx(), value.getIdx())];
+    const auto wrapped_fn = GetReadFallback(bitsize, vaddr.getIdx(), value.getIdx());
 
-    Xbyak::Label abort, end;
+    Xbyak::Label abort, end, straddle;
+    const bool inline_straddle = ShouldInlinePageStraddle(ctx, bitsize);
 
-    const auto src_ptr = EmitVAddrLookup(code, ctx, bitsize, abort, vaddr);
+    const auto src_ptr = EmitVAddrLookup(code, ctx, bitsize, abort, vaddr, inline_straddle ? &straddle : nullptr);
     EmitReadMemoryMov<bitsize>(code, value, src_ptr);
     code.L(end);
 
     code.SwitchToFarCode();
+    if (inline_straddle) {
+        code.L(straddle);
+        EmitStraddledMemoryRead(code, bitsize, abort, end, vaddr, value, [&](auto host_ptr, auto addr, auto tmp, Xbyak::Label& fail) {
+            EmitHostPointerLookup(code, ctx, fail, host_ptr, addr, tmp);
+        });
+    }
     code.L(abort);
     code.call(wrapped_fn);
     code.jmp(end, code.T_NEAR);
@@ -898,15 +993,22 @@ void A64EmitX64::EmitDirectPageTableMemoryWrite(A64EmitContext& ctx, IR::Inst* i
     const Xbyak::Reg64 vaddr = ctx.reg_alloc.UseGpr(args[0]);
     const Xbyak::Reg64 value = ctx.reg_alloc.UseGpr(args[1]);
 
-    const auto wrapped_fn = write_fallbacks[std::make_tuple(bitsize, vaddr.getIdx(), value.getIdx())];
+    const auto wrapped_fn = GetWriteFallback(bitsize, vaddr.getIdx(), value.getIdx());
 
-    Xbyak::Label abort, end;
+    Xbyak::Label abort, end, straddle;
+    const bool inline_straddle = ShouldInlinePageStraddle(ctx, bitsize);
 
-    const auto dest_ptr = EmitVAddrLookup(code, ctx, bitsize, abort, vaddr);
+    const auto dest_ptr = EmitVAddrLookup(code, ctx, bitsize, abort, vaddr, inline_straddle ? &straddle : nullptr);
     EmitWriteMemoryMov<bitsize>(code, dest_ptr, value);
     code.L(end);
 
     code.SwitchToFarCode();
+    if (inline_straddle) {
+        code.L(straddle);
+        EmitStraddledMemoryWrite(code, bitsize, abort, end, vaddr, value, [&](auto host_ptr, auto addr, auto tmp, Xbyak::Label& fail) {
+            EmitHostPointerLookup(code, ctx, fail, host_ptr, addr, tmp);
+        });
+    }
     code.L(abort);
     code.call(wrapped_fn);
     code.jmp(end, code.T_NEAR);
@@ -959,19 +1061,28 @@ void A64EmitX64::EmitA64ReadMemory64(A64EmitContext& ctx, IR::Inst* inst) {
 
 void A64EmitX64::EmitA64ReadMemory128(A64EmitContext& ctx, IR::Inst* inst) {
     if (conf.page_table) {
-        Xbyak::Label abort, end;
+        Xbyak::Label abort, end, straddle;
+        const bool inline_straddle = ShouldInlinePageStraddle(ctx, 128);
 
         auto args = ctx.reg_alloc.GetArgumentInfo(inst);
         const Xbyak::Reg64 vaddr = ctx.reg_alloc.UseGpr(args[0]);
         const Xbyak::Xmm value = ctx.reg_alloc.ScratchXmm();
 
-        const auto src_ptr = EmitVAddrLookup(code, ctx, 128, abort, vaddr);
+        const auto wrapped_fn = GetReadFallback(128, vaddr.getIdx(), value.getIdx());
+
+        const auto src_ptr = EmitVAddrLookup(code, ctx, 128, abort, vaddr, inline_straddle ? &straddle : nullptr);
         code.movups(value, xword[src_ptr]);
         code.L(end);
 
         code.SwitchToFarCode();
+        if (inline_straddle) {
+            code.L(straddle);
+            EmitStraddledMemoryRead(code, 128, abort, end, vaddr, value, [&](auto host_ptr, auto addr, auto tmp, Xbyak::Label& fail) {
+                EmitHostPointerLookup(code, ctx, fail, host_ptr, addr, tmp);
+            });
+        }
         code.L(abort);
-        code.call(read_fallbacks[std::make_tuple(128, vaddr.getIdx(), value.getIdx())]);
+        code.call(wrapped_fn);
         code.jmp(end, code.T_NEAR);
         code.SwitchToNearCode();
 
@@ -1031,19 +1142,28 @@ void A64EmitX64::EmitA64WriteMemory64(A64EmitContext& ctx, IR::Inst* inst) {
 
 void A64EmitX64::EmitA64WriteMemory128(A64EmitContext& ctx, IR::Inst* inst) {
     if (conf.page_table) {
-        Xbyak::Label abort, end;
+        Xbyak::Label abort, end, straddle;
+        const bool inline_straddle = ShouldInlinePageStraddle(ctx, 128);
 
         auto args = ctx.reg_alloc.GetArgumentInfo(inst);
         const Xbyak::Reg64 vaddr = ctx.reg_alloc.UseGpr(args[0]);
         const Xbyak::Xmm value = ctx.reg_alloc.UseXmm(args[1]);
 
-        const auto dest_ptr = EmitVAddrLookup(code, ctx, 128, abort, vaddr);
+        const auto wrapped_fn = GetWriteFallback(128, vaddr.getIdx(), value.getIdx());
+
+        const auto dest_ptr = EmitVAddrLookup(code, ctx, 128, abort, vaddr, inline_straddle ? &straddle : nullptr);
         code.movups(xword[dest_ptr], value);
         code.L(end);
 
         code.SwitchToFarCode();
+        if (inline_straddle) {
+            code.L(straddle);
+            EmitStraddledMemoryWrite(code, 128, abort, end, vaddr, value, [&](auto host_ptr, auto addr, auto tmp, Xbyak::Label& fail) {
+                EmitHostPointerLookup(code, ctx, fail, host_ptr, addr, tmp);
+            });
+        }
         code.L(abort);
-        code.call(write_fallbacks[std::make_tuple(128, vaddr.getIdx(), value.getIdx())]);
+        code.call(wrapped_fn);
         code.jmp(end, code.T_NEAR);
         code.SwitchToNearCode();
         return;
@@ -1057,6 +1177,198 @@ void A64EmitX64::EmitA64WriteMemory128(A64EmitContext& ctx, IR::Inst* inst) {
     code.CallFunction(memory_write_128);
 }
 
+void A64EmitX64::EmitA64ReadMemoryPair32(A64EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const Xbyak::Reg64 vaddr = ctx.reg_alloc.UseScratchGpr(args[0]);
+    const Xbyak::Reg64 value = ctx.reg_alloc.ScratchGpr();
+    const Xbyak::Reg64 value_lo = ctx.reg_alloc.ScratchGpr();
+
+    const auto read_lo_fn = GetReadFallback(32, vaddr.getIdx(), value_lo.getIdx());
+    const auto read_hi_fn = GetReadFallback(32, vaddr.getIdx(), value.getIdx());
+
+    // Out-of-line fallback performing both accesses through the memory callbacks.
+    Xbyak::Label fallback;
+    code.SwitchToFarCode();
+    code.L(fallback);
+    code.sub(rsp, 8);
+    code.call(read_lo_fn);
+    code.add(vaddr, 4);
+    code.call(read_hi_fn);
+    code.add(rsp, 8);
+    code.shl(value, 32);
+    code.mov(value_lo.cvt32(), value_lo.cvt32());
+    code.or_(value, value_lo);
+    code.ret();
+    code.SwitchToNearCode();
+
+    if (!conf.page_table) {
+        code.call(fallback);
+        ctx.reg_alloc.DefineValue(inst, value);
+        return;
+    }
+
+    Xbyak::Label abort, end;
+
+    EmitDetectPageStraddle(code, 8, abort, vaddr, value);
+    const auto src_ptr = EmitVAddrLookup(code, ctx, 32, abort, vaddr);
+    code.mov(value, qword[src_ptr]);
+    code.L(end);
+
+    code.SwitchToFarCode();
+    code.L(abort);
+    code.call(fallback);
+    code.jmp(end, code.T_NEAR);
+    code.SwitchToNearCode();
+
+    ctx.reg_alloc.DefineValue(inst, value);
+}
+
+void A64EmitX64::EmitA64ReadMemoryPair64(A64EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const Xbyak::Reg64 vaddr = ctx.reg_alloc.UseScratchGpr(args[0]);
+    const Xbyak::Xmm value = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Reg64 value_lo = ctx.reg_alloc.ScratchGpr();
+    const Xbyak::Reg64 value_hi = ctx.reg_alloc.ScratchGpr();
+    const Xbyak::Xmm tmp = code.HasSSE41() ? value : ctx.reg_alloc.ScratchXmm();
+
+    const auto read_lo_fn = GetReadFallback(64, vaddr.getIdx(), value_lo.getIdx());
+    const auto read_hi_fn = GetReadFallback(64, vaddr.getIdx(), value_hi.getIdx());
+
+    // Out-of-line fallback performing both accesses through the memory callbacks.
+    Xbyak::Label fallback;
+    code.SwitchToFarCode();
+    code.L(fallback);
+    code.sub(rsp, 8);
+    code.call(read_lo_fn);
+    code.add(vaddr, 8);
+    code.call(read_hi_fn);
+    code.add(rsp, 8);
+    code.movq(value, value_lo);
+    if (code.HasSSE41()) {
+        code.pinsrq(value, value_hi, 1);
+    } else {
+        code.movq(tmp, value_hi);
+        code.punpcklqdq(value, tmp);
+    }
+    code.ret();
+    code.SwitchToNearCode();
+
+    if (!conf.page_table) {
+        code.call(fallback);
+        ctx.reg_alloc.DefineValue(inst, value);
+        return;
+    }
+
+    Xbyak::Label abort, end;
+
+    EmitDetectPageStraddle(code, 16, abort, vaddr, value_lo);
+    const auto src_ptr = EmitVAddrLookup(code, ctx, 64, abort, vaddr);
+    code.movups(value, xword[src_ptr]);
+    code.L(end);
+
+    code.SwitchToFarCode();
+    code.L(abort);
+    code.call(fallback);
+    code.jmp(end, code.T_NEAR);
+    code.SwitchToNearCode();
+
+    ctx.reg_alloc.DefineValue(inst, value);
+}
+
+void A64EmitX64::EmitA64WriteMemoryPair32(A64EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const Xbyak::Reg64 vaddr = ctx.reg_alloc.UseScratchGpr(args[0]);
+    const Xbyak::Reg64 value = ctx.reg_alloc.UseScratchGpr(args[1]);
+
+    const auto write_fn = GetWriteFallback(32, vaddr.getIdx(), value.getIdx());
+
+    // Out-of-line fallback performing both accesses through the memory callbacks.
+    Xbyak::Label fallback;
+    code.SwitchToFarCode();
+    code.L(fallback);
+    code.sub(rsp, 8);
+    code.call(write_fn);
+    code.add(vaddr, 4);
+    code.shr(value, 32);
+    code.call(write_fn);
+    code.add(rsp, 8);
+    code.ret();
+    code.SwitchToNearCode();
+
+    if (!conf.page_table) {
+        code.call(fallback);
+        return;
+    }
+
+    Xbyak::Label abort, end;
+
+    const Xbyak::Reg64 tmp = ctx.reg_alloc.ScratchGpr();
+    EmitDetectPageStraddle(code, 8, abort, vaddr, tmp);
+    const auto dest_ptr = EmitVAddrLookup(code, ctx, 32, abort, vaddr);
+    code.mov(qword[dest_ptr], value);
+    code.L(end);
+
+    code.SwitchToFarCode();
+    code.L(abort);
+    code.call(fallback);
+    code.jmp(end, code.T_NEAR);
+    code.SwitchToNearCode();
+}
+
+void A64EmitX64::EmitA64WriteMemoryPair64(A64EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const Xbyak::Reg64 vaddr = ctx.reg_alloc.UseScratchGpr(args[0]);
+    const Xbyak::Xmm value = ctx.reg_alloc.UseXmm(args[1]);
+    const Xbyak::Reg64 value_lo = ctx.reg_alloc.ScratchGpr();
+    const Xbyak::Reg64 value_hi = ctx.reg_alloc.ScratchGpr();
+    const Xbyak::Xmm tmp = code.HasSSE41() ? value : ctx.reg_alloc.ScratchXmm();
+
+    const auto write_lo_fn = GetWriteFallback(64, vaddr.getIdx(), value_lo.getIdx());
+    const auto write_hi_fn = GetWriteFallback(64, vaddr.getIdx(), value_hi.getIdx());
+
+    // Out-of-line fallback performing both accesses through the memory callbacks.
+    Xbyak::Label fallback;
+    code.SwitchToFarCode();
+    code.L(fallback);
+    code.movq(value_lo, value);
+    if (code.HasSSE41()) {
+        code.pextrq(value_hi, value, 1);
+    } else {
+        code.movaps(tmp, value);
+        code.punpckhqdq(tmp, tmp);
+        code.movq(value_hi, tmp);
+    }
+    code.sub(rsp, 8);
+    code.call(write_lo_fn);
+    code.add(vaddr, 8);
+    code.call(write_hi_fn);
+    code.add(rsp, 8);
+    code.ret();
+    code.SwitchToNearCode();
+
+    if (!conf.page_table) {
+        code.call(fallback);
+        return;
+    }
+
+    Xbyak::Label abort, end;
+
+    EmitDetectPageStraddle(code, 16, abort, vaddr, value_lo);
+    const auto dest_ptr = EmitVAddrLookup(code, ctx, 64, abort, vaddr);
+    code.movups(xword[dest_ptr], value);
+    code.L(end);
+
+    code.SwitchToFarCode();
+    code.L(abort);
+    code.call(fallback);
+    code.jmp(end, code.T_NEAR);
+    code.SwitchToNearCode();
+}
+
 template<std::size_t bitsize, auto callback>
 void A64EmitX64::EmitExclusiveReadMemory(A64EmitContext& ctx, IR::Inst* inst) {
     ASSERT(conf.global_monitor != nullptr);
@@ -1189,6 +1501,371 @@ void A64EmitX64::EmitA64ExclusiveWriteMemory128(A64EmitContext& ctx, IR::Inst* i
     EmitExclusiveWriteMemory<128, &A64::UserCallbacks::MemoryWriteExclusive128>(ctx, inst);
 }
 
+namespace {
+
+template<typename T>
+T ApplyMemAtomicOp(IR::MemAtomicOp op, T old_value, T value) {
+    using S = std::make_signed_t<T>;
+
+    switch (op) {
+    case IR::MemAtomicOp::ADD:
+        return static_cast<T>(old_value + value);
+    case IR::MemAtomicOp::BIC:
+        return static_cast<T>(old_value & ~value);
+    case IR::MemAtomicOp::EOR:
+        return static_cast<T>(old_value ^ value);
+    case IR::MemAtomicOp::ORR:
+        return static_cast<T>(old_value | value);
+    case IR::MemAtomicOp::SMAX:
+        return static_cast<T>(std::max(static_cast<S>(old_value), static_cast<S>(value)));
+    case IR::MemAtomicOp::SMIN:
+        return static_cast<T>(std::min(static_cast<S>(old_value), static_cast<S>(value)));
+    case IR::MemAtomicOp::UMAX:
+        return std::max(old_value, value);
+    case IR::MemAtomicOp::UMIN:
+        return std::min(old_value, value);
+    case IR::MemAtomicOp::SWP:
+        return value;
+    }
+    UNREACHABLE();
+}
+
+/// Performs operation through the memory callbacks. Operations performed this way are serialised
+/// against each other (and against exclusive stores) by the global monitor, if there is one.
+template<typename T, typename Function>
+T DoCallbackAtomicOperation(A64::UserConfig& conf, u64 vaddr, Function operation) {
+    if (conf.global_monitor) {
+        return conf.global_monitor->DoAtomicOperation<T>(vaddr, operation);
+    }
+    return operation();
+}
+
+} // anonymous namespace
+
+// Atomic operations on page-table-backed memory are performed directly with locked host instructions.
+// These do not clear the reservations held by the global monitor; this is safe because exclusive
+// stores are performed as a compare-and-swap against the value observed by the exclusive load,
+// and so fail if an atomic operation has changed the value in the meantime.
+template<std::size_t bitsize, auto read_callback, auto write_callback>
+void A64EmitX64::EmitAtomicMemoryOperation(A64EmitContext& ctx, IR::Inst* inst) {
+    using T = mp::unsigned_integer_of_size<bitsize>;
+
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const auto op = static_cast<IR::MemAtomicOp>(args[2].GetImmediateU8());
+
+    const auto fallback = [](A64::UserConfig& conf, u64 vaddr, T value, u32 op) -> T {
+        return DoCallbackAtomicOperation<T>(conf, vaddr, [&]() -> T {
+            const T old_value = (conf.callbacks->*read_callback)(vaddr);
+            (conf.callbacks->*write_callback)(vaddr, ApplyMemAtomicOp(static_cast<IR::MemAtomicOp>(op), old_value, value));
+            return old_value;
+        });
+    };
+
+    if (!conf.page_table) {
+        ctx.reg_alloc.HostCall(inst, {}, args[0], args[1]);
+        code.mov(code.ABI_PARAM4.cvt32(), static_cast<u32>(op));
+        code.mov(code.ABI_PARAM1, reinterpret_cast<u64>(&conf));
+        code.CallLambda(fallback);
+        return;
+    }
+
+    // lock cmpxchg uses the accumulator as the expected value and updates it on failure.
+    const Xbyak::Reg64 result = ctx.reg_alloc.ScratchGpr(HostLoc::RAX);
+    const Xbyak::Reg64 vaddr = ctx.reg_alloc.UseGpr(args[0]);
+    const Xbyak::Reg64 value = ctx.reg_alloc.UseGpr(args[1]);
+
+    // The compare-and-swap loop needs two more registers. These must be allocated before the
+    // lookup branches to the fallback so that both paths agree on the register allocator state.
+    const bool needs_loop = op != IR::MemAtomicOp::ADD && op != IR::MemAtomicOp::SWP;
+    const Xbyak::Reg64 operand = needs_loop ? ctx.reg_alloc.ScratchGpr() : Xbyak::Reg64{};
+    const Xbyak::Reg64 tmp = needs_loop ? ctx.reg_alloc.ScratchGpr() : Xbyak::Reg64{};
+
+    Xbyak::Label abort, end;
+
+    const auto dest_ptr = EmitVAddrLookup(code, ctx, bitsize, abort, vaddr);
+    const auto mem = ptr[dest_ptr];
+    const int op_bitsize = bitsize == 64 ? 64 : 32;
+
+    switch (op) {
+    case IR::MemAtomicOp::ADD:
+        code.mov(result, value);
+        code.lock();
+        code.xadd(mem, result.changeBit(bitsize));
+        break;
+    case IR::MemAtomicOp::SWP:
+        code.mov(result, value);
+        code.xchg(mem, result.changeBit(bitsize));
+        break;
+    default: {
+        const bool is_signed = op == IR::MemAtomicOp::SMAX || op == IR::MemAtomicOp::SMIN;
+
+        // Extend both operands so that min and max can be computed with full-width comparisons.
+        const auto extend = [&](const Xbyak::Reg64& dest, const Xbyak::Reg64& source) {
+            if (bitsize >= 32) {
+                code.mov(dest.changeBit(op_bitsize), source.changeBit(op_bitsize));
+            } else if (is_signed) {
+                code.movsx(dest.cvt32(), source.changeBit(bitsize));
+            } else {
+                code.movzx(dest.cvt32(), source.changeBit(bitsize));
+            }
+        };
+
+        extend(operand, value);
+        if (op == IR::MemAtomicOp::BIC) {
+            code.not_(operand);
+        }
+
+        EmitReadMemoryMov<bitsize>(code, result, dest_ptr);
+
+        Xbyak::Label loop;
+        code.L(loop);
+        extend(tmp, result);
+        switch (op) {
+        case IR::MemAtomicOp::BIC:
+            code.and_(tmp, operand);
+            break;
+        case IR::MemAtomicOp::EOR:
+            code.xor_(tmp, operand);
+            break;
+        case IR::MemAtomicOp::ORR:
+            code.or_(tmp, operand);
+            break;
+        case IR::MemAtomicOp::SMAX:
+            code.cmp(tmp.changeBit(op_bitsize), operand.changeBit(op_bitsize));
+            code.cmovl(tmp, operand);
+            break;
+        case IR::MemAtomicOp::SMIN:
+            code.cmp(tmp.changeBit(op_bitsize), operand.changeBit(op_bitsize));
+            code.cmovg(tmp, operand);
+            break;
+        case IR::MemAtomicOp::UMAX:
+            code.cmp(tmp.changeBit(op_bitsize), operand.changeBit(op_bitsize));
+            code.cmovb(tmp, operand);
+            break;
+        case IR::MemAtomicOp::UMIN:
+            code.cmp(tmp.changeBit(op_bitsize), operand.changeBit(op_bitsize));
+            code.cmova(tmp, operand);
+            break;
+        default:
+            UNREACHABLE();
+        }
+        code.lock();
+        code.cmpxchg(mem, tmp.changeBit(bitsize));
+        code.jnz(loop);
+        break;
+    }
+    }
+    code.L(end);
+
+    code.SwitchToFarCode();
+    code.L(abort);
+    code.sub(rsp, 8);
+    ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, HostLoc::RAX);
+    code.push(vaddr);
+    code.push(value);
+    code.pop(code.ABI_PARAM3);
+    code.pop(code.ABI_PARAM2);
+    code.mov(code.ABI_PARAM4.cvt32(), static_cast<u32>(op));
+    code.mov(code.ABI_PARAM1, reinterpret_cast<u64>(&conf));
+    code.CallLambda(fallback);
+    ABI_PopCallerSaveRegistersAndAdjustStackExcept(code, HostLoc::RAX);
+    code.add(rsp, 8);
+    code.jmp(end, code.T_NEAR);
+    code.SwitchToNearCode();
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void A64EmitX64::EmitA64AtomicMemoryOperation8(A64EmitContext& ctx, IR::Inst* inst) {
+    EmitAtomicMemoryOperation<8, &A64::UserCallbacks::MemoryRead8, &A64::UserCallbacks::MemoryWrite8>(ctx, inst);
+}
+
+void A64EmitX64::EmitA64AtomicMemoryOperation16(A64EmitContext& ctx, IR::Inst* inst) {
+    EmitAtomicMemoryOperation<16, &A64::UserCallbacks::MemoryRead16, &A64::UserCallbacks::MemoryWrite16>(ctx, inst);
+}
+
+void A64EmitX64::EmitA64AtomicMemoryOperation32(A64EmitContext& ctx, IR::Inst* inst) {
+    EmitAtomicMemoryOperation<32, &A64::UserCallbacks::MemoryRead32, &A64::UserCallbacks::MemoryWrite32>(ctx, inst);
+}
+
+void A64EmitX64::EmitA64AtomicMemoryOperation64(A64EmitContext& ctx, IR::Inst* inst) {
+    EmitAtomicMemoryOperation<64, &A64::UserCallbacks::MemoryRead64, &A64::UserCallbacks::MemoryWrite64>(ctx, inst);
+}
+
+template<std::size_t bitsize, auto read_callback, auto write_callback>
+void A64EmitX64::EmitCompareAndSwapMemory(A64EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    if constexpr (bitsize != 128) {
+        using T = mp::unsigned_integer_of_size<bitsize>;
+
+        const auto fallback = [](A64::UserConfig& conf, u64 vaddr, T expected, T desired) -> T {
+            return DoCallbackAtomicOperation<T>(conf, vaddr, [&]() -> T {
+                const T old_value = (conf.callbacks->*read_callback)(vaddr);
+                if (old_value == expected) {
+                    (conf.callbacks->*write_callback)(vaddr, desired);
+                }
+                return old_value;
+            });
+        };
+
+        if (!conf.page_table) {
+            ctx.reg_alloc.HostCall(inst, {}, args[0], args[1], args[2]);
+            code.mov(code.ABI_PARAM1, reinterpret_cast<u64>(&conf));
+            code.CallLambda(fallback);
+            return;
+        }
+
+        const Xbyak::Reg64 result = ctx.reg_alloc.ScratchGpr(HostLoc::RAX);
+        const Xbyak::Reg64 vaddr = ctx.reg_alloc.UseGpr(args[0]);
+        const Xbyak::Reg64 expected = ctx.reg_alloc.UseGpr(args[1]);
+        const Xbyak::Reg64 desired = ctx.reg_alloc.UseGpr(args[2]);
+
+        Xbyak::Label abort, end;
+
+        const auto dest_ptr = EmitVAddrLookup(code, ctx, bitsize, abort, vaddr);
+        code.mov(result, expected);
+        code.lock();
+        code.cmpxchg(ptr[dest_ptr], desired.changeBit(bitsize));
+        code.L(end);
+
+        code.SwitchToFarCode();
+        code.L(abort);
+        code.sub(rsp, 8);
+        ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, HostLoc::RAX);
+        code.push(vaddr);
+        code.push(expected);
+        code.push(desired);
+        code.pop(code.ABI_PARAM4);
+        code.pop(code.ABI_PARAM3);
+        code.pop(code.ABI_PARAM2);
+        code.mov(code.ABI_PARAM1, reinterpret_cast<u64>(&conf));
+        code.CallLambda(fallback);
+        ABI_PopCallerSaveRegistersAndAdjustStackExcept(code, HostLoc::RAX);
+        code.add(rsp, 8);
+        code.jmp(end, code.T_NEAR);
+        code.SwitchToNearCode();
+
+        ctx.reg_alloc.DefineValue(inst, result);
+    } else {
+        const auto fallback = [](A64::UserConfig& conf, u64 vaddr, A64::Vector& expected, A64::Vector& desired) {
+            expected = DoCallbackAtomicOperation<A64::Vector>(conf, vaddr, [&]() -> A64::Vector {
+                const A64::Vector old_value = (conf.callbacks->*read_callback)(vaddr);
+                if (old_value == expected) {
+                    (conf.callbacks->*write_callback)(vaddr, desired);
+                }
+                return old_value;
+            });
+        };
+
+        if (!conf.page_table) {
+            const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+            ctx.reg_alloc.Use(args[0], ABI_PARAM2);
+            ctx.reg_alloc.Use(args[1], HostLoc::XMM1);
+            ctx.reg_alloc.Use(args[2], HostLoc::XMM2);
+            ctx.reg_alloc.EndOfAllocScope();
+            ctx.reg_alloc.HostCall(nullptr);
+
+            code.mov(code.ABI_PARAM1, reinterpret_cast<u64>(&conf));
+            code.sub(rsp, 32 + ABI_SHADOW_SPACE);
+            code.lea(code.ABI_PARAM3, ptr[rsp + ABI_SHADOW_SPACE]);
+            code.lea(code.ABI_PARAM4, ptr[rsp + ABI_SHADOW_SPACE + 16]);
+            code.movaps(xword[code.ABI_PARAM3], xmm1);
+            code.movaps(xword[code.ABI_PARAM4], xmm2);
+            code.CallLambda(fallback);
+            code.movaps(result, xword[rsp + ABI_SHADOW_SPACE]);
+            code.add(rsp, 32 + ABI_SHADOW_SPACE);
+
+            ctx.reg_alloc.DefineValue(inst, result);
+            return;
+        }
+
+        // lock cmpxchg16b compares against rdx:rax and stores rcx:rbx.
+        ctx.reg_alloc.ScratchGpr(HostLoc::RAX);
+        ctx.reg_alloc.ScratchGpr(HostLoc::RBX);
+        ctx.reg_alloc.ScratchGpr(HostLoc::RCX);
+        ctx.reg_alloc.ScratchGpr(HostLoc::RDX);
+        const Xbyak::Reg64 vaddr = ctx.reg_alloc.UseGpr(args[0]);
+        const Xbyak::Xmm expected = ctx.reg_alloc.UseXmm(args[1]);
+        const Xbyak::Xmm desired = ctx.reg_alloc.UseXmm(args[2]);
+        const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+        const Xbyak::Reg64 host_ptr = ctx.reg_alloc.ScratchGpr();
+        // Allocated before the lookup branches to far code, so both paths reach end with the same allocation.
+        const Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+
+        Xbyak::Label abort, end;
+
+        const auto dest_ptr = EmitVAddrLookup(code, ctx, bitsize, abort, vaddr);
+        // cmpxchg16b faults on unaligned operands, so these are left to the callbacks.
+        code.lea(host_ptr, ptr[dest_ptr]);
+        code.test(host_ptr.cvt8(), 0xF);
+        code.jnz(abort, code.T_NEAR);
+
+        const auto split = [&](const Xbyak::Reg64& lo, const Xbyak::Reg64& hi, const Xbyak::Xmm& source) {
+            code.movq(lo, source);
+            if (code.HasSSE41()) {
+                code.pextrq(hi, source, 1);
+            } else {
+                code.movhlps(result, source);
+                code.movq(hi, result);
+            }
+        };
+        split(rax, rdx, expected);
+        split(rbx, rcx, desired);
+        code.lock();
+        code.cmpxchg16b(ptr[host_ptr]);
+        code.movq(result, rax);
+        if (code.HasSSE41()) {
+            code.pinsrq(result, rdx, 1);
+        } else {
+            code.movq(tmp, rdx);
+            code.punpcklqdq(result, tmp);
+        }
+        code.L(end);
+
+        code.SwitchToFarCode();
+        code.L(abort);
+        code.sub(rsp, 8);
+        ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, HostLocXmmIdx(result.getIdx()));
+        code.sub(rsp, 32 + ABI_SHADOW_SPACE);
+        code.movaps(xword[rsp + ABI_SHADOW_SPACE], expected);
+        code.movaps(xword[rsp + ABI_SHADOW_SPACE + 16], desired);
+        code.mov(code.ABI_PARAM2, vaddr);
+        code.lea(code.ABI_PARAM3, ptr[rsp + ABI_SHADOW_SPACE]);
+        code.lea(code.ABI_PARAM4, ptr[rsp + ABI_SHADOW_SPACE + 16]);
+        code.mov(code.ABI_PARAM1, reinterpret_cast<u64>(&conf));
+        code.CallLambda(fallback);
+        code.movaps(result, xword[rsp + ABI_SHADOW_SPACE]);
+        code.add(rsp, 32 + ABI_SHADOW_SPACE);
+        ABI_PopCallerSaveRegistersAndAdjustStackExcept(code, HostLocXmmIdx(result.getIdx()));
+        code.add(rsp, 8);
+        code.jmp(end, code.T_NEAR);
+        code.SwitchToNearCode();
+
+        ctx.reg_alloc.DefineValue(inst, result);
+    }
+}
+
+void A64EmitX64::EmitA64CompareAndSwapMemory8(A64EmitContext& ctx, IR::Inst* inst) {
+    EmitCompareAndSwapMemory<8, &A64::UserCallbacks::MemoryRead8, &A64::UserCallbacks::MemoryWrite8>(ctx, inst);
+}
+
+void A64EmitX64::EmitA64CompareAndSwapMemory16(A64EmitContext& ctx, IR::Inst* inst) {
+    EmitCompareAndSwapMemory<16, &A64::UserCallbacks::MemoryRead16, &A64::UserCallbacks::MemoryWrite16>(ctx, inst);
+}
+
+void A64EmitX64::EmitA64CompareAndSwapMemory32(A64EmitContext& ctx, IR::Inst* inst) {
+    EmitCompareAndSwapMemory<32, &A64::UserCallbacks::MemoryRead32, &A64::UserCallbacks::MemoryWrite32>(ctx, inst);
+}
+
+void A64EmitX64::EmitA64CompareAndSwapMemory64(A64EmitContext& ctx, IR::Inst* inst) {
+    EmitCompareAndSwapMemory<64, &A64::UserCallbacks::MemoryRead64, &A64::UserCallbacks::MemoryWrite64>(ctx, inst);
+}
+
+void A64EmitX64::EmitA64CompareAndSwapMemory128(A64EmitContext& ctx, IR::Inst* inst) {
+    EmitCompareAndSwapMemory<128, &A64::UserCallbacks::MemoryRead128, &A64::UserCallbacks::MemoryWrite128>(ctx, inst);
+}
+
 std::string A64EmitX64::LocationDescriptorToFriendlyName(const IR::LocationDescriptor& ir_descriptor) const {
     const A64::LocationDescriptor descriptor{ir_descriptor};
     return fmt::format("a64_{:016X}_fpcr{:08X}",
@@ -1197,10 +1874,17 @@ std::string A64EmitX64::LocationDescriptorToFriendlyName(const IR::LocationDescr
 }
 
 void A64EmitX64::EmitTerminalImpl(IR::Term::Interpret terminal, IR::LocationDescriptor, bool) {
+    const u64 pc = A64::LocationDescriptor{terminal.next}.PC();
+    for (size_t i = 0; i < terminal.num_instructions; i++) {
+        const u32 instruction = conf.callbacks->MemoryReadCode(pc + i * 4);
+        code.mov(rax, reinterpret_cast<u64>(&interpreted_instruction_counts[instruction]));
+        code.inc(qword[rax]);
+    }
+
     code.SwitchMxcsrOnExit();
     Devirtualize<&A64::UserCallbacks::InterpreterFallback>(conf.callbacks).EmitCall(code,
         [&](RegList param) {
-            code.mov(param[0], A64::LocationDescriptor{terminal.next}.PC());
+            code.mov(param[0], pc);
             code.mov(qword[r15 + offsetof(A64JitState, pc)], param[0]);
             code.mov(param[1].cvt32(), terminal.num_instructions);
         });
@@ -55,10 +55,23 @@ public:
         conf.processor_id = value;
     }
 
+    /// Execution counts of instructions without an IR translation, by encoding.
+    /// References into this map remain valid for the lifetime of this object.
+    std::map<u32, u64>& GetInterpretedInstructionCounts() {
+        return interpreted_instruction_counts;
+    }
+
+    const std::map<u32, u64>& GetInterpretedInstructionCounts() const {
+        return interpreted_instruction_counts;
+    }
+
 protected:
     A64::UserConfig conf;
     A64::Jit* jit_interface;
     BlockRangeInformation<u64> block_ranges;
+    /// Host GPRs available to the register allocator, excluding those pinned by this configuration.
+    std::vector<HostLoc> gpr_order;
+    std::map<u32, u64> interpreted_instruction_counts;
 
     struct FastDispatchEntry {
         u64 location_descriptor = 0xFFFF'FFFF'FFFF'FFFFull;
@@ -74,9 +87,12 @@ protected:
     void (*memory_write_128)();
     void GenMemory128Accessors();
 
-    std::map<std::tuple<size_t, int, int>, void(*)()> read_fallbacks;
-    std::map<std::tuple<size_t, int, int>, void(*)()> write_fallbacks;
-    void GenFastmemFallbacks();
+    // Fallback thunks are generated into far code on first use and are discarded on cache clear.
+    using FastmemFallback = void(*)();
+    std::map<std::tuple<size_t, int, int>, FastmemFallback> read_fallbacks;
+    std::map<std::tuple<size_t, int, int>, FastmemFallback> write_fallbacks;
+    FastmemFallback GetReadFallback(size_t bitsize, int vaddr_idx, int value_idx);
+    FastmemFallback GetWriteFallback(size_t bitsize, int vaddr_idx, int value_idx);
 
     const void* terminal_handler_pop_rsb_hint;
     const void* terminal_handler_fast_dispatch_hint = nullptr;
@@ -91,6 +107,10 @@ protected:
     void EmitExclusiveReadMemory(A64EmitContext& ctx, IR::Inst* inst);
     template<std::size_t bitsize, auto callback>
     void EmitExclusiveWriteMemory(A64EmitContext& ctx, IR::Inst* inst);
+    template<std::size_t bitsize, auto read_callback, auto write_callback>
+    void EmitAtomicMemoryOperation(A64EmitContext& ctx, IR::Inst* inst);
+    template<std::size_t bitsize, auto read_callback, auto write_callback>
+    void EmitCompareAndSwapMemory(A64EmitContext& ctx, IR::Inst* inst);
 
     // Microinstruction emitters
     void EmitPushRSB(EmitContext& ctx, IR::Inst* inst);
@@ -4,12 +4,16 @@
  */
 
 #include <cstring>
+#include <map>
 #include <memory>
+#include <optional>
+#include <unordered_map>
 
 #include <boost/icl/interval_set.hpp>
 #include <dynarmic/A64/a64.h>
 
 #include "backend/x64/a64_emit_x64.h"
+#include "backend/x64/a64_interpreter.h"
 #include "backend/x64/a64_jitstate.h"
 #include "backend/x64/block_of_code.h"
 #include "backend/x64/devirtualize.h"
@@ -47,6 +51,7 @@ public:
         : conf(conf)
         , block_of_code(GenRunCodeCallbacks(conf.callbacks, &GetCurrentBlockThunk, this), JitStateInfo{jit_state}, GenRCP(conf))
         , emitter(block_of_code, conf, jit)
+        , interpreter(jit_state, this->conf, jit, emitter.GetInterpretedInstructionCounts())
     {
         ASSERT(conf.page_table_address_space_bits >= 12 && conf.page_table_address_space_bits <= 64);
     }
@@ -61,17 +66,25 @@ public:
 
         // TODO: Check code alignment
 
-        const CodePtr current_code_ptr = [this]{
-            // RSB optimization
-            const u32 new_rsb_ptr = (jit_state.rsb_ptr - 1) & A64JitState::RSBPtrMask;
-            if (jit_state.GetUniqueHash() == jit_state.rsb_location_descriptors[new_rsb_ptr]) {
-                jit_state.rsb_ptr = new_rsb_ptr;
-                return reinterpret_cast<CodePtr>(jit_state.rsb_codeptrs[new_rsb_ptr]);
+        do {
+            return_to_interpreter = false;
+
+            if (InterpretColdBlocks()) {
+                break;
             }
 
-            return GetCurrentBlock();
-        }();
-        block_of_code.RunCode(&jit_state, current_code_ptr);
+            const CodePtr current_code_ptr = [this]{
+                // RSB optimization
+                const u32 new_rsb_ptr = (jit_state.rsb_ptr - 1) & A64JitState::RSBPtrMask;
+                if (jit_state.GetUniqueHash() == jit_state.rsb_location_descriptors[new_rsb_ptr]) {
+                    jit_state.rsb_ptr = new_rsb_ptr;
+                    return reinterpret_cast<CodePtr>(jit_state.rsb_codeptrs[new_rsb_ptr]);
+                }
+
+                return GetCurrentBlock();
+            }();
+            block_of_code.RunCode(&jit_state, current_code_ptr);
+        } while (return_to_interpreter && !jit_state.halt_requested);
 
         PerformRequestedCacheInvalidation();
     }
@@ -82,7 +95,20 @@ public:
         SCOPE_EXIT { this->is_executing = false; };
         jit_state.halt_requested = true;
 
-        block_of_code.StepCode(&jit_state, GetCurrentSingleStep());
+        const IR::LocationDescriptor descriptor = A64::LocationDescriptor{GetCurrentLocation()}.SetSingleStepping(true);
+        if (!emitter.GetBasicBlock(descriptor)) {
+            // Single-step blocks are interpreted without being cached.
+            IR::Block ir_block = TranslateBlock(descriptor);
+            if (interpreter.CanInterpret(ir_block)) {
+                jit_state.cycles_to_run = jit_state.cycles_remaining = 1;
+                interpreter.Execute(ir_block);
+                conf.callbacks->AddTicks(jit_state.cycles_to_run - jit_state.cycles_remaining);
+            } else {
+                block_of_code.StepCode(&jit_state, EmitBlock(ir_block));
+            }
+        } else {
+            block_of_code.StepCode(&jit_state, GetCurrentSingleStep());
+        }
 
         PerformRequestedCacheInvalidation();
     }
@@ -215,9 +241,23 @@ public:
         return Common::DisassembleX64(block_of_code.GetCodeBegin(), block_of_code.getCurr());
     }
 
+    std::map<u32, u64> GetInterpretedInstructionCounts() const {
+        return emitter.GetInterpretedInstructionCounts();
+    }
+
 private:
+    // Blocks which have not yet been executed often enough to be compiled.
+    struct ColdBlock {
+        IR::Block ir_block;
+        size_t execution_count = 0;
+    };
+
     static CodePtr GetCurrentBlockThunk(void* thisptr) {
         Jit::Impl* this_ = static_cast<Jit::Impl*>(thisptr);
+        if (this_->GetColdBlock(this_->GetCurrentLocation())) {
+            this_->return_to_interpreter = true;
+            return this_->block_of_code.GetForceReturnFromRunCodeAddress();
+        }
         return this_->GetCurrentBlock();
     }
 
@@ -237,17 +277,33 @@ private:
         if (auto block = emitter.GetBasicBlock(current_location))
             return block->entrypoint;
 
-        constexpr size_t MINIMUM_REMAINING_CODESIZE = 1 * 1024 * 1024;
-        if (block_of_code.SpaceRemaining() < MINIMUM_REMAINING_CODESIZE) {
-            // Immediately evacuate cache
-            invalidate_entire_cache = true;
-            PerformRequestedCacheInvalidation();
-        }
-
         // JIT Compile
-        const auto get_code = [this](u64 vaddr) { return conf.callbacks->MemoryReadCode(vaddr); };
-        IR::Block ir_block = A64::Translate(A64::LocationDescriptor{current_location}, get_code,
-                                                {conf.define_unpredictable_behaviour, conf.wall_clock_cntpct});
+        IR::Block ir_block = TranslateBlock(current_location);
+        return EmitBlock(ir_block);
+    }
+
+    IR::Block TranslateBlock(IR::LocationDescriptor current_location) {
+        // Instructions are read directly from the host code page when the user provides one.
+        constexpr u64 code_page_mask = 0xFFF;
+        std::optional<u64> code_page_vaddr;
+        const u8* code_page = nullptr;
+        const auto get_code = [&](u64 vaddr) {
+            const u64 page_vaddr = vaddr & ~code_page_mask;
+            if (code_page_vaddr != page_vaddr) {
+                code_page_vaddr = page_vaddr;
+                code_page = static_cast<const u8*>(conf.callbacks->GetCodePagePointer(page_vaddr));
+            }
+            // An unaligned PC near the end of the page would read past it.
+            if (!code_page || (vaddr & code_page_mask) > code_page_mask + 1 - sizeof(u32)) {
+                return conf.callbacks->MemoryReadCode(vaddr);
+            }
+            u32 instruction;
+            std::memcpy(&instruction, code_page + (vaddr & code_page_mask), sizeof(instruction));
+            return instruction;
+        };
+        A64::TranslationOptions options{conf.define_unpredictable_behaviour, conf.wall_clock_cntpct};
+        options.pointer_authentication_strip_mask = conf.pointer_authentication_strip_mask;
+        IR::Block ir_block = A64::Translate(A64::LocationDescriptor{current_location}, get_code, options);
         Optimization::A64CallbackConfigPass(ir_block, conf);
         if (conf.HasOptimization(OptimizationFlag::GetSetElimination)) {
             Optimization::A64GetSetElimination(ir_block);
@@ -255,15 +311,94 @@ private:
         }
         if (conf.HasOptimization(OptimizationFlag::ConstProp)) {
             Optimization::ConstantPropagation(ir_block);
+            if (conf.memory_not_concurrently_modified) {
+                Optimization::MemoryForwardingPass(ir_block);
+            }
             Optimization::DeadCodeElimination(ir_block);
         }
         if (conf.HasOptimization(OptimizationFlag::MiscIROpt)) {
             Optimization::A64MergeInterpretBlocksPass(ir_block, conf.callbacks);
+            Optimization::MemoryPairingPass(ir_block);
+            Optimization::DeadCodeElimination(ir_block);
         }
         Optimization::VerificationPass(ir_block);
+        return ir_block;
+    }
+
+    CodePtr EmitBlock(IR::Block& ir_block) {
+        constexpr size_t MINIMUM_REMAINING_CODESIZE = 1 * 1024 * 1024;
+        if (block_of_code.SpaceRemaining() < MINIMUM_REMAINING_CODESIZE) {
+            // Immediately evacuate cache
+            invalidate_entire_cache = true;
+            PerformRequestedCacheInvalidation();
+        }
+
+        cold_blocks.erase(ir_block.Location().Value());
         return emitter.Emit(ir_block).entrypoint;
     }
 
+    /// Returns the interpretable cold block at location, or nullptr if the block at location
+    /// is to be run as compiled code. Blocks are compiled here once they become hot.
+    ColdBlock* GetColdBlock(IR::LocationDescriptor location) {
+        if (conf.interpreter_tier_threshold == 0 || emitter.GetBasicBlock(location)) {
+            return nullptr;
+        }
+
+        auto iter = cold_blocks.find(location.Value());
+        if (iter == cold_blocks.end()) {
+            IR::Block ir_block = TranslateBlock(location);
+            if (!interpreter.CanInterpret(ir_block)) {
+                EmitBlock(ir_block);
+                return nullptr;
+            }
+            iter = cold_blocks.emplace(location.Value(), ColdBlock{std::move(ir_block)}).first;
+        }
+
+        if (iter->second.execution_count >= conf.interpreter_tier_threshold) {
+            IR::Block ir_block = std::move(iter->second.ir_block);
+            cold_blocks.erase(iter);
+            EmitBlock(ir_block);
+            return nullptr;
+        }
+
+        return &iter->second;
+    }
+
+    /// Interprets blocks for as long as execution remains in cold code.
+    /// Returns true if execution should not continue into compiled code.
+    bool InterpretColdBlocks() {
+        ColdBlock* cold_block = GetColdBlock(GetCurrentLocation());
+        if (!cold_block) {
+            return false;
+        }
+
+        jit_state.cycles_to_run = jit_state.cycles_remaining = static_cast<s64>(conf.callbacks->GetTicksRemaining());
+        do {
+            cold_block->execution_count++;
+            interpreter.Execute(cold_block->ir_block);
+            if (jit_state.halt_requested || jit_state.cycles_remaining <= 0) {
+                break;
+            }
+            cold_block = GetColdBlock(GetCurrentLocation());
+        } while (cold_block);
+        conf.callbacks->AddTicks(jit_state.cycles_to_run - jit_state.cycles_remaining);
+
+        return jit_state.halt_requested || jit_state.cycles_remaining <= 0;
+    }
+
+    void InvalidateColdBlocks(const boost::icl::interval_set<u64>& ranges) {
+        for (auto iter = cold_blocks.begin(); iter != cold_blocks.end();) {
+            const A64::LocationDescriptor descriptor{iter->second.ir_block.Location()};
+            const A64::LocationDescriptor end_location{iter->second.ir_block.EndLocation()};
+            const auto range = boost::icl::discrete_interval<u64>::closed(descriptor.PC(), end_location.PC() - 1);
+            if (boost::icl::intersects(ranges, range)) {
+                iter = cold_blocks.erase(iter);
+            } else {
+                ++iter;
+            }
+        }
+    }
+
     void RequestCacheInvalidation() {
         if (is_executing) {
             jit_state.halt_requested = true;
@@ -282,8 +417,10 @@ private:
         if (invalidate_entire_cache) {
             block_of_code.ClearCache();
             emitter.ClearCache();
+            cold_blocks.clear();
         } else {
             emitter.InvalidateCacheRanges(invalid_cache_ranges);
+            InvalidateColdBlocks(invalid_cache_ranges);
         }
         invalid_cache_ranges.clear();
         invalidate_entire_cache = false;
@@ -296,6 +433,10 @@ private:
     BlockOfCode block_of_code;
     A64EmitX64 emitter;
 
+    A64Interpreter interpreter;
+    std::unordered_map<u64, ColdBlock> cold_blocks;
+    bool return_to_interpreter = false;
+
     bool invalidate_entire_cache = false;
     boost::icl::interval_set<u64> invalid_cache_ranges;
 };
@@ -421,4 +562,8 @@ std::string Jit::Disassemble() const {
     return impl->Disassemble();
 }
 
+std::map<std::uint32_t, std::uint64_t> Jit::GetInterpretedInstructionCounts() const {
+    return impl->GetInterpretedInstructionCounts();
+}
+
 } // namespace Dynarmic::A64
@@ -0,0 +1,384 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include <type_traits>
+
+#include <dynarmic/exclusive_monitor.h>
+
+#include "backend/x64/a64_interpreter.h"
+#include "backend/x64/nzcv_util.h"
+#include "common/assert.h"
+#include "common/bit_util.h"
+#include "common/variant_util.h"
+#include "frontend/A64/location_descriptor.h"
+#include "frontend/A64/types.h"
+#include "frontend/ir/basic_block.h"
+#include "frontend/ir/microinstruction.h"
+#include "frontend/ir/opcodes.h"
+
+namespace Dynarmic::Backend::X64 {
+
+A64Interpreter::A64Interpreter(A64JitState& jit_state, const A64::UserConfig& conf, A64::Jit* jit_interface, std::map<u32, u64>& interpreted_instruction_counts)
+        : jit_state(jit_state), conf(conf), jit_interface(jit_interface), interpreted_instruction_counts(interpreted_instruction_counts) {}
+
+void A64Interpreter::Execute(IR::Block& block) {
+    ASSERT(block.GetCondition() == IR::Cond::AL);
+
+    ExecuteInstructions(block);
+    jit_state.cycles_remaining -= static_cast<s64>(block.CycleCount());
+    ExecuteTerminal(block.GetTerminal(), block.Location());
+}
+
+bool A64Interpreter::CanInterpretArch(const IR::Inst& inst) const {
+    switch (inst.GetOpcode()) {
+    case IR::Opcode::A64SetCheckBit:
+    case IR::Opcode::A64GetCFlag:
+    case IR::Opcode::A64GetNZCVRaw:
+    case IR::Opcode::A64SetNZCVRaw:
+    case IR::Opcode::A64SetNZCV:
+    case IR::Opcode::A64GetW:
+    case IR::Opcode::A64GetX:
+    case IR::Opcode::A64GetS:
+    case IR::Opcode::A64GetD:
+    case IR::Opcode::A64GetQ:
+    case IR::Opcode::A64GetSP:
+    case IR::Opcode::A64GetFPCR:
+    case IR::Opcode::A64GetFPSR:
+    case IR::Opcode::A64SetW:
+    case IR::Opcode::A64SetX:
+    case IR::Opcode::A64SetS:
+    case IR::Opcode::A64SetD:
+    case IR::Opcode::A64SetQ:
+    case IR::Opcode::A64SetSP:
+    case IR::Opcode::A64SetFPCR:
+    case IR::Opcode::A64SetFPSR:
+    case IR::Opcode::A64OrQC:
+    case IR::Opcode::A64SetPC:
+    case IR::Opcode::A64CallSupervisor:
+    case IR::Opcode::A64ExceptionRaised:
+    case IR::Opcode::A64DataCacheOperationRaised:
+    case IR::Opcode::A64DataSynchronizationBarrier:
+    case IR::Opcode::A64DataMemoryBarrier:
+    case IR::Opcode::A64InstructionSynchronizationBarrier:
+    case IR::Opcode::A64GetCNTFRQ:
+    case IR::Opcode::A64GetCNTPCT:
+    case IR::Opcode::A64GetCTR:
+    case IR::Opcode::A64GetDCZID:
+    case IR::Opcode::A64GetTPIDR:
+    case IR::Opcode::A64GetTPIDRRO:
+    case IR::Opcode::A64SetTPIDR:
+    case IR::Opcode::A64ClearExclusive:
+    case IR::Opcode::A64ReadMemory8:
+    case IR::Opcode::A64ReadMemory16:
+    case IR::Opcode::A64ReadMemory32:
+    case IR::Opcode::A64ReadMemory64:
+    case IR::Opcode::A64ReadMemoryPair32:
+    case IR::Opcode::A64ReadMemory128:
+    case IR::Opcode::A64WriteMemory8:
+    case IR::Opcode::A64WriteMemory16:
+    case IR::Opcode::A64WriteMemory32:
+    case IR::Opcode::A64WriteMemory64:
+    case IR::Opcode::A64WriteMemoryPair32:
+    case IR::Opcode::A64WriteMemory128:
+        return true;
+    case IR::Opcode::A64ExclusiveReadMemory8:
+    case IR::Opcode::A64ExclusiveReadMemory16:
+    case IR::Opcode::A64ExclusiveReadMemory32:
+    case IR::Opcode::A64ExclusiveReadMemory64:
+    case IR::Opcode::A64ExclusiveWriteMemory8:
+    case IR::Opcode::A64ExclusiveWriteMemory16:
+    case IR::Opcode::A64ExclusiveWriteMemory32:
+    case IR::Opcode::A64ExclusiveWriteMemory64:
+        return conf.global_monitor != nullptr;
+    default:
+        return false;
+    }
+}
+
+u32 A64Interpreter::GetNZCV() const {
+    return NZCV::FromX64(jit_state.cpsr_nzcv);
+}
+
+FP::FPCR A64Interpreter::GetFPCR(IR::LocationDescriptor location) const {
+    return A64::LocationDescriptor{location}.FPCR();
+}
+
+u32& A64Interpreter::FPSRExceptions() {
+    return jit_state.fpsr_exc;
+}
+
+void A64Interpreter::ExecuteArch(IR::Inst* inst) {
+    const auto arg = [inst](size_t i) { return inst->GetArg(i); };
+
+    const auto exclusive_read = [&](auto callback) {
+        using T = std::invoke_result_t<decltype(callback), A64::VAddr>;
+        const u64 vaddr = Get(arg(0));
+        jit_state.exclusive_state = 1;
+        Set(inst, conf.global_monitor->ReadAndMark<T>(conf.processor_id, vaddr, [&]() -> T {
+            return callback(vaddr);
+        }));
+    };
+    const auto exclusive_write = [&](auto callback, auto value) {
+        using T = decltype(value);
+        const u64 vaddr = Get(arg(0));
+        if (jit_state.exclusive_state == 0) {
+            Set(inst, 1);
+            return;
+        }
+        jit_state.exclusive_state = 0;
+        const bool success = conf.global_monitor->DoExclusiveOperation<T>(conf.processor_id, vaddr, [&](T expected) -> bool {
+            return callback(vaddr, value, expected);
+        });
+        Set(inst, success ? 0 : 1);
+    };
+
+    const auto vec = [&](size_t i) { return 2 * static_cast<size_t>(arg(i).GetA64VecRef()); };
+
+    A64::UserCallbacks* cb = conf.callbacks;
+
+    switch (inst->GetOpcode()) {
+    case IR::Opcode::A64SetCheckBit:
+        jit_state.check_bit = Get(arg(0)) != 0;
+        break;
+    case IR::Opcode::A64GetCFlag:
+        Set(inst, Common::Bit<NZCV::x64_c_flag_bit>(jit_state.cpsr_nzcv));
+        break;
+    case IR::Opcode::A64GetNZCVRaw:
+        Set(inst, NZCV::FromX64(jit_state.cpsr_nzcv));
+        break;
+    case IR::Opcode::A64SetNZCVRaw:
+    case IR::Opcode::A64SetNZCV:
+        jit_state.cpsr_nzcv = NZCV::ToX64(static_cast<u32>(Get(arg(0))));
+        break;
+    case IR::Opcode::A64GetW:
+        Set(inst, static_cast<u32>(jit_state.reg[static_cast<size_t>(arg(0).GetA64RegRef())]));
+        break;
+    case IR::Opcode::A64GetX:
+        Set(inst, jit_state.reg[static_cast<size_t>(arg(0).GetA64RegRef())]);
+        break;
+    case IR::Opcode::A64GetS:
+        SetVector(inst, {static_cast<u32>(jit_state.vec[vec(0)]), 0});
+        break;
+    case IR::Opcode::A64GetD:
+        SetVector(inst, {jit_state.vec[vec(0)], 0});
+        break;
+    case IR::Opcode::A64GetQ:
+        SetVector(inst, {jit_state.vec[vec(0)], jit_state.vec[vec(0) + 1]});
+        break;
+    case IR::Opcode::A64GetSP:
+        Set(inst, jit_state.sp);
+        break;
+    case IR::Opcode::A64GetFPCR:
+        Set(inst, jit_state.fpcr);
+        break;
+    case IR::Opcode::A64GetFPSR:
+        Set(inst, jit_state.GetFpsr());
+        break;
+    case IR::Opcode::A64SetW:
+        jit_state.reg[static_cast<size_t>(arg(0).GetA64RegRef())] = static_cast<u32>(Get(arg(1)));
+        break;
+    case IR::Opcode::A64SetX:
+        jit_state.reg[static_cast<size_t>(arg(0).GetA64RegRef())] = Get(arg(1));
+        break;
+    case IR::Opcode::A64SetS:
+        jit_state.vec[vec(0)] = static_cast<u32>(GetVector(arg(1))[0]);
+        jit_state.vec[vec(0) + 1] = 0;
+        break;
+    case IR::Opcode::A64SetD:
+        jit_state.vec[vec(0)] = GetVector(arg(1))[0];
+        jit_state.vec[vec(0) + 1] = 0;
+        break;
+    case IR::Opcode::A64SetQ: {
+        const Vector value = GetVector(arg(1));
+        jit_state.vec[vec(0)] = value[0];
+        jit_state.vec[vec(0) + 1] = value[1];
+        break;
+    }
+    case IR::Opcode::A64SetSP:
+        jit_state.sp = Get(arg(0));
+        break;
+    case IR::Opcode::A64SetFPCR:
+        jit_state.SetFpcr(static_cast<u32>(Get(arg(0))));
+        break;
+    case IR::Opcode::A64SetFPSR:
+        jit_state.SetFpsr(static_cast<u32>(Get(arg(0))));
+        break;
+    case IR::Opcode::A64OrQC:
+        jit_state.fpsr_qc |= Get(arg(0)) != 0 ? 1 : 0;
+        break;
+    case IR::Opcode::A64SetPC:
+        jit_state.pc = Get(arg(0));
+        break;
+    case IR::Opcode::A64CallSupervisor:
+        cb->CallSVC(static_cast<u32>(Get(arg(0))));
+        // The kernel would have to execute ERET to get here, which would clear exclusive state.
+        jit_state.exclusive_state = 0;
+        break;
+    case IR::Opcode::A64ExceptionRaised:
+        cb->ExceptionRaised(Get(arg(0)), static_cast<A64::Exception>(Get(arg(1))));
+        break;
+    case IR::Opcode::A64DataCacheOperationRaised:
+        cb->DataCacheOperationRaised(static_cast<A64::DataCacheOperation>(Get(arg(0))), Get(arg(1)));
+        break;
+    case IR::Opcode::A64DataSynchronizationBarrier:
+    case IR::Opcode::A64DataMemoryBarrier:
+        break;
+    case IR::Opcode::A64InstructionSynchronizationBarrier:
+        jit_interface->ClearCache();
+        break;
+    case IR::Opcode::A64GetCNTFRQ:
+        Set(inst, conf.cntfrq_el0);
+        break;
+    case IR::Opcode::A64GetCNTPCT:
+        if (!conf.wall_clock_cntpct) {
+            cb->AddTicks(jit_state.cycles_to_run - jit_state.cycles_remaining);
+            jit_state.cycles_to_run = jit_state.cycles_remaining = static_cast<s64>(cb->GetTicksRemaining());
+        }
+        Set(inst, cb->GetCNTPCT());
+        break;
+    case IR::Opcode::A64GetCTR:
+        Set(inst, conf.ctr_el0);
+        break;
+    case IR::Opcode::A64GetDCZID:
+        Set(inst, conf.dczid_el0);
+        break;
+    case IR::Opcode::A64GetTPIDR:
+        Set(inst, conf.tpidr_el0 ? *conf.tpidr_el0 : 0);
+        break;
+    case IR::Opcode::A64GetTPIDRRO:
+        Set(inst, conf.tpidrro_el0 ? *conf.tpidrro_el0 : 0);
+        break;
+    case IR::Opcode::A64SetTPIDR:
+        if (conf.tpidr_el0) {
+            *const_cast<u64*>(conf.tpidr_el0) = Get(arg(0));
+        }
+        break;
+    case IR::Opcode::A64ClearExclusive:
+        jit_state.exclusive_state = 0;
+        break;
+    case IR::Opcode::A64ReadMemory8:
+        Set(inst, cb->MemoryRead8(Get(arg(0))));
+        break;
+    case IR::Opcode::A64ReadMemory16:
+        Set(inst, cb->MemoryRead16(Get(arg(0))));
+        break;
+    case IR::Opcode::A64ReadMemory32:
+        Set(inst, cb->MemoryRead32(Get(arg(0))));
+        break;
+    case IR::Opcode::A64ReadMemory64:
+        Set(inst, cb->MemoryRead64(Get(arg(0))));
+        break;
+    case IR::Opcode::A64ReadMemoryPair32: {
+        const u64 vaddr = Get(arg(0));
+        const u64 lo = cb->MemoryRead32(vaddr);
+        const u64 hi = cb->MemoryRead32(vaddr + 4);
+        Set(inst, lo | (hi << 32));
+        break;
+    }
+    case IR::Opcode::A64ReadMemory128:
+        SetVector(inst, cb->MemoryRead128(Get(arg(0))));
+        break;
+    case IR::Opcode::A64WriteMemory8:
+        cb->MemoryWrite8(Get(arg(0)), static_cast<u8>(Get(arg(1))));
+        break;
+    case IR::Opcode::A64WriteMemory16:
+        cb->MemoryWrite16(Get(arg(0)), static_cast<u16>(Get(arg(1))));
+        break;
+    case IR::Opcode::A64WriteMemory32:
+        cb->MemoryWrite32(Get(arg(0)), static_cast<u32>(Get(arg(1))));
+        break;
+    case IR::Opcode::A64WriteMemory64:
+        cb->MemoryWrite64(Get(arg(0)), Get(arg(1)));
+        break;
+    case IR::Opcode::A64WriteMemoryPair32: {
+        const u64 vaddr = Get(arg(0));
+        const u64 value = Get(arg(1));
+        cb->MemoryWrite32(vaddr, static_cast<u32>(value));
+        cb->MemoryWrite32(vaddr + 4, static_cast<u32>(value >> 32));
+        break;
+    }
+    case IR::Opcode::A64WriteMemory128:
+        cb->MemoryWrite128(Get(arg(0)), GetVector(arg(1)));
+        break;
+    case IR::Opcode::A64ExclusiveReadMemory8:
+        exclusive_read([cb](u64 vaddr) { return cb->MemoryRead8(vaddr); });
+        break;
+    case IR::Opcode::A64ExclusiveReadMemory16:
+        exclusive_read([cb](u64 vaddr) { return cb->MemoryRead16(vaddr); });
+        break;
+    case IR::Opcode::A64ExclusiveReadMemory32:
+        exclusive_read([cb](u64 vaddr) { return cb->MemoryRead32(vaddr); });
+        break;
+    case IR::Opcode::A64ExclusiveReadMemory64:
+        exclusive_read([cb](u64 vaddr) { return cb->MemoryRead64(vaddr); });
+        break;
+    case IR::Opcode::A64ExclusiveWriteMemory8:
+        exclusive_write([cb](u64 vaddr, u8 value, u8 expected) { return cb->MemoryWriteExclusive8(vaddr, value, expected); }, static_cast<u8>(Get(arg(1))));
+        break;
+    case IR::Opcode::A64ExclusiveWriteMemory16:
+        exclusive_write([cb](u64 vaddr, u16 value, u16 expected) { return cb->MemoryWriteExclusive16(vaddr, value, expected); }, static_cast<u16>(Get(arg(1))));
+        break;
+    case IR::Opcode::A64ExclusiveWriteMemory32:
+        exclusive_write([cb](u64 vaddr, u32 value, u32 expected) { return cb->MemoryWriteExclusive32(vaddr, value, expected); }, static_cast<u32>(Get(arg(1))));
+        break;
+    case IR::Opcode::A64ExclusiveWriteMemory64:
+        exclusive_write([cb](u64 vaddr, u64 value, u64 expected) { return cb->MemoryWriteExclusive64(vaddr, value, expected); }, Get(arg(1)));
+        break;
+    default:
+        ASSERT_FALSE("Invalid opcode: {}", inst->GetOpcode());
+    }
+}
+
+void A64Interpreter::ExecuteTerminal(const IR::Terminal& terminal, IR::LocationDescriptor initial_location) {
+    Common::VisitVariant<void>(terminal, [this, initial_location](const auto& x) {
+        using T = std::decay_t<decltype(x)>;
+        if constexpr (!std::is_same_v<T, IR::Term::Invalid>) {
+            this->ExecuteTerminalImpl(x, initial_location);
+        } else {
+            ASSERT_MSG(false, "Invalid terminal");
+        }
+    });
+}
+
+void A64Interpreter::ExecuteTerminalImpl(const IR::Term::Interpret& terminal, IR::LocationDescriptor) {
+    jit_state.pc = A64::LocationDescriptor{terminal.next}.PC();
+
+    for (size_t i = 0; i < terminal.num_instructions; i++) {
+        interpreted_instruction_counts[conf.callbacks->MemoryReadCode(jit_state.pc + i * 4)]++;
+    }
+
+    conf.callbacks->InterpreterFallback(jit_state.pc, terminal.num_instructions);
+}
+
+void A64Interpreter::ExecuteTerminalImpl(const IR::Term::ReturnToDispatch&, IR::LocationDescriptor) {}
+
+void A64Interpreter::ExecuteTerminalImpl(const IR::Term::LinkBlock& terminal, IR::LocationDescriptor) {
+    jit_state.pc = A64::LocationDescriptor{terminal.next}.PC();
+}
+
+void A64Interpreter::ExecuteTerminalImpl(const IR::Term::LinkBlockFast& terminal, IR::LocationDescriptor) {
+    jit_state.pc = A64::LocationDescriptor{terminal.next}.PC();
+}
+
+void A64Interpreter::ExecuteTerminalImpl(const IR::Term::PopRSBHint&, IR::LocationDescriptor) {}
+
+void A64Interpreter::ExecuteTerminalImpl(const IR::Term::FastDispatchHint&, IR::LocationDescriptor) {}
+
+void A64Interpreter::ExecuteTerminalImpl(const IR::Term::If& terminal, IR::LocationDescriptor initial_location) {
+    ExecuteTerminal(ConditionPassed(terminal.if_, GetNZCV()) ? terminal.then_ : terminal.else_, initial_location);
+}
+
+void A64Interpreter::ExecuteTerminalImpl(const IR::Term::CheckBit& terminal, IR::LocationDescriptor initial_location) {
+    ExecuteTerminal(jit_state.check_bit ? terminal.then_ : terminal.else_, initial_location);
+}
+
+void A64Interpreter::ExecuteTerminalImpl(const IR::Term::CheckHalt& terminal, IR::LocationDescriptor initial_location) {
+    if (jit_state.halt_requested) {
+        return;
+    }
+    ExecuteTerminal(terminal.else_, initial_location);
+}
+
+} // namespace Dynarmic::Backend::X64
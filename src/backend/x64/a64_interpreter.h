@@ -0,0 +1,52 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#pragma once
+
+#include <map>
+
+#include <dynarmic/A64/a64.h>
+#include <dynarmic/A64/config.h>
+
+#include "backend/x64/a64_jitstate.h"
+#include "backend/x64/interpreter.h"
+#include "frontend/ir/location_descriptor.h"
+#include "frontend/ir/terminal.h"
+
+namespace Dynarmic::Backend::X64 {
+
+class A64Interpreter final : public Interpreter {
+public:
+    A64Interpreter(A64JitState& jit_state, const A64::UserConfig& conf, A64::Jit* jit_interface, std::map<u32, u64>& interpreted_instruction_counts);
+
+    /// Executes block, including its terminal, and updates cycles_remaining.
+    void Execute(IR::Block& block);
+
+protected:
+    bool CanInterpretArch(const IR::Inst& inst) const override;
+    void ExecuteArch(IR::Inst* inst) override;
+    u32 GetNZCV() const override;
+    FP::FPCR GetFPCR(IR::LocationDescriptor location) const override;
+    u32& FPSRExceptions() override;
+
+private:
+    void ExecuteTerminal(const IR::Terminal& terminal, IR::LocationDescriptor initial_location);
+    void ExecuteTerminalImpl(const IR::Term::Interpret& terminal, IR::LocationDescriptor initial_location);
+    void ExecuteTerminalImpl(const IR::Term::ReturnToDispatch& terminal, IR::LocationDescriptor initial_location);
+    void ExecuteTerminalImpl(const IR::Term::LinkBlock& terminal, IR::LocationDescriptor initial_location);
+    void ExecuteTerminalImpl(const IR::Term::LinkBlockFast& terminal, IR::LocationDescriptor initial_location);
+    void ExecuteTerminalImpl(const IR::Term::PopRSBHint& terminal, IR::LocationDescriptor initial_location);
+    void ExecuteTerminalImpl(const IR::Term::FastDispatchHint& terminal, IR::LocationDescriptor initial_location);
+    void ExecuteTerminalImpl(const IR::Term::If& terminal, IR::LocationDescriptor initial_location);
+    void ExecuteTerminalImpl(const IR::Term::CheckBit& terminal, IR::LocationDescriptor initial_location);
+    void ExecuteTerminalImpl(const IR::Term::CheckHalt& terminal, IR::LocationDescriptor initial_location);
+
+    A64JitState& jit_state;
+    const A64::UserConfig& conf;
+    A64::Jit* jit_interface;
+    std::map<u32, u64>& interpreted_instruction_counts;
+};
+
+} // namespace Dynarmic::Backend::X64
@@ -351,6 +351,14 @@ bool BlockOfCode::HasAESNI() const {
     return DoesCpuSupport(Xbyak::util::Cpu::tAESNI);
 }
 
+bool BlockOfCode::HasGFNI() const {
+    return DoesCpuSupport(Xbyak::util::Cpu::tGFNI);
+}
+
+bool BlockOfCode::HasSHA() const {
+    return DoesCpuSupport(Xbyak::util::Cpu::tSHA);
+}
+
 bool BlockOfCode::HasLZCNT() const {
     return DoesCpuSupport(Xbyak::util::Cpu::tLZCNT);
 }
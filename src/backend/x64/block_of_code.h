@@ -151,6 +151,8 @@ public:
     bool HasAVX() const;
     bool HasF16C() const;
     bool HasAESNI() const;
+    bool HasGFNI() const;
+    bool HasSHA() const;
     bool HasLZCNT() const;
     bool HasBMI1() const;
     bool HasBMI2() const;
@@ -39,6 +39,62 @@ void EmitContext::EraseInstruction(IR::Inst* inst) {
     inst->ClearArgs();
 }
 
+void EmitContext::EnterStandardASIMD(BlockOfCode& code) {
+    if (in_standard_asimd) {
+        return;
+    }
+    code.EnterStandardASIMD();
+    in_standard_asimd = true;
+}
+
+void EmitContext::LeaveStandardASIMD(BlockOfCode& code) {
+    if (!in_standard_asimd) {
+        return;
+    }
+    code.LeaveStandardASIMD();
+    in_standard_asimd = false;
+}
+
+bool EmitContext::CanRemainInStandardASIMD(const IR::Inst& inst) {
+    switch (inst.GetOpcode()) {
+    case IR::Opcode::A32GetExtendedRegister32:
+    case IR::Opcode::A32GetExtendedRegister64:
+    case IR::Opcode::A32GetVector:
+    case IR::Opcode::A32SetExtendedRegister32:
+    case IR::Opcode::A32SetExtendedRegister64:
+    case IR::Opcode::A32SetVector:
+    case IR::Opcode::A64GetS:
+    case IR::Opcode::A64GetD:
+    case IR::Opcode::A64GetQ:
+    case IR::Opcode::A64SetS:
+    case IR::Opcode::A64SetD:
+    case IR::Opcode::A64SetQ:
+    case IR::Opcode::Identity:
+    case IR::Opcode::Void:
+    case IR::Opcode::VectorTranspose8:
+    case IR::Opcode::VectorTranspose16:
+    case IR::Opcode::VectorTranspose32:
+    case IR::Opcode::VectorTranspose64:
+        return true;
+    default:
+        break;
+    }
+
+    if (inst.GetType() != IR::Type::U128 || inst.IsMemoryReadOrWrite()) {
+        return false;
+    }
+
+    // Floating-point vector operations take fpcr_controlled as their last argument.
+    const size_t num_args = inst.NumArgs();
+    if (num_args != 0) {
+        const IR::Value last_arg = inst.GetArg(num_args - 1);
+        if (last_arg.IsImmediate() && last_arg.GetType() == IR::Type::U1) {
+            return !last_arg.GetU1();
+        }
+    }
+    return !inst.ReadsFromAndWritesToFPSRCumulativeExceptionBits();
+}
+
 EmitX64::EmitX64(BlockOfCode& code) : code(code) {
     exception_handler.Register(code);
 }
@@ -57,8 +57,19 @@ struct EmitContext {
 
     virtual bool HasOptimization(OptimizationFlag flag) const = 0;
 
+    /// Switches to asimd_MXCSR if it is not already loaded.
+    void EnterStandardASIMD(BlockOfCode& code);
+    /// Switches back to guest_MXCSR if asimd_MXCSR is currently loaded.
+    void LeaveStandardASIMD(BlockOfCode& code);
+    /// Returns true if asimd_MXCSR may remain loaded while emitting inst.
+    static bool CanRemainInStandardASIMD(const IR::Inst& inst);
+
     RegAlloc& reg_alloc;
     IR::Block& block;
+
+    /// asimd_MXCSR is left loaded between consecutive standard ASIMD operations so that
+    /// interleaved register accesses do not cause redundant MXCSR switches.
+    bool in_standard_asimd = false;
 };
 
 class EmitX64 {
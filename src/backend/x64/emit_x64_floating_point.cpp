@@ -20,6 +20,7 @@
 #include "backend/x64/block_of_code.h"
 #include "backend/x64/emit_x64.h"
 #include "common/assert.h"
+#include "common/bit_util.h"
 #include "common/common_types.h"
 #include "common/cast_util.h"
 #include "common/fp/fpcr.h"
@@ -30,6 +31,7 @@
 #include "common/lut_from_list.h"
 #include "frontend/ir/basic_block.h"
 #include "frontend/ir/microinstruction.h"
+#include "frontend/ir/opcodes.h"
 
 namespace Dynarmic::Backend::X64 {
 
@@ -257,6 +259,17 @@ void FPTwoOp(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, Function fn) {
 
     Xbyak::Xmm result = ctx.reg_alloc.UseScratchXmm(args[0]);
 
+    if (ctx.HasOptimization(OptimizationFlag::Unsafe_InaccurateNaN)) {
+        if constexpr (std::is_member_function_pointer_v<Function>) {
+            (code.*fn)(result, result);
+        } else {
+            fn(result);
+        }
+
+        ctx.reg_alloc.DefineValue(inst, result);
+        return;
+    }
+
     if (!ctx.FPCR().DN()) {
         end = ProcessNaN<fsize>(code, result);
     }
@@ -281,7 +294,7 @@ void FPThreeOp(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, Function fn)
 
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
 
-    if (ctx.FPCR().DN()) {
+    if (ctx.FPCR().DN() || ctx.HasOptimization(OptimizationFlag::Unsafe_InaccurateNaN)) {
         const Xbyak::Xmm result = ctx.reg_alloc.UseScratchXmm(args[0]);
         const Xbyak::Xmm operand = ctx.reg_alloc.UseScratchXmm(args[1]);
 
@@ -291,7 +304,9 @@ void FPThreeOp(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, Function fn)
             fn(result, operand);
         }
 
-        ForceToDefaultNaN<fsize>(code, result);
+        if (!ctx.HasOptimization(OptimizationFlag::Unsafe_InaccurateNaN)) {
+            ForceToDefaultNaN<fsize>(code, result);
+        }
 
         ctx.reg_alloc.DefineValue(inst, result);
         return;
@@ -409,7 +424,16 @@ static void EmitFPMinMax(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
     const Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
     const Xbyak::Reg64 gpr_scratch = ctx.reg_alloc.ScratchGpr();
 
-    DenormalsAreZero<fsize>(code, ctx, {result, operand});
+    if (ctx.FPCR().FZ() && ctx.FPCR().DN()) {
+        // MXCSR.DAZ flushes the operands of this addition. Any signalling NaN it quietens would
+        // produce the default NaN anyway.
+        const bool round_down = ctx.FPCR().RMode() == FP::RoundingMode::TowardsMinusInfinity;
+        code.movaps(tmp, code.MConst(xword, round_down ? 0 : (fsize == 32 ? f32_negative_zero : f64_negative_zero)));
+        FCODE(adds)(result, tmp);
+        FCODE(adds)(operand, tmp);
+    } else {
+        DenormalsAreZero<fsize>(code, ctx, {result, operand});
+    }
 
     Xbyak::Label equal, end, nan;
 
@@ -607,6 +631,10 @@ static void EmitFPMulAdd(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
             code.movaps(tmp, code.MConst(xword, fsize == 32 ? f32_non_sign_mask : f64_non_sign_mask));
             code.andps(tmp, result);
             FCODE(ucomis)(tmp, code.MConst(xword, fsize == 32 ? f32_smallest_normal : f64_smallest_normal));
+            if (ctx.HasOptimization(OptimizationFlag::Unsafe_InaccurateNaN)) {
+                // NaN results are left as-is.
+                code.jp(end);
+            }
             code.jz(fallback, code.T_NEAR);
             code.L(end);
 
@@ -740,6 +768,94 @@ void EmitX64::EmitFPMulX64(EmitContext& ctx, IR::Inst* inst) {
     EmitFPMulX<64>(code, ctx, inst);
 }
 
+// For normal operands that produce normal results, FRECPE and FRSQRTE depend only on the sign,
+// the exponent and the upper eight bits of the fraction, so the estimate can be read out of a
+// table. Other operands are handled by calling the fallback.
+template<size_t fsize>
+static void EmitFPEstimateLookup(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, bool rsqrt, const u32* table, mp::unsigned_integer_of_size<fsize> (*fallback_fn)(mp::unsigned_integer_of_size<fsize>, FP::FPCR, FP::FPSR&)) {
+    using FPT = mp::unsigned_integer_of_size<fsize>;
+    constexpr size_t mantissa_width = FP::FPInfo<FPT>::explicit_mantissa_width;
+    constexpr int bias = FP::FPInfo<FPT>::exponent_bias;
+
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    Xbyak::Label end, fallback;
+
+    const Xbyak::Xmm operand = ctx.reg_alloc.UseXmm(args[0]);
+    const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Reg64 value = ctx.reg_alloc.ScratchGpr();
+    const Xbyak::Reg64 exponent = ctx.reg_alloc.ScratchGpr();
+    const Xbyak::Reg64 estimate = ctx.reg_alloc.ScratchGpr();
+    const Xbyak::Reg64 tmp = ctx.reg_alloc.ScratchGpr();
+
+    if constexpr (fsize == 16) {
+        code.movd(value.cvt32(), operand);
+        code.movzx(value.cvt32(), value.cvt16());
+    } else if constexpr (fsize == 32) {
+        code.movd(value.cvt32(), operand);
+    } else {
+        code.movq(value, operand);
+    }
+
+    // The biased exponent must be in [1, 2 * bias - 2] for FRECPE and [1, 2 * bias] for FRSQRTE.
+    // For FRSQRTE the sign bit is left above the exponent, so negative operands are out of range.
+    code.mov(exponent, value);
+    code.shr(exponent, mantissa_width);
+    if (!rsqrt) {
+        code.and_(exponent, (1 << FP::FPInfo<FPT>::exponent_width) - 1);
+    }
+    code.lea(tmp, ptr[exponent - 1]);
+    code.cmp(tmp, rsqrt ? 2 * bias - 1 : 2 * bias - 3);
+    code.ja(fallback, code.T_NEAR);
+
+    code.mov(estimate, value);
+    code.shr(estimate, mantissa_width - 8);
+    code.and_(estimate, rsqrt ? 0x1FF : 0xFF);
+    code.mov(tmp, reinterpret_cast<u64>(table));
+    code.mov(estimate.cvt32(), dword[tmp + estimate * 4]);
+    code.shl(estimate, mantissa_width - 8);
+
+    // FRECPE: result exponent = (2 * bias - 1) - exponent
+    // FRSQRTE: result exponent = ((3 * bias - 1) - exponent) / 2
+    code.mov(tmp, rsqrt ? 3 * bias - 1 : 2 * bias - 1);
+    code.sub(tmp, exponent);
+    if (rsqrt) {
+        code.shr(tmp, 1);
+    }
+    code.shl(tmp, mantissa_width);
+    code.or_(estimate, tmp);
+    if (!rsqrt) {
+        code.shr(value, fsize - 1);
+        code.shl(value, fsize - 1);
+        code.or_(estimate, value);
+    }
+
+    if constexpr (fsize == 64) {
+        code.movq(result, estimate);
+    } else {
+        code.movd(result, estimate.cvt32());
+    }
+    code.L(end);
+
+    code.SwitchToFarCode();
+    code.L(fallback);
+
+    code.sub(rsp, 8);
+    ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, HostLocXmmIdx(result.getIdx()));
+    code.movq(code.ABI_PARAM1, operand);
+    code.mov(code.ABI_PARAM2.cvt32(), ctx.FPCR().Value());
+    code.lea(code.ABI_PARAM3, code.ptr[code.r15 + code.GetJitStateInfo().offsetof_fpsr_exc]);
+    code.CallFunction(fallback_fn);
+    code.movq(result, code.ABI_RETURN);
+    ABI_PopCallerSaveRegistersAndAdjustStackExcept(code, HostLocXmmIdx(result.getIdx()));
+    code.add(rsp, 8);
+
+    code.jmp(end, code.T_NEAR);
+    code.SwitchToNearCode();
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
 template<size_t fsize>
 static void EmitFPRecipEstimate(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
     using FPT = mp::unsigned_integer_of_size<fsize>;
@@ -763,11 +879,7 @@ static void EmitFPRecipEstimate(BlockOfCode& code, EmitContext& ctx, IR::Inst* i
         }
     }
 
-    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-    ctx.reg_alloc.HostCall(inst, args[0]);
-    code.mov(code.ABI_PARAM2.cvt32(), ctx.FPCR().Value());
-    code.lea(code.ABI_PARAM3, code.ptr[code.r15 + code.GetJitStateInfo().offsetof_fpsr_exc]);
-    code.CallFunction(&FP::FPRecipEstimate<FPT>);
+    EmitFPEstimateLookup<fsize>(code, ctx, inst, false, FP::FPRecipEstimateTable().data(), &FP::FPRecipEstimate<FPT>);
 }
 
 void EmitX64::EmitFPRecipEstimate16(EmitContext& ctx, IR::Inst* inst) {
@@ -951,6 +1063,103 @@ void EmitX64::EmitFPRoundInt64(EmitContext& ctx, IR::Inst* inst) {
     EmitFPRound(code, ctx, inst, 64);
 }
 
+template<size_t fsize>
+static void EmitFPRoundIntN(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
+    using FPT = mp::unsigned_integer_of_size<fsize>;
+
+    const auto rounding_mode = static_cast<FP::RoundingMode>(inst->GetArg(1).GetU8());
+    const size_t intsize = inst->GetArg(2).GetU8();
+    const auto round_imm = ConvertRoundingModeToX64Immediate(rounding_mode);
+
+    using rounding_list = mp::list<
+        mp::lift_value<FP::RoundingMode::ToNearest_TieEven>,
+        mp::lift_value<FP::RoundingMode::TowardsPlusInfinity>,
+        mp::lift_value<FP::RoundingMode::TowardsMinusInfinity>,
+        mp::lift_value<FP::RoundingMode::TowardsZero>,
+        mp::lift_value<FP::RoundingMode::ToNearest_TieAwayFromZero>
+    >;
+    using intsize_list = mp::list<mp::lift_value<size_t(32)>, mp::lift_value<size_t(64)>>;
+
+    static const auto lut = Common::GenerateLookupTableFromList(
+        [](auto args) {
+            return std::pair{
+                mp::lower_to_tuple_v<decltype(args)>,
+                Common::FptrCast(
+                    [](u64 input, FP::FPSR& fpsr, FP::FPCR fpcr) {
+                        constexpr auto t = mp::lower_to_tuple_v<decltype(args)>;
+                        constexpr FP::RoundingMode rounding_mode = std::get<0>(t);
+                        constexpr size_t intsize = std::get<1>(t);
+
+                        return FP::FPRoundIntN<FPT>(static_cast<FPT>(input), fpcr, rounding_mode, intsize, fpsr);
+                    }
+                )
+            };
+        },
+        mp::cartesian_product<rounding_list, intsize_list>{}
+    );
+
+    const auto fallback_fn = lut.at(std::make_tuple(rounding_mode, intsize));
+
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    if (!code.HasSSE41() || !round_imm) {
+        ctx.reg_alloc.HostCall(inst, args[0]);
+        code.lea(code.ABI_PARAM2, code.ptr[code.r15 + code.GetJitStateInfo().offsetof_fpsr_exc]);
+        code.mov(code.ABI_PARAM3.cvt32(), ctx.FPCR().Value());
+        code.CallFunction(fallback_fn);
+        return;
+    }
+
+    // An operand within [-2^(intsize-1), 2^(intsize-1)-1] rounds to an integer that is also within
+    // that range, so only NaNs and operands outside of it (which may still round into it) need the
+    // fallback. The precision exception is not suppressed as these instructions are always exact.
+    constexpr size_t mantissa_width = FP::FPInfo<FPT>::mantissa_width;
+    constexpr size_t explicit_mantissa_width = FP::FPInfo<FPT>::explicit_mantissa_width;
+    constexpr u64 sign_mask = FP::FPInfo<FPT>::sign_mask;
+    constexpr u64 bias = FP::FPInfo<FPT>::exponent_bias;
+
+    const u64 lower_bound = sign_mask | ((bias + intsize - 1) << explicit_mantissa_width);
+    const u64 upper_bound = intsize - 1 < mantissa_width
+                          ? ((bias + intsize - 2) << explicit_mantissa_width) | (Common::Ones<u64>(intsize - 2) << (explicit_mantissa_width - (intsize - 2)))
+                          : ((bias + intsize - 1) << explicit_mantissa_width) - 1;
+
+    Xbyak::Label end, fallback;
+
+    const Xbyak::Xmm operand = ctx.reg_alloc.UseXmm(args[0]);
+    const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+
+    FCODE(ucomis)(operand, code.MConst(xword, lower_bound));
+    code.jb(fallback, code.T_NEAR);
+    FCODE(ucomis)(operand, code.MConst(xword, upper_bound));
+    code.ja(fallback, code.T_NEAR);
+    FCODE(rounds)(result, operand, static_cast<u8>(*round_imm));
+    code.L(end);
+
+    code.SwitchToFarCode();
+    code.L(fallback);
+    code.sub(rsp, 8);
+    ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, HostLocXmmIdx(result.getIdx()));
+    code.movq(code.ABI_PARAM1, operand);
+    code.lea(code.ABI_PARAM2, code.ptr[code.r15 + code.GetJitStateInfo().offsetof_fpsr_exc]);
+    code.mov(code.ABI_PARAM3.cvt32(), ctx.FPCR().Value());
+    code.CallFunction(fallback_fn);
+    code.movq(result, code.ABI_RETURN);
+    ABI_PopCallerSaveRegistersAndAdjustStackExcept(code, HostLocXmmIdx(result.getIdx()));
+    code.add(rsp, 8);
+    code.jmp(end, code.T_NEAR);
+    code.SwitchToNearCode();
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+void EmitX64::EmitFPRoundIntN32(EmitContext& ctx, IR::Inst* inst) {
+    EmitFPRoundIntN<32>(code, ctx, inst);
+}
+
+void EmitX64::EmitFPRoundIntN64(EmitContext& ctx, IR::Inst* inst) {
+    EmitFPRoundIntN<64>(code, ctx, inst);
+}
+
 template<size_t fsize>
 static void EmitFPRSqrtEstimate(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
     using FPT = mp::unsigned_integer_of_size<fsize>;
@@ -974,11 +1183,7 @@ static void EmitFPRSqrtEstimate(BlockOfCode& code, EmitContext& ctx, IR::Inst* i
         }
     }
 
-    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-    ctx.reg_alloc.HostCall(inst, args[0]);
-    code.mov(code.ABI_PARAM2.cvt32(), ctx.FPCR().Value());
-    code.lea(code.ABI_PARAM3, code.ptr[code.r15 + code.GetJitStateInfo().offsetof_fpsr_exc]);
-    code.CallFunction(&FP::FPRSqrtEstimate<FPT>);
+    EmitFPEstimateLookup<fsize>(code, ctx, inst, true, FP::FPRSqrtEstimateTable().data(), &FP::FPRSqrtEstimate<FPT>);
 }
 
 void EmitX64::EmitFPRSqrtEstimate16(EmitContext& ctx, IR::Inst* inst) {
@@ -1166,7 +1371,9 @@ void EmitX64::EmitFPHalfToDouble(EmitContext& ctx, IR::Inst* inst) {
         const Xbyak::Xmm value = ctx.reg_alloc.UseXmm(args[0]);
 
         // Double-conversion here is acceptable as this is expanding precision.
-        code.vcvtph2ps(result, value);
+        // The upper halves are cleared so that they cannot raise spurious exceptions.
+        code.vpmovzxwq(result, value);
+        code.vcvtph2ps(result, result);
         code.vcvtps2pd(result, result);
         if (ctx.FPCR().DN()) {
             ForceToDefaultNaN<64>(code, result);
@@ -1191,7 +1398,9 @@ void EmitX64::EmitFPHalfToSingle(EmitContext& ctx, IR::Inst* inst) {
         const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
         const Xbyak::Xmm value = ctx.reg_alloc.UseXmm(args[0]);
 
-        code.vcvtph2ps(result, value);
+        // The upper halves are cleared so that they cannot raise spurious exceptions.
+        code.vpmovzxwq(result, value);
+        code.vcvtph2ps(result, result);
         if (ctx.FPCR().DN()) {
             ForceToDefaultNaN<32>(code, result);
         }
@@ -1234,12 +1443,15 @@ void EmitX64::EmitFPSingleToHalf(EmitContext& ctx, IR::Inst* inst) {
     const auto rounding_mode = static_cast<FP::RoundingMode>(args[1].GetImmediateU8());
     const auto round_imm = ConvertRoundingModeToX64Immediate(rounding_mode);
 
-    if (code.HasF16C() && !ctx.FPCR().AHP() && !ctx.FPCR().FZ16()) {
+    if (code.HasF16C() && !ctx.FPCR().AHP() && !ctx.FPCR().FZ16() && round_imm) {
         const Xbyak::Xmm result = ctx.reg_alloc.UseScratchXmm(args[0]);
 
+        DenormalsAreZero<32>(code, ctx, {result});
         if (ctx.FPCR().DN()) {
             ForceToDefaultNaN<32>(code, result);
         }
+        // The upper elements are cleared so that they cannot raise spurious exceptions.
+        code.vinsertps(result, result, result, 0b00001110);
         code.vcvtps2ph(result, result, static_cast<u8>(*round_imm));
 
         ctx.reg_alloc.DefineValue(inst, result);
@@ -1256,9 +1468,49 @@ void EmitX64::EmitFPSingleToHalf(EmitContext& ctx, IR::Inst* inst) {
 void EmitX64::EmitFPDoubleToHalf(EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
     const auto rounding_mode = static_cast<FP::RoundingMode>(args[1].GetImmediateU8());
+    const auto round_imm = ConvertRoundingModeToX64Immediate(rounding_mode);
+
+    // NOTE: Double-converting is only accurate if the first conversion is "round-to-odd".
+    //       We emulate this by truncating and then setting the lowest bit if the result was inexact.
+    //       Embedded rounding is used so that the intermediate conversion raises no exceptions.
+    if (code.HasAVX512_Skylake() && code.HasF16C() && !ctx.FPCR().AHP() && !ctx.FPCR().FZ() && !ctx.FPCR().FZ16() && round_imm) {
+        Xbyak::Label end, fallback;
+
+        const Xbyak::Xmm value = ctx.reg_alloc.UseXmm(args[0]);
+        const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+        const Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+
+        code.ucomisd(value, value);
+        code.jp(fallback, code.T_NEAR);
+        code.vcvtsd2ss(result, value, value | code.T_rz_sae);
+        code.vcvtss2sd(tmp, result, result);
+        code.vcmpneqsd(tmp, tmp, value);
+        code.vpand(tmp, tmp, code.MConst(xword, 1, 0));
+        code.vpor(result, result, tmp);
+        code.vinsertps(result, result, result, 0b00001110);
+        code.vcvtps2ph(result, result, static_cast<u8>(*round_imm));
+        code.L(end);
+
+        code.SwitchToFarCode();
+        code.L(fallback);
 
-    // NOTE: Do not double-convert here as that is inaccurate.
-    //       To be accurate, the first conversion would need to be "round-to-odd", which x64 doesn't support.
+        code.sub(rsp, 8);
+        ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, HostLocXmmIdx(result.getIdx()));
+        code.movq(code.ABI_PARAM1, value);
+        code.mov(code.ABI_PARAM2.cvt32(), ctx.FPCR().Value());
+        code.mov(code.ABI_PARAM3.cvt32(), static_cast<u32>(rounding_mode));
+        code.lea(code.ABI_PARAM4, code.ptr[code.r15 + code.GetJitStateInfo().offsetof_fpsr_exc]);
+        code.CallFunction(&FP::FPConvert<u16, u64>);
+        code.movq(result, code.ABI_RETURN);
+        ABI_PopCallerSaveRegistersAndAdjustStackExcept(code, HostLocXmmIdx(result.getIdx()));
+        code.add(rsp, 8);
+
+        code.jmp(end, code.T_NEAR);
+        code.SwitchToNearCode();
+
+        ctx.reg_alloc.DefineValue(inst, result);
+        return;
+    }
 
     ctx.reg_alloc.HostCall(inst, args[0]);
     code.mov(code.ABI_PARAM2.cvt32(), ctx.FPCR().Value());
@@ -1430,6 +1682,101 @@ void EmitX64::EmitFPDoubleToFixedU64(EmitContext& ctx, IR::Inst* inst) {
     EmitFPToFixed<64, true, 64>(code, ctx, inst);
 }
 
+// FJCVTZS truncates towards zero and wraps out of range values modulo 2^32. Z is set only when the
+// conversion is exact, which is equivalent to the result converting back to the operand bit for bit.
+// The x64 conversion returns the integer indefinite value for NaNs and out of range operands; those
+// results are recomputed from the bits of the operand, after the conversion has raised the exceptions.
+// With FPCR.FZ set a denormal operand is flushed to zero first: this sets IDC and converts exactly,
+// so Z is set unless the operand is negative. This is handled separately as the comparison would fail.
+void EmitX64::EmitFPDoubleToFixedJS(EmitContext& ctx, IR::Inst* inst) {
+    const auto nzcv_inst = inst->GetAssociatedPseudoOperation(IR::Opcode::GetNZCVFromOp);
+
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const Xbyak::Reg64 nzcv = nzcv_inst ? ctx.reg_alloc.ScratchGpr(HostLoc::RAX) : Xbyak::Reg64{-1};
+    const Xbyak::Reg64 shift = ctx.reg_alloc.ScratchGpr(HostLoc::RCX);
+    const Xbyak::Xmm operand = ctx.reg_alloc.UseXmm(args[0]);
+    const Xbyak::Reg64 result = ctx.reg_alloc.ScratchGpr();
+    const Xbyak::Reg64 tmp = ctx.reg_alloc.ScratchGpr();
+
+    Xbyak::Label end, fallback, shift_left, zero, apply_sign, denormal, not_denormal, flags_done;
+
+    if (ctx.FPCR().FZ()) {
+        code.movq(tmp, operand);
+        code.shl(tmp, 1);
+        code.jz(not_denormal);
+        code.shr(tmp, 53);
+        code.jz(denormal, code.T_NEAR);
+        code.L(not_denormal);
+    }
+
+    code.cvttsd2si(result.cvt32(), operand);
+    code.cmp(result.cvt32(), 0x80000000);
+    code.je(fallback, code.T_NEAR);
+    code.L(end);
+
+    if (nzcv_inst) {
+        code.xorps(xmm0, xmm0);
+        code.cvtsi2sd(xmm0, result.cvt32());
+        code.movq(tmp, xmm0);
+        code.movq(shift, operand);
+        code.cmp(tmp, shift);
+        code.sete(nzcv.cvt8());
+        code.movzx(nzcv.cvt32(), nzcv.cvt8());
+        code.shl(nzcv.cvt32(), 14);
+
+        ctx.reg_alloc.DefineValue(nzcv_inst, nzcv);
+        ctx.EraseInstruction(nzcv_inst);
+    }
+    code.L(flags_done);
+
+    code.SwitchToFarCode();
+    if (ctx.FPCR().FZ()) {
+        code.L(denormal);
+        code.or_(code.byte[code.r15 + code.GetJitStateInfo().offsetof_fpsr_exc], 1 << 7);
+        code.xor_(result.cvt32(), result.cvt32());
+        if (nzcv_inst) {
+            code.movq(nzcv, operand);
+            code.shr(nzcv, 63);
+            code.xor_(nzcv.cvt32(), 1);
+            code.shl(nzcv.cvt32(), 14);
+        }
+        code.jmp(flags_done, code.T_NEAR);
+    }
+
+    code.L(fallback);
+    code.movq(tmp, operand);
+    code.mov(result, tmp);
+    code.shl(result, 12);
+    code.shr(result, 12);
+    code.bts(result, 52);
+    code.mov(shift, tmp);
+    code.shr(shift, 52);
+    code.and_(shift.cvt32(), 0x7FF);
+    code.sub(shift.cvt32(), 1075);
+    code.jns(shift_left);
+    // Only operands of magnitude 2^31 or more get here, so this shift is at most 21.
+    code.neg(shift.cvt32());
+    code.shr(result, shift.cvt8());
+    code.jmp(apply_sign);
+    code.L(shift_left);
+    // This also zeroes NaNs and infinities.
+    code.cmp(shift.cvt32(), 31);
+    code.ja(zero);
+    code.shl(result, shift.cvt8());
+    code.jmp(apply_sign);
+    code.L(zero);
+    code.xor_(result.cvt32(), result.cvt32());
+    code.L(apply_sign);
+    code.sar(tmp, 63);
+    code.xor_(result.cvt32(), tmp.cvt32());
+    code.sub(result.cvt32(), tmp.cvt32());
+    code.jmp(end, code.T_NEAR);
+    code.SwitchToNearCode();
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
 void EmitX64::EmitFPHalfToFixedS16(EmitContext& ctx, IR::Inst* inst) {
     EmitFPToFixed<16, false, 16>(code, ctx, inst);
 }
@@ -1530,9 +1877,9 @@ void EmitX64::EmitFPFixedS32ToSingle(EmitContext& ctx, IR::Inst* inst) {
         code.cvtsi2ss(result, from);
     } else {
         ASSERT(rounding_mode == FP::RoundingMode::ToNearest_TieEven);
-        code.EnterStandardASIMD();
+        ctx.EnterStandardASIMD(code);
         code.cvtsi2ss(result, from);
-        code.LeaveStandardASIMD();
+        ctx.LeaveStandardASIMD(code);
     }
 
     if (fbits != 0) {
@@ -1566,9 +1913,9 @@ void EmitX64::EmitFPFixedU32ToSingle(EmitContext& ctx, IR::Inst* inst) {
         op();
     } else {
         ASSERT(rounding_mode == FP::RoundingMode::ToNearest_TieEven);
-        code.EnterStandardASIMD();
+        ctx.EnterStandardASIMD(code);
         op();
-        code.LeaveStandardASIMD();
+        ctx.LeaveStandardASIMD(code);
     }
 
     if (fbits != 0) {
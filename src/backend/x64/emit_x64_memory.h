@@ -0,0 +1,243 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <initializer_list>
+
+#include <xbyak.h>
+
+#include "backend/x64/block_of_code.h"
+#include "common/assert.h"
+#include "common/common_types.h"
+
+namespace Dynarmic::Backend::X64 {
+
+// Page-straddling accesses
+//
+// An access of N bytes that straddles a page boundary is split across two host pages. These
+// helpers emit code that performs such an access without calling into the user callbacks:
+// both pages are looked up first, and only if both are mapped is the access performed.
+//
+// The emitted code preserves all registers, so is suitable for placement in far code.
+// `lookup(host_ptr, addr, tmp, fail)` must emit code that translates guest address `addr` into
+// a host pointer in `host_ptr`, jumping to `fail` if the page is unmapped. It may clobber `tmp`.
+
+namespace detail {
+
+template<size_t count>
+std::array<Xbyak::Reg64, count> ChooseStraddleScratch(std::initializer_list<int> excluded_idxes) {
+    static const std::array<Xbyak::Reg64, 12> candidates{
+        Xbyak::util::rax, Xbyak::util::rcx, Xbyak::util::rdx, Xbyak::util::rbx,
+        Xbyak::util::rbp, Xbyak::util::rsi, Xbyak::util::rdi, Xbyak::util::r8,
+        Xbyak::util::r9, Xbyak::util::r10, Xbyak::util::r11, Xbyak::util::r12,
+    };
+
+    std::array<Xbyak::Reg64, count> result;
+    size_t i = 0;
+    for (const auto& reg : candidates) {
+        if (i == count) {
+            break;
+        }
+        if (std::find(excluded_idxes.begin(), excluded_idxes.end(), reg.getIdx()) == excluded_idxes.end()) {
+            result[i++] = reg;
+        }
+    }
+    ASSERT(i == count);
+    return result;
+}
+
+/// Copies `bytes` bytes between buffers, with the copy split as the bits of count (< bytes) dictate.
+inline void EmitStraddleCopy(BlockOfCode& code, size_t bytes, Xbyak::Reg64 dest, Xbyak::Reg64 src, Xbyak::Reg64 count, Xbyak::Reg64 tmp) {
+    for (size_t width = bytes / 2; width >= 1; width /= 2) {
+        Xbyak::Label skip;
+        code.test(count.cvt32(), static_cast<u32>(width));
+        code.jz(skip);
+        switch (width) {
+        case 8:
+            code.mov(tmp, code.qword[src]);
+            code.mov(code.qword[dest], tmp);
+            break;
+        case 4:
+            code.mov(tmp.cvt32(), code.dword[src]);
+            code.mov(code.dword[dest], tmp.cvt32());
+            break;
+        case 2:
+            code.mov(tmp.cvt16(), code.word[src]);
+            code.mov(code.word[dest], tmp.cvt16());
+            break;
+        case 1:
+            code.mov(tmp.cvt8(), code.byte[src]);
+            code.mov(code.byte[dest], tmp.cvt8());
+            break;
+        }
+        code.add(src, static_cast<u32>(width));
+        code.add(dest, static_cast<u32>(width));
+        code.L(skip);
+    }
+}
+
+/// Copies a naturally aligned chunk of `bytes` bytes from src to dest.
+inline void EmitStraddleChunkCopy(BlockOfCode& code, size_t bytes, const Xbyak::RegExp& dest, const Xbyak::RegExp& src, Xbyak::Reg64 tmp) {
+    switch (bytes) {
+    case 2:
+        code.mov(tmp.cvt16(), code.word[src]);
+        code.mov(code.word[dest], tmp.cvt16());
+        return;
+    case 4:
+        code.mov(tmp.cvt32(), code.dword[src]);
+        code.mov(code.dword[dest], tmp.cvt32());
+        return;
+    case 8:
+        code.mov(tmp, code.qword[src]);
+        code.mov(code.qword[dest], tmp);
+        return;
+    case 16:
+        code.mov(tmp, code.qword[src]);
+        code.mov(code.qword[dest], tmp);
+        code.mov(tmp, code.qword[src + 8]);
+        code.mov(code.qword[dest + 8], tmp);
+        return;
+    default:
+        ASSERT_FALSE("Invalid bytes");
+    }
+}
+
+constexpr u32 page_mask = 0xFFF;
+constexpr int straddle_buffer_size = 32;
+
+} // namespace detail
+
+/// Reads the `bitsize`-bit value at vaddr (which is known to straddle a page boundary) into value.
+/// Both naturally aligned chunks surrounding the boundary are copied to the stack, and the
+/// value is then loaded from the appropriate offset. Jumps to end on success, abort otherwise.
+template<typename PageLookupFn>
+void EmitStraddledMemoryRead(BlockOfCode& code, size_t bitsize, Xbyak::Label& abort, Xbyak::Label& end, Xbyak::Reg64 vaddr, const Xbyak::Reg& value, PageLookupFn lookup) {
+    const size_t bytes = bitsize / 8;
+    const auto [addr, host_ptr, tmp] = value.isXMM()
+                                     ? detail::ChooseStraddleScratch<3>({vaddr.getIdx()})
+                                     : detail::ChooseStraddleScratch<3>({vaddr.getIdx(), value.getIdx()});
+
+    Xbyak::Label fail;
+
+    code.push(addr);
+    code.push(host_ptr);
+    code.push(tmp);
+    code.sub(code.rsp, detail::straddle_buffer_size);
+
+    code.mov(addr, vaddr);
+    code.and_(addr, ~static_cast<u32>(bytes - 1));
+    lookup(host_ptr, addr, tmp, fail);
+    detail::EmitStraddleChunkCopy(code, bytes, code.rsp, host_ptr, tmp);
+
+    code.add(addr, static_cast<u32>(bytes));
+    lookup(host_ptr, addr, tmp, fail);
+    detail::EmitStraddleChunkCopy(code, bytes, code.rsp + bytes, host_ptr, tmp);
+
+    code.mov(tmp.cvt32(), vaddr.cvt32());
+    code.and_(tmp.cvt32(), static_cast<u32>(bytes - 1));
+    switch (bitsize) {
+    case 16:
+        code.movzx(Xbyak::Reg32{value.getIdx()}, code.word[code.rsp + tmp]);
+        break;
+    case 32:
+        code.mov(Xbyak::Reg32{value.getIdx()}, code.dword[code.rsp + tmp]);
+        break;
+    case 64:
+        code.mov(Xbyak::Reg64{value.getIdx()}, code.qword[code.rsp + tmp]);
+        break;
+    case 128:
+        code.movups(Xbyak::Xmm{value.getIdx()}, code.xword[code.rsp + tmp]);
+        break;
+    default:
+        ASSERT_FALSE("Invalid bitsize");
+    }
+
+    code.add(code.rsp, detail::straddle_buffer_size);
+    code.pop(tmp);
+    code.pop(host_ptr);
+    code.pop(addr);
+    code.jmp(end, code.T_NEAR);
+
+    code.L(fail);
+    code.add(code.rsp, detail::straddle_buffer_size);
+    code.pop(tmp);
+    code.pop(host_ptr);
+    code.pop(addr);
+    code.jmp(abort, code.T_NEAR);
+}
+
+/// Writes the `bitsize`-bit value to vaddr (which is known to straddle a page boundary).
+/// Both pages are looked up before any memory is modified, and only the bytes belonging to the
+/// access are written. Jumps to end on success, abort otherwise.
+template<typename PageLookupFn>
+void EmitStraddledMemoryWrite(BlockOfCode& code, size_t bitsize, Xbyak::Label& abort, Xbyak::Label& end, Xbyak::Reg64 vaddr, const Xbyak::Reg& value, PageLookupFn lookup) {
+    const size_t bytes = bitsize / 8;
+    const auto [lo_ptr, hi_ptr, count, src, tmp] = value.isXMM()
+                                                 ? detail::ChooseStraddleScratch<5>({vaddr.getIdx()})
+                                                 : detail::ChooseStraddleScratch<5>({vaddr.getIdx(), value.getIdx()});
+
+    Xbyak::Label fail;
+
+    code.push(lo_ptr);
+    code.push(hi_ptr);
+    code.push(count);
+    code.push(src);
+    code.push(tmp);
+    code.sub(code.rsp, detail::straddle_buffer_size);
+
+    // count = number of bytes before the page boundary
+    code.mov(count, vaddr);
+    code.neg(count);
+    code.and_(count.cvt32(), detail::page_mask);
+
+    lookup(lo_ptr, vaddr, tmp, fail);
+    code.lea(src, code.ptr[vaddr + count]);
+    lookup(hi_ptr, src, tmp, fail);
+
+    switch (bitsize) {
+    case 16:
+        code.mov(code.word[code.rsp], Xbyak::Reg16{value.getIdx()});
+        break;
+    case 32:
+        code.mov(code.dword[code.rsp], Xbyak::Reg32{value.getIdx()});
+        break;
+    case 64:
+        code.mov(code.qword[code.rsp], Xbyak::Reg64{value.getIdx()});
+        break;
+    case 128:
+        code.movups(code.xword[code.rsp], Xbyak::Xmm{value.getIdx()});
+        break;
+    default:
+        ASSERT_FALSE("Invalid bitsize");
+    }
+
+    code.mov(src, code.rsp);
+    detail::EmitStraddleCopy(code, bytes, lo_ptr, src, count, tmp);
+    code.neg(count);
+    code.add(count, static_cast<u32>(bytes));
+    detail::EmitStraddleCopy(code, bytes, hi_ptr, src, count, tmp);
+
+    code.add(code.rsp, detail::straddle_buffer_size);
+    code.pop(tmp);
+    code.pop(src);
+    code.pop(count);
+    code.pop(hi_ptr);
+    code.pop(lo_ptr);
+    code.jmp(end, code.T_NEAR);
+
+    code.L(fail);
+    code.add(code.rsp, detail::straddle_buffer_size);
+    code.pop(tmp);
+    code.pop(src);
+    code.pop(count);
+    code.pop(hi_ptr);
+    code.pop(lo_ptr);
+    code.jmp(abort, code.T_NEAR);
+}
+
+} // namespace Dynarmic::Backend::X64
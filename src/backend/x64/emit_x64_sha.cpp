@@ -0,0 +1,181 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include <array>
+
+#include "backend/x64/abi.h"
+#include "backend/x64/block_of_code.h"
+#include "backend/x64/emit_x64.h"
+#include "common/common_types.h"
+#include "common/crypto/sha.h"
+#include "frontend/ir/microinstruction.h"
+
+namespace Dynarmic::Backend::X64 {
+
+using namespace Xbyak::util;
+namespace SHA = Common::Crypto::SHA;
+
+template<typename Fn>
+static void EmitSHAFunction(EmitContext& ctx, BlockOfCode& code, IR::Inst* inst, Fn fn) {
+    constexpr size_t state_size = sizeof(SHA::State);
+
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const size_t num_args = inst->NumArgs();
+    const u32 stack_space = static_cast<u32>(state_size * (num_args + 1));
+
+    std::array<Xbyak::Xmm, 3> inputs;
+    for (size_t i = 0; i < num_args; i++) {
+        inputs[i] = ctx.reg_alloc.UseXmm(args[i]);
+    }
+    const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+    ctx.reg_alloc.EndOfAllocScope();
+
+    ctx.reg_alloc.HostCall(nullptr);
+    code.sub(rsp, stack_space + ABI_SHADOW_SPACE);
+
+    for (size_t i = 0; i < num_args; i++) {
+        code.movaps(xword[rsp + ABI_SHADOW_SPACE + state_size * (i + 1)], inputs[i]);
+        code.lea(code.ABI_PARAMS[i + 1], ptr[rsp + ABI_SHADOW_SPACE + state_size * (i + 1)]);
+    }
+    code.lea(code.ABI_PARAM1, ptr[rsp + ABI_SHADOW_SPACE]);
+    code.CallFunction(fn);
+    code.movaps(result, xword[rsp + ABI_SHADOW_SPACE]);
+
+    code.add(rsp, stack_space + ABI_SHADOW_SPACE);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+// sha1rnds4 expects the hash state and message words in reverse word order, adds the round
+// constant selected by its immediate itself, and takes e pre-added to the first message word.
+static void EmitSHA1HashUpdate(EmitContext& ctx, BlockOfCode& code, IR::Inst* inst, u8 function, u32 round_constant) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const Xbyak::Xmm x = ctx.reg_alloc.UseScratchXmm(args[0]);
+    const Xbyak::Xmm y = ctx.reg_alloc.UseScratchXmm(args[1]);
+    const Xbyak::Xmm w = ctx.reg_alloc.UseScratchXmm(args[2]);
+
+    code.pshufd(x, x, 0b00011011);
+    code.pshufd(w, w, 0b00011011);
+    const u64 round_constants = u64{round_constant} << 32 | round_constant;
+    code.psubd(w, code.MConst(xword, round_constants, round_constants));
+    code.pslldq(y, 12);
+    code.paddd(w, y);
+    code.sha1rnds4(x, w, function);
+    code.pshufd(x, x, 0b00011011);
+
+    ctx.reg_alloc.DefineValue(inst, x);
+}
+
+void EmitX64::EmitSHA1HashUpdateChoose(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasSHA()) {
+        EmitSHA1HashUpdate(ctx, code, inst, 0, 0x5A827999);
+        return;
+    }
+
+    EmitSHAFunction(ctx, code, inst, SHA::SHA1HashUpdateChoose);
+}
+
+void EmitX64::EmitSHA1HashUpdateMajority(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasSHA()) {
+        EmitSHA1HashUpdate(ctx, code, inst, 2, 0x8F1BBCDC);
+        return;
+    }
+
+    EmitSHAFunction(ctx, code, inst, SHA::SHA1HashUpdateMajority);
+}
+
+void EmitX64::EmitSHA1HashUpdateParity(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasSHA()) {
+        EmitSHA1HashUpdate(ctx, code, inst, 1, 0x6ED9EBA1);
+        return;
+    }
+
+    EmitSHAFunction(ctx, code, inst, SHA::SHA1HashUpdateParity);
+}
+
+// sha256rnds2 operates on the state split as (a, b, e, f) and (c, d, g, h), each with the
+// earlier letters in the upper words, and performs two rounds using the low two words of xmm0.
+static void EmitSHA256Hash(EmitContext& ctx, BlockOfCode& code, IR::Inst* inst, bool part1) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const Xbyak::Xmm x = ctx.reg_alloc.UseXmm(args[0]);
+    const Xbyak::Xmm y = ctx.reg_alloc.UseXmm(args[1]);
+    const Xbyak::Xmm w = ctx.reg_alloc.UseXmm(args[2]);
+    const Xbyak::Xmm abef = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm cdgh = ctx.reg_alloc.ScratchXmm();
+
+    code.movaps(abef, y);
+    code.shufps(abef, x, 0b00010001);
+    code.movaps(cdgh, y);
+    code.shufps(cdgh, x, 0b10111011);
+
+    code.movaps(xmm0, w);
+    code.sha256rnds2(cdgh, abef);
+    code.pshufd(xmm0, w, 0b00001110);
+    code.sha256rnds2(abef, cdgh);
+
+    // abef now holds the updated (a, b, e, f) and cdgh holds the updated (c, d, g, h).
+    code.shufps(abef, cdgh, part1 ? 0b10111011 : 0b00010001);
+
+    ctx.reg_alloc.DefineValue(inst, abef);
+}
+
+void EmitX64::EmitSHA256HashPart1(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasSHA()) {
+        EmitSHA256Hash(ctx, code, inst, true);
+        return;
+    }
+
+    EmitSHAFunction(ctx, code, inst, SHA::SHA256HashPart1);
+}
+
+void EmitX64::EmitSHA256HashPart2(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasSHA()) {
+        EmitSHA256Hash(ctx, code, inst, false);
+        return;
+    }
+
+    EmitSHAFunction(ctx, code, inst, SHA::SHA256HashPart2);
+}
+
+void EmitX64::EmitSHA256MessageSchedule0(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasSHA()) {
+        auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+        const Xbyak::Xmm d = ctx.reg_alloc.UseScratchXmm(args[0]);
+        const Xbyak::Xmm n = ctx.reg_alloc.UseXmm(args[1]);
+
+        code.sha256msg1(d, n);
+
+        ctx.reg_alloc.DefineValue(inst, d);
+        return;
+    }
+
+    EmitSHAFunction(ctx, code, inst, SHA::SHA256MessageSchedule0);
+}
+
+void EmitX64::EmitSHA256MessageSchedule1(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasSHA() && code.HasSSSE3()) {
+        auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+        const Xbyak::Xmm d = ctx.reg_alloc.UseXmm(args[0]);
+        const Xbyak::Xmm n = ctx.reg_alloc.UseXmm(args[1]);
+        const Xbyak::Xmm m = ctx.reg_alloc.UseXmm(args[2]);
+        const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+
+        code.movdqa(result, m);
+        code.palignr(result, n, 4);
+        code.paddd(result, d);
+        code.sha256msg2(result, m);
+
+        ctx.reg_alloc.DefineValue(inst, result);
+        return;
+    }
+
+    EmitSHAFunction(ctx, code, inst, SHA::SHA256MessageSchedule1);
+}
+
+} // namespace Dynarmic::Backend::X64
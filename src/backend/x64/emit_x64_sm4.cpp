@@ -3,18 +3,151 @@
  * SPDX-License-Identifier: 0BSD
  */
 
+#include <algorithm>
+#include <array>
+#include <initializer_list>
+
+#include "backend/x64/abi.h"
 #include "backend/x64/block_of_code.h"
 #include "backend/x64/emit_x64.h"
+#include "common/common_types.h"
 #include "common/crypto/sm4.h"
 #include "frontend/ir/microinstruction.h"
 
 namespace Dynarmic::Backend::X64 {
 
-void EmitX64::EmitSM4AccessSubstitutionBox(EmitContext& ctx, IR::Inst* inst) {
+using namespace Xbyak::util;
+namespace SM4 = Common::Crypto::SM4;
+
+using SM4Fn = void(SM4::State&, const SM4::State&, const SM4::State&);
+
+static void EmitSM4Function(RegAlloc::ArgumentInfo args, EmitContext& ctx, BlockOfCode& code, IR::Inst* inst, SM4Fn fn) {
+    constexpr u32 stack_space = static_cast<u32>(sizeof(SM4::State)) * 3;
+    const Xbyak::Xmm state = ctx.reg_alloc.UseXmm(args[0]);
+    const Xbyak::Xmm round_keys = ctx.reg_alloc.UseXmm(args[1]);
+    const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+    ctx.reg_alloc.EndOfAllocScope();
+
+    ctx.reg_alloc.HostCall(nullptr);
+    code.sub(rsp, stack_space + ABI_SHADOW_SPACE);
+
+    code.lea(code.ABI_PARAM1, ptr[rsp + ABI_SHADOW_SPACE]);
+    code.lea(code.ABI_PARAM2, ptr[rsp + ABI_SHADOW_SPACE + sizeof(SM4::State)]);
+    code.lea(code.ABI_PARAM3, ptr[rsp + ABI_SHADOW_SPACE + sizeof(SM4::State) * 2]);
+    code.movaps(xword[code.ABI_PARAM2], state);
+    code.movaps(xword[code.ABI_PARAM3], round_keys);
+    code.CallFunction(fn);
+    code.movaps(result, xword[rsp + ABI_SHADOW_SPACE]);
+
+    code.add(rsp, stack_space + ABI_SHADOW_SPACE);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+// The SM4 S-box is affine-equivalent to inversion in GF(2^8). Mapping from the SM4 field to the
+// AES field, it can be computed as post_affine(aes_inverse(pre_affine(x))), which GFNI computes
+// directly. Without GFNI we use the AES S-box (aesenclast) in place of inversion, with the affine
+// transforms (adjusted to undo the AES affine transform) performed using nibble lookup tables.
+static void EmitSM4SubstituteBytes(BlockOfCode& code, Xbyak::Xmm data, Xbyak::Xmm tmp1, Xbyak::Xmm tmp2) {
+    if (code.HasGFNI()) {
+        code.gf2p8affineqb(data, code.MConst(xword, 0x4C287DB91A22505D, 0x4C287DB91A22505D), 0x3E);
+        code.gf2p8affineinvqb(data, code.MConst(xword, 0xF3AB34A974A6B589, 0xF3AB34A974A6B589), 0xD3);
+        return;
+    }
+
+    const auto affine_transform = [&](u64 low_nibble_lo, u64 low_nibble_hi, u64 high_nibble_lo, u64 high_nibble_hi) {
+        code.movdqa(tmp1, data);
+        code.psrlw(tmp1, 4);
+        code.pand(data, code.MConst(xword, 0x0F0F0F0F0F0F0F0F, 0x0F0F0F0F0F0F0F0F));
+        code.pand(tmp1, code.MConst(xword, 0x0F0F0F0F0F0F0F0F, 0x0F0F0F0F0F0F0F0F));
+        code.movdqa(tmp2, code.MConst(xword, low_nibble_lo, low_nibble_hi));
+        code.pshufb(tmp2, data);
+        code.movdqa(data, code.MConst(xword, high_nibble_lo, high_nibble_hi));
+        code.pshufb(data, tmp1);
+        code.pxor(data, tmp2);
+    };
+
+    affine_transform(0x078B37BB820EB23E, 0x9814A8241D912DA1, 0x37EB19C5F22EDC00, 0x3FE311CDFA26D408);
+    // Every column holds the same word, so ShiftRows does not affect the result.
+    code.pshufd(data, data, 0);
+    code.pxor(tmp1, tmp1);
+    code.aesenclast(data, tmp1);
+    affine_transform(0x2098EA521EA6D46C, 0x47FF8D3579C1B30B, 0x2DCD7D9DB050E000, 0xED0DBD5D709020C0);
+}
+
+static void EmitSM4FourRounds(EmitContext& ctx, BlockOfCode& code, IR::Inst* inst, std::initializer_list<int> rotations, SM4Fn fallback_fn) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
 
-    ctx.reg_alloc.HostCall(inst, args[0]);
-    code.CallFunction(&Common::Crypto::SM4::AccessSubstitutionBox);
+    if (!code.HasGFNI() && !(code.HasAESNI() && code.HasSSSE3())) {
+        EmitSM4Function(args, ctx, code, inst, fallback_fn);
+        return;
+    }
+
+    const Xbyak::Xmm state = ctx.reg_alloc.UseScratchXmm(args[0]);
+    const Xbyak::Xmm round_keys = ctx.reg_alloc.UseXmm(args[1]);
+    const Xbyak::Xmm tmp1 = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm tmp2 = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm tmp3 = ctx.reg_alloc.ScratchXmm();
+    std::array<Xbyak::Reg32, 4> x;
+    for (auto& reg : x) {
+        reg = ctx.reg_alloc.ScratchGpr().cvt32();
+    }
+    const Xbyak::Reg32 b = ctx.reg_alloc.ScratchGpr().cvt32();
+    const Xbyak::Reg32 rotated = ctx.reg_alloc.ScratchGpr().cvt32();
+
+    code.movd(x[0], state);
+    for (u8 i = 1; i < 4; i++) {
+        code.pshufd(tmp1, state, i);
+        code.movd(x[i], tmp1);
+    }
+
+    for (u8 i = 0; i < 4; i++) {
+        if (i == 0) {
+            code.movd(b, round_keys);
+        } else {
+            code.pshufd(tmp1, round_keys, i);
+            code.movd(b, tmp1);
+        }
+        code.xor_(b, x[1]);
+        code.xor_(b, x[2]);
+        code.xor_(b, x[3]);
+
+        code.movd(tmp1, b);
+        EmitSM4SubstituteBytes(code, tmp1, tmp2, tmp3);
+        code.movd(b, tmp1);
+
+        code.xor_(x[0], b);
+        for (const int amount : rotations) {
+            if (code.HasBMI2()) {
+                code.rorx(rotated, b, amount);
+            } else {
+                code.mov(rotated, b);
+                code.ror(rotated, amount);
+            }
+            code.xor_(x[0], rotated);
+        }
+
+        // The new word enters at the top: [x0, x1, x2, x3] -> [x1, x2, x3, new x0]
+        std::rotate(x.begin(), x.begin() + 1, x.end());
+    }
+
+    code.movd(state, x[0]);
+    code.movd(tmp1, x[1]);
+    code.punpckldq(state, tmp1);
+    code.movd(tmp1, x[2]);
+    code.movd(tmp2, x[3]);
+    code.punpckldq(tmp1, tmp2);
+    code.punpcklqdq(state, tmp1);
+
+    ctx.reg_alloc.DefineValue(inst, state);
+}
+
+void EmitX64::EmitSM4EncryptFourRounds(EmitContext& ctx, IR::Inst* inst) {
+    EmitSM4FourRounds(ctx, code, inst, {30, 22, 14, 8}, SM4::EncryptFourRounds);
+}
+
+void EmitX64::EmitSM4ExpandKeyFourRounds(EmitContext& ctx, IR::Inst* inst) {
+    EmitSM4FourRounds(ctx, code, inst, {19, 9}, SM4::ExpandKeyFourRounds);
 }
 
 } // namespace Dynarmic::Backend::X64
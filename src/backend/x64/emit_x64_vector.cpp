@@ -6,6 +6,7 @@
 #include <algorithm>
 #include <bitset>
 #include <cstdlib>
+#include <tuple>
 #include <type_traits>
 
 #include <mp/traits/function_info.h>
@@ -125,6 +126,37 @@ static void EmitTwoArgumentFallbackWithSaturation(BlockOfCode& code, EmitContext
     ctx.reg_alloc.DefineValue(inst, result);
 }
 
+template <typename Lambda>
+static void EmitThreeArgumentFallbackWithSaturation(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, Lambda lambda) {
+    const auto fn = static_cast<mp::equivalent_function_type<Lambda>*>(lambda);
+    constexpr u32 stack_space = 4 * 16;
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const Xbyak::Xmm arg1 = ctx.reg_alloc.UseXmm(args[0]);
+    const Xbyak::Xmm arg2 = ctx.reg_alloc.UseXmm(args[1]);
+    const Xbyak::Xmm arg3 = ctx.reg_alloc.UseXmm(args[2]);
+    const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+    ctx.reg_alloc.EndOfAllocScope();
+
+    ctx.reg_alloc.HostCall(nullptr);
+    code.sub(rsp, stack_space + ABI_SHADOW_SPACE);
+    code.lea(code.ABI_PARAM1, ptr[rsp + ABI_SHADOW_SPACE + 0 * 16]);
+    code.lea(code.ABI_PARAM2, ptr[rsp + ABI_SHADOW_SPACE + 1 * 16]);
+    code.lea(code.ABI_PARAM3, ptr[rsp + ABI_SHADOW_SPACE + 2 * 16]);
+    code.lea(code.ABI_PARAM4, ptr[rsp + ABI_SHADOW_SPACE + 3 * 16]);
+
+    code.movaps(xword[code.ABI_PARAM2], arg1);
+    code.movaps(xword[code.ABI_PARAM3], arg2);
+    code.movaps(xword[code.ABI_PARAM4], arg3);
+    code.CallFunction(fn);
+    code.movaps(result, xword[rsp + ABI_SHADOW_SPACE + 0 * 16]);
+
+    code.add(rsp, stack_space + ABI_SHADOW_SPACE);
+
+    code.or_(code.byte[code.r15 + code.GetJitStateInfo().offsetof_fpsr_qc], code.ABI_RETURN.cvt8());
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
 template <typename Lambda>
 static void EmitTwoArgumentFallback(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, Lambda lambda) {
     const auto fn = static_cast<mp::equivalent_function_type<Lambda>*>(lambda);
@@ -442,8 +474,10 @@ static void ArithmeticShiftRightByte(EmitContext& ctx, BlockOfCode& code, const
     if (code.HasAVX512_Icelake()) {
         // Do a logical shift right upon the 8x8 bit-matrix, but shift in
         // `0x80` bytes into the matrix to repeat the most significant bit.
-        const u64 zero_extend = ~(0xFFFFFFFFFFFFFFFF << (shift_amount * 8)) & 0x8080808080808080;
-        const u64 shift_matrix = (0x0102040810204080 >> (shift_amount * 8)) | zero_extend;
+        // Shifting by 8 is the same as shifting by 7, and keeps the u64 shifts below 64.
+        const u8 shift = std::min<u8>(shift_amount, 7);
+        const u64 zero_extend = ~(0xFFFFFFFFFFFFFFFF << (shift * 8)) & 0x8080808080808080;
+        const u64 shift_matrix = (0x0102040810204080 << (shift * 8)) | zero_extend;
         code.vgf2p8affineqb(result, result, code.MConst(xword_b, shift_matrix), 0);
         return;
     }
@@ -541,7 +575,84 @@ static constexpr T VShift(T x, T y) {
     return static_cast<T>(static_cast<unsigned_type>(x) << static_cast<unsigned_type>(shift_amount));
 }
 
+// There are no variable shifts of bytes, so the even and odd bytes of each word are
+// shifted separately as 16-bit lanes. Rounding right shifts add in the last bit shifted out.
+// Requires AVX512BW.
+static void EmitVectorVShift8AVX512(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, bool is_signed, bool is_rounding = false) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const Xbyak::Xmm value = ctx.reg_alloc.UseXmm(args[0]);
+    const Xbyak::Xmm shift = ctx.reg_alloc.UseXmm(args[1]);
+    const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm half = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm left_shift = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm right_shift = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm mask = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm round = ctx.reg_alloc.ScratchXmm();
+
+    for (const bool odd : {false, true}) {
+        const u64 lane_mask = odd ? 0xFF00FF00FF00FF00 : 0x00FF00FF00FF00FF;
+        const u64 lane_lsb = odd ? 0x0100010001000100 : 0x0001000100010001;
+
+        if (odd) {
+            code.vpsrlw(left_shift, shift, 8);
+        } else {
+            code.vpand(left_shift, shift, code.MConst(xword, 0x00FF00FF00FF00FF, 0x00FF00FF00FF00FF));
+        }
+        code.vpxor(right_shift, right_shift, right_shift);
+        code.vpsubw(right_shift, right_shift, left_shift);
+        code.vpand(right_shift, right_shift, code.MConst(xword, 0x00FF00FF00FF00FF, 0x00FF00FF00FF00FF));
+        code.vpsllw(mask, left_shift, 8);
+        code.vpsraw(mask, mask, 15);
+
+        // Odd bytes are already in the upper half of the word, so are correctly sign-extended.
+        if (odd) {
+            code.vpand(half, value, code.MConst(xword, lane_mask, lane_mask));
+        } else if (is_signed) {
+            code.vpsllw(half, value, 8);
+            code.vpsraw(half, half, 8);
+        } else {
+            code.vpand(half, value, code.MConst(xword, lane_mask, lane_mask));
+        }
+
+        code.vpsllvw(left_shift, half, left_shift);
+        if (is_rounding) {
+            code.vpsubw(round, right_shift, code.MConst(xword, 0x0001000100010001, 0x0001000100010001));
+        }
+        if (is_signed) {
+            code.vpsravw(right_shift, half, right_shift);
+            if (is_rounding) {
+                code.vpsravw(round, half, round);
+            }
+        } else {
+            code.vpsrlvw(right_shift, half, right_shift);
+            if (is_rounding) {
+                code.vpsrlvw(round, half, round);
+            }
+        }
+        if (is_rounding) {
+            code.vpand(round, round, code.MConst(xword, lane_lsb, lane_lsb));
+            code.vpaddw(right_shift, right_shift, round);
+        }
+        code.vpblendvb(half, left_shift, right_shift, mask);
+
+        if (odd) {
+            code.vpand(half, half, code.MConst(xword, lane_mask, lane_mask));
+            code.vpor(result, result, half);
+        } else {
+            code.vpand(result, half, code.MConst(xword, lane_mask, lane_mask));
+        }
+    }
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
 void EmitX64::EmitVectorArithmeticVShift8(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasAVX512_Skylake()) {
+        EmitVectorVShift8AVX512(code, ctx, inst, true);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<s8>& result, const VectorArray<s8>& a, const VectorArray<s8>& b) {
         std::transform(a.begin(), a.end(), b.begin(), result.begin(), VShift<s8>);
     });
@@ -1574,6 +1685,11 @@ void EmitX64::EmitVectorLogicalShiftRight64(EmitContext& ctx, IR::Inst* inst) {
 }
 
 void EmitX64::EmitVectorLogicalVShift8(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasAVX512_Skylake()) {
+        EmitVectorVShift8AVX512(code, ctx, inst, false);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<u8>& result, const VectorArray<u8>& a, const VectorArray<u8>& b) {
         std::transform(a.begin(), a.end(), b.begin(), result.begin(), VShift<u8>);
     });
@@ -2416,16 +2532,75 @@ static void PairedMin(VectorArray<T>& result, const VectorArray<T>& x, const Vec
     PairedOperation(result, x, y, [](auto a, auto b) { return std::min(a, b); });
 }
 
+// Computes fn over adjacent pairs of bytes by widening each pair to 16-bit lanes.
+// fn must be a signed 16-bit operation; unsigned bytes are zero-extended so remain in range.
+template <typename Function>
+static void EmitVectorPairedMinMax8(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, bool is_signed, Function fn) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const Xbyak::Xmm x = ctx.reg_alloc.UseScratchXmm(args[0]);
+    const Xbyak::Xmm y = ctx.reg_alloc.UseScratchXmm(args[1]);
+    const Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+
+    for (const Xbyak::Xmm& operand : {x, y}) {
+        code.movdqa(tmp, operand);
+        if (is_signed) {
+            code.psllw(operand, 8);
+            code.psraw(operand, 8);
+            code.psraw(tmp, 8);
+        } else {
+            code.pand(operand, code.MConst(xword, 0x00FF00FF00FF00FF, 0x00FF00FF00FF00FF));
+            code.psrlw(tmp, 8);
+        }
+        (code.*fn)(operand, tmp);
+    }
+
+    if (is_signed) {
+        code.packsswb(x, y);
+    } else {
+        code.packuswb(x, y);
+    }
+
+    ctx.reg_alloc.DefineValue(inst, x);
+}
+
+// Computes fn over adjacent pairs of halfwords. The odd halfword of each pair is moved down
+// beside the even one, then the even results are packed together.
+template <typename Function>
+static void EmitVectorPairedMinMax16(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, bool is_signed, Function fn) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const Xbyak::Xmm x = ctx.reg_alloc.UseScratchXmm(args[0]);
+    const Xbyak::Xmm y = ctx.reg_alloc.UseScratchXmm(args[1]);
+    const Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+
+    for (const Xbyak::Xmm& operand : {x, y}) {
+        code.movdqa(tmp, operand);
+        code.psrld(tmp, 16);
+        (code.*fn)(operand, tmp);
+        code.pslld(operand, 16);
+        if (is_signed) {
+            code.psrad(operand, 16);
+        } else {
+            code.psrld(operand, 16);
+        }
+    }
+
+    if (is_signed) {
+        code.packssdw(x, y);
+    } else {
+        code.packusdw(x, y);
+    }
+
+    ctx.reg_alloc.DefineValue(inst, x);
+}
+
 void EmitX64::EmitVectorPairedMaxS8(EmitContext& ctx, IR::Inst* inst) {
-    EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<s8>& result, const VectorArray<s8>& a, const VectorArray<s8>& b) {
-        PairedMax(result, a, b);
-    });
+    EmitVectorPairedMinMax8(code, ctx, inst, true, &Xbyak::CodeGenerator::pmaxsw);
 }
 
 void EmitX64::EmitVectorPairedMaxS16(EmitContext& ctx, IR::Inst* inst) {
-    EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<s16>& result, const VectorArray<s16>& a, const VectorArray<s16>& b) {
-        PairedMax(result, a, b);
-    });
+    EmitVectorPairedMinMax16(code, ctx, inst, true, &Xbyak::CodeGenerator::pmaxsw);
 }
 
 void EmitX64::EmitVectorPairedMaxS32(EmitContext& ctx, IR::Inst* inst) {
@@ -2457,12 +2632,15 @@ void EmitX64::EmitVectorPairedMaxS32(EmitContext& ctx, IR::Inst* inst) {
 }
 
 void EmitX64::EmitVectorPairedMaxU8(EmitContext& ctx, IR::Inst* inst) {
-    EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<u8>& result, const VectorArray<u8>& a, const VectorArray<u8>& b) {
-        PairedMax(result, a, b);
-    });
+    EmitVectorPairedMinMax8(code, ctx, inst, false, &Xbyak::CodeGenerator::pmaxsw);
 }
 
 void EmitX64::EmitVectorPairedMaxU16(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasSSE41()) {
+        EmitVectorPairedMinMax16(code, ctx, inst, false, &Xbyak::CodeGenerator::pmaxuw);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<u16>& result, const VectorArray<u16>& a, const VectorArray<u16>& b) {
         PairedMax(result, a, b);
     });
@@ -2502,15 +2680,11 @@ void EmitX64::EmitVectorPairedMaxU32(EmitContext& ctx, IR::Inst* inst) {
 }
 
 void EmitX64::EmitVectorPairedMinS8(EmitContext& ctx, IR::Inst* inst) {
-    EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<s8>& result, const VectorArray<s8>& a, const VectorArray<s8>& b) {
-        PairedMin(result, a, b);
-    });
+    EmitVectorPairedMinMax8(code, ctx, inst, true, &Xbyak::CodeGenerator::pminsw);
 }
 
 void EmitX64::EmitVectorPairedMinS16(EmitContext& ctx, IR::Inst* inst) {
-    EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<s16>& result, const VectorArray<s16>& a, const VectorArray<s16>& b) {
-        PairedMin(result, a, b);
-    });
+    EmitVectorPairedMinMax16(code, ctx, inst, true, &Xbyak::CodeGenerator::pminsw);
 }
 
 void EmitX64::EmitVectorPairedMinS32(EmitContext& ctx, IR::Inst* inst) {
@@ -2542,12 +2716,15 @@ void EmitX64::EmitVectorPairedMinS32(EmitContext& ctx, IR::Inst* inst) {
 }
 
 void EmitX64::EmitVectorPairedMinU8(EmitContext& ctx, IR::Inst* inst) {
-    EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<u8>& result, const VectorArray<u8>& a, const VectorArray<u8>& b) {
-        PairedMin(result, a, b);
-    });
+    EmitVectorPairedMinMax8(code, ctx, inst, false, &Xbyak::CodeGenerator::pminsw);
 }
 
 void EmitX64::EmitVectorPairedMinU16(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasSSE41()) {
+        EmitVectorPairedMinMax16(code, ctx, inst, false, &Xbyak::CodeGenerator::pminuw);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<u16>& result, const VectorArray<u16>& a, const VectorArray<u16>& b) {
         PairedMin(result, a, b);
     });
@@ -2948,49 +3125,161 @@ static void RoundingShiftLeft(VectorArray<T>& out, const VectorArray<T>& lhs, co
     }
 }
 
+// Variable rounding shift using the AVX2 (and for 16-bit elements or 64-bit arithmetic shifts,
+// AVX512BW/VL) per-element shifts. The shift amount is the signed lowest byte of each element.
+static void EmitRoundingShiftLeft(size_t esize, bool is_signed, BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const Xbyak::Xmm value = ctx.reg_alloc.UseXmm(args[0]);
+    const Xbyak::Xmm shift = ctx.reg_alloc.UseScratchXmm(args[1]);
+    const Xbyak::Xmm mask = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm left = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm right = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm round = ctx.reg_alloc.ScratchXmm();
+
+    using ThreeOperandFn = void (Xbyak::CodeGenerator::*)(const Xbyak::Xmm&, const Xbyak::Xmm&, const Xbyak::Operand&);
+    const auto [count_mask, one, sub, add, shift_left, shift_right] = [&]() -> std::tuple<u64, u64, ThreeOperandFn, ThreeOperandFn, ThreeOperandFn, ThreeOperandFn> {
+        switch (esize) {
+        case 16:
+            return {0x00FF00FF00FF00FF, 0x0001000100010001, &Xbyak::CodeGenerator::vpsubw, &Xbyak::CodeGenerator::vpaddw,
+                    &Xbyak::CodeGenerator::vpsllvw, is_signed ? &Xbyak::CodeGenerator::vpsravw : &Xbyak::CodeGenerator::vpsrlvw};
+        case 32:
+            return {0x000000FF000000FF, 0x0000000100000001, &Xbyak::CodeGenerator::vpsubd, &Xbyak::CodeGenerator::vpaddd,
+                    &Xbyak::CodeGenerator::vpsllvd, is_signed ? &Xbyak::CodeGenerator::vpsravd : &Xbyak::CodeGenerator::vpsrlvd};
+        case 64:
+            return {0x00000000000000FF, 0x0000000000000001, &Xbyak::CodeGenerator::vpsubq, &Xbyak::CodeGenerator::vpaddq,
+                    &Xbyak::CodeGenerator::vpsllvq, is_signed ? &Xbyak::CodeGenerator::vpsravq : &Xbyak::CodeGenerator::vpsrlvq};
+        default:
+            UNREACHABLE();
+        }
+    }();
+
+    // mask has the sign bit of the shift amount in the most significant bit of each element
+    switch (esize) {
+    case 16:
+        code.vpsllw(mask, shift, 8);
+        code.vpsraw(mask, mask, 15);
+        break;
+    case 32:
+        code.vpslld(mask, shift, 24);
+        break;
+    case 64:
+        code.vpsllq(mask, shift, 56);
+        break;
+    }
+    code.vpand(shift, shift, code.MConst(xword, count_mask, count_mask));
+
+    // Non-negative shift amounts: a plain left shift, which produces zero for amounts >= esize.
+    (code.*shift_left)(left, value, shift);
+
+    // Negative shift amounts: shift right by n, then add in bit (n - 1) to round.
+    code.vpxor(right, right, right);
+    (code.*sub)(right, right, shift);
+    code.vpand(right, right, code.MConst(xword, count_mask, count_mask));
+    (code.*sub)(round, right, code.MConst(xword, one, one));
+    (code.*shift_right)(right, value, right);
+    (code.*shift_right)(round, value, round);
+    code.vpand(round, round, code.MConst(xword, one, one));
+    (code.*add)(right, right, round);
+
+    switch (esize) {
+    case 16:
+        code.vpblendvb(left, left, right, mask);
+        break;
+    case 32:
+        code.vblendvps(left, left, right, mask);
+        break;
+    case 64:
+        code.vblendvpd(left, left, right, mask);
+        break;
+    }
+
+    ctx.reg_alloc.DefineValue(inst, left);
+}
+
 void EmitX64::EmitVectorRoundingShiftLeftS8(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasAVX512_Skylake()) {
+        EmitVectorVShift8AVX512(code, ctx, inst, true, true);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<s8>& result, const VectorArray<s8>& lhs, const VectorArray<s8>& rhs) {
         RoundingShiftLeft(result, lhs, rhs);
     });
 }
 
 void EmitX64::EmitVectorRoundingShiftLeftS16(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasAVX512_Skylake()) {
+        EmitRoundingShiftLeft(16, true, code, ctx, inst);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<s16>& result, const VectorArray<s16>& lhs, const VectorArray<s16>& rhs) {
         RoundingShiftLeft(result, lhs, rhs);
     });
 }
 
 void EmitX64::EmitVectorRoundingShiftLeftS32(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasAVX2()) {
+        EmitRoundingShiftLeft(32, true, code, ctx, inst);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<s32>& result, const VectorArray<s32>& lhs, const VectorArray<s32>& rhs) {
         RoundingShiftLeft(result, lhs, rhs);
     });
 }
 
 void EmitX64::EmitVectorRoundingShiftLeftS64(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasAVX512_Skylake()) {
+        EmitRoundingShiftLeft(64, true, code, ctx, inst);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<s64>& result, const VectorArray<s64>& lhs, const VectorArray<s64>& rhs) {
         RoundingShiftLeft(result, lhs, rhs);
     });
 }
 
 void EmitX64::EmitVectorRoundingShiftLeftU8(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasAVX512_Skylake()) {
+        EmitVectorVShift8AVX512(code, ctx, inst, false, true);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<u8>& result, const VectorArray<u8>& lhs, const VectorArray<s8>& rhs) {
         RoundingShiftLeft(result, lhs, rhs);
     });
 }
 
 void EmitX64::EmitVectorRoundingShiftLeftU16(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasAVX512_Skylake()) {
+        EmitRoundingShiftLeft(16, false, code, ctx, inst);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<u16>& result, const VectorArray<u16>& lhs, const VectorArray<s16>& rhs) {
         RoundingShiftLeft(result, lhs, rhs);
     });
 }
 
 void EmitX64::EmitVectorRoundingShiftLeftU32(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasAVX2()) {
+        EmitRoundingShiftLeft(32, false, code, ctx, inst);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<u32>& result, const VectorArray<u32>& lhs, const VectorArray<s32>& rhs) {
         RoundingShiftLeft(result, lhs, rhs);
     });
 }
 
 void EmitX64::EmitVectorRoundingShiftLeftU64(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasAVX2()) {
+        EmitRoundingShiftLeft(64, false, code, ctx, inst);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<u64>& result, const VectorArray<u64>& lhs, const VectorArray<s64>& rhs) {
         RoundingShiftLeft(result, lhs, rhs);
     });
@@ -4005,6 +4294,280 @@ void EmitX64::EmitVectorSignedSaturatedNeg64(EmitContext& ctx, IR::Inst* inst) {
     });
 }
 
+template <typename T, bool subtract>
+static bool VectorSignedSaturatedRoundingDoublingMultiplyAccumulate(VectorArray<T>& result, const VectorArray<T>& addend, const VectorArray<T>& lhs, const VectorArray<T>& rhs) {
+    static_assert(std::is_same_v<T, s16> || std::is_same_v<T, s32>, "T must be s16 or s32.");
+
+    constexpr size_t bit_size = Common::BitSize<T>();
+    constexpr s64 min = std::numeric_limits<T>::min();
+    constexpr s64 max = std::numeric_limits<T>::max();
+
+    bool qc_flag = false;
+
+    for (size_t i = 0; i < result.size(); i++) {
+        const s64 product = static_cast<s64>(lhs[i]) * static_cast<s64>(rhs[i]);
+        const s64 doubled_high = ((subtract ? -product : product) + (s64(1) << (bit_size - 2))) >> (bit_size - 1);
+        const s64 sum = static_cast<s64>(addend[i]) + doubled_high;
+
+        if (sum > max) {
+            result[i] = static_cast<T>(max);
+            qc_flag = true;
+        } else if (sum < min) {
+            result[i] = static_cast<T>(min);
+            qc_flag = true;
+        } else {
+            result[i] = static_cast<T>(sum);
+        }
+    }
+
+    return qc_flag;
+}
+
+// Computes addend + ((±2 * a * b + rounding) >> esize) with saturation. The high half of the
+// rounded doubled product is formed exactly (see below), then accumulated with a saturating add.
+template <size_t esize, bool subtract>
+static void EmitVectorSignedSaturatedRoundingDoublingMultiplyAccumulate(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
+    static_assert(esize == 16 || esize == 32);
+
+    if ((esize == 16 && !code.HasSSSE3()) || (esize == 32 && !code.HasSSE41())) {
+        using T = std::conditional_t<esize == 16, s16, s32>;
+        EmitThreeArgumentFallbackWithSaturation(code, ctx, inst, VectorSignedSaturatedRoundingDoublingMultiplyAccumulate<T, subtract>);
+        return;
+    }
+
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const Xbyak::Xmm addend = ctx.reg_alloc.UseScratchXmm(args[0]);
+    const Xbyak::Xmm x = ctx.reg_alloc.UseScratchXmm(args[1]);
+    const Xbyak::Xmm y = ctx.reg_alloc.UseScratchXmm(args[2]);
+    const Xbyak::Xmm tmp1 = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm tmp2 = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Reg32 bit = ctx.reg_alloc.ScratchGpr().cvt32();
+
+    const u64 msb_mask = esize == 16 ? 0x8000800080008000 : 0x8000000080000000;
+    const u64 max_mask = ~msb_mask;
+
+    if constexpr (esize == 16) {
+        if constexpr (subtract) {
+            // Negating the pmulhrsw result rounds the wrong way only when the discarded bits are
+            // exactly one half, i.e. when the low 15 bits of the product are 0x4000.
+            code.movdqa(tmp1, x);
+            code.pmullw(tmp1, y);
+            code.pmulhrsw(x, y);
+            code.pand(tmp1, code.MConst(xword, 0x7FFF7FFF7FFF7FFF, 0x7FFF7FFF7FFF7FFF));
+            code.pcmpeqw(tmp1, code.MConst(xword, 0x4000400040004000, 0x4000400040004000));
+            code.paddw(x, tmp1);
+            code.pxor(tmp1, tmp1);
+            code.psubw(tmp1, x);
+            code.movdqa(x, tmp1);
+        } else {
+            // A result of 0x8000 here represents +0x8000, which is handled during accumulation.
+            code.pmulhrsw(x, y);
+        }
+    } else {
+        const Xbyak::Address rounding = code.MConst(xword, 0x0000000080000000, 0x0000000080000000);
+
+        code.movdqa(tmp1, x);
+        code.pmuldq(tmp1, y);
+        code.psrlq(x, 32);
+        code.psrlq(y, 32);
+        code.pmuldq(x, y);
+        code.paddq(tmp1, tmp1);
+        code.paddq(x, x);
+
+        if constexpr (subtract) {
+            code.movdqa(tmp2, rounding);
+            code.psubq(tmp2, tmp1);
+            code.movdqa(tmp1, rounding);
+            code.psubq(tmp1, x);
+            code.movdqa(x, tmp1);
+            code.movdqa(tmp1, tmp2);
+        } else {
+            // A result of 0x80000000 here represents +0x80000000, which is handled during accumulation.
+            code.paddq(tmp1, rounding);
+            code.paddq(x, rounding);
+        }
+
+        code.psrlq(tmp1, 32);
+        code.blendps(x, tmp1, 0b0101);
+    }
+
+    const auto add = [&](const Xbyak::Xmm& lhs, const Xbyak::Operand& rhs) {
+        esize == 16 ? code.paddw(lhs, rhs) : code.paddd(lhs, rhs);
+    };
+    const auto compare_equal = [&](const Xbyak::Xmm& lhs, const Xbyak::Operand& rhs) {
+        esize == 16 ? code.pcmpeqw(lhs, rhs) : code.pcmpeqd(lhs, rhs);
+    };
+    const auto arithmetic_shift_right = [&](const Xbyak::Xmm& reg) {
+        esize == 16 ? code.psraw(reg, 15) : code.psrad(reg, 31);
+    };
+
+    // x now holds the rounded high half of the doubled product.
+    code.movdqa(y, addend);
+    add(y, x);
+
+    // Signed overflow occurred if both inputs differ in sign from the wrapped sum.
+    code.movdqa(tmp1, addend);
+    code.pxor(tmp1, y);
+    code.movdqa(tmp2, x);
+    code.pxor(tmp2, y);
+    code.pand(tmp1, tmp2);
+
+    if constexpr (!subtract) {
+        // The high half is actually positive in this case, which inverts the overflow condition.
+        code.movdqa(tmp2, x);
+        compare_equal(tmp2, code.MConst(xword, msb_mask, msb_mask));
+        code.pxor(tmp1, tmp2);
+    }
+
+    arithmetic_shift_right(addend);
+    code.pxor(addend, code.MConst(xword, max_mask, max_mask));
+    arithmetic_shift_right(tmp1);
+
+    code.pmovmskb(bit, tmp1);
+    code.or_(code.dword[code.r15 + code.GetJitStateInfo().offsetof_fpsr_qc], bit);
+
+    code.pand(addend, tmp1);
+    code.pandn(tmp1, y);
+    code.por(tmp1, addend);
+
+    ctx.reg_alloc.DefineValue(inst, tmp1);
+}
+
+void EmitX64::EmitVectorSignedSaturatedRoundingDoublingMulAdd16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorSignedSaturatedRoundingDoublingMultiplyAccumulate<16, false>(code, ctx, inst);
+}
+
+void EmitX64::EmitVectorSignedSaturatedRoundingDoublingMulAdd32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorSignedSaturatedRoundingDoublingMultiplyAccumulate<32, false>(code, ctx, inst);
+}
+
+void EmitX64::EmitVectorSignedSaturatedRoundingDoublingMulSub16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorSignedSaturatedRoundingDoublingMultiplyAccumulate<16, true>(code, ctx, inst);
+}
+
+void EmitX64::EmitVectorSignedSaturatedRoundingDoublingMulSub32(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorSignedSaturatedRoundingDoublingMultiplyAccumulate<32, true>(code, ctx, inst);
+}
+
+// Variable saturating shift using the AVX2 (and for 8-bit and 16-bit elements or 64-bit arithmetic
+// shifts, AVX512BW/VL) per-element shifts. The shift amount is the signed lowest byte of each element.
+// A left shift saturates when shifting the result back does not recover the original value, which
+// also covers amounts of at least esize. Rounding right shifts add in the last bit shifted out.
+// Bytes are shifted as the upper halves of 16-bit lanes, so that bits leave the lane exactly when
+// they would leave the byte.
+static void EmitSaturatedShiftLeft(size_t esize, bool is_signed, bool is_rounding, BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const Xbyak::Xmm value = ctx.reg_alloc.UseXmm(args[0]);
+    const Xbyak::Xmm shift = ctx.reg_alloc.UseScratchXmm(args[1]);
+    const Xbyak::Xmm data = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm count = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm negative = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm left = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm right = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm round = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm unsaturated = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Reg32 bit = ctx.reg_alloc.ScratchGpr().cvt32();
+
+    using ThreeOperandFn = void (Xbyak::CodeGenerator::*)(const Xbyak::Xmm&, const Xbyak::Xmm&, const Xbyak::Operand&);
+    const size_t lane_size = esize == 8 ? 16 : esize;
+    const auto [count_mask, one, max, sub, add, compare_equal, compare_greater, shift_left, shift_right] = [&]() -> std::tuple<u64, u64, u64, ThreeOperandFn, ThreeOperandFn, ThreeOperandFn, ThreeOperandFn, ThreeOperandFn, ThreeOperandFn> {
+        switch (lane_size) {
+        case 16:
+            return {0x00FF00FF00FF00FF, 0x0001000100010001, 0x7FFF7FFF7FFF7FFF, &Xbyak::CodeGenerator::vpsubw, &Xbyak::CodeGenerator::vpaddw,
+                    &Xbyak::CodeGenerator::vpcmpeqw, &Xbyak::CodeGenerator::vpcmpgtw,
+                    &Xbyak::CodeGenerator::vpsllvw, is_signed ? &Xbyak::CodeGenerator::vpsravw : &Xbyak::CodeGenerator::vpsrlvw};
+        case 32:
+            return {0x000000FF000000FF, 0x0000000100000001, 0x7FFFFFFF7FFFFFFF, &Xbyak::CodeGenerator::vpsubd, &Xbyak::CodeGenerator::vpaddd,
+                    &Xbyak::CodeGenerator::vpcmpeqd, &Xbyak::CodeGenerator::vpcmpgtd,
+                    &Xbyak::CodeGenerator::vpsllvd, is_signed ? &Xbyak::CodeGenerator::vpsravd : &Xbyak::CodeGenerator::vpsrlvd};
+        case 64:
+            return {0x00000000000000FF, 0x0000000000000001, 0x7FFFFFFFFFFFFFFF, &Xbyak::CodeGenerator::vpsubq, &Xbyak::CodeGenerator::vpaddq,
+                    &Xbyak::CodeGenerator::vpcmpeqq, &Xbyak::CodeGenerator::vpcmpgtq,
+                    &Xbyak::CodeGenerator::vpsllvq, is_signed ? &Xbyak::CodeGenerator::vpsravq : &Xbyak::CodeGenerator::vpsrlvq};
+        default:
+            UNREACHABLE();
+        }
+    }();
+    // The lowest bit of each element, which for bytes is the lowest bit of the upper half of the lane.
+    const u64 element_lsb = esize == 8 ? 0x0100010001000100 : one;
+
+    // Shifts each lane of elements by the low byte of the same lane of amounts, leaving the result
+    // in left. Lanes with a non-negative amount that saturated are cleared in unsaturated.
+    const auto emit_shift = [&](const Xbyak::Xmm& elements, const Xbyak::Xmm& amounts) {
+        // negative is all ones in lanes with a negative shift amount
+        switch (lane_size) {
+        case 16:
+            code.vpsllw(negative, amounts, 8);
+            break;
+        case 32:
+            code.vpslld(negative, amounts, 24);
+            break;
+        case 64:
+            code.vpsllq(negative, amounts, 56);
+            break;
+        }
+        code.vpxor(tmp, tmp, tmp);
+        (code.*compare_greater)(negative, tmp, negative);
+        code.vpand(amounts, amounts, code.MConst(xword, count_mask, count_mask));
+
+        if (is_signed) {
+            (code.*compare_greater)(right, tmp, elements);
+            code.vpxor(right, right, code.MConst(xword, max, max));
+        } else {
+            code.vpcmpeqb(right, right, right);
+        }
+
+        (code.*shift_left)(left, elements, amounts);
+        (code.*shift_right)(tmp, left, amounts);
+        (code.*compare_equal)(tmp, tmp, elements);
+        code.vpblendvb(left, right, left, tmp);
+
+        code.vpor(tmp, tmp, negative);
+        code.vpand(unsaturated, unsaturated, tmp);
+
+        // Negative shift amounts shift right, which never saturates.
+        code.vpxor(right, right, right);
+        (code.*sub)(right, right, amounts);
+        code.vpand(right, right, code.MConst(xword, count_mask, count_mask));
+        if (is_rounding) {
+            (code.*sub)(round, right, code.MConst(xword, one, one));
+            (code.*shift_right)(round, elements, round);
+            code.vpand(round, round, code.MConst(xword, element_lsb, element_lsb));
+        }
+        (code.*shift_right)(right, elements, right);
+        if (is_rounding) {
+            (code.*add)(right, right, round);
+        }
+        code.vpblendvb(left, left, right, negative);
+    };
+
+    code.vpcmpeqb(unsaturated, unsaturated, unsaturated);
+
+    if (esize == 8) {
+        code.vpsllw(data, value, 8);
+        code.vpand(count, shift, code.MConst(xword, 0x00FF00FF00FF00FF, 0x00FF00FF00FF00FF));
+        emit_shift(data, count);
+        code.vpsrlw(result, left, 8);
+
+        code.vpand(data, value, code.MConst(xword, 0xFF00FF00FF00FF00, 0xFF00FF00FF00FF00));
+        code.vpsrlw(shift, shift, 8);
+        emit_shift(data, shift);
+        code.vpand(left, left, code.MConst(xword, 0xFF00FF00FF00FF00, 0xFF00FF00FF00FF00));
+        code.vpor(result, result, left);
+    } else {
+        emit_shift(value, shift);
+    }
+
+    code.vpmovmskb(bit, unsaturated);
+    code.xor_(bit, 0xFFFF);
+    code.or_(code.dword[code.r15 + code.GetJitStateInfo().offsetof_fpsr_qc], bit);
+
+    ctx.reg_alloc.DefineValue(inst, esize == 8 ? result : left);
+}
+
 // MSVC requires the capture within the saturate lambda, but it's
 // determined to be unnecessary via clang and GCC.
 #ifdef __clang__
@@ -4054,21 +4617,93 @@ static bool VectorSignedSaturatedShiftLeft(VectorArray<T>& dst, const VectorArra
 #endif
 
 void EmitX64::EmitVectorSignedSaturatedShiftLeft8(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasAVX512_Skylake()) {
+        EmitSaturatedShiftLeft(8, true, false, code, ctx, inst);
+        return;
+    }
+
     EmitTwoArgumentFallbackWithSaturation(code, ctx, inst, VectorSignedSaturatedShiftLeft<s8>);
 }
 
 void EmitX64::EmitVectorSignedSaturatedShiftLeft16(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasAVX512_Skylake()) {
+        EmitSaturatedShiftLeft(16, true, false, code, ctx, inst);
+        return;
+    }
+
     EmitTwoArgumentFallbackWithSaturation(code, ctx, inst, VectorSignedSaturatedShiftLeft<s16>);
 }
 
 void EmitX64::EmitVectorSignedSaturatedShiftLeft32(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasAVX2()) {
+        EmitSaturatedShiftLeft(32, true, false, code, ctx, inst);
+        return;
+    }
+
     EmitTwoArgumentFallbackWithSaturation(code, ctx, inst, VectorSignedSaturatedShiftLeft<s32>);
 }
 
 void EmitX64::EmitVectorSignedSaturatedShiftLeft64(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasAVX512_Skylake()) {
+        EmitSaturatedShiftLeft(64, true, false, code, ctx, inst);
+        return;
+    }
+
     EmitTwoArgumentFallbackWithSaturation(code, ctx, inst, VectorSignedSaturatedShiftLeft<s64>);
 }
 
+template <typename T>
+static bool VectorSignedSaturatedRoundingShiftLeft(VectorArray<T>& dst, const VectorArray<T>& data, const VectorArray<T>& shift_values) {
+    // Right shifts round and can never saturate; left shifts are identical to the non-rounding form.
+    VectorArray<T> rounded;
+    RoundingShiftLeft(rounded, data, shift_values);
+    const bool qc_flag = VectorSignedSaturatedShiftLeft(dst, data, shift_values);
+
+    for (size_t i = 0; i < dst.size(); i++) {
+        if (static_cast<T>(Common::SignExtend<8>(shift_values[i] & 0xFF)) < 0) {
+            dst[i] = rounded[i];
+        }
+    }
+
+    return qc_flag;
+}
+
+void EmitX64::EmitVectorSignedSaturatedRoundingShiftLeft8(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasAVX512_Skylake()) {
+        EmitSaturatedShiftLeft(8, true, true, code, ctx, inst);
+        return;
+    }
+
+    EmitTwoArgumentFallbackWithSaturation(code, ctx, inst, VectorSignedSaturatedRoundingShiftLeft<s8>);
+}
+
+void EmitX64::EmitVectorSignedSaturatedRoundingShiftLeft16(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasAVX512_Skylake()) {
+        EmitSaturatedShiftLeft(16, true, true, code, ctx, inst);
+        return;
+    }
+
+    EmitTwoArgumentFallbackWithSaturation(code, ctx, inst, VectorSignedSaturatedRoundingShiftLeft<s16>);
+}
+
+void EmitX64::EmitVectorSignedSaturatedRoundingShiftLeft32(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasAVX2()) {
+        EmitSaturatedShiftLeft(32, true, true, code, ctx, inst);
+        return;
+    }
+
+    EmitTwoArgumentFallbackWithSaturation(code, ctx, inst, VectorSignedSaturatedRoundingShiftLeft<s32>);
+}
+
+void EmitX64::EmitVectorSignedSaturatedRoundingShiftLeft64(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasAVX512_Skylake()) {
+        EmitSaturatedShiftLeft(64, true, true, code, ctx, inst);
+        return;
+    }
+
+    EmitTwoArgumentFallbackWithSaturation(code, ctx, inst, VectorSignedSaturatedRoundingShiftLeft<s64>);
+}
+
 template <typename T, typename U = std::make_unsigned_t<T>>
 static bool VectorSignedSaturatedShiftLeftUnsigned(VectorArray<T>& dst, const VectorArray<T>& data, const VectorArray<T>& shift_values) {
     static_assert(std::is_signed_v<T>, "T must be signed.");
@@ -4854,21 +5489,96 @@ static bool VectorUnsignedSaturatedShiftLeft(VectorArray<T>& dst, const VectorAr
 }
 
 void EmitX64::EmitVectorUnsignedSaturatedShiftLeft8(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasAVX512_Skylake()) {
+        EmitSaturatedShiftLeft(8, false, false, code, ctx, inst);
+        return;
+    }
+
     EmitTwoArgumentFallbackWithSaturation(code, ctx, inst, VectorUnsignedSaturatedShiftLeft<u8>);
 }
 
 void EmitX64::EmitVectorUnsignedSaturatedShiftLeft16(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasAVX512_Skylake()) {
+        EmitSaturatedShiftLeft(16, false, false, code, ctx, inst);
+        return;
+    }
+
     EmitTwoArgumentFallbackWithSaturation(code, ctx, inst, VectorUnsignedSaturatedShiftLeft<u16>);
 }
 
 void EmitX64::EmitVectorUnsignedSaturatedShiftLeft32(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasAVX2()) {
+        EmitSaturatedShiftLeft(32, false, false, code, ctx, inst);
+        return;
+    }
+
     EmitTwoArgumentFallbackWithSaturation(code, ctx, inst, VectorUnsignedSaturatedShiftLeft<u32>);
 }
 
 void EmitX64::EmitVectorUnsignedSaturatedShiftLeft64(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasAVX2()) {
+        EmitSaturatedShiftLeft(64, false, false, code, ctx, inst);
+        return;
+    }
+
     EmitTwoArgumentFallbackWithSaturation(code, ctx, inst, VectorUnsignedSaturatedShiftLeft<u64>);
 }
 
+template <typename T, typename S = std::make_signed_t<T>>
+static bool VectorUnsignedSaturatedRoundingShiftLeft(VectorArray<T>& dst, const VectorArray<T>& data, const VectorArray<T>& shift_values) {
+    // Right shifts round and can never saturate; left shifts are identical to the non-rounding form.
+    VectorArray<S> signed_shift_values;
+    std::transform(shift_values.begin(), shift_values.end(), signed_shift_values.begin(), [](T shift) { return static_cast<S>(shift); });
+
+    VectorArray<T> rounded;
+    RoundingShiftLeft(rounded, data, signed_shift_values);
+    const bool qc_flag = VectorUnsignedSaturatedShiftLeft(dst, data, shift_values);
+
+    for (size_t i = 0; i < dst.size(); i++) {
+        if (static_cast<S>(Common::SignExtend<8>(shift_values[i] & 0xFF)) < 0) {
+            dst[i] = rounded[i];
+        }
+    }
+
+    return qc_flag;
+}
+
+void EmitX64::EmitVectorUnsignedSaturatedRoundingShiftLeft8(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasAVX512_Skylake()) {
+        EmitSaturatedShiftLeft(8, false, true, code, ctx, inst);
+        return;
+    }
+
+    EmitTwoArgumentFallbackWithSaturation(code, ctx, inst, VectorUnsignedSaturatedRoundingShiftLeft<u8>);
+}
+
+void EmitX64::EmitVectorUnsignedSaturatedRoundingShiftLeft16(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasAVX512_Skylake()) {
+        EmitSaturatedShiftLeft(16, false, true, code, ctx, inst);
+        return;
+    }
+
+    EmitTwoArgumentFallbackWithSaturation(code, ctx, inst, VectorUnsignedSaturatedRoundingShiftLeft<u16>);
+}
+
+void EmitX64::EmitVectorUnsignedSaturatedRoundingShiftLeft32(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasAVX2()) {
+        EmitSaturatedShiftLeft(32, false, true, code, ctx, inst);
+        return;
+    }
+
+    EmitTwoArgumentFallbackWithSaturation(code, ctx, inst, VectorUnsignedSaturatedRoundingShiftLeft<u32>);
+}
+
+void EmitX64::EmitVectorUnsignedSaturatedRoundingShiftLeft64(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasAVX2()) {
+        EmitSaturatedShiftLeft(64, false, true, code, ctx, inst);
+        return;
+    }
+
+    EmitTwoArgumentFallbackWithSaturation(code, ctx, inst, VectorUnsignedSaturatedRoundingShiftLeft<u64>);
+}
+
 void EmitX64::EmitVectorZeroExtend8(EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
     const Xbyak::Xmm a = ctx.reg_alloc.UseScratchXmm(args[0]);
@@ -26,6 +26,7 @@
 #include "common/fp/fpcr.h"
 #include "common/fp/info.h"
 #include "common/fp/op.h"
+#include "common/fp/unpacked.h"
 #include "common/fp/util.h"
 #include "common/lut_from_list.h"
 #include "frontend/ir/basic_block.h"
@@ -59,12 +60,10 @@ void MaybeStandardFPSCRValue(BlockOfCode& code, EmitContext& ctx, bool fpcr_cont
     const bool switch_mxcsr = ctx.FPCR(fpcr_controlled) != ctx.FPCR();
 
     if (switch_mxcsr) {
-        code.EnterStandardASIMD();
-        lambda();
-        code.LeaveStandardASIMD();
-    } else {
-        lambda();
+        // The switch back to guest_MXCSR is deferred to the block emitter; see EmitContext::CanRemainInStandardASIMD.
+        ctx.EnterStandardASIMD(code);
     }
+    lambda();
 }
 
 template<size_t fsize, template<typename> class Indexer, size_t narg>
@@ -214,6 +213,8 @@ void ZeroIfNaN(BlockOfCode& code, Xbyak::Xmm result) {
     }
 }
 
+// MXCSR.DAZ is set whenever FPCR.FZ is, so this is only required where operands are inspected
+// bitwise; comparisons and arithmetic already see flushed inputs.
 template<size_t fsize>
 void DenormalsAreZero(BlockOfCode& code, FP::FPCR fpcr, std::initializer_list<Xbyak::Xmm> to_daz, Xbyak::Xmm tmp) {
     if (fpcr.FZ()) {
@@ -228,6 +229,15 @@ void DenormalsAreZero(BlockOfCode& code, FP::FPCR fpcr, std::initializer_list<Xb
     }
 }
 
+// Widening half-precision values to single-precision is exact (and quiets signalling NaNs, raising
+// Invalid Operation as required), so F16C lets us operate on the eight halves of value as two
+// vectors of singles.
+void WidenHalfVector(BlockOfCode& code, Xbyak::Xmm lower, Xbyak::Xmm upper, Xbyak::Xmm value) {
+    code.vcvtph2ps(lower, value);
+    code.vpshufd(upper, value, 0b11101110);
+    code.vcvtph2ps(upper, upper);
+}
+
 template<typename T>
 struct DefaultIndexer {
     std::tuple<T> operator()(size_t i, const VectorArray<T>& a) {
@@ -290,7 +300,7 @@ void EmitTwoOpVectorOperation(BlockOfCode& code, EmitContext& ctx, IR::Inst* ins
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
     const bool fpcr_controlled = args[fpcr_controlled_arg_index].GetImmediateU1();
 
-    if (ctx.FPCR(fpcr_controlled).DN()) {
+    if (ctx.FPCR(fpcr_controlled).DN() || ctx.HasOptimization(OptimizationFlag::Unsafe_InaccurateNaN)) {
         Xbyak::Xmm result;
 
         if constexpr (std::is_member_function_pointer_v<Function>) {
@@ -306,7 +316,9 @@ void EmitTwoOpVectorOperation(BlockOfCode& code, EmitContext& ctx, IR::Inst* ins
             });
         }
 
-        ForceToDefaultNaN<fsize>(code, ctx.FPCR(fpcr_controlled), result);
+        if (!ctx.HasOptimization(OptimizationFlag::Unsafe_InaccurateNaN)) {
+            ForceToDefaultNaN<fsize>(code, ctx.FPCR(fpcr_controlled), result);
+        }
 
         ctx.reg_alloc.DefineValue(inst, result);
         return;
@@ -342,7 +354,7 @@ void EmitThreeOpVectorOperation(BlockOfCode& code, EmitContext& ctx, IR::Inst* i
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
     const bool fpcr_controlled = args[2].GetImmediateU1();
 
-    if (ctx.FPCR(fpcr_controlled).DN()) {
+    if (ctx.FPCR(fpcr_controlled).DN() || ctx.HasOptimization(OptimizationFlag::Unsafe_InaccurateNaN)) {
         const Xbyak::Xmm xmm_a = ctx.reg_alloc.UseScratchXmm(args[0]);
         const Xbyak::Xmm xmm_b = ctx.reg_alloc.UseXmm(args[1]);
 
@@ -356,7 +368,9 @@ void EmitThreeOpVectorOperation(BlockOfCode& code, EmitContext& ctx, IR::Inst* i
             });
         }
 
-        ForceToDefaultNaN<fsize>(code, ctx.FPCR(fpcr_controlled), xmm_a);
+        if (!ctx.HasOptimization(OptimizationFlag::Unsafe_InaccurateNaN)) {
+            ForceToDefaultNaN<fsize>(code, ctx.FPCR(fpcr_controlled), xmm_a);
+        }
 
         ctx.reg_alloc.DefineValue(inst, xmm_a);
         return;
@@ -382,17 +396,10 @@ void EmitThreeOpVectorOperation(BlockOfCode& code, EmitContext& ctx, IR::Inst* i
     ctx.reg_alloc.DefineValue(inst, result);
 }
 
-template<size_t fpcr_controlled_arg_index = 1, typename Lambda>
-void EmitTwoOpFallback(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, Lambda lambda) {
+template<typename Lambda>
+void EmitTwoOpFallbackWithoutRegAlloc(BlockOfCode& code, EmitContext& ctx, Xbyak::Xmm result, Xbyak::Xmm arg1, Lambda lambda, bool fpcr_controlled) {
     const auto fn = static_cast<mp::equivalent_function_type<Lambda>*>(lambda);
 
-    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-    const bool fpcr_controlled = args[fpcr_controlled_arg_index].GetImmediateU1();
-    const Xbyak::Xmm arg1 = ctx.reg_alloc.UseXmm(args[0]);
-    const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
-    ctx.reg_alloc.EndOfAllocScope();
-    ctx.reg_alloc.HostCall(nullptr);
-
     constexpr u32 stack_space = 2 * 16;
     code.sub(rsp, stack_space + ABI_SHADOW_SPACE);
     code.lea(code.ABI_PARAM1, ptr[rsp + ABI_SHADOW_SPACE + 0 * 16]);
@@ -405,6 +412,18 @@ void EmitTwoOpFallback(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, Lamb
     code.movaps(result, xword[rsp + ABI_SHADOW_SPACE + 0 * 16]);
 
     code.add(rsp, stack_space + ABI_SHADOW_SPACE);
+}
+
+template<size_t fpcr_controlled_arg_index = 1, typename Lambda>
+void EmitTwoOpFallback(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, Lambda lambda) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const bool fpcr_controlled = args[fpcr_controlled_arg_index].GetImmediateU1();
+    const Xbyak::Xmm arg1 = ctx.reg_alloc.UseXmm(args[0]);
+    const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+    ctx.reg_alloc.EndOfAllocScope();
+    ctx.reg_alloc.HostCall(nullptr);
+
+    EmitTwoOpFallbackWithoutRegAlloc(code, ctx, result, arg1, lambda, fpcr_controlled);
 
     ctx.reg_alloc.DefineValue(inst, result);
 }
@@ -518,6 +537,114 @@ void EmitFourOpFallback(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, Lam
     ctx.reg_alloc.DefineValue(inst, result);
 }
 
+// Single precision has more than 2 * 11 + 2 significand bits, so rounding the single-precision
+// result of an addition, subtraction, multiplication, division or square root of widened halves
+// back to half precision gives the correctly rounded result in every rounding mode. None of these
+// intermediate results can be subnormal in single precision, so MXCSR.FTZ/DAZ have no effect.
+// FPCR.FZ16 cannot be honoured this way, and NaN results are recomputed in software.
+template<size_t nargs, typename Function, typename Lambda>
+void EmitHalfVectorOperation(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, Function fn, Lambda fallback_fn) {
+    static_assert(nargs == 1 || nargs == 2);
+
+    const bool fpcr_controlled = inst->GetArg(nargs).GetU1();
+    const FP::FPCR fpcr = ctx.FPCR(fpcr_controlled);
+
+    if (!code.HasF16C() || fpcr.FZ16()) {
+        if constexpr (nargs == 1) {
+            EmitTwoOpFallback(code, ctx, inst, fallback_fn);
+        } else {
+            EmitThreeOpFallback(code, ctx, inst, fallback_fn);
+        }
+        return;
+    }
+
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm upper = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm xmm_a = ctx.reg_alloc.UseXmm(args[0]);
+    const Xbyak::Xmm xmm_b = nargs == 2 ? ctx.reg_alloc.UseXmm(args[1]) : Xbyak::Xmm{};
+    const Xbyak::Xmm operand_lower = nargs == 2 ? ctx.reg_alloc.ScratchXmm() : Xbyak::Xmm{};
+    const Xbyak::Xmm operand_upper = nargs == 2 ? ctx.reg_alloc.ScratchXmm() : Xbyak::Xmm{};
+
+    Xbyak::Label end, fallback;
+
+    MaybeStandardFPSCRValue(code, ctx, fpcr_controlled, [&]{
+        WidenHalfVector(code, result, upper, xmm_a);
+        if constexpr (nargs == 1) {
+            fn(result);
+            fn(upper);
+        } else {
+            WidenHalfVector(code, operand_lower, operand_upper, xmm_b);
+            fn(result, operand_lower);
+            fn(upper, operand_upper);
+        }
+
+        if (fpcr.DN() || ctx.HasOptimization(OptimizationFlag::Unsafe_InaccurateNaN)) {
+            if (!ctx.HasOptimization(OptimizationFlag::Unsafe_InaccurateNaN)) {
+                ForceToDefaultNaN<32>(code, fpcr, result);
+                ForceToDefaultNaN<32>(code, fpcr, upper);
+            }
+        } else {
+            code.vcmpunordps(xmm0, result, upper);
+            code.vptest(xmm0, xmm0);
+            code.jnz(fallback, code.T_NEAR);
+        }
+
+        code.vcvtps2ph(result, result, 0b100);
+        code.vcvtps2ph(upper, upper, 0b100);
+        code.vpunpcklqdq(result, result, upper);
+        code.L(end);
+    });
+
+    if (!fpcr.DN() && !ctx.HasOptimization(OptimizationFlag::Unsafe_InaccurateNaN)) {
+        code.SwitchToFarCode();
+        code.L(fallback);
+        code.sub(rsp, 8);
+        ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, HostLocXmmIdx(result.getIdx()));
+        if constexpr (nargs == 1) {
+            EmitTwoOpFallbackWithoutRegAlloc(code, ctx, result, xmm_a, fallback_fn, fpcr_controlled);
+        } else {
+            EmitThreeOpFallbackWithoutRegAlloc(code, ctx, result, xmm_a, xmm_b, fallback_fn, fpcr_controlled);
+        }
+        ABI_PopCallerSaveRegistersAndAdjustStackExcept(code, HostLocXmmIdx(result.getIdx()));
+        code.add(rsp, 8);
+        code.jmp(end, code.T_NEAR);
+        code.SwitchToNearCode();
+    }
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+template<typename Function, typename Lambda>
+void EmitHalfVectorComparison(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, Function fn, Lambda fallback_fn) {
+    const bool fpcr_controlled = inst->GetArg(2).GetU1();
+
+    if (!code.HasF16C() || ctx.FPCR(fpcr_controlled).FZ16()) {
+        EmitThreeOpFallback(code, ctx, inst, fallback_fn);
+        return;
+    }
+
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const Xbyak::Xmm a = ctx.reg_alloc.UseXmm(args[0]);
+    const Xbyak::Xmm b = ctx.reg_alloc.UseXmm(args[1]);
+    const Xbyak::Xmm a_lower = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm a_upper = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm b_lower = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm b_upper = ctx.reg_alloc.ScratchXmm();
+
+    MaybeStandardFPSCRValue(code, ctx, fpcr_controlled, [&]{
+        WidenHalfVector(code, a_lower, a_upper, a);
+        WidenHalfVector(code, b_lower, b_upper, b);
+        fn(a_lower, b_lower);
+        fn(a_upper, b_upper);
+    });
+    code.vpackssdw(a_lower, a_lower, a_upper);
+
+    ctx.reg_alloc.DefineValue(inst, a_lower);
+}
+
 } // anonymous namespace
 
 void EmitX64::EmitFPVectorAbs16(EmitContext& ctx, IR::Inst* inst) {
@@ -553,6 +680,18 @@ void EmitX64::EmitFPVectorAbs64(EmitContext& ctx, IR::Inst* inst) {
     ctx.reg_alloc.DefineValue(inst, a);
 }
 
+// The software fallbacks for addition, subtraction and multiplication are fused multiply-adds with
+// an exactly representable third operand, which round only once.
+void EmitX64::EmitFPVectorAdd16(EmitContext& ctx, IR::Inst* inst) {
+    EmitHalfVectorOperation<2>(code, ctx, inst, [&](const Xbyak::Xmm& result, const Xbyak::Xmm& operand) {
+        code.vaddps(result, result, operand);
+    }, [](VectorArray<u16>& result, const VectorArray<u16>& op1, const VectorArray<u16>& op2, FP::FPCR fpcr, FP::FPSR& fpsr) {
+        for (size_t i = 0; i < result.size(); i++) {
+            result[i] = FP::FPMulAdd<u16>(op1[i], op2[i], FP::FPValue<u16, false, 0, 1>(), fpcr, fpsr);
+        }
+    });
+}
+
 void EmitX64::EmitFPVectorAdd32(EmitContext& ctx, IR::Inst* inst) {
     EmitThreeOpVectorOperation<32, DefaultIndexer>(code, ctx, inst, &Xbyak::CodeGenerator::addps);
 }
@@ -561,6 +700,16 @@ void EmitX64::EmitFPVectorAdd64(EmitContext& ctx, IR::Inst* inst) {
     EmitThreeOpVectorOperation<64, DefaultIndexer>(code, ctx, inst, &Xbyak::CodeGenerator::addpd);
 }
 
+void EmitX64::EmitFPVectorDiv16(EmitContext& ctx, IR::Inst* inst) {
+    EmitHalfVectorOperation<2>(code, ctx, inst, [&](const Xbyak::Xmm& result, const Xbyak::Xmm& operand) {
+        code.vdivps(result, result, operand);
+    }, [](VectorArray<u16>& result, const VectorArray<u16>& op1, const VectorArray<u16>& op2, FP::FPCR fpcr, FP::FPSR& fpsr) {
+        for (size_t i = 0; i < result.size(); i++) {
+            result[i] = FP::FPDiv(op1[i], op2[i], fpcr, fpsr);
+        }
+    });
+}
+
 void EmitX64::EmitFPVectorDiv32(EmitContext& ctx, IR::Inst* inst) {
     EmitThreeOpVectorOperation<32, DefaultIndexer>(code, ctx, inst, &Xbyak::CodeGenerator::divps);
 }
@@ -570,7 +719,9 @@ void EmitX64::EmitFPVectorDiv64(EmitContext& ctx, IR::Inst* inst) {
 }
 
 void EmitX64::EmitFPVectorEqual16(EmitContext& ctx, IR::Inst* inst) {
-    EmitThreeOpFallback(code, ctx, inst, [](VectorArray<u16>& result, const VectorArray<u16>& op1, const VectorArray<u16>& op2, FP::FPCR fpcr, FP::FPSR& fpsr) {
+    EmitHalfVectorComparison(code, ctx, inst, [&](const Xbyak::Xmm& a, const Xbyak::Xmm& b) {
+        code.vcmpeqps(a, a, b);
+    }, [](VectorArray<u16>& result, const VectorArray<u16>& op1, const VectorArray<u16>& op2, FP::FPCR fpcr, FP::FPSR& fpsr) {
         for (size_t i = 0; i < result.size(); i++) {
             result[i] = FP::FPCompareEQ(op1[i], op2[i], fpcr, fpsr) ? 0xFFFF : 0;
         }
@@ -581,10 +732,9 @@ void EmitX64::EmitFPVectorEqual32(EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
     const bool fpcr_controlled = args[2].GetImmediateU1();
     const Xbyak::Xmm a = ctx.reg_alloc.UseScratchXmm(args[0]);
-    const Xbyak::Xmm b = ctx.FPCR(fpcr_controlled).FZ() ? ctx.reg_alloc.UseScratchXmm(args[1]) : ctx.reg_alloc.UseXmm(args[1]);
+    const Xbyak::Xmm b = ctx.reg_alloc.UseXmm(args[1]);
 
     MaybeStandardFPSCRValue(code, ctx, fpcr_controlled, [&]{
-        DenormalsAreZero<32>(code, ctx.FPCR(fpcr_controlled), {a, b}, xmm0);
         code.cmpeqps(a, b);
     });
 
@@ -595,16 +745,88 @@ void EmitX64::EmitFPVectorEqual64(EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
     const bool fpcr_controlled = args[2].GetImmediateU1();
     const Xbyak::Xmm a = ctx.reg_alloc.UseScratchXmm(args[0]);
-    const Xbyak::Xmm b = ctx.FPCR(fpcr_controlled).FZ() ? ctx.reg_alloc.UseScratchXmm(args[1]) : ctx.reg_alloc.UseXmm(args[1]);
+    const Xbyak::Xmm b = ctx.reg_alloc.UseXmm(args[1]);
 
     MaybeStandardFPSCRValue(code, ctx, fpcr_controlled, [&]{
-        DenormalsAreZero<64>(code, ctx.FPCR(fpcr_controlled), {a, b}, xmm0);
         code.cmpeqpd(a, b);
     });
 
     ctx.reg_alloc.DefineValue(inst, a);
 }
 
+// Scaled sixteen-bit integers are exact in single precision, so these conversions round only once.
+template<bool unsigned_>
+static void EmitFPVectorFromFixed16(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
+    const size_t fbits = inst->GetArg(1).GetU8();
+    const FP::RoundingMode rounding_mode = static_cast<FP::RoundingMode>(inst->GetArg(2).GetU8());
+    const bool fpcr_controlled = inst->GetArg(3).GetU1();
+    ASSERT(rounding_mode == ctx.FPCR(fpcr_controlled).RMode());
+
+    if (code.HasF16C() && !ctx.FPCR(fpcr_controlled).FZ16()) {
+        auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+        const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+        const Xbyak::Xmm upper = ctx.reg_alloc.ScratchXmm();
+        const Xbyak::Xmm value = ctx.reg_alloc.UseXmm(args[0]);
+
+        code.vpshufd(upper, value, 0b11101110);
+        if constexpr (unsigned_) {
+            code.vpmovzxwd(result, value);
+            code.vpmovzxwd(upper, upper);
+        } else {
+            code.vpmovsxwd(result, value);
+            code.vpmovsxwd(upper, upper);
+        }
+
+        MaybeStandardFPSCRValue(code, ctx, fpcr_controlled, [&]{
+            code.vcvtdq2ps(result, result);
+            code.vcvtdq2ps(upper, upper);
+            if (fbits != 0) {
+                code.vmulps(result, result, GetVectorOf<32>(code, static_cast<u32>(127 - fbits) << 23));
+                code.vmulps(upper, upper, GetVectorOf<32>(code, static_cast<u32>(127 - fbits) << 23));
+            }
+            code.vcvtps2ph(result, result, 0b100);
+            code.vcvtps2ph(upper, upper, 0b100);
+            code.vpunpcklqdq(result, result, upper);
+        });
+
+        ctx.reg_alloc.DefineValue(inst, result);
+        return;
+    }
+
+    using fbits_list = mp::lift_sequence<std::make_index_sequence<17>>;
+
+    static const auto lut = Common::GenerateLookupTableFromList(
+        [](auto arg) {
+            return std::pair{
+                mp::lower_to_tuple_v<decltype(arg)>,
+                Common::FptrCast(
+                    [](VectorArray<u16>& output, const VectorArray<u16>& input, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                        constexpr size_t fbits = std::get<0>(mp::lower_to_tuple_v<decltype(arg)>);
+
+                        for (size_t i = 0; i < output.size(); ++i) {
+                            const s64 integer = unsigned_ ? static_cast<s64>(input[i]) : static_cast<s64>(static_cast<s16>(input[i]));
+                            if (integer == 0) {
+                                output[i] = FP::FPInfo<u16>::Zero(false);
+                                continue;
+                            }
+                            const FP::FPUnpacked value = FP::ToNormalized(integer < 0, -static_cast<int>(fbits), static_cast<u64>(integer < 0 ? -integer : integer));
+                            output[i] = FP::FPRound<u16>(value, fpcr, fpsr);
+                        }
+                    }
+                )
+            };
+        },
+        mp::cartesian_product<fbits_list>{}
+    );
+
+    EmitTwoOpFallback<3>(code, ctx, inst, lut.at(std::make_tuple(fbits)));
+}
+
+void EmitX64::EmitFPVectorFromSignedFixed16(EmitContext& ctx, IR::Inst* inst) {
+    EmitFPVectorFromFixed16<false>(code, ctx, inst);
+}
+
 void EmitX64::EmitFPVectorFromSignedFixed32(EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
     const Xbyak::Xmm xmm = ctx.reg_alloc.UseScratchXmm(args[0]);
@@ -674,6 +896,10 @@ void EmitX64::EmitFPVectorFromSignedFixed64(EmitContext& ctx, IR::Inst* inst) {
     ctx.reg_alloc.DefineValue(inst, xmm);
 }
 
+void EmitX64::EmitFPVectorFromUnsignedFixed16(EmitContext& ctx, IR::Inst* inst) {
+    EmitFPVectorFromFixed16<true>(code, ctx, inst);
+}
+
 void EmitX64::EmitFPVectorFromUnsignedFixed32(EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
     const Xbyak::Xmm xmm = ctx.reg_alloc.UseScratchXmm(args[0]);
@@ -791,14 +1017,23 @@ void EmitX64::EmitFPVectorFromUnsignedFixed64(EmitContext& ctx, IR::Inst* inst)
     ctx.reg_alloc.DefineValue(inst, xmm);
 }
 
+void EmitX64::EmitFPVectorGreater16(EmitContext& ctx, IR::Inst* inst) {
+    EmitHalfVectorComparison(code, ctx, inst, [&](const Xbyak::Xmm& a, const Xbyak::Xmm& b) {
+        code.vcmpgtps(a, a, b);
+    }, [](VectorArray<u16>& result, const VectorArray<u16>& op1, const VectorArray<u16>& op2, FP::FPCR fpcr, FP::FPSR& fpsr) {
+        for (size_t i = 0; i < result.size(); i++) {
+            result[i] = FP::FPCompareGT(op1[i], op2[i], fpcr, fpsr) ? 0xFFFF : 0;
+        }
+    });
+}
+
 void EmitX64::EmitFPVectorGreater32(EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
     const bool fpcr_controlled = args[2].GetImmediateU1();
-    const Xbyak::Xmm a = ctx.FPCR(fpcr_controlled).FZ() ? ctx.reg_alloc.UseScratchXmm(args[0]) : ctx.reg_alloc.UseXmm(args[0]);
+    const Xbyak::Xmm a = ctx.reg_alloc.UseXmm(args[0]);
     const Xbyak::Xmm b = ctx.reg_alloc.UseScratchXmm(args[1]);
 
     MaybeStandardFPSCRValue(code, ctx, fpcr_controlled, [&]{
-        DenormalsAreZero<32>(code, ctx.FPCR(fpcr_controlled), {a, b}, xmm0);
         code.cmpltps(b, a);
     });
 
@@ -808,25 +1043,33 @@ void EmitX64::EmitFPVectorGreater32(EmitContext& ctx, IR::Inst* inst) {
 void EmitX64::EmitFPVectorGreater64(EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
     const bool fpcr_controlled = args[2].GetImmediateU1();
-    const Xbyak::Xmm a = ctx.FPCR(fpcr_controlled).FZ() ? ctx.reg_alloc.UseScratchXmm(args[0]) : ctx.reg_alloc.UseXmm(args[0]);
+    const Xbyak::Xmm a = ctx.reg_alloc.UseXmm(args[0]);
     const Xbyak::Xmm b = ctx.reg_alloc.UseScratchXmm(args[1]);
 
     MaybeStandardFPSCRValue(code, ctx, fpcr_controlled, [&]{
-        DenormalsAreZero<64>(code, ctx.FPCR(fpcr_controlled), {a, b}, xmm0);
         code.cmpltpd(b, a);
     });
 
     ctx.reg_alloc.DefineValue(inst, b);
 }
 
+void EmitX64::EmitFPVectorGreaterEqual16(EmitContext& ctx, IR::Inst* inst) {
+    EmitHalfVectorComparison(code, ctx, inst, [&](const Xbyak::Xmm& a, const Xbyak::Xmm& b) {
+        code.vcmpgeps(a, a, b);
+    }, [](VectorArray<u16>& result, const VectorArray<u16>& op1, const VectorArray<u16>& op2, FP::FPCR fpcr, FP::FPSR& fpsr) {
+        for (size_t i = 0; i < result.size(); i++) {
+            result[i] = FP::FPCompareGE(op1[i], op2[i], fpcr, fpsr) ? 0xFFFF : 0;
+        }
+    });
+}
+
 void EmitX64::EmitFPVectorGreaterEqual32(EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
     const bool fpcr_controlled = args[2].GetImmediateU1();
-    const Xbyak::Xmm a = ctx.FPCR(fpcr_controlled).FZ() ? ctx.reg_alloc.UseScratchXmm(args[0]) : ctx.reg_alloc.UseXmm(args[0]);
+    const Xbyak::Xmm a = ctx.reg_alloc.UseXmm(args[0]);
     const Xbyak::Xmm b = ctx.reg_alloc.UseScratchXmm(args[1]);
 
     MaybeStandardFPSCRValue(code, ctx, fpcr_controlled, [&]{
-        DenormalsAreZero<32>(code, ctx.FPCR(fpcr_controlled), {a, b}, xmm0);
         code.cmpleps(b, a);
     });
 
@@ -836,11 +1079,10 @@ void EmitX64::EmitFPVectorGreaterEqual32(EmitContext& ctx, IR::Inst* inst) {
 void EmitX64::EmitFPVectorGreaterEqual64(EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
     const bool fpcr_controlled = args[2].GetImmediateU1();
-    const Xbyak::Xmm a = ctx.FPCR(fpcr_controlled).FZ() ? ctx.reg_alloc.UseScratchXmm(args[0]) : ctx.reg_alloc.UseXmm(args[0]);
+    const Xbyak::Xmm a = ctx.reg_alloc.UseXmm(args[0]);
     const Xbyak::Xmm b = ctx.reg_alloc.UseScratchXmm(args[1]);
 
     MaybeStandardFPSCRValue(code, ctx, fpcr_controlled, [&]{
-        DenormalsAreZero<64>(code, ctx.FPCR(fpcr_controlled), {a, b}, xmm0);
         code.cmplepd(b, a);
     });
 
@@ -950,6 +1192,39 @@ static void EmitFPVectorMinMax(BlockOfCode& code, EmitContext& ctx, IR::Inst* in
     });
 }
 
+// vmaxps and vminps signal on quiet NaNs, so the operation is built from quiet comparisons instead.
+// NaN lanes are set to all-ones (a NaN) up front, and differently signed zeroes (which compare equal)
+// are combined bitwise to give the ARM result.
+template<bool is_max>
+static void EmitFPVectorMinMax16(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
+    EmitHalfVectorOperation<2>(code, ctx, inst, [&](const Xbyak::Xmm& result, const Xbyak::Xmm& operand) {
+        const Xbyak::Xmm tmp = xmm0;
+
+        code.vcmpunordps(tmp, result, operand);
+        code.vorps(operand, operand, tmp);
+        if constexpr (is_max) {
+            code.vcmpneqps(tmp, result, operand);
+            code.vorps(tmp, tmp, result);
+            code.vandps(operand, operand, tmp);
+            code.vcmplt_oqps(tmp, operand, result);
+        } else {
+            code.vcmpeqps(tmp, result, operand);
+            code.vandps(tmp, tmp, result);
+            code.vorps(operand, operand, tmp);
+            code.vcmplt_oqps(tmp, result, operand);
+        }
+        code.vblendvps(result, operand, result, tmp);
+    }, [](VectorArray<u16>& result, const VectorArray<u16>& op1, const VectorArray<u16>& op2, FP::FPCR fpcr, FP::FPSR& fpsr) {
+        for (size_t i = 0; i < result.size(); i++) {
+            result[i] = is_max ? FP::FPMax(op1[i], op2[i], fpcr, fpsr) : FP::FPMin(op1[i], op2[i], fpcr, fpsr);
+        }
+    });
+}
+
+void EmitX64::EmitFPVectorMax16(EmitContext& ctx, IR::Inst* inst) {
+    EmitFPVectorMinMax16<true>(code, ctx, inst);
+}
+
 void EmitX64::EmitFPVectorMax32(EmitContext& ctx, IR::Inst* inst) {
     EmitFPVectorMinMax<32, true>(code, ctx, inst);
 }
@@ -958,6 +1233,10 @@ void EmitX64::EmitFPVectorMax64(EmitContext& ctx, IR::Inst* inst) {
     EmitFPVectorMinMax<64, true>(code, ctx, inst);
 }
 
+void EmitX64::EmitFPVectorMin16(EmitContext& ctx, IR::Inst* inst) {
+    EmitFPVectorMinMax16<false>(code, ctx, inst);
+}
+
 void EmitX64::EmitFPVectorMin32(EmitContext& ctx, IR::Inst* inst) {
     EmitFPVectorMinMax<32, false>(code, ctx, inst);
 }
@@ -966,6 +1245,17 @@ void EmitX64::EmitFPVectorMin64(EmitContext& ctx, IR::Inst* inst) {
     EmitFPVectorMinMax<64, false>(code, ctx, inst);
 }
 
+// The addend is a zero of the same sign as the product, which preserves the sign of a zero product.
+void EmitX64::EmitFPVectorMul16(EmitContext& ctx, IR::Inst* inst) {
+    EmitHalfVectorOperation<2>(code, ctx, inst, [&](const Xbyak::Xmm& result, const Xbyak::Xmm& operand) {
+        code.vmulps(result, result, operand);
+    }, [](VectorArray<u16>& result, const VectorArray<u16>& op1, const VectorArray<u16>& op2, FP::FPCR fpcr, FP::FPSR& fpsr) {
+        for (size_t i = 0; i < result.size(); i++) {
+            result[i] = FP::FPMulAdd<u16>(FP::FPInfo<u16>::Zero(((op1[i] ^ op2[i]) & FP::FPInfo<u16>::sign_mask) != 0), op1[i], op2[i], fpcr, fpsr);
+        }
+    });
+}
+
 void EmitX64::EmitFPVectorMul32(EmitContext& ctx, IR::Inst* inst) {
     EmitThreeOpVectorOperation<32, DefaultIndexer>(code, ctx, inst, &Xbyak::CodeGenerator::mulps);
 }
@@ -1004,7 +1294,12 @@ void EmitFPVectorMulAdd(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
 
                 code.movaps(tmp, GetNegativeZeroVector<fsize>(code));
                 code.andnps(tmp, result);
-                FCODE(vcmpeq_uqp)(tmp, tmp, GetSmallestNormalVector<fsize>(code));
+                if (ctx.HasOptimization(OptimizationFlag::Unsafe_InaccurateNaN)) {
+                    // NaN results are left as-is.
+                    FCODE(vcmpeqp)(tmp, tmp, GetSmallestNormalVector<fsize>(code));
+                } else {
+                    FCODE(vcmpeq_uqp)(tmp, tmp, GetSmallestNormalVector<fsize>(code));
+                }
                 code.vptest(tmp, tmp);
                 code.jnz(fallback, code.T_NEAR);
                 code.L(end);
@@ -1054,6 +1349,64 @@ void EmitX64::EmitFPVectorMulAdd64(EmitContext& ctx, IR::Inst* inst) {
     EmitFPVectorMulAdd<64>(code, ctx, inst);
 }
 
+// The half-precision operands are widened exactly, so NaNs are the only results that differ from a
+// single-precision FMA: a signalling NaN operand must take priority over a quiet NaN addend.
+void EmitX64::EmitFPVectorMulAddLong32(EmitContext& ctx, IR::Inst* inst) {
+    const auto fallback_fn = [](VectorArray<u32>& result, const VectorArray<u32>& addend, const VectorArray<u16>& op1, const VectorArray<u16>& op2, FP::FPCR fpcr, FP::FPSR& fpsr) {
+        for (size_t i = 0; i < result.size(); i++) {
+            result[i] = FP::FPMulAddH(addend[i], op1[i], op2[i], fpcr, fpsr);
+        }
+    };
+
+    const bool fpcr_controlled = inst->GetArg(3).GetU1();
+
+    if (code.HasFMA() && code.HasAVX() && code.HasF16C() && !ctx.FPCR(fpcr_controlled).FZ16()) {
+        auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+        const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+        const Xbyak::Xmm xmm_a = ctx.reg_alloc.UseXmm(args[0]);
+        const Xbyak::Xmm xmm_b = ctx.reg_alloc.UseXmm(args[1]);
+        const Xbyak::Xmm xmm_c = ctx.reg_alloc.UseXmm(args[2]);
+        const Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+
+        Xbyak::Label end, fallback;
+
+        MaybeStandardFPSCRValue(code, ctx, fpcr_controlled, [&]{
+            code.vcvtph2ps(result, xmm_b);
+            code.vcvtph2ps(tmp, xmm_c);
+            code.vfmadd213ps(result, tmp, xmm_a);
+
+            // NaNs, and results that may need flushing or that are zero, are computed by the fallback.
+            code.movaps(tmp, GetNegativeZeroVector<32>(code));
+            code.andnps(tmp, result);
+            if (ctx.HasOptimization(OptimizationFlag::Unsafe_InaccurateNaN)) {
+                // NaN results are left as-is.
+                code.vcmpeqps(tmp, tmp, GetSmallestNormalVector<32>(code));
+            } else {
+                code.vcmpeq_uqps(tmp, tmp, GetSmallestNormalVector<32>(code));
+            }
+            code.vptest(tmp, tmp);
+            code.jnz(fallback, code.T_NEAR);
+            code.L(end);
+        });
+
+        code.SwitchToFarCode();
+        code.L(fallback);
+        code.sub(rsp, 8);
+        ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, HostLocXmmIdx(result.getIdx()));
+        EmitFourOpFallbackWithoutRegAlloc(code, ctx, result, xmm_a, xmm_b, xmm_c, fallback_fn, fpcr_controlled);
+        ABI_PopCallerSaveRegistersAndAdjustStackExcept(code, HostLocXmmIdx(result.getIdx()));
+        code.add(rsp, 8);
+        code.jmp(end, code.T_NEAR);
+        code.SwitchToNearCode();
+
+        ctx.reg_alloc.DefineValue(inst, result);
+        return;
+    }
+
+    EmitFourOpFallback(code, ctx, inst, fallback_fn);
+}
+
 template<size_t fsize>
 static void EmitFPVectorMulX(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
     using FPT = mp::unsigned_integer_of_size<fsize>;
@@ -1180,6 +1533,90 @@ void EmitX64::EmitFPVectorPairedAddLower64(EmitContext& ctx, IR::Inst* inst) {
     });
 }
 
+// For normal operands that produce normal results, FRECPE and FRSQRTE depend only on the sign,
+// the exponent and the upper eight bits of the fraction, so the estimates can be gathered from a
+// table. If any element is outside of this range, the whole vector is handled by the fallback.
+template<size_t fsize, typename Lambda>
+static void EmitEstimateLookup(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, bool rsqrt, const u32* table, Lambda fallback_fn) {
+    using FPT = mp::unsigned_integer_of_size<fsize>;
+    constexpr size_t mantissa_width = FP::FPInfo<FPT>::explicit_mantissa_width;
+    constexpr u64 bias = FP::FPInfo<FPT>::exponent_bias;
+
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const bool fpcr_controlled = args[1].GetImmediateU1();
+
+    Xbyak::Label end, fallback;
+
+    const Xbyak::Xmm operand = ctx.reg_alloc.UseXmm(args[0]);
+    const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm exponent = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm index = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm mask = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Reg64 table_ptr = ctx.reg_alloc.ScratchGpr();
+
+    // The biased exponent must be in [1, 2 * bias - 2] for FRECPE and [1, 2 * bias] for FRSQRTE.
+    // For FRSQRTE the sign bit is left above the exponent, so negative operands are out of range.
+    ICODE(vpsrl)(exponent, operand, u8(mantissa_width));
+    if (!rsqrt) {
+        code.vpand(exponent, exponent, GetVectorOf<fsize, (1 << FP::FPInfo<FPT>::exponent_width) - 1>(code));
+        ICODE(vpcmpgt)(mask, exponent, GetVectorOf<fsize, 2 * bias - 2>(code));
+    } else {
+        ICODE(vpcmpgt)(mask, exponent, GetVectorOf<fsize, 2 * bias>(code));
+    }
+    code.vpxor(index, index, index);
+    ICODE(vpcmpeq)(index, index, exponent);
+    code.vpor(mask, mask, index);
+    code.vptest(mask, mask);
+    code.jnz(fallback, code.T_NEAR);
+
+    ICODE(vpsrl)(index, operand, u8(mantissa_width - 8));
+    if (rsqrt) {
+        code.vpand(index, index, GetVectorOf<fsize, 0x1FF>(code));
+    } else {
+        code.vpand(index, index, GetVectorOf<fsize, 0xFF>(code));
+    }
+    code.mov(table_ptr, reinterpret_cast<u64>(table));
+    code.vpcmpeqd(mask, mask, mask);
+    if constexpr (fsize == 32) {
+        code.vpgatherdd(result, ptr[table_ptr + index * 4], mask);
+    } else {
+        // Each element also reads the following table entry into its upper half.
+        code.vpgatherqq(result, ptr[table_ptr + index * 4], mask);
+        code.vpand(result, result, GetVectorOf<fsize, 0xFF>(code));
+    }
+    ICODE(vpsll)(result, result, u8(mantissa_width - 8));
+
+    // FRECPE: result exponent = (2 * bias - 1) - exponent
+    // FRSQRTE: result exponent = ((3 * bias - 1) - exponent) / 2
+    if (rsqrt) {
+        code.vmovdqa(index, GetVectorOf<fsize, 3 * bias - 1>(code));
+        ICODE(vpsub)(index, index, exponent);
+        ICODE(vpsrl)(index, index, u8(1));
+    } else {
+        code.vmovdqa(index, GetVectorOf<fsize, 2 * bias - 1>(code));
+        ICODE(vpsub)(index, index, exponent);
+    }
+    ICODE(vpsll)(index, index, u8(mantissa_width));
+    code.vpor(result, result, index);
+    if (!rsqrt) {
+        code.vpand(index, operand, GetNegativeZeroVector<fsize>(code));
+        code.vpor(result, result, index);
+    }
+    code.L(end);
+
+    code.SwitchToFarCode();
+    code.L(fallback);
+    code.sub(rsp, 8);
+    ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, HostLocXmmIdx(result.getIdx()));
+    EmitTwoOpFallbackWithoutRegAlloc(code, ctx, result, operand, fallback_fn, fpcr_controlled);
+    ABI_PopCallerSaveRegistersAndAdjustStackExcept(code, HostLocXmmIdx(result.getIdx()));
+    code.add(rsp, 8);
+    code.jmp(end, code.T_NEAR);
+    code.SwitchToNearCode();
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
 template<size_t fsize>
 static void EmitRecipEstimate(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
     using FPT = mp::unsigned_integer_of_size<fsize>;
@@ -1203,11 +1640,20 @@ static void EmitRecipEstimate(BlockOfCode& code, EmitContext& ctx, IR::Inst* ins
         }
     }
 
-    EmitTwoOpFallback(code, ctx, inst, [](VectorArray<FPT>& result, const VectorArray<FPT>& operand, FP::FPCR fpcr, FP::FPSR& fpsr) {
+    const auto fallback_fn = [](VectorArray<FPT>& result, const VectorArray<FPT>& operand, FP::FPCR fpcr, FP::FPSR& fpsr) {
         for (size_t i = 0; i < result.size(); i++) {
             result[i] = FP::FPRecipEstimate<FPT>(operand[i], fpcr, fpsr);
         }
-    });
+    };
+
+    if constexpr (fsize != 16) {
+        if (code.HasAVX2()) {
+            EmitEstimateLookup<fsize>(code, ctx, inst, false, FP::FPRecipEstimateTable().data(), fallback_fn);
+            return;
+        }
+    }
+
+    EmitTwoOpFallback(code, ctx, inst, fallback_fn);
 }
 
 void EmitX64::EmitFPVectorRecipEstimate16(EmitContext& ctx, IR::Inst* inst) {
@@ -1306,28 +1752,56 @@ void EmitFPVectorRoundInt(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
     const auto rounding = static_cast<FP::RoundingMode>(inst->GetArg(1).GetU8());
     const bool exact = inst->GetArg(2).GetU1();
 
-    if constexpr (fsize != 16) {
-        if (code.HasSSE41() && rounding != FP::RoundingMode::ToNearest_TieAwayFromZero && !exact) {
-            const u8 round_imm = [&]() -> u8 {
-                switch (rounding) {
-                case FP::RoundingMode::ToNearest_TieEven:
-                    return 0b00;
-                case FP::RoundingMode::TowardsPlusInfinity:
-                    return 0b10;
-                case FP::RoundingMode::TowardsMinusInfinity:
-                    return 0b01;
-                case FP::RoundingMode::TowardsZero:
-                    return 0b11;
-                default:
-                    UNREACHABLE();
-                }
-            }();
-
-            EmitTwoOpVectorOperation<fsize, DefaultIndexer, 3>(code, ctx, inst, [&](const Xbyak::Xmm& result, const Xbyak::Xmm& xmm_a){
-                FCODE(roundp)(result, xmm_a, round_imm);
-            });
+    if (rounding != FP::RoundingMode::ToNearest_TieAwayFromZero) {
+        const u8 round_imm = [&]() -> u8 {
+            switch (rounding) {
+            case FP::RoundingMode::ToNearest_TieEven:
+                return 0b00;
+            case FP::RoundingMode::TowardsPlusInfinity:
+                return 0b10;
+            case FP::RoundingMode::TowardsMinusInfinity:
+                return 0b01;
+            case FP::RoundingMode::TowardsZero:
+                return 0b11;
+            default:
+                UNREACHABLE();
+            }
+        }();
+
+        if constexpr (fsize == 16) {
+            const bool fpcr_controlled = inst->GetArg(3).GetU1();
+
+            // Every integral value of a widened half is representable as a half, so narrowing
+            // the rounded singles is exact. The precision exception is only raised for FRINTX.
+            if (code.HasF16C() && !ctx.FPCR(fpcr_controlled).FZ16()) {
+                auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+                const Xbyak::Xmm value = ctx.reg_alloc.UseXmm(args[0]);
+                const Xbyak::Xmm lower = ctx.reg_alloc.ScratchXmm();
+                const Xbyak::Xmm upper = ctx.reg_alloc.ScratchXmm();
+
+                MaybeStandardFPSCRValue(code, ctx, fpcr_controlled, [&]{
+                    WidenHalfVector(code, lower, upper, value);
+                    code.vroundps(lower, lower, static_cast<u8>(round_imm | (exact ? 0b0000 : 0b1000)));
+                    code.vroundps(upper, upper, static_cast<u8>(round_imm | (exact ? 0b0000 : 0b1000)));
+                    ForceToDefaultNaN<32>(code, ctx.FPCR(fpcr_controlled), lower);
+                    ForceToDefaultNaN<32>(code, ctx.FPCR(fpcr_controlled), upper);
+                    code.vcvtps2ph(lower, lower, 0);
+                    code.vcvtps2ph(upper, upper, 0);
+                });
+                code.vpunpcklqdq(lower, lower, upper);
+
+                ctx.reg_alloc.DefineValue(inst, lower);
+                return;
+            }
+        } else {
+            if (code.HasSSE41() && !exact) {
+                EmitTwoOpVectorOperation<fsize, DefaultIndexer, 3>(code, ctx, inst, [&](const Xbyak::Xmm& result, const Xbyak::Xmm& xmm_a){
+                    FCODE(roundp)(result, xmm_a, round_imm);
+                });
 
-            return;
+                return;
+            }
         }
     }
 
@@ -1375,6 +1849,53 @@ void EmitX64::EmitFPVectorRoundInt64(EmitContext& ctx, IR::Inst* inst) {
     EmitFPVectorRoundInt<64>(code, ctx, inst);
 }
 
+template<size_t fsize>
+void EmitFPVectorRoundIntN(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
+    using FPT = mp::unsigned_integer_of_size<fsize>;
+
+    const auto rounding = static_cast<FP::RoundingMode>(inst->GetArg(1).GetU8());
+    const size_t intsize = inst->GetArg(2).GetU8();
+
+    using rounding_list = mp::list<
+        mp::lift_value<FP::RoundingMode::ToNearest_TieEven>,
+        mp::lift_value<FP::RoundingMode::TowardsPlusInfinity>,
+        mp::lift_value<FP::RoundingMode::TowardsMinusInfinity>,
+        mp::lift_value<FP::RoundingMode::TowardsZero>,
+        mp::lift_value<FP::RoundingMode::ToNearest_TieAwayFromZero>
+    >;
+    using intsize_list = mp::list<mp::lift_value<size_t(32)>, mp::lift_value<size_t(64)>>;
+
+    static const auto lut = Common::GenerateLookupTableFromList(
+        [](auto arg) {
+            return std::pair{
+                mp::lower_to_tuple_v<decltype(arg)>,
+                Common::FptrCast(
+                    [](VectorArray<FPT>& output, const VectorArray<FPT>& input, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                        constexpr auto t = mp::lower_to_tuple_v<decltype(arg)>;
+                        constexpr FP::RoundingMode rounding_mode = std::get<0>(t);
+                        constexpr size_t intsize = std::get<1>(t);
+
+                        for (size_t i = 0; i < output.size(); ++i) {
+                            output[i] = static_cast<FPT>(FP::FPRoundIntN<FPT>(input[i], fpcr, rounding_mode, intsize, fpsr));
+                        }
+                    }
+                )
+            };
+        },
+        mp::cartesian_product<rounding_list, intsize_list>{}
+    );
+
+    EmitTwoOpFallback<3>(code, ctx, inst, lut.at(std::make_tuple(rounding, intsize)));
+}
+
+void EmitX64::EmitFPVectorRoundIntN32(EmitContext& ctx, IR::Inst* inst) {
+    EmitFPVectorRoundIntN<32>(code, ctx, inst);
+}
+
+void EmitX64::EmitFPVectorRoundIntN64(EmitContext& ctx, IR::Inst* inst) {
+    EmitFPVectorRoundIntN<64>(code, ctx, inst);
+}
+
 template<size_t fsize>
 static void EmitRSqrtEstimate(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
     using FPT = mp::unsigned_integer_of_size<fsize>;
@@ -1398,11 +1919,20 @@ static void EmitRSqrtEstimate(BlockOfCode& code, EmitContext& ctx, IR::Inst* ins
         }
     }
 
-    EmitTwoOpFallback(code, ctx, inst, [](VectorArray<FPT>& result, const VectorArray<FPT>& operand, FP::FPCR fpcr, FP::FPSR& fpsr) {
+    const auto fallback_fn = [](VectorArray<FPT>& result, const VectorArray<FPT>& operand, FP::FPCR fpcr, FP::FPSR& fpsr) {
         for (size_t i = 0; i < result.size(); i++) {
             result[i] = FP::FPRSqrtEstimate<FPT>(operand[i], fpcr, fpsr);
         }
-    });
+    };
+
+    if constexpr (fsize != 16) {
+        if (code.HasAVX2()) {
+            EmitEstimateLookup<fsize>(code, ctx, inst, true, FP::FPRSqrtEstimateTable().data(), fallback_fn);
+            return;
+        }
+    }
+
+    EmitTwoOpFallback(code, ctx, inst, fallback_fn);
 }
 
 void EmitX64::EmitFPVectorRSqrtEstimate16(EmitContext& ctx, IR::Inst* inst) {
@@ -1501,6 +2031,16 @@ void EmitX64::EmitFPVectorRSqrtStepFused64(EmitContext& ctx, IR::Inst* inst) {
     EmitRSqrtStepFused<64>(code, ctx, inst);
 }
 
+void EmitX64::EmitFPVectorSqrt16(EmitContext& ctx, IR::Inst* inst) {
+    EmitHalfVectorOperation<1>(code, ctx, inst, [&](const Xbyak::Xmm& result) {
+        code.vsqrtps(result, result);
+    }, [](VectorArray<u16>& result, const VectorArray<u16>& operand, FP::FPCR fpcr, FP::FPSR& fpsr) {
+        for (size_t i = 0; i < result.size(); i++) {
+            result[i] = FP::FPSqrt(operand[i], fpcr, fpsr);
+        }
+    });
+}
+
 void EmitX64::EmitFPVectorSqrt32(EmitContext& ctx, IR::Inst* inst) {
     EmitTwoOpVectorOperation<32, DefaultIndexer>(code, ctx, inst, [this](const Xbyak::Xmm& result, const Xbyak::Xmm& operand) {
         code.sqrtps(result, operand);
@@ -1513,6 +2053,16 @@ void EmitX64::EmitFPVectorSqrt64(EmitContext& ctx, IR::Inst* inst) {
     });
 }
 
+void EmitX64::EmitFPVectorSub16(EmitContext& ctx, IR::Inst* inst) {
+    EmitHalfVectorOperation<2>(code, ctx, inst, [&](const Xbyak::Xmm& result, const Xbyak::Xmm& operand) {
+        code.vsubps(result, result, operand);
+    }, [](VectorArray<u16>& result, const VectorArray<u16>& op1, const VectorArray<u16>& op2, FP::FPCR fpcr, FP::FPSR& fpsr) {
+        for (size_t i = 0; i < result.size(); i++) {
+            result[i] = FP::FPMulAdd<u16>(op1[i], op2[i], FP::FPValue<u16, true, 0, 1>(), fpcr, fpsr);
+        }
+    });
+}
+
 void EmitX64::EmitFPVectorSub32(EmitContext& ctx, IR::Inst* inst) {
     EmitThreeOpVectorOperation<32, DefaultIndexer>(code, ctx, inst, &Xbyak::CodeGenerator::subps);
 }
@@ -1529,29 +2079,118 @@ void EmitFPVectorToFixed(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
     const auto rounding = static_cast<FP::RoundingMode>(inst->GetArg(2).GetU8());
     [[maybe_unused]] const bool fpcr_controlled = inst->GetArg(3).GetU1();
 
+    const int round_imm = [&]{
+        switch (rounding) {
+        case FP::RoundingMode::ToNearest_TieEven:
+        default:
+            return 0b00;
+        case FP::RoundingMode::TowardsPlusInfinity:
+            return 0b10;
+        case FP::RoundingMode::TowardsMinusInfinity:
+            return 0b01;
+        case FP::RoundingMode::TowardsZero:
+            return 0b11;
+        }
+    }();
+
+    using fbits_list = mp::lift_sequence<std::make_index_sequence<fsize + 1>>;
+    using rounding_list = mp::list<
+        mp::lift_value<FP::RoundingMode::ToNearest_TieEven>,
+        mp::lift_value<FP::RoundingMode::TowardsPlusInfinity>,
+        mp::lift_value<FP::RoundingMode::TowardsMinusInfinity>,
+        mp::lift_value<FP::RoundingMode::TowardsZero>,
+        mp::lift_value<FP::RoundingMode::ToNearest_TieAwayFromZero>
+    >;
+
+    static const auto lut = Common::GenerateLookupTableFromList(
+        [](auto arg) {
+            return std::pair{
+                mp::lower_to_tuple_v<decltype(arg)>,
+                Common::FptrCast(
+                    [](VectorArray<FPT>& output, const VectorArray<FPT>& input, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                        constexpr auto t = mp::lower_to_tuple_v<decltype(arg)>;
+                        constexpr size_t fbits = std::get<0>(t);
+                        constexpr FP::RoundingMode rounding_mode = std::get<1>(t);
+
+                        for (size_t i = 0; i < output.size(); ++i) {
+                            output[i] = static_cast<FPT>(FP::FPToFixed<FPT>(fsize, input[i], fbits, unsigned_, fpcr, rounding_mode, fpsr));
+                        }
+                    }
+                )
+            };
+        },
+        mp::cartesian_product<fbits_list, rounding_list>{}
+    );
+
     // TODO: AVX512 implementation
 
-    if constexpr (fsize != 16) {
-        if (code.HasSSE41() && rounding != FP::RoundingMode::ToNearest_TieAwayFromZero) {
+    if constexpr (fsize == 16) {
+        // Every half-precision value scaled by at most 2^16 is exact in single precision. Lanes that
+        // are NaN or that could saturate are left to the software fallback, which orders the
+        // exceptions that saturation raises correctly; the comparisons used to find them are quiet.
+        if (code.HasF16C() && !ctx.FPCR(fpcr_controlled).FZ16() && rounding != FP::RoundingMode::ToNearest_TieAwayFromZero) {
             auto args = ctx.reg_alloc.GetArgumentInfo(inst);
 
-            const Xbyak::Xmm src = ctx.reg_alloc.UseScratchXmm(args[0]);
+            const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+            const Xbyak::Xmm upper = ctx.reg_alloc.ScratchXmm();
+            const Xbyak::Xmm in_range = ctx.reg_alloc.ScratchXmm();
+            const Xbyak::Xmm value = ctx.reg_alloc.UseXmm(args[0]);
+
+            // Rounding moves a value by less than one, so these bounds cannot be crossed by rounding.
+            constexpr u64 float_lower_limit = unsigned_ ? 0x00000000 : 0xC6FFFE00; // 0.0 or -32767.0
+            constexpr u64 float_upper_limit = unsigned_ ? 0x477FFE00 : 0x46FFFC00; // 65534.0 or 32766.0
+
+            Xbyak::Label end, fallback;
 
             MaybeStandardFPSCRValue(code, ctx, fpcr_controlled, [&]{
+                WidenHalfVector(code, result, upper, value);
 
-                const int round_imm = [&]{
-                    switch (rounding) {
-                    case FP::RoundingMode::ToNearest_TieEven:
-                    default:
-                        return 0b00;
-                    case FP::RoundingMode::TowardsPlusInfinity:
-                        return 0b10;
-                    case FP::RoundingMode::TowardsMinusInfinity:
-                        return 0b01;
-                    case FP::RoundingMode::TowardsZero:
-                        return 0b11;
+                code.vpcmpeqd(in_range, in_range, in_range);
+                for (const Xbyak::Xmm& xmm : {result, upper}) {
+                    if (fbits != 0) {
+                        code.vmulps(xmm, xmm, GetVectorOf<32>(code, static_cast<u64>(fbits + 127) << 23));
                     }
-                }();
+                    code.vcmpge_oqps(xmm0, xmm, GetVectorOf<32, float_lower_limit>(code));
+                    code.vandps(in_range, in_range, xmm0);
+                    code.vcmple_oqps(xmm0, xmm, GetVectorOf<32, float_upper_limit>(code));
+                    code.vandps(in_range, in_range, xmm0);
+                }
+                code.vpcmpeqd(xmm0, xmm0, xmm0);
+                code.vptest(in_range, xmm0);
+                code.jnc(fallback, code.T_NEAR);
+
+                for (const Xbyak::Xmm& xmm : {result, upper}) {
+                    code.vroundps(xmm, xmm, static_cast<u8>(round_imm));
+                    code.vcvttps2dq(xmm, xmm);
+                }
+                if constexpr (unsigned_) {
+                    code.vpackusdw(result, result, upper);
+                } else {
+                    code.vpackssdw(result, result, upper);
+                }
+                code.L(end);
+            });
+
+            code.SwitchToFarCode();
+            code.L(fallback);
+            code.sub(rsp, 8);
+            ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, HostLocXmmIdx(result.getIdx()));
+            EmitTwoOpFallbackWithoutRegAlloc(code, ctx, result, value, lut.at(std::make_tuple(fbits, rounding)), fpcr_controlled);
+            ABI_PopCallerSaveRegistersAndAdjustStackExcept(code, HostLocXmmIdx(result.getIdx()));
+            code.add(rsp, 8);
+            code.jmp(end, code.T_NEAR);
+            code.SwitchToNearCode();
+
+            ctx.reg_alloc.DefineValue(inst, result);
+            return;
+        }
+    } else {
+        if (code.HasSSE41() && rounding != FP::RoundingMode::ToNearest_TieAwayFromZero) {
+            auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+            const Xbyak::Xmm src = ctx.reg_alloc.UseScratchXmm(args[0]);
+
+            MaybeStandardFPSCRValue(code, ctx, fpcr_controlled, [&]{
 
                 const auto perform_conversion = [&code, &ctx](const Xbyak::Xmm& src) {
                     // MSVC doesn't allow us to use a [&] capture, so we have to do this instead.
@@ -1627,35 +2266,6 @@ void EmitFPVectorToFixed(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
         }
     }
 
-    using fbits_list = mp::lift_sequence<std::make_index_sequence<fsize + 1>>;
-    using rounding_list = mp::list<
-        mp::lift_value<FP::RoundingMode::ToNearest_TieEven>,
-        mp::lift_value<FP::RoundingMode::TowardsPlusInfinity>,
-        mp::lift_value<FP::RoundingMode::TowardsMinusInfinity>,
-        mp::lift_value<FP::RoundingMode::TowardsZero>,
-        mp::lift_value<FP::RoundingMode::ToNearest_TieAwayFromZero>
-    >;
-
-    static const auto lut = Common::GenerateLookupTableFromList(
-        [](auto arg) {
-            return std::pair{
-                mp::lower_to_tuple_v<decltype(arg)>,
-                Common::FptrCast(
-                    [](VectorArray<FPT>& output, const VectorArray<FPT>& input, FP::FPCR fpcr, FP::FPSR& fpsr) {
-                        constexpr auto t = mp::lower_to_tuple_v<decltype(arg)>;
-                        constexpr size_t fbits = std::get<0>(t);
-                        constexpr FP::RoundingMode rounding_mode = std::get<1>(t);
-
-                        for (size_t i = 0; i < output.size(); ++i) {
-                            output[i] = static_cast<FPT>(FP::FPToFixed<FPT>(fsize, input[i], fbits, unsigned_, fpcr, rounding_mode, fpsr));
-                        }
-                    }
-                )
-            };
-        },
-        mp::cartesian_product<fbits_list, rounding_list>{}
-    );
-
     EmitTwoOpFallback<3>(code, ctx, inst, lut.at(std::make_tuple(fbits, rounding)));
 }
 
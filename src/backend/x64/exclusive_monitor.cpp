@@ -44,6 +44,19 @@ bool ExclusiveMonitor::CheckAndClear(size_t processor_id, VAddr address) {
     return true;
 }
 
+void ExclusiveMonitor::LockAndClear(VAddr address, size_t size) {
+    // The access may span several reservation granules; clear all of them.
+    const VAddr first_granule = address & RESERVATION_GRANULE_MASK;
+    const VAddr last_granule = (address + size - 1) & RESERVATION_GRANULE_MASK;
+
+    Lock();
+    for (VAddr& other_address : exclusive_addresses) {
+        if (other_address >= first_granule && other_address <= last_granule) {
+            other_address = INVALID_EXCLUSIVE_ADDRESS;
+        }
+    }
+}
+
 void ExclusiveMonitor::Clear() {
     Lock();
     std::fill(exclusive_addresses.begin(), exclusive_addresses.end(), INVALID_EXCLUSIVE_ADDRESS);
@@ -0,0 +1,1346 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include <algorithm>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+
+#include "backend/x64/interpreter.h"
+#include "common/assert.h"
+#include "common/bit_util.h"
+#include "common/fp/fpsr.h"
+#include "common/fp/info.h"
+#include "common/fp/op.h"
+#include "common/fp/op/FPNeg.h"
+#include "common/fp/process_exception.h"
+#include "common/fp/rounding_mode.h"
+#include "common/fp/unpacked.h"
+#include "frontend/ir/basic_block.h"
+#include "frontend/ir/cond.h"
+#include "frontend/ir/microinstruction.h"
+#include "frontend/ir/opcodes.h"
+#include "frontend/ir/value.h"
+
+namespace Dynarmic::Backend::X64 {
+
+namespace {
+
+bool IsFPOpcode(IR::Opcode op) {
+    switch (op) {
+    case IR::Opcode::FPAbs16:
+    case IR::Opcode::FPAbs32:
+    case IR::Opcode::FPAbs64:
+    case IR::Opcode::FPAdd32:
+    case IR::Opcode::FPAdd64:
+    case IR::Opcode::FPCompare32:
+    case IR::Opcode::FPCompare64:
+    case IR::Opcode::FPDiv32:
+    case IR::Opcode::FPDiv64:
+    case IR::Opcode::FPMax32:
+    case IR::Opcode::FPMax64:
+    case IR::Opcode::FPMaxNumeric32:
+    case IR::Opcode::FPMaxNumeric64:
+    case IR::Opcode::FPMin32:
+    case IR::Opcode::FPMin64:
+    case IR::Opcode::FPMinNumeric32:
+    case IR::Opcode::FPMinNumeric64:
+    case IR::Opcode::FPMul32:
+    case IR::Opcode::FPMul64:
+    case IR::Opcode::FPMulAdd16:
+    case IR::Opcode::FPMulAdd32:
+    case IR::Opcode::FPMulAdd64:
+    case IR::Opcode::FPMulX32:
+    case IR::Opcode::FPMulX64:
+    case IR::Opcode::FPNeg16:
+    case IR::Opcode::FPNeg32:
+    case IR::Opcode::FPNeg64:
+    case IR::Opcode::FPRecipEstimate16:
+    case IR::Opcode::FPRecipEstimate32:
+    case IR::Opcode::FPRecipEstimate64:
+    case IR::Opcode::FPRecipExponent16:
+    case IR::Opcode::FPRecipExponent32:
+    case IR::Opcode::FPRecipExponent64:
+    case IR::Opcode::FPRecipStepFused16:
+    case IR::Opcode::FPRecipStepFused32:
+    case IR::Opcode::FPRecipStepFused64:
+    case IR::Opcode::FPRoundInt16:
+    case IR::Opcode::FPRoundInt32:
+    case IR::Opcode::FPRoundInt64:
+    case IR::Opcode::FPRoundIntN32:
+    case IR::Opcode::FPRoundIntN64:
+    case IR::Opcode::FPRSqrtEstimate16:
+    case IR::Opcode::FPRSqrtEstimate32:
+    case IR::Opcode::FPRSqrtEstimate64:
+    case IR::Opcode::FPRSqrtStepFused16:
+    case IR::Opcode::FPRSqrtStepFused32:
+    case IR::Opcode::FPRSqrtStepFused64:
+    case IR::Opcode::FPSqrt32:
+    case IR::Opcode::FPSqrt64:
+    case IR::Opcode::FPSub32:
+    case IR::Opcode::FPSub64:
+    case IR::Opcode::FPHalfToDouble:
+    case IR::Opcode::FPHalfToSingle:
+    case IR::Opcode::FPSingleToDouble:
+    case IR::Opcode::FPSingleToHalf:
+    case IR::Opcode::FPDoubleToHalf:
+    case IR::Opcode::FPDoubleToSingle:
+    case IR::Opcode::FPDoubleToFixedS16:
+    case IR::Opcode::FPDoubleToFixedS32:
+    case IR::Opcode::FPDoubleToFixedS64:
+    case IR::Opcode::FPDoubleToFixedU16:
+    case IR::Opcode::FPDoubleToFixedU32:
+    case IR::Opcode::FPDoubleToFixedU64:
+    case IR::Opcode::FPDoubleToFixedJS:
+    case IR::Opcode::FPHalfToFixedS16:
+    case IR::Opcode::FPHalfToFixedS32:
+    case IR::Opcode::FPHalfToFixedS64:
+    case IR::Opcode::FPHalfToFixedU16:
+    case IR::Opcode::FPHalfToFixedU32:
+    case IR::Opcode::FPHalfToFixedU64:
+    case IR::Opcode::FPSingleToFixedS16:
+    case IR::Opcode::FPSingleToFixedS32:
+    case IR::Opcode::FPSingleToFixedS64:
+    case IR::Opcode::FPSingleToFixedU16:
+    case IR::Opcode::FPSingleToFixedU32:
+    case IR::Opcode::FPSingleToFixedU64:
+    case IR::Opcode::FPFixedU16ToSingle:
+    case IR::Opcode::FPFixedS16ToSingle:
+    case IR::Opcode::FPFixedU16ToDouble:
+    case IR::Opcode::FPFixedS16ToDouble:
+    case IR::Opcode::FPFixedU32ToSingle:
+    case IR::Opcode::FPFixedS32ToSingle:
+    case IR::Opcode::FPFixedU32ToDouble:
+    case IR::Opcode::FPFixedS32ToDouble:
+    case IR::Opcode::FPFixedU64ToDouble:
+    case IR::Opcode::FPFixedU64ToSingle:
+    case IR::Opcode::FPFixedS64ToDouble:
+    case IR::Opcode::FPFixedS64ToSingle:
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool IsGenericOpcode(IR::Opcode op) {
+    switch (op) {
+    case IR::Opcode::Void:
+    case IR::Opcode::Identity:
+    case IR::Opcode::PushRSB:
+    case IR::Opcode::GetCarryFromOp:
+    case IR::Opcode::GetOverflowFromOp:
+    case IR::Opcode::GetNZCVFromOp:
+    case IR::Opcode::NZCVFromPackedFlags:
+    case IR::Opcode::Pack2x32To1x64:
+    case IR::Opcode::LeastSignificantWord:
+    case IR::Opcode::LeastSignificantHalf:
+    case IR::Opcode::LeastSignificantByte:
+    case IR::Opcode::MostSignificantWord:
+    case IR::Opcode::MostSignificantBit:
+    case IR::Opcode::IsZero32:
+    case IR::Opcode::IsZero64:
+    case IR::Opcode::TestBit:
+    case IR::Opcode::ConditionalSelect1:
+    case IR::Opcode::ConditionalSelect32:
+    case IR::Opcode::ConditionalSelect64:
+    case IR::Opcode::ConditionalSelectNZCV:
+    case IR::Opcode::LogicalShiftLeft32:
+    case IR::Opcode::LogicalShiftLeft64:
+    case IR::Opcode::LogicalShiftRight32:
+    case IR::Opcode::LogicalShiftRight64:
+    case IR::Opcode::ArithmeticShiftRight32:
+    case IR::Opcode::ArithmeticShiftRight64:
+    case IR::Opcode::RotateRight32:
+    case IR::Opcode::RotateRight64:
+    case IR::Opcode::RotateRightExtended:
+    case IR::Opcode::LogicalShiftLeftMasked32:
+    case IR::Opcode::LogicalShiftLeftMasked64:
+    case IR::Opcode::LogicalShiftRightMasked32:
+    case IR::Opcode::LogicalShiftRightMasked64:
+    case IR::Opcode::ArithmeticShiftRightMasked32:
+    case IR::Opcode::ArithmeticShiftRightMasked64:
+    case IR::Opcode::RotateRightMasked32:
+    case IR::Opcode::RotateRightMasked64:
+    case IR::Opcode::Add32:
+    case IR::Opcode::Add64:
+    case IR::Opcode::Sub32:
+    case IR::Opcode::Sub64:
+    case IR::Opcode::Mul32:
+    case IR::Opcode::Mul64:
+    case IR::Opcode::SignedMultiplyHigh64:
+    case IR::Opcode::UnsignedMultiplyHigh64:
+    case IR::Opcode::UnsignedDiv32:
+    case IR::Opcode::UnsignedDiv64:
+    case IR::Opcode::SignedDiv32:
+    case IR::Opcode::SignedDiv64:
+    case IR::Opcode::And32:
+    case IR::Opcode::And64:
+    case IR::Opcode::Eor32:
+    case IR::Opcode::Eor64:
+    case IR::Opcode::Or32:
+    case IR::Opcode::Or64:
+    case IR::Opcode::Not32:
+    case IR::Opcode::Not64:
+    case IR::Opcode::SignExtendByteToWord:
+    case IR::Opcode::SignExtendHalfToWord:
+    case IR::Opcode::SignExtendByteToLong:
+    case IR::Opcode::SignExtendHalfToLong:
+    case IR::Opcode::SignExtendWordToLong:
+    case IR::Opcode::ZeroExtendByteToWord:
+    case IR::Opcode::ZeroExtendHalfToWord:
+    case IR::Opcode::ZeroExtendByteToLong:
+    case IR::Opcode::ZeroExtendHalfToLong:
+    case IR::Opcode::ZeroExtendWordToLong:
+    case IR::Opcode::ByteReverseWord:
+    case IR::Opcode::ByteReverseHalf:
+    case IR::Opcode::ByteReverseDual:
+    case IR::Opcode::CountLeadingZeros32:
+    case IR::Opcode::CountLeadingZeros64:
+    case IR::Opcode::ExtractRegister32:
+    case IR::Opcode::ExtractRegister64:
+    case IR::Opcode::ReplicateBit32:
+    case IR::Opcode::ReplicateBit64:
+    case IR::Opcode::MaxSigned32:
+    case IR::Opcode::MaxSigned64:
+    case IR::Opcode::MaxUnsigned32:
+    case IR::Opcode::MaxUnsigned64:
+    case IR::Opcode::MinSigned32:
+    case IR::Opcode::MinSigned64:
+    case IR::Opcode::MinUnsigned32:
+    case IR::Opcode::MinUnsigned64:
+    case IR::Opcode::SignedSaturatedAdd8:
+    case IR::Opcode::SignedSaturatedAdd16:
+    case IR::Opcode::SignedSaturatedAdd32:
+    case IR::Opcode::SignedSaturatedAdd64:
+    case IR::Opcode::SignedSaturatedSub8:
+    case IR::Opcode::SignedSaturatedSub16:
+    case IR::Opcode::SignedSaturatedSub32:
+    case IR::Opcode::SignedSaturatedSub64:
+    case IR::Opcode::SignedSaturation:
+    case IR::Opcode::UnsignedSaturatedAdd8:
+    case IR::Opcode::UnsignedSaturatedAdd16:
+    case IR::Opcode::UnsignedSaturatedAdd32:
+    case IR::Opcode::UnsignedSaturatedAdd64:
+    case IR::Opcode::UnsignedSaturatedSub8:
+    case IR::Opcode::UnsignedSaturatedSub16:
+    case IR::Opcode::UnsignedSaturatedSub32:
+    case IR::Opcode::UnsignedSaturatedSub64:
+    case IR::Opcode::UnsignedSaturation:
+    case IR::Opcode::ZeroExtendLongToQuad:
+    case IR::Opcode::VectorGetElement8:
+    case IR::Opcode::VectorGetElement16:
+    case IR::Opcode::VectorGetElement32:
+    case IR::Opcode::VectorGetElement64:
+    case IR::Opcode::VectorSetElement8:
+    case IR::Opcode::VectorSetElement16:
+    case IR::Opcode::VectorSetElement32:
+    case IR::Opcode::VectorSetElement64:
+    case IR::Opcode::VectorBroadcast8:
+    case IR::Opcode::VectorBroadcast16:
+    case IR::Opcode::VectorBroadcast32:
+    case IR::Opcode::VectorBroadcast64:
+    case IR::Opcode::VectorZeroUpper:
+    case IR::Opcode::ZeroVector:
+        return true;
+    default:
+        return IsFPOpcode(op);
+    }
+}
+
+template<typename T>
+u32 NZCVFrom(T result, bool carry, bool overflow) {
+    u32 nzcv = 0;
+    nzcv |= Common::MostSignificantBit(result) ? 1u << 31 : 0;
+    nzcv |= result == 0 ? 1u << 30 : 0;
+    nzcv |= carry ? 1u << 29 : 0;
+    nzcv |= overflow ? 1u << 28 : 0;
+    return nzcv;
+}
+
+/// Returns {result, carry_out, overflow} of a + b + carry_in.
+template<typename T>
+std::tuple<T, bool, bool> AddWithCarry(T a, T b, bool carry_in) {
+    const T result = static_cast<T>(a + b + (carry_in ? 1 : 0));
+    const bool carry = carry_in ? result <= a : result < a;
+    const bool overflow = Common::MostSignificantBit(static_cast<T>(~(a ^ b) & (a ^ result)));
+    return {result, carry, overflow};
+}
+
+/// Returns {result, carry_out} of a 32-bit shift where the shift amount is not masked.
+std::tuple<u32, bool> LogicalShiftLeft32(u32 operand, u8 shift, bool carry_in) {
+    if (shift == 0) {
+        return {operand, carry_in};
+    }
+    if (shift < 32) {
+        return {operand << shift, Common::Bit(32 - shift, operand)};
+    }
+    return {0, shift == 32 && Common::Bit<0>(operand)};
+}
+
+std::tuple<u32, bool> LogicalShiftRight32(u32 operand, u8 shift, bool carry_in) {
+    if (shift == 0) {
+        return {operand, carry_in};
+    }
+    if (shift < 32) {
+        return {operand >> shift, Common::Bit(shift - 1, operand)};
+    }
+    return {0, shift == 32 && Common::Bit<31>(operand)};
+}
+
+std::tuple<u32, bool> ArithmeticShiftRight32(u32 operand, u8 shift, bool carry_in) {
+    if (shift == 0) {
+        return {operand, carry_in};
+    }
+    if (shift < 32) {
+        return {static_cast<u32>(static_cast<s32>(operand) >> shift), Common::Bit(shift - 1, operand)};
+    }
+    return {static_cast<u32>(static_cast<s32>(operand) >> 31), Common::Bit<31>(operand)};
+}
+
+std::tuple<u32, bool> RotateRight32(u32 operand, u8 shift, bool carry_in) {
+    if (shift == 0) {
+        return {operand, carry_in};
+    }
+    const u32 result = Common::RotateRight(operand, shift & 0x1F);
+    return {result, Common::Bit<31>(result)};
+}
+
+template<typename T>
+std::tuple<T, bool> SignedSaturatedAdd(T a, T b) {
+    const T result = static_cast<T>(a + b);
+    if (Common::MostSignificantBit(static_cast<T>(~(a ^ b) & (a ^ result)))) {
+        return {Common::MostSignificantBit(a) ? T(T(1) << (Common::BitSize<T>() - 1)) : T(std::numeric_limits<T>::max() >> 1), true};
+    }
+    return {result, false};
+}
+
+template<typename T>
+std::tuple<T, bool> SignedSaturatedSub(T a, T b) {
+    const T result = static_cast<T>(a - b);
+    if (Common::MostSignificantBit(static_cast<T>((a ^ b) & (a ^ result)))) {
+        return {Common::MostSignificantBit(a) ? T(T(1) << (Common::BitSize<T>() - 1)) : T(std::numeric_limits<T>::max() >> 1), true};
+    }
+    return {result, false};
+}
+
+template<typename T>
+std::tuple<T, bool> UnsignedSaturatedAdd(T a, T b) {
+    const T result = static_cast<T>(a + b);
+    if (result < a) {
+        return {std::numeric_limits<T>::max(), true};
+    }
+    return {result, false};
+}
+
+template<typename T>
+std::tuple<T, bool> UnsignedSaturatedSub(T a, T b) {
+    if (a < b) {
+        return {0, true};
+    }
+    return {static_cast<T>(a - b), false};
+}
+
+template<typename T>
+T SignedDiv(T a, T b) {
+    using S = std::make_signed_t<T>;
+    if (b == 0) {
+        return 0;
+    }
+    if (static_cast<S>(a) == std::numeric_limits<S>::min() && static_cast<S>(b) == -1) {
+        return a;
+    }
+    return static_cast<T>(static_cast<S>(a) / static_cast<S>(b));
+}
+
+template<typename T>
+T ExtractRegister(T a, T b, u8 lsb) {
+    if (lsb == 0) {
+        return a;
+    }
+    return static_cast<T>((a >> lsb) | (b << (Common::BitSize<T>() - lsb)));
+}
+
+u64 MultiplyHigh(u64 a, u64 b) {
+    const u64 a_lo = a & 0xFFFFFFFF;
+    const u64 a_hi = a >> 32;
+    const u64 b_lo = b & 0xFFFFFFFF;
+    const u64 b_hi = b >> 32;
+
+    const u64 lo_lo = a_lo * b_lo;
+    const u64 hi_lo = a_hi * b_lo;
+    const u64 lo_hi = a_lo * b_hi;
+    const u64 hi_hi = a_hi * b_hi;
+
+    const u64 cross = (lo_lo >> 32) + (hi_lo & 0xFFFFFFFF) + lo_hi;
+    return hi_hi + (hi_lo >> 32) + (cross >> 32);
+}
+
+/// Returns the element at index of a vector of elements of type T.
+template<typename T>
+T VectorGetElement(const std::array<u64, 2>& vector, size_t index) {
+    constexpr size_t per_half = 64 / Common::BitSize<T>();
+    return static_cast<T>(vector[index / per_half] >> (index % per_half * Common::BitSize<T>()));
+}
+
+template<typename T>
+std::array<u64, 2> VectorSetElement(std::array<u64, 2> vector, size_t index, T value) {
+    constexpr size_t per_half = 64 / Common::BitSize<T>();
+    const size_t shift = index % per_half * Common::BitSize<T>();
+    vector[index / per_half] &= ~(u64{static_cast<T>(~T(0))} << shift);
+    vector[index / per_half] |= u64{value} << shift;
+    return vector;
+}
+
+template<typename T>
+std::array<u64, 2> VectorBroadcast(T value) {
+    std::array<u64, 2> result{};
+    for (size_t i = 0; i < 128 / Common::BitSize<T>(); i++) {
+        result = VectorSetElement<T>(result, i, value);
+    }
+    return result;
+}
+
+// The multiplications by one below are exact, so each of these rounds once, and NaN operands are
+// processed in the same order as for the corresponding ARM operation.
+
+template<typename FPT>
+FPT FPAdd(FPT op1, FPT op2, FP::FPCR fpcr, FP::FPSR& fpsr) {
+    return FP::FPMulAdd<FPT>(op1, op2, FP::FPValue<FPT, false, 0, 1>(), fpcr, fpsr);
+}
+
+template<typename FPT>
+FPT FPSub(FPT op1, FPT op2, FP::FPCR fpcr, FP::FPSR& fpsr) {
+    return FP::FPMulAdd<FPT>(op1, op2, FP::FPValue<FPT, true, 0, 1>(), fpcr, fpsr);
+}
+
+template<typename FPT>
+FPT FPMul(FPT op1, FPT op2, FP::FPCR fpcr, FP::FPSR& fpsr) {
+    // Adding a zero of the same sign as the product leaves it unchanged.
+    const FPT addend = FP::FPInfo<FPT>::Zero(((op1 ^ op2) & FP::FPInfo<FPT>::sign_mask) != 0);
+    return FP::FPMulAdd<FPT>(addend, op1, op2, fpcr, fpsr);
+}
+
+template<typename FPT>
+FPT FPMulX(FPT op1, FPT op2, FP::FPCR fpcr, FP::FPSR& fpsr) {
+    const auto [type1, sign1, value1] = FP::FPUnpack<FPT>(op1, fpcr, fpsr);
+    const auto [type2, sign2, value2] = FP::FPUnpack<FPT>(op2, fpcr, fpsr);
+
+    const bool inf_times_zero = (type1 == FP::FPType::Infinity && type2 == FP::FPType::Zero)
+                             || (type1 == FP::FPType::Zero && type2 == FP::FPType::Infinity);
+    if (inf_times_zero) {
+        return static_cast<FPT>(FP::FPValue<FPT, false, 0, 2>() | (sign1 != sign2 ? FP::FPInfo<FPT>::sign_mask : 0));
+    }
+    return FPMul<FPT>(op1, op2, fpcr, fpsr);
+}
+
+/// Returns the NZCV flags (in the ARM format) of a comparison of op1 with op2.
+template<typename FPT>
+u32 FPCompare(FPT op1, FPT op2, bool exc_on_qnan, FP::FPCR fpcr, FP::FPSR& fpsr) {
+    const auto [type1, sign1, value1] = FP::FPUnpack<FPT>(op1, fpcr, fpsr);
+    const auto [type2, sign2, value2] = FP::FPUnpack<FPT>(op2, fpcr, fpsr);
+
+    const bool snan = type1 == FP::FPType::SNaN || type2 == FP::FPType::SNaN;
+    const bool qnan = type1 == FP::FPType::QNaN || type2 == FP::FPType::QNaN;
+    if (snan || qnan) {
+        if (snan || exc_on_qnan) {
+            FP::FPProcessException(FP::FPExc::InvalidOp, fpcr, fpsr);
+        }
+        return 0x30000000;
+    }
+    if (FP::FPCompareEQ<FPT>(op1, op2, fpcr, fpsr)) {
+        return 0x60000000;
+    }
+    if (FP::FPCompareGT<FPT>(op2, op1, fpcr, fpsr)) {
+        return 0x80000000;
+    }
+    return 0x20000000;
+}
+
+/// Converts a fixed-point value of width ibits to floating-point.
+template<typename FPT>
+FPT FixedToFP(u64 value, size_t ibits, bool unsigned_, size_t fbits, FP::FPCR fpcr, FP::RoundingMode rounding, FP::FPSR& fpsr) {
+    const bool sign = !unsigned_ && Common::Bit(ibits - 1, value);
+    if (sign) {
+        value |= ibits == 64 ? 0 : ~u64(0) << ibits;
+        value = 0 - value;
+    }
+    if (value == 0) {
+        return FP::FPInfo<FPT>::Zero(false);
+    }
+    return FP::FPRound<FPT>(FP::ToNormalized(sign, -static_cast<int>(fbits), value), fpcr, rounding, fpsr);
+}
+
+/// FJCVTZS: Returns the result modulo 2^32 and whether the conversion was exact and in range.
+std::tuple<u32, bool> FPToFixedJS(u64 op, FP::FPCR fpcr, FP::FPSR& fpsr) {
+    const auto [type, sign, value] = FP::FPUnpack<u64>(op, fpcr, fpsr);
+
+    switch (type) {
+    case FP::FPType::SNaN:
+    case FP::FPType::QNaN:
+    case FP::FPType::Infinity:
+        FP::FPProcessException(FP::FPExc::InvalidOp, fpcr, fpsr);
+        return {0, false};
+    case FP::FPType::Zero:
+        return {0, !sign};
+    case FP::FPType::Nonzero:
+        break;
+    }
+
+    // value is mantissa * 2^(exponent - 62).
+    const int shift = value.exponent - static_cast<int>(FP::normalized_point_position);
+    u64 integer;
+    bool inexact;
+    bool overflow;
+    if (shift >= 0) {
+        integer = shift < 64 ? value.mantissa << shift : 0;
+        inexact = false;
+        overflow = true;
+    } else {
+        integer = -shift < 64 ? value.mantissa >> -shift : 0;
+        inexact = -shift < 64 ? (value.mantissa & ((u64(1) << -shift) - 1)) != 0 : true;
+        overflow = integer > (sign ? u64(0x80000000) : u64(0x7FFFFFFF));
+    }
+
+    if (overflow) {
+        FP::FPProcessException(FP::FPExc::InvalidOp, fpcr, fpsr);
+    } else if (inexact) {
+        FP::FPProcessException(FP::FPExc::Inexact, fpcr, fpsr);
+    }
+
+    const u32 result = static_cast<u32>(sign ? 0 - integer : integer);
+    return {result, !inexact && !overflow};
+}
+
+u64 SignedMultiplyHigh(u64 a, u64 b) {
+    u64 result = MultiplyHigh(a, b);
+    if (Common::MostSignificantBit(a)) {
+        result -= b;
+    }
+    if (Common::MostSignificantBit(b)) {
+        result -= a;
+    }
+    return result;
+}
+
+} // anonymous namespace
+
+Interpreter::~Interpreter() = default;
+
+bool Interpreter::CanInterpret(const IR::Block& block) const {
+    for (const auto& inst : block) {
+        if (!IsGenericOpcode(inst.GetOpcode()) && !CanInterpretArch(inst)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void Interpreter::ExecuteInstructions(IR::Block& block) {
+    results.clear();
+    fpcr = GetFPCR(block.Location());
+    for (auto& inst : block) {
+        ExecuteInst(&inst);
+    }
+}
+
+u64 Interpreter::Get(const IR::Value& arg) const {
+    if (arg.IsImmediate()) {
+        return arg.GetImmediateAsU64();
+    }
+    return GetResult(arg).value;
+}
+
+Interpreter::Vector Interpreter::GetVector(const IR::Value& arg) const {
+    const Result& result = GetResult(arg);
+    return {result.value, result.upper};
+}
+
+const Interpreter::Result& Interpreter::GetResult(const IR::Value& arg) const {
+    const auto iter = results.find(arg.GetInst());
+    ASSERT(iter != results.end());
+    return iter->second;
+}
+
+void Interpreter::Set(IR::Inst* inst, u64 value) {
+    results[inst].value = value;
+}
+
+void Interpreter::SetVector(IR::Inst* inst, Vector value) {
+    Result& result = results[inst];
+    result.value = value[0];
+    result.upper = value[1];
+}
+
+bool Interpreter::ConditionPassed(IR::Cond cond, u32 nzcv) {
+    const bool n = Common::Bit<31>(nzcv);
+    const bool z = Common::Bit<30>(nzcv);
+    const bool c = Common::Bit<29>(nzcv);
+    const bool v = Common::Bit<28>(nzcv);
+
+    switch (cond) {
+    case IR::Cond::EQ:
+        return z;
+    case IR::Cond::NE:
+        return !z;
+    case IR::Cond::CS:
+        return c;
+    case IR::Cond::CC:
+        return !c;
+    case IR::Cond::MI:
+        return n;
+    case IR::Cond::PL:
+        return !n;
+    case IR::Cond::VS:
+        return v;
+    case IR::Cond::VC:
+        return !v;
+    case IR::Cond::HI:
+        return c && !z;
+    case IR::Cond::LS:
+        return !c || z;
+    case IR::Cond::GE:
+        return n == v;
+    case IR::Cond::LT:
+        return n != v;
+    case IR::Cond::GT:
+        return !z && n == v;
+    case IR::Cond::LE:
+        return z || n != v;
+    case IR::Cond::AL:
+    case IR::Cond::NV:
+        return true;
+    }
+    UNREACHABLE();
+}
+
+void Interpreter::ExecuteInst(IR::Inst* inst) {
+    const auto arg = [inst](size_t i) { return inst->GetArg(i); };
+
+    const auto set_with_carry = [&](std::tuple<u32, bool> r) {
+        Result& result = results[inst];
+        result.value = std::get<0>(r);
+        result.carry = std::get<1>(r);
+    };
+
+    const auto set_with_overflow = [&](auto r) {
+        Result& result = results[inst];
+        result.value = std::get<0>(r);
+        result.overflow = std::get<1>(r);
+    };
+
+    const auto set_add = [&](auto r) {
+        Result& result = results[inst];
+        result.value = std::get<0>(r);
+        result.carry = std::get<1>(r);
+        result.overflow = std::get<2>(r);
+        result.nzcv = NZCVFrom(std::get<0>(r), std::get<1>(r), std::get<2>(r));
+    };
+
+    switch (inst->GetOpcode()) {
+    case IR::Opcode::Void:
+    case IR::Opcode::PushRSB:
+        break;
+    case IR::Opcode::Identity:
+        if (arg(0).IsImmediate()) {
+            Set(inst, Get(arg(0)));
+        } else {
+            results[inst] = GetResult(arg(0));
+        }
+        break;
+    case IR::Opcode::GetCarryFromOp:
+        Set(inst, GetResult(arg(0)).carry);
+        break;
+    case IR::Opcode::GetOverflowFromOp:
+        Set(inst, GetResult(arg(0)).overflow);
+        break;
+    case IR::Opcode::GetNZCVFromOp: {
+        const IR::Inst* parent = arg(0).GetInst();
+        switch (parent->GetOpcode()) {
+        case IR::Opcode::Add32:
+        case IR::Opcode::Add64:
+        case IR::Opcode::Sub32:
+        case IR::Opcode::Sub64:
+        case IR::Opcode::FPDoubleToFixedJS:
+            Set(inst, GetResult(arg(0)).nzcv);
+            break;
+        default:
+            // Logical operations set N and Z from the result and clear C and V.
+            if (arg(0).GetType() == IR::Type::U64) {
+                Set(inst, NZCVFrom<u64>(Get(arg(0)), false, false));
+            } else {
+                Set(inst, NZCVFrom<u32>(static_cast<u32>(Get(arg(0))), false, false));
+            }
+            break;
+        }
+        break;
+    }
+    case IR::Opcode::NZCVFromPackedFlags:
+        Set(inst, Get(arg(0)) & 0xF0000000);
+        break;
+    case IR::Opcode::Pack2x32To1x64:
+        Set(inst, (Get(arg(0)) & 0xFFFFFFFF) | (Get(arg(1)) << 32));
+        break;
+    case IR::Opcode::LeastSignificantWord:
+        Set(inst, Get(arg(0)) & 0xFFFFFFFF);
+        break;
+    case IR::Opcode::LeastSignificantHalf:
+        Set(inst, Get(arg(0)) & 0xFFFF);
+        break;
+    case IR::Opcode::LeastSignificantByte:
+        Set(inst, Get(arg(0)) & 0xFF);
+        break;
+    case IR::Opcode::MostSignificantWord: {
+        const u64 value = Get(arg(0));
+        set_with_carry({static_cast<u32>(value >> 32), Common::Bit<31>(value)});
+        break;
+    }
+    case IR::Opcode::MostSignificantBit:
+        Set(inst, Common::Bit<31>(Get(arg(0))));
+        break;
+    case IR::Opcode::IsZero32:
+        Set(inst, static_cast<u32>(Get(arg(0))) == 0);
+        break;
+    case IR::Opcode::IsZero64:
+        Set(inst, Get(arg(0)) == 0);
+        break;
+    case IR::Opcode::TestBit:
+        Set(inst, Common::Bit(Get(arg(1)), Get(arg(0))));
+        break;
+    case IR::Opcode::ConditionalSelect1:
+    case IR::Opcode::ConditionalSelect32:
+    case IR::Opcode::ConditionalSelect64:
+    case IR::Opcode::ConditionalSelectNZCV:
+        Set(inst, ConditionPassed(arg(0).GetCond(), GetNZCV()) ? Get(arg(1)) : Get(arg(2)));
+        break;
+    case IR::Opcode::LogicalShiftLeft32:
+        set_with_carry(LogicalShiftLeft32(static_cast<u32>(Get(arg(0))), static_cast<u8>(Get(arg(1))), Get(arg(2)) != 0));
+        break;
+    case IR::Opcode::LogicalShiftRight32:
+        set_with_carry(LogicalShiftRight32(static_cast<u32>(Get(arg(0))), static_cast<u8>(Get(arg(1))), Get(arg(2)) != 0));
+        break;
+    case IR::Opcode::ArithmeticShiftRight32:
+        set_with_carry(ArithmeticShiftRight32(static_cast<u32>(Get(arg(0))), static_cast<u8>(Get(arg(1))), Get(arg(2)) != 0));
+        break;
+    case IR::Opcode::RotateRight32:
+        set_with_carry(RotateRight32(static_cast<u32>(Get(arg(0))), static_cast<u8>(Get(arg(1))), Get(arg(2)) != 0));
+        break;
+    case IR::Opcode::LogicalShiftLeft64: {
+        const u8 shift = static_cast<u8>(Get(arg(1)));
+        Set(inst, shift < 64 ? Get(arg(0)) << shift : 0);
+        break;
+    }
+    case IR::Opcode::LogicalShiftRight64: {
+        const u8 shift = static_cast<u8>(Get(arg(1)));
+        Set(inst, shift < 64 ? Get(arg(0)) >> shift : 0);
+        break;
+    }
+    case IR::Opcode::ArithmeticShiftRight64: {
+        const u8 shift = static_cast<u8>(Get(arg(1)));
+        Set(inst, static_cast<u64>(static_cast<s64>(Get(arg(0))) >> (shift < 63 ? shift : 63)));
+        break;
+    }
+    case IR::Opcode::RotateRight64:
+        Set(inst, Common::RotateRight(Get(arg(0)), static_cast<u8>(Get(arg(1))) & 0x3F));
+        break;
+    case IR::Opcode::RotateRightExtended: {
+        const u32 operand = static_cast<u32>(Get(arg(0)));
+        const bool carry_in = Get(arg(1)) != 0;
+        set_with_carry({(operand >> 1) | (carry_in ? 0x80000000 : 0), Common::Bit<0>(operand)});
+        break;
+    }
+    case IR::Opcode::LogicalShiftLeftMasked32:
+        Set(inst, static_cast<u32>(Get(arg(0)) << (Get(arg(1)) & 0x1F)));
+        break;
+    case IR::Opcode::LogicalShiftLeftMasked64:
+        Set(inst, Get(arg(0)) << (Get(arg(1)) & 0x3F));
+        break;
+    case IR::Opcode::LogicalShiftRightMasked32:
+        Set(inst, static_cast<u32>(Get(arg(0))) >> (Get(arg(1)) & 0x1F));
+        break;
+    case IR::Opcode::LogicalShiftRightMasked64:
+        Set(inst, Get(arg(0)) >> (Get(arg(1)) & 0x3F));
+        break;
+    case IR::Opcode::ArithmeticShiftRightMasked32:
+        Set(inst, static_cast<u32>(static_cast<s32>(Get(arg(0))) >> (Get(arg(1)) & 0x1F)));
+        break;
+    case IR::Opcode::ArithmeticShiftRightMasked64:
+        Set(inst, static_cast<u64>(static_cast<s64>(Get(arg(0))) >> (Get(arg(1)) & 0x3F)));
+        break;
+    case IR::Opcode::RotateRightMasked32:
+        Set(inst, Common::RotateRight(static_cast<u32>(Get(arg(0))), Get(arg(1)) & 0x1F));
+        break;
+    case IR::Opcode::RotateRightMasked64:
+        Set(inst, Common::RotateRight(Get(arg(0)), Get(arg(1)) & 0x3F));
+        break;
+    case IR::Opcode::Add32:
+        set_add(AddWithCarry<u32>(static_cast<u32>(Get(arg(0))), static_cast<u32>(Get(arg(1))), Get(arg(2)) != 0));
+        break;
+    case IR::Opcode::Add64:
+        set_add(AddWithCarry<u64>(Get(arg(0)), Get(arg(1)), Get(arg(2)) != 0));
+        break;
+    case IR::Opcode::Sub32:
+        set_add(AddWithCarry<u32>(static_cast<u32>(Get(arg(0))), ~static_cast<u32>(Get(arg(1))), Get(arg(2)) != 0));
+        break;
+    case IR::Opcode::Sub64:
+        set_add(AddWithCarry<u64>(Get(arg(0)), ~Get(arg(1)), Get(arg(2)) != 0));
+        break;
+    case IR::Opcode::Mul32:
+        Set(inst, static_cast<u32>(Get(arg(0)) * Get(arg(1))));
+        break;
+    case IR::Opcode::Mul64:
+        Set(inst, Get(arg(0)) * Get(arg(1)));
+        break;
+    case IR::Opcode::SignedMultiplyHigh64:
+        Set(inst, SignedMultiplyHigh(Get(arg(0)), Get(arg(1))));
+        break;
+    case IR::Opcode::UnsignedMultiplyHigh64:
+        Set(inst, MultiplyHigh(Get(arg(0)), Get(arg(1))));
+        break;
+    case IR::Opcode::UnsignedDiv32: {
+        const u32 divisor = static_cast<u32>(Get(arg(1)));
+        Set(inst, divisor == 0 ? 0 : static_cast<u32>(Get(arg(0))) / divisor);
+        break;
+    }
+    case IR::Opcode::UnsignedDiv64: {
+        const u64 divisor = Get(arg(1));
+        Set(inst, divisor == 0 ? 0 : Get(arg(0)) / divisor);
+        break;
+    }
+    case IR::Opcode::SignedDiv32:
+        Set(inst, SignedDiv<u32>(static_cast<u32>(Get(arg(0))), static_cast<u32>(Get(arg(1)))));
+        break;
+    case IR::Opcode::SignedDiv64:
+        Set(inst, SignedDiv<u64>(Get(arg(0)), Get(arg(1))));
+        break;
+    case IR::Opcode::And32:
+    case IR::Opcode::And64:
+        Set(inst, Get(arg(0)) & Get(arg(1)));
+        break;
+    case IR::Opcode::Eor32:
+    case IR::Opcode::Eor64:
+        Set(inst, Get(arg(0)) ^ Get(arg(1)));
+        break;
+    case IR::Opcode::Or32:
+    case IR::Opcode::Or64:
+        Set(inst, Get(arg(0)) | Get(arg(1)));
+        break;
+    case IR::Opcode::Not32:
+        Set(inst, ~static_cast<u32>(Get(arg(0))));
+        break;
+    case IR::Opcode::Not64:
+        Set(inst, ~Get(arg(0)));
+        break;
+    case IR::Opcode::SignExtendByteToWord:
+        Set(inst, static_cast<u32>(static_cast<s8>(Get(arg(0)))));
+        break;
+    case IR::Opcode::SignExtendHalfToWord:
+        Set(inst, static_cast<u32>(static_cast<s16>(Get(arg(0)))));
+        break;
+    case IR::Opcode::SignExtendByteToLong:
+        Set(inst, static_cast<u64>(static_cast<s8>(Get(arg(0)))));
+        break;
+    case IR::Opcode::SignExtendHalfToLong:
+        Set(inst, static_cast<u64>(static_cast<s16>(Get(arg(0)))));
+        break;
+    case IR::Opcode::SignExtendWordToLong:
+        Set(inst, static_cast<u64>(static_cast<s32>(Get(arg(0)))));
+        break;
+    case IR::Opcode::ZeroExtendByteToWord:
+    case IR::Opcode::ZeroExtendByteToLong:
+        Set(inst, Get(arg(0)) & 0xFF);
+        break;
+    case IR::Opcode::ZeroExtendHalfToWord:
+    case IR::Opcode::ZeroExtendHalfToLong:
+        Set(inst, Get(arg(0)) & 0xFFFF);
+        break;
+    case IR::Opcode::ZeroExtendWordToLong:
+        Set(inst, Get(arg(0)) & 0xFFFFFFFF);
+        break;
+    case IR::Opcode::ByteReverseWord:
+        Set(inst, Common::Swap32(static_cast<u32>(Get(arg(0)))));
+        break;
+    case IR::Opcode::ByteReverseHalf:
+        Set(inst, Common::Swap16(static_cast<u16>(Get(arg(0)))));
+        break;
+    case IR::Opcode::ByteReverseDual:
+        Set(inst, Common::Swap64(Get(arg(0))));
+        break;
+    case IR::Opcode::CountLeadingZeros32:
+        Set(inst, Common::CountLeadingZeros(static_cast<u32>(Get(arg(0)))));
+        break;
+    case IR::Opcode::CountLeadingZeros64:
+        Set(inst, Common::CountLeadingZeros(Get(arg(0))));
+        break;
+    case IR::Opcode::ExtractRegister32:
+        Set(inst, ExtractRegister<u32>(static_cast<u32>(Get(arg(0))), static_cast<u32>(Get(arg(1))), static_cast<u8>(Get(arg(2)))));
+        break;
+    case IR::Opcode::ExtractRegister64:
+        Set(inst, ExtractRegister<u64>(Get(arg(0)), Get(arg(1)), static_cast<u8>(Get(arg(2)))));
+        break;
+    case IR::Opcode::ReplicateBit32:
+        Set(inst, Common::Bit(Get(arg(1)), Get(arg(0))) ? 0xFFFFFFFF : 0);
+        break;
+    case IR::Opcode::ReplicateBit64:
+        Set(inst, Common::Bit(Get(arg(1)), Get(arg(0))) ? ~u64(0) : 0);
+        break;
+    case IR::Opcode::MaxSigned32:
+        Set(inst, static_cast<u32>(std::max(static_cast<s32>(Get(arg(0))), static_cast<s32>(Get(arg(1))))));
+        break;
+    case IR::Opcode::MaxSigned64:
+        Set(inst, static_cast<u64>(std::max(static_cast<s64>(Get(arg(0))), static_cast<s64>(Get(arg(1))))));
+        break;
+    case IR::Opcode::MaxUnsigned32:
+    case IR::Opcode::MaxUnsigned64:
+        Set(inst, std::max(Get(arg(0)), Get(arg(1))));
+        break;
+    case IR::Opcode::MinSigned32:
+        Set(inst, static_cast<u32>(std::min(static_cast<s32>(Get(arg(0))), static_cast<s32>(Get(arg(1))))));
+        break;
+    case IR::Opcode::MinSigned64:
+        Set(inst, static_cast<u64>(std::min(static_cast<s64>(Get(arg(0))), static_cast<s64>(Get(arg(1))))));
+        break;
+    case IR::Opcode::MinUnsigned32:
+    case IR::Opcode::MinUnsigned64:
+        Set(inst, std::min(Get(arg(0)), Get(arg(1))));
+        break;
+    case IR::Opcode::SignedSaturatedAdd8:
+        set_with_overflow(SignedSaturatedAdd<u8>(static_cast<u8>(Get(arg(0))), static_cast<u8>(Get(arg(1)))));
+        break;
+    case IR::Opcode::SignedSaturatedAdd16:
+        set_with_overflow(SignedSaturatedAdd<u16>(static_cast<u16>(Get(arg(0))), static_cast<u16>(Get(arg(1)))));
+        break;
+    case IR::Opcode::SignedSaturatedAdd32:
+        set_with_overflow(SignedSaturatedAdd<u32>(static_cast<u32>(Get(arg(0))), static_cast<u32>(Get(arg(1)))));
+        break;
+    case IR::Opcode::SignedSaturatedAdd64:
+        set_with_overflow(SignedSaturatedAdd<u64>(Get(arg(0)), Get(arg(1))));
+        break;
+    case IR::Opcode::SignedSaturatedSub8:
+        set_with_overflow(SignedSaturatedSub<u8>(static_cast<u8>(Get(arg(0))), static_cast<u8>(Get(arg(1)))));
+        break;
+    case IR::Opcode::SignedSaturatedSub16:
+        set_with_overflow(SignedSaturatedSub<u16>(static_cast<u16>(Get(arg(0))), static_cast<u16>(Get(arg(1)))));
+        break;
+    case IR::Opcode::SignedSaturatedSub32:
+        set_with_overflow(SignedSaturatedSub<u32>(static_cast<u32>(Get(arg(0))), static_cast<u32>(Get(arg(1)))));
+        break;
+    case IR::Opcode::SignedSaturatedSub64:
+        set_with_overflow(SignedSaturatedSub<u64>(Get(arg(0)), Get(arg(1))));
+        break;
+    case IR::Opcode::UnsignedSaturatedAdd8:
+        set_with_overflow(UnsignedSaturatedAdd<u8>(static_cast<u8>(Get(arg(0))), static_cast<u8>(Get(arg(1)))));
+        break;
+    case IR::Opcode::UnsignedSaturatedAdd16:
+        set_with_overflow(UnsignedSaturatedAdd<u16>(static_cast<u16>(Get(arg(0))), static_cast<u16>(Get(arg(1)))));
+        break;
+    case IR::Opcode::UnsignedSaturatedAdd32:
+        set_with_overflow(UnsignedSaturatedAdd<u32>(static_cast<u32>(Get(arg(0))), static_cast<u32>(Get(arg(1)))));
+        break;
+    case IR::Opcode::UnsignedSaturatedAdd64:
+        set_with_overflow(UnsignedSaturatedAdd<u64>(Get(arg(0)), Get(arg(1))));
+        break;
+    case IR::Opcode::UnsignedSaturatedSub8:
+        set_with_overflow(UnsignedSaturatedSub<u8>(static_cast<u8>(Get(arg(0))), static_cast<u8>(Get(arg(1)))));
+        break;
+    case IR::Opcode::UnsignedSaturatedSub16:
+        set_with_overflow(UnsignedSaturatedSub<u16>(static_cast<u16>(Get(arg(0))), static_cast<u16>(Get(arg(1)))));
+        break;
+    case IR::Opcode::UnsignedSaturatedSub32:
+        set_with_overflow(UnsignedSaturatedSub<u32>(static_cast<u32>(Get(arg(0))), static_cast<u32>(Get(arg(1)))));
+        break;
+    case IR::Opcode::UnsignedSaturatedSub64:
+        set_with_overflow(UnsignedSaturatedSub<u64>(Get(arg(0)), Get(arg(1))));
+        break;
+    case IR::Opcode::SignedSaturation: {
+        const s32 value = static_cast<s32>(Get(arg(0)));
+        const size_t N = static_cast<size_t>(Get(arg(1)));
+        if (N == 32) {
+            set_with_overflow(std::make_tuple(static_cast<u32>(value), false));
+            break;
+        }
+        const s32 max = static_cast<s32>((1u << (N - 1)) - 1);
+        const s32 min = -max - 1;
+        if (value > max) {
+            set_with_overflow(std::make_tuple(static_cast<u32>(max), true));
+        } else if (value < min) {
+            set_with_overflow(std::make_tuple(static_cast<u32>(min), true));
+        } else {
+            set_with_overflow(std::make_tuple(static_cast<u32>(value), false));
+        }
+        break;
+    }
+    case IR::Opcode::UnsignedSaturation: {
+        const s32 value = static_cast<s32>(Get(arg(0)));
+        const size_t N = static_cast<size_t>(Get(arg(1)));
+        const s32 max = static_cast<s32>((1u << N) - 1);
+        if (value > max) {
+            set_with_overflow(std::make_tuple(static_cast<u32>(max), true));
+        } else if (value < 0) {
+            set_with_overflow(std::make_tuple(u32(0), true));
+        } else {
+            set_with_overflow(std::make_tuple(static_cast<u32>(value), false));
+        }
+        break;
+    }
+    case IR::Opcode::ZeroExtendLongToQuad:
+        SetVector(inst, {Get(arg(0)), 0});
+        break;
+    case IR::Opcode::VectorGetElement8:
+        Set(inst, VectorGetElement<u8>(GetVector(arg(0)), arg(1).GetU8()));
+        break;
+    case IR::Opcode::VectorGetElement16:
+        Set(inst, VectorGetElement<u16>(GetVector(arg(0)), arg(1).GetU8()));
+        break;
+    case IR::Opcode::VectorGetElement32:
+        Set(inst, VectorGetElement<u32>(GetVector(arg(0)), arg(1).GetU8()));
+        break;
+    case IR::Opcode::VectorGetElement64:
+        Set(inst, VectorGetElement<u64>(GetVector(arg(0)), arg(1).GetU8()));
+        break;
+    case IR::Opcode::VectorSetElement8:
+        SetVector(inst, VectorSetElement<u8>(GetVector(arg(0)), arg(1).GetU8(), static_cast<u8>(Get(arg(2)))));
+        break;
+    case IR::Opcode::VectorSetElement16:
+        SetVector(inst, VectorSetElement<u16>(GetVector(arg(0)), arg(1).GetU8(), static_cast<u16>(Get(arg(2)))));
+        break;
+    case IR::Opcode::VectorSetElement32:
+        SetVector(inst, VectorSetElement<u32>(GetVector(arg(0)), arg(1).GetU8(), static_cast<u32>(Get(arg(2)))));
+        break;
+    case IR::Opcode::VectorSetElement64:
+        SetVector(inst, VectorSetElement<u64>(GetVector(arg(0)), arg(1).GetU8(), Get(arg(2))));
+        break;
+    case IR::Opcode::VectorBroadcast8:
+        SetVector(inst, VectorBroadcast<u8>(static_cast<u8>(Get(arg(0)))));
+        break;
+    case IR::Opcode::VectorBroadcast16:
+        SetVector(inst, VectorBroadcast<u16>(static_cast<u16>(Get(arg(0)))));
+        break;
+    case IR::Opcode::VectorBroadcast32:
+        SetVector(inst, VectorBroadcast<u32>(static_cast<u32>(Get(arg(0)))));
+        break;
+    case IR::Opcode::VectorBroadcast64:
+        SetVector(inst, VectorBroadcast<u64>(Get(arg(0))));
+        break;
+    case IR::Opcode::VectorZeroUpper:
+        SetVector(inst, {GetVector(arg(0))[0], 0});
+        break;
+    case IR::Opcode::ZeroVector:
+        SetVector(inst, {0, 0});
+        break;
+    default:
+        if (IsFPOpcode(inst->GetOpcode())) {
+            ExecuteFP(inst);
+        } else {
+            ExecuteArch(inst);
+        }
+        break;
+    }
+}
+
+void Interpreter::ExecuteFP(IR::Inst* inst) {
+    const auto arg = [inst](size_t i) { return inst->GetArg(i); };
+    const auto rounding = [&](size_t i) { return static_cast<FP::RoundingMode>(arg(i).GetU8()); };
+    const auto h = [&](size_t i) { return static_cast<u16>(Get(arg(i))); };
+    const auto s = [&](size_t i) { return static_cast<u32>(Get(arg(i))); };
+    const auto d = [&](size_t i) { return Get(arg(i)); };
+
+    FP::FPSR fpsr{FPSRExceptions()};
+
+    switch (inst->GetOpcode()) {
+    case IR::Opcode::FPAbs16:
+        Set(inst, h(0) & ~FP::FPInfo<u16>::sign_mask);
+        break;
+    case IR::Opcode::FPAbs32:
+        Set(inst, s(0) & ~FP::FPInfo<u32>::sign_mask);
+        break;
+    case IR::Opcode::FPAbs64:
+        Set(inst, d(0) & ~FP::FPInfo<u64>::sign_mask);
+        break;
+    case IR::Opcode::FPNeg16:
+        Set(inst, FP::FPNeg<u16>(h(0)));
+        break;
+    case IR::Opcode::FPNeg32:
+        Set(inst, FP::FPNeg<u32>(s(0)));
+        break;
+    case IR::Opcode::FPNeg64:
+        Set(inst, FP::FPNeg<u64>(d(0)));
+        break;
+    case IR::Opcode::FPAdd32:
+        Set(inst, FPAdd<u32>(s(0), s(1), fpcr, fpsr));
+        break;
+    case IR::Opcode::FPAdd64:
+        Set(inst, FPAdd<u64>(d(0), d(1), fpcr, fpsr));
+        break;
+    case IR::Opcode::FPSub32:
+        Set(inst, FPSub<u32>(s(0), s(1), fpcr, fpsr));
+        break;
+    case IR::Opcode::FPSub64:
+        Set(inst, FPSub<u64>(d(0), d(1), fpcr, fpsr));
+        break;
+    case IR::Opcode::FPMul32:
+        Set(inst, FPMul<u32>(s(0), s(1), fpcr, fpsr));
+        break;
+    case IR::Opcode::FPMul64:
+        Set(inst, FPMul<u64>(d(0), d(1), fpcr, fpsr));
+        break;
+    case IR::Opcode::FPMulX32:
+        Set(inst, FPMulX<u32>(s(0), s(1), fpcr, fpsr));
+        break;
+    case IR::Opcode::FPMulX64:
+        Set(inst, FPMulX<u64>(d(0), d(1), fpcr, fpsr));
+        break;
+    case IR::Opcode::FPDiv32:
+        Set(inst, FP::FPDiv<u32>(s(0), s(1), fpcr, fpsr));
+        break;
+    case IR::Opcode::FPDiv64:
+        Set(inst, FP::FPDiv<u64>(d(0), d(1), fpcr, fpsr));
+        break;
+    case IR::Opcode::FPSqrt32:
+        Set(inst, FP::FPSqrt<u32>(s(0), fpcr, fpsr));
+        break;
+    case IR::Opcode::FPSqrt64:
+        Set(inst, FP::FPSqrt<u64>(d(0), fpcr, fpsr));
+        break;
+    case IR::Opcode::FPMax32:
+        Set(inst, FP::FPMax<u32>(s(0), s(1), fpcr, fpsr));
+        break;
+    case IR::Opcode::FPMax64:
+        Set(inst, FP::FPMax<u64>(d(0), d(1), fpcr, fpsr));
+        break;
+    case IR::Opcode::FPMaxNumeric32:
+        Set(inst, FP::FPMaxNumeric<u32>(s(0), s(1), fpcr, fpsr));
+        break;
+    case IR::Opcode::FPMaxNumeric64:
+        Set(inst, FP::FPMaxNumeric<u64>(d(0), d(1), fpcr, fpsr));
+        break;
+    case IR::Opcode::FPMin32:
+        Set(inst, FP::FPMin<u32>(s(0), s(1), fpcr, fpsr));
+        break;
+    case IR::Opcode::FPMin64:
+        Set(inst, FP::FPMin<u64>(d(0), d(1), fpcr, fpsr));
+        break;
+    case IR::Opcode::FPMinNumeric32:
+        Set(inst, FP::FPMinNumeric<u32>(s(0), s(1), fpcr, fpsr));
+        break;
+    case IR::Opcode::FPMinNumeric64:
+        Set(inst, FP::FPMinNumeric<u64>(d(0), d(1), fpcr, fpsr));
+        break;
+    case IR::Opcode::FPMulAdd16:
+        Set(inst, FP::FPMulAdd<u16>(h(0), h(1), h(2), fpcr, fpsr));
+        break;
+    case IR::Opcode::FPMulAdd32:
+        Set(inst, FP::FPMulAdd<u32>(s(0), s(1), s(2), fpcr, fpsr));
+        break;
+    case IR::Opcode::FPMulAdd64:
+        Set(inst, FP::FPMulAdd<u64>(d(0), d(1), d(2), fpcr, fpsr));
+        break;
+    case IR::Opcode::FPRecipEstimate16:
+        Set(inst, FP::FPRecipEstimate<u16>(h(0), fpcr, fpsr));
+        break;
+    case IR::Opcode::FPRecipEstimate32:
+        Set(inst, FP::FPRecipEstimate<u32>(s(0), fpcr, fpsr));
+        break;
+    case IR::Opcode::FPRecipEstimate64:
+        Set(inst, FP::FPRecipEstimate<u64>(d(0), fpcr, fpsr));
+        break;
+    case IR::Opcode::FPRecipExponent16:
+        Set(inst, FP::FPRecipExponent<u16>(h(0), fpcr, fpsr));
+        break;
+    case IR::Opcode::FPRecipExponent32:
+        Set(inst, FP::FPRecipExponent<u32>(s(0), fpcr, fpsr));
+        break;
+    case IR::Opcode::FPRecipExponent64:
+        Set(inst, FP::FPRecipExponent<u64>(d(0), fpcr, fpsr));
+        break;
+    case IR::Opcode::FPRecipStepFused16:
+        Set(inst, FP::FPRecipStepFused<u16>(h(0), h(1), fpcr, fpsr));
+        break;
+    case IR::Opcode::FPRecipStepFused32:
+        Set(inst, FP::FPRecipStepFused<u32>(s(0), s(1), fpcr, fpsr));
+        break;
+    case IR::Opcode::FPRecipStepFused64:
+        Set(inst, FP::FPRecipStepFused<u64>(d(0), d(1), fpcr, fpsr));
+        break;
+    case IR::Opcode::FPRSqrtEstimate16:
+        Set(inst, FP::FPRSqrtEstimate<u16>(h(0), fpcr, fpsr));
+        break;
+    case IR::Opcode::FPRSqrtEstimate32:
+        Set(inst, FP::FPRSqrtEstimate<u32>(s(0), fpcr, fpsr));
+        break;
+    case IR::Opcode::FPRSqrtEstimate64:
+        Set(inst, FP::FPRSqrtEstimate<u64>(d(0), fpcr, fpsr));
+        break;
+    case IR::Opcode::FPRSqrtStepFused16:
+        Set(inst, FP::FPRSqrtStepFused<u16>(h(0), h(1), fpcr, fpsr));
+        break;
+    case IR::Opcode::FPRSqrtStepFused32:
+        Set(inst, FP::FPRSqrtStepFused<u32>(s(0), s(1), fpcr, fpsr));
+        break;
+    case IR::Opcode::FPRSqrtStepFused64:
+        Set(inst, FP::FPRSqrtStepFused<u64>(d(0), d(1), fpcr, fpsr));
+        break;
+    case IR::Opcode::FPRoundInt16:
+        Set(inst, FP::FPRoundInt<u16>(h(0), fpcr, rounding(1), arg(2).GetU1(), fpsr));
+        break;
+    case IR::Opcode::FPRoundInt32:
+        Set(inst, FP::FPRoundInt<u32>(s(0), fpcr, rounding(1), arg(2).GetU1(), fpsr));
+        break;
+    case IR::Opcode::FPRoundInt64:
+        Set(inst, FP::FPRoundInt<u64>(d(0), fpcr, rounding(1), arg(2).GetU1(), fpsr));
+        break;
+    case IR::Opcode::FPRoundIntN32:
+        Set(inst, FP::FPRoundIntN<u32>(s(0), fpcr, rounding(1), arg(2).GetU8(), fpsr));
+        break;
+    case IR::Opcode::FPRoundIntN64:
+        Set(inst, FP::FPRoundIntN<u64>(d(0), fpcr, rounding(1), arg(2).GetU8(), fpsr));
+        break;
+    case IR::Opcode::FPCompare32: {
+        Result& result = results[inst];
+        result.value = result.nzcv = FPCompare<u32>(s(0), s(1), arg(2).GetU1(), fpcr, fpsr);
+        break;
+    }
+    case IR::Opcode::FPCompare64: {
+        Result& result = results[inst];
+        result.value = result.nzcv = FPCompare<u64>(d(0), d(1), arg(2).GetU1(), fpcr, fpsr);
+        break;
+    }
+    case IR::Opcode::FPHalfToDouble:
+        Set(inst, FP::FPConvert<u64, u16>(h(0), fpcr, rounding(1), fpsr));
+        break;
+    case IR::Opcode::FPHalfToSingle:
+        Set(inst, FP::FPConvert<u32, u16>(h(0), fpcr, rounding(1), fpsr));
+        break;
+    case IR::Opcode::FPSingleToDouble:
+        Set(inst, FP::FPConvert<u64, u32>(s(0), fpcr, rounding(1), fpsr));
+        break;
+    case IR::Opcode::FPSingleToHalf:
+        Set(inst, FP::FPConvert<u16, u32>(s(0), fpcr, rounding(1), fpsr));
+        break;
+    case IR::Opcode::FPDoubleToHalf:
+        Set(inst, FP::FPConvert<u16, u64>(d(0), fpcr, rounding(1), fpsr));
+        break;
+    case IR::Opcode::FPDoubleToSingle:
+        Set(inst, FP::FPConvert<u32, u64>(d(0), fpcr, rounding(1), fpsr));
+        break;
+    case IR::Opcode::FPDoubleToFixedJS: {
+        const auto [value, z] = FPToFixedJS(d(0), fpcr, fpsr);
+        Result& result = results[inst];
+        result.value = value;
+        result.nzcv = z ? 0x40000000 : 0;
+        break;
+    }
+    default: {
+        const auto to_fixed = [&](auto op, size_t ibits, bool unsigned_) {
+            using FPT = decltype(op);
+            const u64 value = FP::FPToFixed<FPT>(ibits, op, arg(1).GetU8(), unsigned_, fpcr, rounding(2), fpsr);
+            Set(inst, ibits == 64 ? value : value & ((u64(1) << ibits) - 1));
+        };
+        const auto from_fixed = [&](auto zero, size_t ibits, bool unsigned_) {
+            using FPT = decltype(zero);
+            Set(inst, FixedToFP<FPT>(Get(arg(0)), ibits, unsigned_, arg(1).GetU8(), fpcr, rounding(2), fpsr));
+        };
+
+        switch (inst->GetOpcode()) {
+        case IR::Opcode::FPDoubleToFixedS16:
+            to_fixed(d(0), 16, false);
+            break;
+        case IR::Opcode::FPDoubleToFixedS32:
+            to_fixed(d(0), 32, false);
+            break;
+        case IR::Opcode::FPDoubleToFixedS64:
+            to_fixed(d(0), 64, false);
+            break;
+        case IR::Opcode::FPDoubleToFixedU16:
+            to_fixed(d(0), 16, true);
+            break;
+        case IR::Opcode::FPDoubleToFixedU32:
+            to_fixed(d(0), 32, true);
+            break;
+        case IR::Opcode::FPDoubleToFixedU64:
+            to_fixed(d(0), 64, true);
+            break;
+        case IR::Opcode::FPHalfToFixedS16:
+            to_fixed(h(0), 16, false);
+            break;
+        case IR::Opcode::FPHalfToFixedS32:
+            to_fixed(h(0), 32, false);
+            break;
+        case IR::Opcode::FPHalfToFixedS64:
+            to_fixed(h(0), 64, false);
+            break;
+        case IR::Opcode::FPHalfToFixedU16:
+            to_fixed(h(0), 16, true);
+            break;
+        case IR::Opcode::FPHalfToFixedU32:
+            to_fixed(h(0), 32, true);
+            break;
+        case IR::Opcode::FPHalfToFixedU64:
+            to_fixed(h(0), 64, true);
+            break;
+        case IR::Opcode::FPSingleToFixedS16:
+            to_fixed(s(0), 16, false);
+            break;
+        case IR::Opcode::FPSingleToFixedS32:
+            to_fixed(s(0), 32, false);
+            break;
+        case IR::Opcode::FPSingleToFixedS64:
+            to_fixed(s(0), 64, false);
+            break;
+        case IR::Opcode::FPSingleToFixedU16:
+            to_fixed(s(0), 16, true);
+            break;
+        case IR::Opcode::FPSingleToFixedU32:
+            to_fixed(s(0), 32, true);
+            break;
+        case IR::Opcode::FPSingleToFixedU64:
+            to_fixed(s(0), 64, true);
+            break;
+        case IR::Opcode::FPFixedU16ToSingle:
+            from_fixed(u32{}, 16, true);
+            break;
+        case IR::Opcode::FPFixedS16ToSingle:
+            from_fixed(u32{}, 16, false);
+            break;
+        case IR::Opcode::FPFixedU16ToDouble:
+            from_fixed(u64{}, 16, true);
+            break;
+        case IR::Opcode::FPFixedS16ToDouble:
+            from_fixed(u64{}, 16, false);
+            break;
+        case IR::Opcode::FPFixedU32ToSingle:
+            from_fixed(u32{}, 32, true);
+            break;
+        case IR::Opcode::FPFixedS32ToSingle:
+            from_fixed(u32{}, 32, false);
+            break;
+        case IR::Opcode::FPFixedU32ToDouble:
+            from_fixed(u64{}, 32, true);
+            break;
+        case IR::Opcode::FPFixedS32ToDouble:
+            from_fixed(u64{}, 32, false);
+            break;
+        case IR::Opcode::FPFixedU64ToDouble:
+            from_fixed(u64{}, 64, true);
+            break;
+        case IR::Opcode::FPFixedU64ToSingle:
+            from_fixed(u32{}, 64, true);
+            break;
+        case IR::Opcode::FPFixedS64ToDouble:
+            from_fixed(u64{}, 64, false);
+            break;
+        case IR::Opcode::FPFixedS64ToSingle:
+            from_fixed(u32{}, 64, false);
+            break;
+        default:
+            UNREACHABLE();
+        }
+        break;
+    }
+    }
+
+    FPSRExceptions() = fpsr.Value();
+}
+
+} // namespace Dynarmic::Backend::X64
@@ -0,0 +1,82 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#pragma once
+
+#include <array>
+
+#include <tsl/robin_map.h>
+
+#include "common/common_types.h"
+#include "common/fp/fpcr.h"
+
+namespace Dynarmic::IR {
+class Block;
+enum class Cond;
+class Inst;
+class LocationDescriptor;
+class Value;
+} // namespace Dynarmic::IR
+
+namespace Dynarmic::Backend::X64 {
+
+/**
+ * Executes IR blocks directly against the guest state instead of emitting host code for them.
+ *
+ * This serves as a first execution tier for code that has not yet run often enough to be worth
+ * compiling, and for single-stepping, so that neither fills the code cache with blocks that will
+ * rarely run again. Only a subset of the IR is implemented: callers must check CanInterpret and
+ * fall back to compiling blocks which use anything else.
+ *
+ * Values of type NZCV are held in the ARM format (flags in bits 28-31) while interpreting.
+ * Floating-point operations use the software implementations in common/fp.
+ */
+class Interpreter {
+public:
+    virtual ~Interpreter();
+
+    /// Returns true if every instruction in block is implemented by this interpreter.
+    bool CanInterpret(const IR::Block& block) const;
+
+protected:
+    using Vector = std::array<u64, 2>;
+
+    struct Result {
+        u64 value = 0;
+        u64 upper = 0; ///< Upper 64 bits of values of type U128.
+        bool carry = false;
+        bool overflow = false;
+        u32 nzcv = 0;
+    };
+
+    /// Executes the instructions of block in order. The terminal is left to the caller.
+    void ExecuteInstructions(IR::Block& block);
+
+    u64 Get(const IR::Value& arg) const;
+    const Result& GetResult(const IR::Value& arg) const;
+    void Set(IR::Inst* inst, u64 value);
+    Vector GetVector(const IR::Value& arg) const;
+    void SetVector(IR::Inst* inst, Vector value);
+
+    static bool ConditionPassed(IR::Cond cond, u32 nzcv);
+
+    virtual bool CanInterpretArch(const IR::Inst& inst) const = 0;
+    virtual void ExecuteArch(IR::Inst* inst) = 0;
+    /// Returns the current guest NZCV flags in the ARM format.
+    virtual u32 GetNZCV() const = 0;
+    /// Returns the FPCR that blocks at location are translated and executed with.
+    virtual FP::FPCR GetFPCR(IR::LocationDescriptor location) const = 0;
+    /// Returns the cumulative floating-point exception flags in the FPSR format.
+    virtual u32& FPSRExceptions() = 0;
+
+private:
+    void ExecuteInst(IR::Inst* inst);
+    void ExecuteFP(IR::Inst* inst);
+
+    tsl::robin_map<const IR::Inst*, Result> results;
+    FP::FPCR fpcr;
+};
+
+} // namespace Dynarmic::Backend::X64
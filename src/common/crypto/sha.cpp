@@ -0,0 +1,117 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include "common/bit_util.h"
+#include "common/common_types.h"
+#include "common/crypto/sha.h"
+
+namespace Dynarmic::Common::Crypto::SHA {
+
+namespace {
+
+u32 Choose(u32 x, u32 y, u32 z) {
+    return ((y ^ z) & x) ^ z;
+}
+
+u32 Majority(u32 x, u32 y, u32 z) {
+    return (x & y) | ((x | y) & z);
+}
+
+u32 Parity(u32 x, u32 y, u32 z) {
+    return x ^ y ^ z;
+}
+
+u32 Sigma0(u32 x) {
+    return Common::RotateRight(x, 2) ^ Common::RotateRight(x, 13) ^ Common::RotateRight(x, 22);
+}
+
+u32 Sigma1(u32 x) {
+    return Common::RotateRight(x, 6) ^ Common::RotateRight(x, 11) ^ Common::RotateRight(x, 25);
+}
+
+u32 ScheduleSigma0(u32 x) {
+    return Common::RotateRight(x, 7) ^ Common::RotateRight(x, 18) ^ (x >> 3);
+}
+
+u32 ScheduleSigma1(u32 x) {
+    return Common::RotateRight(x, 17) ^ Common::RotateRight(x, 19) ^ (x >> 10);
+}
+
+template<typename Function>
+void SHA1HashUpdate(State& out_state, const State& x, const State& y, const State& w, Function fn) {
+    u32 a = x[0], b = x[1], c = x[2], d = x[3];
+    u32 e = y[0];
+
+    for (size_t i = 0; i < 4; i++) {
+        const u32 t = e + Common::RotateRight(a, 27) + fn(b, c, d) + w[i];
+        e = d;
+        d = c;
+        c = Common::RotateRight(b, 2);
+        b = a;
+        a = t;
+    }
+
+    out_state = {a, b, c, d};
+}
+
+void SHA256Hash(State& x, State& y, const State& w) {
+    for (size_t i = 0; i < 4; i++) {
+        const u32 t = y[3] + Sigma1(y[0]) + Choose(y[0], y[1], y[2]) + w[i];
+        const u32 new_a = t + Sigma0(x[0]) + Majority(x[0], x[1], x[2]);
+        const u32 new_e = t + x[3];
+
+        x = {new_a, x[0], x[1], x[2]};
+        y = {new_e, y[0], y[1], y[2]};
+    }
+}
+
+} // Anonymous namespace
+
+void SHA1HashUpdateChoose(State& out_state, const State& x, const State& y, const State& w) {
+    SHA1HashUpdate(out_state, x, y, w, Choose);
+}
+
+void SHA1HashUpdateMajority(State& out_state, const State& x, const State& y, const State& w) {
+    SHA1HashUpdate(out_state, x, y, w, Majority);
+}
+
+void SHA1HashUpdateParity(State& out_state, const State& x, const State& y, const State& w) {
+    SHA1HashUpdate(out_state, x, y, w, Parity);
+}
+
+void SHA256HashPart1(State& out_state, const State& x, const State& y, const State& w) {
+    State new_x = x;
+    State new_y = y;
+    SHA256Hash(new_x, new_y, w);
+    out_state = new_x;
+}
+
+void SHA256HashPart2(State& out_state, const State& x, const State& y, const State& w) {
+    State new_x = x;
+    State new_y = y;
+    SHA256Hash(new_x, new_y, w);
+    out_state = new_y;
+}
+
+void SHA256MessageSchedule0(State& out_state, const State& d, const State& n) {
+    const State t{d[1], d[2], d[3], n[0]};
+
+    for (size_t i = 0; i < 4; i++) {
+        out_state[i] = d[i] + ScheduleSigma0(t[i]);
+    }
+}
+
+void SHA256MessageSchedule1(State& out_state, const State& d, const State& n, const State& m) {
+    const State t{n[1], n[2], n[3], m[0]};
+
+    const u32 w16 = d[0] + t[0] + ScheduleSigma1(m[2]);
+    const u32 w17 = d[1] + t[1] + ScheduleSigma1(m[3]);
+    const u32 w18 = d[2] + t[2] + ScheduleSigma1(w16);
+    const u32 w19 = d[3] + t[3] + ScheduleSigma1(w17);
+
+    out_state = {w16, w17, w18, w19};
+}
+
+} // namespace Dynarmic::Common::Crypto::SHA
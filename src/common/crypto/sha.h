@@ -0,0 +1,30 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#pragma once
+
+#include <array>
+#include "common/common_types.h"
+
+namespace Dynarmic::Common::Crypto::SHA {
+
+/// Four 32-bit words, with element 0 being the least significant word of the vector register.
+using State = std::array<u32, 4>;
+
+// Each of these performs four rounds of the hash function.
+// x is the hash state (a, b, c, d), y[0] is e, w is the schedule with round constants already added.
+void SHA1HashUpdateChoose(State& out_state, const State& x, const State& y, const State& w);
+void SHA1HashUpdateMajority(State& out_state, const State& x, const State& y, const State& w);
+void SHA1HashUpdateParity(State& out_state, const State& x, const State& y, const State& w);
+
+// x is (a, b, c, d), y is (e, f, g, h), w is the schedule with round constants already added.
+// Part1 returns the updated (a, b, c, d), Part2 returns the updated (e, f, g, h).
+void SHA256HashPart1(State& out_state, const State& x, const State& y, const State& w);
+void SHA256HashPart2(State& out_state, const State& x, const State& y, const State& w);
+
+void SHA256MessageSchedule0(State& out_state, const State& d, const State& n);
+void SHA256MessageSchedule1(State& out_state, const State& d, const State& n, const State& m);
+
+} // namespace Dynarmic::Common::Crypto::SHA
@@ -5,6 +5,7 @@
 
 #include <array>
 
+#include "common/bit_util.h"
 #include "common/common_types.h"
 #include "common/crypto/sm4.h"
 
@@ -47,8 +48,44 @@ constexpr SubstitutionTable substitution_box{{
     0x79, 0xEE, 0x5F, 0x3E, 0xD7, 0xCB, 0x39, 0x48
 }};
 
+namespace {
+
+u32 SubstituteWord(u32 word) {
+    u32 result = 0;
+    for (size_t i = 0; i < 4; i++) {
+        result |= u32{AccessSubstitutionBox(static_cast<u8>(word >> (i * 8)))} << (i * 8);
+    }
+    return result;
+}
+
+template<typename LinearTransform>
+void FourRounds(State& out_state, const State& state, const State& round_keys, LinearTransform transform) {
+    State x = state;
+
+    for (size_t i = 0; i < 4; i++) {
+        const u32 b = SubstituteWord(x[1] ^ x[2] ^ x[3] ^ round_keys[i]);
+        x = {x[1], x[2], x[3], x[0] ^ transform(b)};
+    }
+
+    out_state = x;
+}
+
+} // Anonymous namespace
+
 u8 AccessSubstitutionBox(u8 index) {
     return substitution_box[index];
 }
 
+void EncryptFourRounds(State& out_state, const State& state, const State& round_keys) {
+    FourRounds(out_state, state, round_keys, [](u32 b) {
+        return b ^ Common::RotateRight(b, 30) ^ Common::RotateRight(b, 22) ^ Common::RotateRight(b, 14) ^ Common::RotateRight(b, 8);
+    });
+}
+
+void ExpandKeyFourRounds(State& out_state, const State& state, const State& constants) {
+    FourRounds(out_state, state, constants, [](u32 b) {
+        return b ^ Common::RotateRight(b, 19) ^ Common::RotateRight(b, 9);
+    });
+}
+
 } // namespace Dynarmic::Common::Crypto::SM4
@@ -5,10 +5,18 @@
 
 #pragma once
 
+#include <array>
 #include "common/common_types.h"
 
 namespace Dynarmic::Common::Crypto::SM4 {
 
+/// Four 32-bit words, with element 0 being the least significant word of the vector register.
+using State = std::array<u32, 4>;
+
 u8 AccessSubstitutionBox(u8 index);
 
+// Each of these performs four rounds, consuming one word of round_keys (or key schedule constants) per round.
+void EncryptFourRounds(State& out_state, const State& state, const State& round_keys);
+void ExpandKeyFourRounds(State& out_state, const State& state, const State& constants);
+
 } // namespace Dynarmic::Common::Crypto::SM4
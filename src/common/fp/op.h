@@ -7,6 +7,8 @@
 
 #include "common/fp/op/FPCompare.h"
 #include "common/fp/op/FPConvert.h"
+#include "common/fp/op/FPDiv.h"
+#include "common/fp/op/FPMinMax.h"
 #include "common/fp/op/FPMulAdd.h"
 #include "common/fp/op/FPRecipEstimate.h"
 #include "common/fp/op/FPRecipExponent.h"
@@ -14,4 +16,5 @@
 #include "common/fp/op/FPRoundInt.h"
 #include "common/fp/op/FPRSqrtEstimate.h"
 #include "common/fp/op/FPRSqrtStepFused.h"
+#include "common/fp/op/FPSqrt.h"
 #include "common/fp/op/FPToFixed.h"
@@ -5,12 +5,24 @@
 
 #include "common/fp/fpcr.h"
 #include "common/fp/fpsr.h"
+#include "common/fp/info.h"
 #include "common/fp/op/FPCompare.h"
 #include "common/fp/process_exception.h"
 #include "common/fp/unpacked.h"
 
 namespace Dynarmic::FP {
 
+namespace {
+
+/// Maps a non-NaN value onto a signed integer with the same ordering. Both zeroes map to zero.
+template <typename FPT>
+s64 OrderingKey(FPType type, bool sign, FPT op) {
+    const s64 magnitude = type == FPType::Zero ? 0 : static_cast<s64>(op & ~FPInfo<FPT>::sign_mask);
+    return sign ? -magnitude : magnitude;
+}
+
+} // anonymous namespace
+
 template <typename FPT>
 bool FPCompareEQ(FPT lhs, FPT rhs, FPCR fpcr, FPSR& fpsr) {
     const auto unpacked1 = FPUnpack(lhs, fpcr, fpsr);
@@ -33,8 +45,46 @@ bool FPCompareEQ(FPT lhs, FPT rhs, FPCR fpcr, FPSR& fpsr) {
     return value1 == value2 || (type1 == FPType::Zero && type2 == FPType::Zero);
 }
 
+template <typename FPT>
+bool FPCompareGE(FPT lhs, FPT rhs, FPCR fpcr, FPSR& fpsr) {
+    const auto [type1, sign1, value1] = FPUnpack(lhs, fpcr, fpsr);
+    const auto [type2, sign2, value2] = FPUnpack(rhs, fpcr, fpsr);
+
+    if (type1 == FPType::QNaN || type1 == FPType::SNaN ||
+        type2 == FPType::QNaN || type2 == FPType::SNaN) {
+        // Ordered comparisons signal on quiet NaNs too.
+        FPProcessException(FPExc::InvalidOp, fpcr, fpsr);
+        return false;
+    }
+
+    return OrderingKey(type1, sign1, lhs) >= OrderingKey(type2, sign2, rhs);
+}
+
+template <typename FPT>
+bool FPCompareGT(FPT lhs, FPT rhs, FPCR fpcr, FPSR& fpsr) {
+    const auto [type1, sign1, value1] = FPUnpack(lhs, fpcr, fpsr);
+    const auto [type2, sign2, value2] = FPUnpack(rhs, fpcr, fpsr);
+
+    if (type1 == FPType::QNaN || type1 == FPType::SNaN ||
+        type2 == FPType::QNaN || type2 == FPType::SNaN) {
+        // Ordered comparisons signal on quiet NaNs too.
+        FPProcessException(FPExc::InvalidOp, fpcr, fpsr);
+        return false;
+    }
+
+    return OrderingKey(type1, sign1, lhs) > OrderingKey(type2, sign2, rhs);
+}
+
 template bool FPCompareEQ<u16>(u16 lhs, u16 rhs, FPCR fpcr, FPSR& fpsr);
 template bool FPCompareEQ<u32>(u32 lhs, u32 rhs, FPCR fpcr, FPSR& fpsr);
 template bool FPCompareEQ<u64>(u64 lhs, u64 rhs, FPCR fpcr, FPSR& fpsr);
 
+template bool FPCompareGE<u16>(u16 lhs, u16 rhs, FPCR fpcr, FPSR& fpsr);
+template bool FPCompareGE<u32>(u32 lhs, u32 rhs, FPCR fpcr, FPSR& fpsr);
+template bool FPCompareGE<u64>(u64 lhs, u64 rhs, FPCR fpcr, FPSR& fpsr);
+
+template bool FPCompareGT<u16>(u16 lhs, u16 rhs, FPCR fpcr, FPSR& fpsr);
+template bool FPCompareGT<u32>(u32 lhs, u32 rhs, FPCR fpcr, FPSR& fpsr);
+template bool FPCompareGT<u64>(u64 lhs, u64 rhs, FPCR fpcr, FPSR& fpsr);
+
 } // namespace Dynarmic::FP
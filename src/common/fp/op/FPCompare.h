@@ -13,4 +13,10 @@ class FPSR;
 template <typename FPT>
 bool FPCompareEQ(FPT lhs, FPT rhs, FPCR fpcr, FPSR& fpsr);
 
+template <typename FPT>
+bool FPCompareGE(FPT lhs, FPT rhs, FPCR fpcr, FPSR& fpsr);
+
+template <typename FPT>
+bool FPCompareGT(FPT lhs, FPT rhs, FPCR fpcr, FPSR& fpsr);
+
 } // namespace Dynarmic::FP
@@ -0,0 +1,71 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include "common/common_types.h"
+#include "common/fp/fpcr.h"
+#include "common/fp/fpsr.h"
+#include "common/fp/info.h"
+#include "common/fp/op/FPDiv.h"
+#include "common/fp/process_exception.h"
+#include "common/fp/process_nan.h"
+#include "common/fp/unpacked.h"
+
+namespace Dynarmic::FP {
+
+template<typename FPT>
+FPT FPDiv(FPT op1, FPT op2, FPCR fpcr, FPSR& fpsr) {
+    const auto [type1, sign1, value1] = FPUnpack(op1, fpcr, fpsr);
+    const auto [type2, sign2, value2] = FPUnpack(op2, fpcr, fpsr);
+
+    if (const auto maybe_nan = FPProcessNaNs(type1, type2, op1, op2, fpcr, fpsr)) {
+        return *maybe_nan;
+    }
+
+    const bool inf1 = type1 == FPType::Infinity;
+    const bool inf2 = type2 == FPType::Infinity;
+    const bool zero1 = type1 == FPType::Zero;
+    const bool zero2 = type2 == FPType::Zero;
+    const bool sign = sign1 != sign2;
+
+    if ((inf1 && inf2) || (zero1 && zero2)) {
+        FPProcessException(FPExc::InvalidOp, fpcr, fpsr);
+        return FPInfo<FPT>::DefaultNaN();
+    }
+
+    if (inf1 || zero2) {
+        if (!inf1) {
+            FPProcessException(FPExc::DivideByZero, fpcr, fpsr);
+        }
+        return FPInfo<FPT>::Infinity(sign);
+    }
+
+    if (zero1 || inf2) {
+        return FPInfo<FPT>::Zero(sign);
+    }
+
+    // Restoring long division of the normalized mantissas, producing a quotient with at least 62
+    // significant bits. Any remainder is folded into a sticky bit.
+    const u64 divisor = value2.mantissa;
+    u64 quotient = value1.mantissa >= divisor ? 1 : 0;
+    u64 remainder = value1.mantissa - (quotient != 0 ? divisor : 0);
+    for (size_t i = 0; i < normalized_point_position; i++) {
+        quotient <<= 1;
+        remainder <<= 1;
+        if (remainder >= divisor) {
+            remainder -= divisor;
+            quotient |= 1;
+        }
+    }
+    quotient |= remainder != 0 ? 1 : 0;
+
+    const int exponent = value1.exponent - value2.exponent - static_cast<int>(normalized_point_position);
+    return FPRound<FPT>(ToNormalized(sign, exponent, quotient), fpcr, fpsr);
+}
+
+template u16 FPDiv<u16>(u16 op1, u16 op2, FPCR fpcr, FPSR& fpsr);
+template u32 FPDiv<u32>(u32 op1, u32 op2, FPCR fpcr, FPSR& fpsr);
+template u64 FPDiv<u64>(u64 op1, u64 op2, FPCR fpcr, FPSR& fpsr);
+
+} // namespace Dynarmic::FP
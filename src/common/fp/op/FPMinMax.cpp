@@ -0,0 +1,96 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include "common/common_types.h"
+#include "common/fp/fpcr.h"
+#include "common/fp/fpsr.h"
+#include "common/fp/info.h"
+#include "common/fp/op/FPCompare.h"
+#include "common/fp/op/FPMinMax.h"
+#include "common/fp/process_nan.h"
+#include "common/fp/unpacked.h"
+
+namespace Dynarmic::FP {
+
+namespace {
+
+template<typename FPT, bool is_max>
+FPT FPMinMax(FPT op1, FPT op2, FPCR fpcr, FPSR& fpsr) {
+    const auto [type1, sign1, value1] = FPUnpack(op1, fpcr, fpsr);
+    const auto [type2, sign2, value2] = FPUnpack(op2, fpcr, fpsr);
+
+    if (const auto maybe_nan = FPProcessNaNs(type1, type2, op1, op2, fpcr, fpsr)) {
+        return *maybe_nan;
+    }
+
+    if (type1 == FPType::Zero && type2 == FPType::Zero) {
+        return FPInfo<FPT>::Zero(is_max ? sign1 && sign2 : sign1 || sign2);
+    }
+
+    const bool take_op1 = is_max ? FPCompareGT(op1, op2, fpcr, fpsr) : FPCompareGT(op2, op1, fpcr, fpsr);
+    const FPType type = take_op1 ? type1 : type2;
+    const bool sign = take_op1 ? sign1 : sign2;
+
+    // Denormals flushed on input are returned as zeroes; everything else is returned unchanged.
+    if (type == FPType::Zero) {
+        return FPInfo<FPT>::Zero(sign);
+    }
+    return take_op1 ? op1 : op2;
+}
+
+template<typename FPT, bool is_max>
+FPT FPMinMaxNumeric(FPT op1, FPT op2, FPCR fpcr, FPSR& fpsr) {
+    const auto [type1, sign1, value1] = FPUnpack(op1, fpcr, fpsr);
+    const auto [type2, sign2, value2] = FPUnpack(op2, fpcr, fpsr);
+
+    // A single quiet NaN is treated as the infinity that loses the comparison.
+    if (type1 == FPType::QNaN && type2 != FPType::QNaN) {
+        op1 = FPInfo<FPT>::Infinity(is_max);
+    } else if (type1 != FPType::QNaN && type2 == FPType::QNaN) {
+        op2 = FPInfo<FPT>::Infinity(is_max);
+    }
+
+    return FPMinMax<FPT, is_max>(op1, op2, fpcr, fpsr);
+}
+
+} // anonymous namespace
+
+template<typename FPT>
+FPT FPMax(FPT op1, FPT op2, FPCR fpcr, FPSR& fpsr) {
+    return FPMinMax<FPT, true>(op1, op2, fpcr, fpsr);
+}
+
+template<typename FPT>
+FPT FPMaxNumeric(FPT op1, FPT op2, FPCR fpcr, FPSR& fpsr) {
+    return FPMinMaxNumeric<FPT, true>(op1, op2, fpcr, fpsr);
+}
+
+template<typename FPT>
+FPT FPMin(FPT op1, FPT op2, FPCR fpcr, FPSR& fpsr) {
+    return FPMinMax<FPT, false>(op1, op2, fpcr, fpsr);
+}
+
+template<typename FPT>
+FPT FPMinNumeric(FPT op1, FPT op2, FPCR fpcr, FPSR& fpsr) {
+    return FPMinMaxNumeric<FPT, false>(op1, op2, fpcr, fpsr);
+}
+
+template u16 FPMax<u16>(u16 op1, u16 op2, FPCR fpcr, FPSR& fpsr);
+template u32 FPMax<u32>(u32 op1, u32 op2, FPCR fpcr, FPSR& fpsr);
+template u64 FPMax<u64>(u64 op1, u64 op2, FPCR fpcr, FPSR& fpsr);
+
+template u16 FPMaxNumeric<u16>(u16 op1, u16 op2, FPCR fpcr, FPSR& fpsr);
+template u32 FPMaxNumeric<u32>(u32 op1, u32 op2, FPCR fpcr, FPSR& fpsr);
+template u64 FPMaxNumeric<u64>(u64 op1, u64 op2, FPCR fpcr, FPSR& fpsr);
+
+template u16 FPMin<u16>(u16 op1, u16 op2, FPCR fpcr, FPSR& fpsr);
+template u32 FPMin<u32>(u32 op1, u32 op2, FPCR fpcr, FPSR& fpsr);
+template u64 FPMin<u64>(u64 op1, u64 op2, FPCR fpcr, FPSR& fpsr);
+
+template u16 FPMinNumeric<u16>(u16 op1, u16 op2, FPCR fpcr, FPSR& fpsr);
+template u32 FPMinNumeric<u32>(u32 op1, u32 op2, FPCR fpcr, FPSR& fpsr);
+template u64 FPMinNumeric<u64>(u64 op1, u64 op2, FPCR fpcr, FPSR& fpsr);
+
+} // namespace Dynarmic::FP
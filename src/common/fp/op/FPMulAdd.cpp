@@ -3,11 +3,14 @@
  * SPDX-License-Identifier: 0BSD
  */
 
+#include <optional>
+
 #include "common/common_types.h"
 #include "common/fp/fpcr.h"
 #include "common/fp/fpsr.h"
 #include "common/fp/info.h"
 #include "common/fp/fused.h"
+#include "common/fp/op/FPConvert.h"
 #include "common/fp/op/FPMulAdd.h"
 #include "common/fp/process_exception.h"
 #include "common/fp/process_nan.h"
@@ -76,4 +79,66 @@ template u16 FPMulAdd<u16>(u16 addend, u16 op1, u16 op2, FPCR fpcr, FPSR& fpsr);
 template u32 FPMulAdd<u32>(u32 addend, u32 op1, u32 op2, FPCR fpcr, FPSR& fpsr);
 template u64 FPMulAdd<u64>(u64 addend, u64 op1, u64 op2, FPCR fpcr, FPSR& fpsr);
 
+namespace {
+
+/// Processes a half-precision NaN operand and converts it to single precision.
+u32 FPProcessNaNH(FPType type, u16 op, FPCR fpcr, FPSR& fpsr) {
+    const u16 result = FPProcessNaN<u16>(type, op, fpcr, fpsr);
+    fpcr.AHP(false);
+    return FPConvert<u32>(result, fpcr, fpcr.RMode(), fpsr);
+}
+
+/// Converts a half-precision operand that is not a NaN to single precision. This is exact.
+u32 FPWidenH(FPType type, bool sign, FPUnpacked value, FPCR fpcr, FPSR& fpsr) {
+    switch (type) {
+    case FPType::Zero:
+        return FPInfo<u32>::Zero(sign);
+    case FPType::Infinity:
+        return FPInfo<u32>::Infinity(sign);
+    default:
+        return FPRound<u32>(value, fpcr, fpsr);
+    }
+}
+
+} // anonymous namespace
+
+u32 FPMulAddH(u32 addend, u16 op1, u16 op2, FPCR fpcr, FPSR& fpsr) {
+    const auto [typeA, signA, valueA] = FPUnpack(addend, fpcr, fpsr);
+    const auto [type1, sign1, value1] = FPUnpack(op1, fpcr, fpsr);
+    const auto [type2, sign2, value2] = FPUnpack(op2, fpcr, fpsr);
+
+    const bool inf1 = type1 == FPType::Infinity;
+    const bool inf2 = type2 == FPType::Infinity;
+    const bool zero1 = type1 == FPType::Zero;
+    const bool zero2 = type2 == FPType::Zero;
+
+    // NaN priority is as FPProcessNaNs3, with half-precision NaNs converted to single precision.
+    std::optional<u32> maybe_nan;
+    if (typeA == FPType::SNaN) {
+        maybe_nan = FPProcessNaN<u32>(typeA, addend, fpcr, fpsr);
+    } else if (type1 == FPType::SNaN) {
+        maybe_nan = FPProcessNaNH(type1, op1, fpcr, fpsr);
+    } else if (type2 == FPType::SNaN) {
+        maybe_nan = FPProcessNaNH(type2, op2, fpcr, fpsr);
+    } else if (typeA == FPType::QNaN) {
+        maybe_nan = FPProcessNaN<u32>(typeA, addend, fpcr, fpsr);
+    } else if (type1 == FPType::QNaN) {
+        maybe_nan = FPProcessNaNH(type1, op1, fpcr, fpsr);
+    } else if (type2 == FPType::QNaN) {
+        maybe_nan = FPProcessNaNH(type2, op2, fpcr, fpsr);
+    }
+
+    if (typeA == FPType::QNaN && ((inf1 && zero2) || (zero1 && inf2))) {
+        FPProcessException(FPExc::InvalidOp, fpcr, fpsr);
+        return FPInfo<u32>::DefaultNaN();
+    }
+
+    if (maybe_nan) {
+        return *maybe_nan;
+    }
+
+    // Both operands are exactly representable in single precision, so the remaining cases are as FPMulAdd.
+    return FPMulAdd<u32>(addend, FPWidenH(type1, sign1, value1, fpcr, fpsr), FPWidenH(type2, sign2, value2, fpcr, fpsr), fpcr, fpsr);
+}
+
 } // namespace Dynarmic::FP
@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include "common/common_types.h"
+
 namespace Dynarmic::FP {
 
 class FPCR;
@@ -13,4 +15,7 @@ class FPSR;
 template<typename FPT>
 FPT FPMulAdd(FPT addend, FPT op1, FPT op2, FPCR fpcr, FPSR& fpsr);
 
+/// Fused multiply-add of two half-precision operands to a single-precision addend, as FMLAL and FMLSL perform.
+u32 FPMulAddH(u32 addend, u16 op1, u16 op2, FPCR fpcr, FPSR& fpsr);
+
 } // namespace Dynarmic::FP
@@ -49,6 +49,20 @@ FPT FPRSqrtEstimate(FPT op, FPCR fpcr, FPSR& fpsr) {
     return (bits_exponent << FPInfo<FPT>::explicit_mantissa_width) | (bits_mantissa & FPInfo<FPT>::mantissa_mask);
 }
 
+const std::array<u32, 513>& FPRSqrtEstimateTable() {
+    static const std::array<u32, 513> table = [] {
+        std::array<u32, 513> result{};
+        for (u64 i = 0; i < 512; i++) {
+            // An odd biased exponent is an even unbiased exponent, which uses one fewer bit of the fraction.
+            const bool was_exponent_odd = (i & 0x100) != 0;
+            const u64 fraction = i & 0xFF;
+            result[i] = Common::RecipSqrtEstimate(was_exponent_odd ? 128 + (fraction >> 1) : 256 + fraction);
+        }
+        return result;
+    }();
+    return table;
+}
+
 template u16 FPRSqrtEstimate<u16>(u16 op, FPCR fpcr, FPSR& fpsr);
 template u32 FPRSqrtEstimate<u32>(u32 op, FPCR fpcr, FPSR& fpsr);
 template u64 FPRSqrtEstimate<u64>(u64 op, FPCR fpcr, FPSR& fpsr);
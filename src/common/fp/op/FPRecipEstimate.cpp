@@ -91,6 +91,17 @@ FPT FPRecipEstimate(FPT op, FPCR fpcr, FPSR& fpsr) {
     return FPT((bits_exponent << FPInfo<FPT>::explicit_mantissa_width) | (bits_mantissa & FPInfo<FPT>::mantissa_mask) | bits_sign);
 }
 
+const std::array<u32, 257>& FPRecipEstimateTable() {
+    static const std::array<u32, 257> table = [] {
+        std::array<u32, 257> result{};
+        for (u64 i = 0; i < 256; i++) {
+            result[i] = Common::RecipEstimate(256 + i);
+        }
+        return result;
+    }();
+    return table;
+}
+
 template u16 FPRecipEstimate<u16>(u16 op, FPCR fpcr, FPSR& fpsr);
 template u32 FPRecipEstimate<u32>(u32 op, FPCR fpcr, FPSR& fpsr);
 template u64 FPRecipEstimate<u64>(u64 op, FPCR fpcr, FPSR& fpsr);
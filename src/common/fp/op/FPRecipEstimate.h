@@ -5,6 +5,10 @@
 
 #pragma once
 
+#include <array>
+
+#include "common/common_types.h"
+
 namespace Dynarmic::FP {
 
 class FPCR;
@@ -13,4 +17,9 @@ class FPSR;
 template<typename FPT>
 FPT FPRecipEstimate(FPT op, FPCR fpcr, FPSR& fpsr);
 
+/// The estimates produced by FPRecipEstimate for normal operands, indexed by the upper eight bits
+/// of the operand's fraction. Emitted code uses this to compute estimates without a call.
+/// The final entry is padding so that the table may be read with wide loads.
+const std::array<u32, 257>& FPRecipEstimateTable();
+
 } // namespace Dynarmic::FP
@@ -92,4 +92,41 @@ template u64 FPRoundInt<u16>(u16 op, FPCR fpcr, RoundingMode rounding, bool exac
 template u64 FPRoundInt<u32>(u32 op, FPCR fpcr, RoundingMode rounding, bool exact, FPSR& fpsr);
 template u64 FPRoundInt<u64>(u64 op, FPCR fpcr, RoundingMode rounding, bool exact, FPSR& fpsr);
 
+template<typename FPT>
+u64 FPRoundIntN(FPT op, FPCR fpcr, RoundingMode rounding, size_t intsize, FPSR& fpsr) {
+    ASSERT(intsize == 32 || intsize == 64);
+
+    // NaNs, infinities and values that round outside of the intsize-bit signed integer range
+    // all produce the most negative integer and raise only the invalid operation exception.
+    const FPT most_negative = static_cast<FPT>(FPInfo<FPT>::sign_mask | ((FPInfo<FPT>::exponent_bias + intsize - 1) << FPInfo<FPT>::explicit_mantissa_width));
+
+    FPSR rounding_fpsr;
+    const auto type = std::get<FPType>(FPUnpack<FPT>(op, fpcr, rounding_fpsr));
+
+    if (type == FPType::SNaN || type == FPType::QNaN || type == FPType::Infinity) {
+        FPProcessException(FPExc::InvalidOp, fpcr, fpsr);
+        return most_negative;
+    }
+
+    const FPT result = static_cast<FPT>(FPRoundInt<FPT>(op, fpcr, rounding, true, rounding_fpsr));
+
+    FPSR unused_fpsr;
+    const auto [result_type, result_sign, result_value] = FPUnpack<FPT>(result, fpcr, unused_fpsr);
+    const int max_exponent = static_cast<int>(intsize) - 1;
+    const bool in_range = result_type == FPType::Zero
+                       || result_value.exponent < max_exponent
+                       || (result_sign && result_value.exponent == max_exponent && result_value.mantissa == u64(1) << normalized_point_position);
+
+    if (!in_range) {
+        FPProcessException(FPExc::InvalidOp, fpcr, fpsr);
+        return most_negative;
+    }
+
+    fpsr = fpsr.Value() | rounding_fpsr.Value();
+    return result;
+}
+
+template u64 FPRoundIntN<u32>(u32 op, FPCR fpcr, RoundingMode rounding, size_t intsize, FPSR& fpsr);
+template u64 FPRoundIntN<u64>(u64 op, FPCR fpcr, RoundingMode rounding, size_t intsize, FPSR& fpsr);
+
 } // namespace Dynarmic::FP
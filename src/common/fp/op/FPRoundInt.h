@@ -16,4 +16,7 @@ enum class RoundingMode;
 template<typename FPT>
 u64 FPRoundInt(FPT op, FPCR fpcr, RoundingMode rounding, bool exact, FPSR& fpsr);
 
+template<typename FPT>
+u64 FPRoundIntN(FPT op, FPCR fpcr, RoundingMode rounding, size_t intsize, FPSR& fpsr);
+
 } // namespace Dynarmic::FP
@@ -0,0 +1,78 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include <tuple>
+
+#include "common/common_types.h"
+#include "common/fp/fpcr.h"
+#include "common/fp/fpsr.h"
+#include "common/fp/info.h"
+#include "common/fp/op/FPSqrt.h"
+#include "common/fp/process_exception.h"
+#include "common/fp/process_nan.h"
+#include "common/fp/unpacked.h"
+#include "common/u128.h"
+
+namespace Dynarmic::FP {
+
+namespace {
+
+/// Returns floor(sqrt(value)) and whether the root is inexact.
+std::tuple<u64, bool> IntegerSqrt(u128 value) {
+    u128 result = 0;
+    for (int i = 63; i >= 0; i--) {
+        const u128 bit = u128(1) << (2 * i);
+        if (value >= result + bit) {
+            value = value - (result + bit);
+            result = (result >> 1) + bit;
+        } else {
+            result = result >> 1;
+        }
+    }
+    return {result.lower, value != 0};
+}
+
+} // anonymous namespace
+
+template<typename FPT>
+FPT FPSqrt(FPT op, FPCR fpcr, FPSR& fpsr) {
+    const auto [type, sign, value] = FPUnpack(op, fpcr, fpsr);
+
+    if (type == FPType::SNaN || type == FPType::QNaN) {
+        return FPProcessNaN(type, op, fpcr, fpsr);
+    }
+
+    if (type == FPType::Zero) {
+        return FPInfo<FPT>::Zero(sign);
+    }
+
+    if (sign) {
+        FPProcessException(FPExc::InvalidOp, fpcr, fpsr);
+        return FPInfo<FPT>::DefaultNaN();
+    }
+
+    if (type == FPType::Infinity) {
+        return FPInfo<FPT>::Infinity(false);
+    }
+
+    // value = radicand * 2^exponent, where the radicand is the mantissa widened to 128 bits and
+    // the exponent is made even. The integer root then has 62 or 63 significant bits.
+    int exponent = value.exponent - static_cast<int>(normalized_point_position) * 2;
+    u128 radicand = u128(value.mantissa) << static_cast<int>(normalized_point_position);
+    if (exponent % 2 != 0) {
+        radicand = u128(value.mantissa) << static_cast<int>(normalized_point_position - 1);
+        exponent++;
+    }
+
+    const auto [root, inexact] = IntegerSqrt(radicand);
+
+    return FPRound<FPT>(ToNormalized(false, exponent / 2, root | (inexact ? 1 : 0)), fpcr, fpsr);
+}
+
+template u16 FPSqrt<u16>(u16 op, FPCR fpcr, FPSR& fpsr);
+template u32 FPSqrt<u32>(u32 op, FPCR fpcr, FPSR& fpsr);
+template u64 FPSqrt<u64>(u64 op, FPCR fpcr, FPSR& fpsr);
+
+} // namespace Dynarmic::FP
@@ -22,6 +22,9 @@ public:
     }
 
     IR::Cond Cond() const {
+        if (value == 0b00000000) {
+            return IR::Cond::AL;
+        }
         return static_cast<IR::Cond>(Common::Bits<4, 7>(value));
     }
     void Cond(IR::Cond cond) {
@@ -44,12 +47,12 @@ public:
     }
 
     ITState Advance() const {
-        ITState result{*this};
-        result.Mask(result.Mask() << 1);
-        if (result.Mask() == 0) {
-            return ITState{0};
+        if (Common::Bits<0, 2>(value) == 0b000) {
+            return ITState{0b00000000};
         }
-        return result;
+        // ITSTATE<4:0> is shifted as a whole: the least significant bit of the condition is
+        // replaced by the next bit of the mask.
+        return ITState{Common::ModifyBits<0, 4>(value, static_cast<u8>(value << 1))};
     }
 
     u8 Value() const {
@@ -269,6 +269,19 @@ public:
         return "yield";
     }
 
+    std::string thumb16_IT(Imm<8> imm8) {
+        const Cond firstcond = imm8.Bits<4, 7, Cond>();
+        const bool firstcond0 = imm8.Bit<4>();
+        const u32 mask = imm8.Bits<0, 3>();
+
+        std::string xyz;
+        for (size_t i = 3; i > 0 && Common::Bits(0, i, mask) != (1U << i); i--) {
+            xyz += Common::Bit(i, mask) == firstcond0 ? 't' : 'e';
+        }
+
+        return fmt::format("it{} {}", xyz, CondToString(firstcond));
+    }
+
     std::string thumb16_SXTH(Reg m, Reg d) {
         return fmt::format("sxth {}, {}", d, m);
     }
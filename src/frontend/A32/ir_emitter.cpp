@@ -92,6 +92,10 @@ void IREmitter::LoadWritePC(const IR::U32& value) {
     BXWritePC(value);
 }
 
+void IREmitter::UpdateUpperLocationDescriptor() {
+    Inst(Opcode::A32UpdateUpperLocationDescriptor);
+}
+
 void IREmitter::CallSupervisor(const IR::U32& value) {
     Inst(Opcode::A32CallSupervisor, value);
 }
@@ -124,10 +128,22 @@ void IREmitter::SetCheckBit(const IR::U1& value) {
     Inst(Opcode::A32SetCheckBit, value);
 }
 
+IR::U1 IREmitter::GetNFlag() {
+    return Inst<IR::U1>(Opcode::A32GetNFlag);
+}
+
+IR::U1 IREmitter::GetZFlag() {
+    return Inst<IR::U1>(Opcode::A32GetZFlag);
+}
+
 IR::U1 IREmitter::GetCFlag() {
     return Inst<IR::U1>(Opcode::A32GetCFlag);
 }
 
+IR::U1 IREmitter::GetVFlag() {
+    return Inst<IR::U1>(Opcode::A32GetVFlag);
+}
+
 void IREmitter::SetNFlag(const IR::U1& value) {
     Inst(Opcode::A32SetNFlag, value);
 }
@@ -207,21 +223,21 @@ IR::UAny IREmitter::ReadMemory(size_t bitsize, const IR::U32& vaddr) {
 }
 
 IR::U8 IREmitter::ReadMemory8(const IR::U32& vaddr) {
-    return Inst<IR::U8>(Opcode::A32ReadMemory8, vaddr);
+    return Inst<IR::U8>(Opcode::A32ReadMemory8, vaddr, IR::Value{IR::Cond::AL});
 }
 
 IR::U16 IREmitter::ReadMemory16(const IR::U32& vaddr) {
-    const auto value = Inst<IR::U16>(Opcode::A32ReadMemory16, vaddr);
+    const auto value = Inst<IR::U16>(Opcode::A32ReadMemory16, vaddr, IR::Value{IR::Cond::AL});
     return current_location.EFlag() ? ByteReverseHalf(value) : value;
 }
 
 IR::U32 IREmitter::ReadMemory32(const IR::U32& vaddr) {
-    const auto value = Inst<IR::U32>(Opcode::A32ReadMemory32, vaddr);
+    const auto value = Inst<IR::U32>(Opcode::A32ReadMemory32, vaddr, IR::Value{IR::Cond::AL});
     return current_location.EFlag() ? ByteReverseWord(value) : value;
 }
 
 IR::U64 IREmitter::ReadMemory64(const IR::U32& vaddr) {
-    const auto value = Inst<IR::U64>(Opcode::A32ReadMemory64, vaddr);
+    const auto value = Inst<IR::U64>(Opcode::A32ReadMemory64, vaddr, IR::Value{IR::Cond::AL});
     return current_location.EFlag() ? ByteReverseDual(value) : value;
 }
 
@@ -265,33 +281,33 @@ void IREmitter::WriteMemory(size_t bitsize, const IR::U32& vaddr, const IR::UAny
 }
 
 void IREmitter::WriteMemory8(const IR::U32& vaddr, const IR::U8& value) {
-    Inst(Opcode::A32WriteMemory8, vaddr, value);
+    Inst(Opcode::A32WriteMemory8, vaddr, value, IR::Value{IR::Cond::AL});
 }
 
 void IREmitter::WriteMemory16(const IR::U32& vaddr, const IR::U16& value) {
     if (current_location.EFlag()) {
         const auto v = ByteReverseHalf(value);
-        Inst(Opcode::A32WriteMemory16, vaddr, v);
+        Inst(Opcode::A32WriteMemory16, vaddr, v, IR::Value{IR::Cond::AL});
     } else {
-        Inst(Opcode::A32WriteMemory16, vaddr, value);
+        Inst(Opcode::A32WriteMemory16, vaddr, value, IR::Value{IR::Cond::AL});
     }
 }
 
 void IREmitter::WriteMemory32(const IR::U32& vaddr, const IR::U32& value) {
     if (current_location.EFlag()) {
         const auto v = ByteReverseWord(value);
-        Inst(Opcode::A32WriteMemory32, vaddr, v);
+        Inst(Opcode::A32WriteMemory32, vaddr, v, IR::Value{IR::Cond::AL});
     } else {
-        Inst(Opcode::A32WriteMemory32, vaddr, value);
+        Inst(Opcode::A32WriteMemory32, vaddr, value, IR::Value{IR::Cond::AL});
     }
 }
 
 void IREmitter::WriteMemory64(const IR::U32& vaddr, const IR::U64& value) {
     if (current_location.EFlag()) {
         const auto v = ByteReverseDual(value);
-        Inst(Opcode::A32WriteMemory64, vaddr, v);
+        Inst(Opcode::A32WriteMemory64, vaddr, v, IR::Value{IR::Cond::AL});
     } else {
-        Inst(Opcode::A32WriteMemory64, vaddr, value);
+        Inst(Opcode::A32WriteMemory64, vaddr, value, IR::Value{IR::Cond::AL});
     }
 }
 
@@ -44,6 +44,7 @@ public:
     void BranchWritePC(const IR::U32& value);
     void BXWritePC(const IR::U32& value);
     void LoadWritePC(const IR::U32& value);
+    void UpdateUpperLocationDescriptor();
 
     void CallSupervisor(const IR::U32& value);
     void ExceptionRaised(Exception exception);
@@ -54,7 +55,10 @@ public:
     void SetCpsrNZCV(const IR::NZCV& value);
     void SetCpsrNZCVQ(const IR::U32& value);
     void SetCheckBit(const IR::U1& value);
+    IR::U1 GetNFlag();
+    IR::U1 GetZFlag();
     IR::U1 GetCFlag();
+    IR::U1 GetVFlag();
     void SetNFlag(const IR::U1& value);
     void SetZFlag(const IR::U1& value);
     void SetCFlag(const IR::U1& value);
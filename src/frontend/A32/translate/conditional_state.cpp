@@ -0,0 +1,226 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2016 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include "common/assert.h"
+#include "frontend/A32/ir_emitter.h"
+#include "frontend/A32/translate/conditional_state.h"
+#include "frontend/A32/types.h"
+#include "frontend/ir/basic_block.h"
+#include "frontend/ir/microinstruction.h"
+#include "frontend/ir/opcodes.h"
+#include "frontend/ir/terminal.h"
+
+namespace Dynarmic::A32 {
+
+bool CondCanContinue(ConditionalState cond_state, const A32::IREmitter& ir) {
+    ASSERT_MSG(cond_state != ConditionalState::Break, "Should never happen.");
+
+    // Conditional instructions after the block's leading conditional run are predicated on the
+    // flags at that point, so writes to the CPSR only matter while that run may still be extended.
+    if (cond_state == ConditionalState::None || cond_state == ConditionalState::Trailing)
+        return true;
+
+    // TODO: This is more conservative than necessary.
+    return std::all_of(ir.block.begin(), ir.block.end(), [](const IR::Inst& inst) { return !inst.WritesToCPSR(); });
+}
+
+bool IsConditionPassed(IR::Cond cond, ConditionalState& cond_state, IR::Cond& predicate, A32::IREmitter& ir, int instruction_size) {
+    ASSERT_MSG(cond_state != ConditionalState::Break,
+               "This should never happen. We requested a break but that wasn't honored.");
+
+    // In Thumb mode the IT state advances with every instruction, including those that fail their condition.
+    const auto next_location = ir.current_location.AdvancePC(instruction_size).AdvanceIT();
+
+    if (cond_state == ConditionalState::Translating) {
+        if (ir.block.ConditionFailedLocation() != ir.current_location || cond == IR::Cond::AL) {
+            cond_state = ConditionalState::Trailing;
+        } else {
+            if (cond == ir.block.GetCondition()) {
+                ir.block.SetConditionFailedLocation(next_location);
+                ir.block.ConditionFailedCycleCount()++;
+                return true;
+            }
+
+            // cond has changed, so the block's conditional run ends here
+            cond_state = ConditionalState::Trailing;
+        }
+    }
+
+    if (cond == IR::Cond::AL) {
+        // Everything is fine with the world
+        return true;
+    }
+
+    // non-AL cond
+
+    if (!ir.block.empty()) {
+        // We've already emitted instructions. Try to predicate this instruction;
+        // if that isn't possible PredicateInstruction ends the block, and we'll make a new block here later.
+        cond_state = ConditionalState::Predicating;
+        predicate = cond;
+        return true;
+    }
+
+    // We've not emitted instructions yet.
+    // We'll emit one instruction, and set the block-entry conditional appropriately.
+
+    cond_state = ConditionalState::Translating;
+    ir.block.SetCondition(cond);
+    ir.block.SetConditionFailedLocation(next_location);
+    ir.block.ConditionFailedCycleCount() = ir.block.CycleCount() + 1;
+    return true;
+}
+
+bool PredicateInstruction(IR::Cond predicate, ConditionalState& cond_state, IR::Inst* last_inst, bool should_continue, A32::IREmitter& ir) {
+    ASSERT(cond_state == ConditionalState::Predicating);
+
+    const auto instruction_begin = [&] {
+        return last_inst ? std::next(IR::Block::iterator{*last_inst}) : ir.block.begin();
+    };
+    const auto first_inst = instruction_begin();
+
+    const auto is_predicable_flag_write = [](const IR::Inst& inst) {
+        switch (inst.GetOpcode()) {
+        case IR::Opcode::A32SetCpsrNZCV:
+        case IR::Opcode::A32SetCpsrNZCVRaw:
+        case IR::Opcode::A32SetNFlag:
+        case IR::Opcode::A32SetZFlag:
+        case IR::Opcode::A32SetCFlag:
+        case IR::Opcode::A32SetVFlag:
+        case IR::Opcode::A32OrQFlag:
+        case IR::Opcode::A32SetGEFlags:
+            return true;
+        default:
+            return false;
+        }
+    };
+
+    const auto is_predicable = [&](const IR::Inst& inst) {
+        switch (inst.GetOpcode()) {
+        case IR::Opcode::A32SetRegister:
+            return inst.GetArg(0).GetA32RegRef() != Reg::PC;
+        case IR::Opcode::A32SetExtendedRegister32:
+        case IR::Opcode::A32SetExtendedRegister64:
+            return true;
+        default:
+            // Exclusive accesses also alter the exclusive state, so they cannot be predicated.
+            return is_predicable_flag_write(inst)
+                || inst.IsSharedMemoryReadOrWrite()
+                || (!inst.MayHaveSideEffects() && !inst.IsMemoryReadOrWrite());
+        }
+    };
+
+    // Flag writes are moved behind the rest of the instruction below, so that every condition
+    // is evaluated against the flags from before it. This requires nothing to observe them early.
+    const auto first_flag_write = std::find_if(first_inst, ir.block.end(), [](const IR::Inst& inst) { return inst.WritesToCPSR(); });
+    const bool reads_own_flags = std::any_of(first_flag_write, ir.block.end(), [](const IR::Inst& inst) { return inst.ReadsFromCPSR(); });
+
+    if (should_continue && !ir.block.HasTerminal() && !reads_own_flags && std::all_of(first_inst, ir.block.end(), is_predicable)) {
+        std::vector<IR::Inst*> flag_writes;
+        for (auto iter = first_flag_write; iter != ir.block.end();) {
+            IR::Inst& inst = *iter++;
+            if (inst.WritesToCPSR()) {
+                ir.block.Instructions().remove(inst);
+                flag_writes.push_back(&inst);
+            }
+        }
+        for (IR::Inst* inst : flag_writes) {
+            ir.block.Instructions().push_back(inst);
+        }
+
+        for (auto iter = instruction_begin(); iter != ir.block.end(); ++iter) {
+            ir.SetInsertionPoint(iter);
+
+            switch (iter->GetOpcode()) {
+            case IR::Opcode::A32SetRegister: {
+                const Reg reg = iter->GetArg(0).GetA32RegRef();
+                iter->SetArg(1, ir.ConditionalSelect(predicate, IR::U32{iter->GetArg(1)}, ir.GetRegister(reg)));
+                break;
+            }
+            case IR::Opcode::A32SetExtendedRegister32:
+            case IR::Opcode::A32SetExtendedRegister64: {
+                const ExtReg reg = iter->GetArg(0).GetA32ExtRegRef();
+                iter->SetArg(1, ir.ConditionalSelect(predicate, IR::U32U64{iter->GetArg(1)}, ir.GetExtendedRegister(reg)));
+                break;
+            }
+            case IR::Opcode::A32ReadMemory8:
+            case IR::Opcode::A32ReadMemory16:
+            case IR::Opcode::A32ReadMemory32:
+            case IR::Opcode::A32ReadMemory64:
+            case IR::Opcode::A32WriteMemory8:
+            case IR::Opcode::A32WriteMemory16:
+            case IR::Opcode::A32WriteMemory32:
+            case IR::Opcode::A32WriteMemory64:
+                // The backend branches around the access if the predicate fails.
+                iter->SetArg(iter->NumArgs() - 1, IR::Value{predicate});
+                break;
+            default:
+                break;
+            }
+        }
+
+        // The selects of all flag writes are emitted before the first of them.
+        if (!flag_writes.empty()) {
+            ir.SetInsertionPoint(flag_writes.front());
+        }
+        for (IR::Inst* inst : flag_writes) {
+            switch (inst->GetOpcode()) {
+            case IR::Opcode::A32SetCpsrNZCV:
+                inst->SetArg(0, ir.ConditionalSelect(predicate, IR::NZCV{inst->GetArg(0)}, ir.NZCVFromPackedFlags(ir.GetCpsr())));
+                break;
+            case IR::Opcode::A32SetCpsrNZCVRaw:
+                inst->SetArg(0, ir.ConditionalSelect(predicate, IR::U32{inst->GetArg(0)}, ir.GetCpsr()));
+                break;
+            case IR::Opcode::A32SetNFlag:
+                inst->SetArg(0, ir.ConditionalSelect(predicate, IR::U1{inst->GetArg(0)}, ir.GetNFlag()));
+                break;
+            case IR::Opcode::A32SetZFlag:
+                inst->SetArg(0, ir.ConditionalSelect(predicate, IR::U1{inst->GetArg(0)}, ir.GetZFlag()));
+                break;
+            case IR::Opcode::A32SetCFlag:
+                inst->SetArg(0, ir.ConditionalSelect(predicate, IR::U1{inst->GetArg(0)}, ir.GetCFlag()));
+                break;
+            case IR::Opcode::A32SetVFlag:
+                inst->SetArg(0, ir.ConditionalSelect(predicate, IR::U1{inst->GetArg(0)}, ir.GetVFlag()));
+                break;
+            case IR::Opcode::A32OrQFlag:
+                inst->SetArg(0, ir.ConditionalSelect(predicate, IR::U1{inst->GetArg(0)}, ir.Imm1(false)));
+                break;
+            case IR::Opcode::A32SetGEFlags:
+                inst->SetArg(0, ir.ConditionalSelect(predicate, IR::U32{inst->GetArg(0)}, ir.GetGEFlags()));
+                break;
+            default:
+                UNREACHABLE();
+            }
+        }
+
+        ir.SetInsertionPoint(ir.block.end());
+        cond_state = ConditionalState::Trailing;
+        return true;
+    }
+
+    // Remove this instruction's IR again, last use first.
+    while (!ir.block.empty() && &ir.block.back() != last_inst) {
+        IR::Inst& inst = ir.block.back();
+        inst.Invalidate();
+        ir.block.Instructions().remove(inst);
+    }
+
+    const IR::Term::LinkBlockFast terminal{ir.current_location};
+    if (ir.block.HasTerminal()) {
+        ir.block.ReplaceTerminal(terminal);
+    } else {
+        ir.SetTerm(terminal);
+    }
+
+    cond_state = ConditionalState::Break;
+    return false;
+}
+
+} // namespace Dynarmic::A32
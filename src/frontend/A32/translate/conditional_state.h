@@ -0,0 +1,51 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2016 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#pragma once
+
+#include "common/common_types.h"
+#include "frontend/ir/cond.h"
+
+namespace Dynarmic::IR {
+class Inst;
+} // namespace Dynarmic::IR
+
+namespace Dynarmic::A32 {
+
+class IREmitter;
+
+enum class ConditionalState {
+    /// We haven't met any conditional instructions yet.
+    None,
+    /// Current instruction is a conditional. This marks the end of this basic block.
+    Break,
+    /// This basic block is made up solely of conditional instructions.
+    Translating,
+    /// This basic block is made up of conditional instructions followed by unconditional instructions.
+    Trailing,
+    /// Current instruction is a conditional in the middle of this basic block. It is translated
+    /// with its register writes, flag writes and memory accesses predicated on its condition.
+    /// See PredicateInstruction.
+    Predicating,
+};
+
+bool CondCanContinue(ConditionalState cond_state, const A32::IREmitter& ir);
+
+/// Decides whether the instruction at ir.current_location (of the given size in bytes) can be
+/// translated into the current block given its condition, updating cond_state as appropriate.
+/// If the instruction is to be predicated, cond_state is set to Predicating and predicate to its condition.
+/// Returns false if the block must end before this instruction.
+bool IsConditionPassed(IR::Cond cond, ConditionalState& cond_state, IR::Cond& predicate, A32::IREmitter& ir, int instruction_size);
+
+/// Completes translation of an instruction which IsConditionPassed decided to predicate.
+/// The instruction's IR starts after last_inst (or at the beginning of the block if last_inst is null).
+/// Register and flag writes are made conditional on predicate by selecting between the new and old
+/// values, and memory accesses are given predicate as their condition. Flag writes are moved to the
+/// end of the instruction so that all of these observe the flags from before it.
+/// If the IR has any other effects, it is removed again and the block ends before this instruction.
+/// Returns false if the block must end.
+bool PredicateInstruction(IR::Cond predicate, ConditionalState& cond_state, IR::Inst* last_inst, bool should_continue, A32::IREmitter& ir);
+
+} // namespace Dynarmic::A32
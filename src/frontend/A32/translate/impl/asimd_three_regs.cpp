@@ -27,6 +27,11 @@ enum class WidenBehaviour {
     Both,
 };
 
+enum class Rounding {
+    None,
+    Round,
+};
+
 template <bool WithDst, typename Callable>
 bool BitwiseInstruction(ArmTranslatorVisitor& v, bool D, size_t Vn, size_t Vd, bool N, bool Q, bool M, size_t Vm, Callable fn) {
     if (Q && (Common::Bit<0>(Vd) || Common::Bit<0>(Vn) || Common::Bit<0>(Vm))) {
@@ -245,6 +250,40 @@ bool WideInstruction(ArmTranslatorVisitor& v, bool U, bool D, size_t sz, size_t
     return true;
 }
 
+template <typename Callable>
+bool HighNarrowingInstruction(ArmTranslatorVisitor& v, bool D, size_t sz, size_t Vn, size_t Vd, bool N, bool M, size_t Vm, Rounding rounding, Callable fn) {
+    if (sz == 0b11) {
+        return v.DecodeError();
+    }
+
+    if (Common::Bit<0>(Vn) || Common::Bit<0>(Vm)) {
+        return v.UndefinedInstruction();
+    }
+
+    const size_t esize = 8U << sz;
+    const size_t wide_esize = 2 * esize;
+    const auto d = ToVector(false, Vd, D);
+    const auto m = ToVector(true, Vm, M);
+    const auto n = ToVector(true, Vn, N);
+
+    const auto reg_n = v.ir.GetVector(n);
+    const auto reg_m = v.ir.GetVector(m);
+    const auto wide = [&] {
+        const auto tmp = fn(wide_esize, reg_n, reg_m);
+
+        if (rounding == Rounding::Round) {
+            const auto round_const = v.ir.VectorBroadcast(wide_esize, v.I(wide_esize, u64(1) << (esize - 1)));
+            return v.ir.VectorAdd(wide_esize, tmp, round_const);
+        }
+
+        return tmp;
+    }();
+    const auto result = v.ir.VectorNarrow(wide_esize, v.ir.VectorLogicalShiftRight(wide_esize, wide, static_cast<u8>(esize)));
+
+    v.ir.SetVector(d, result);
+    return true;
+}
+
 } // Anonymous namespace
 
 // ASIMD Three registers of the same length
@@ -516,6 +555,32 @@ bool ArmTranslatorVisitor::asimd_VRSHL(bool U, bool D, size_t sz, size_t Vn, siz
     return true;
 }
 
+bool ArmTranslatorVisitor::asimd_VQRSHL(bool U, bool D, size_t sz, size_t Vn, size_t Vd, bool N, bool Q, bool M, size_t Vm) {
+    if (Q && (Common::Bit<0>(Vd) || Common::Bit<0>(Vn) || Common::Bit<0>(Vm))) {
+        return UndefinedInstruction();
+    }
+
+    const size_t esize = 8U << sz;
+    const auto d = ToVector(Q, Vd, D);
+    const auto m = ToVector(Q, Vm, M);
+    const auto n = ToVector(Q, Vn, N);
+
+    const auto reg_m = ir.GetVector(m);
+    const auto reg_n = ir.GetVector(n);
+
+    // A left shift of an integer is exact, so rounding only matters for right shifts, and a rounded
+    // right shift can never saturate. Select per element on the sign of the shift amount.
+    const auto saturated = U ? ir.VectorUnsignedSaturatedShiftLeft(esize, reg_m, reg_n)
+                             : ir.VectorSignedSaturatedShiftLeft(esize, reg_m, reg_n);
+    const auto rounded = U ? ir.VectorRoundingShiftLeftUnsigned(esize, reg_m, reg_n)
+                           : ir.VectorRoundingShiftLeftSigned(esize, reg_m, reg_n);
+    const auto is_right_shift = ir.VectorArithmeticShiftRight(esize, ir.VectorLogicalShiftLeft(esize, reg_n, static_cast<u8>(esize - 8)), static_cast<u8>(esize - 1));
+    const auto result = ir.VectorEor(saturated, ir.VectorAnd(ir.VectorEor(saturated, rounded), is_right_shift));
+
+    ir.SetVector(d, result);
+    return true;
+}
+
 bool ArmTranslatorVisitor::asimd_VMAX(bool U, bool D, size_t sz, size_t Vn, size_t Vd, bool N, bool Q, bool M, bool op, size_t Vm) {
     if (sz == 0b11) {
         return UndefinedInstruction();
@@ -850,10 +915,34 @@ bool ArmTranslatorVisitor::asimd_VSUBL(bool U, bool D, size_t sz, size_t Vn, siz
     });
 }
 
+bool ArmTranslatorVisitor::asimd_VADDHN(bool D, size_t sz, size_t Vn, size_t Vd, bool N, bool M, size_t Vm) {
+    return HighNarrowingInstruction(*this, D, sz, Vn, Vd, N, M, Vm, Rounding::None, [this](size_t esize, const auto& reg_n, const auto& reg_m) {
+        return ir.VectorAdd(esize, reg_n, reg_m);
+    });
+}
+
+bool ArmTranslatorVisitor::asimd_VRADDHN(bool D, size_t sz, size_t Vn, size_t Vd, bool N, bool M, size_t Vm) {
+    return HighNarrowingInstruction(*this, D, sz, Vn, Vd, N, M, Vm, Rounding::Round, [this](size_t esize, const auto& reg_n, const auto& reg_m) {
+        return ir.VectorAdd(esize, reg_n, reg_m);
+    });
+}
+
 bool ArmTranslatorVisitor::asimd_VABAL(bool U, bool D, size_t sz, size_t Vn, size_t Vd, bool N, bool M, size_t Vm) {
     return AbsoluteDifferenceLong(*this, U, D, sz, Vn, Vd, N, M, Vm, AccumulateBehavior::Accumulate);
 }
 
+bool ArmTranslatorVisitor::asimd_VSUBHN(bool D, size_t sz, size_t Vn, size_t Vd, bool N, bool M, size_t Vm) {
+    return HighNarrowingInstruction(*this, D, sz, Vn, Vd, N, M, Vm, Rounding::None, [this](size_t esize, const auto& reg_n, const auto& reg_m) {
+        return ir.VectorSub(esize, reg_n, reg_m);
+    });
+}
+
+bool ArmTranslatorVisitor::asimd_VRSUBHN(bool D, size_t sz, size_t Vn, size_t Vd, bool N, bool M, size_t Vm) {
+    return HighNarrowingInstruction(*this, D, sz, Vn, Vd, N, M, Vm, Rounding::Round, [this](size_t esize, const auto& reg_n, const auto& reg_m) {
+        return ir.VectorSub(esize, reg_n, reg_m);
+    });
+}
+
 bool ArmTranslatorVisitor::asimd_VABDL(bool U, bool D, size_t sz, size_t Vn, size_t Vd, bool N, bool M, size_t Vm) {
     return AbsoluteDifferenceLong(*this, U, D, sz, Vn, Vd, N, M, Vm, AccumulateBehavior::None);
 }
@@ -866,6 +955,31 @@ bool ArmTranslatorVisitor::asimd_VMLAL(bool U, bool D, size_t sz, size_t Vn, siz
     });
 }
 
+bool ArmTranslatorVisitor::asimd_VQDMLAL(bool D, size_t sz, size_t Vn, size_t Vd, bool op, bool N, bool M, size_t Vm) {
+    if (sz == 0b11) {
+        return DecodeError();
+    }
+
+    if (sz == 0b00 || Common::Bit<0>(Vd)) {
+        return UndefinedInstruction();
+    }
+
+    const size_t esize = 8U << sz;
+    const auto d = ToVector(true, Vd, D);
+    const auto m = ToVector(false, Vm, M);
+    const auto n = ToVector(false, Vn, N);
+
+    const auto reg_d = ir.GetVector(d);
+    const auto reg_n = ir.GetVector(n);
+    const auto reg_m = ir.GetVector(m);
+    const auto product = ir.VectorSignedSaturatedDoublingMultiplyLong(esize, reg_n, reg_m);
+    const auto result = op ? ir.VectorSignedSaturatedSub(2 * esize, reg_d, product)
+                           : ir.VectorSignedSaturatedAdd(2 * esize, reg_d, product);
+
+    ir.SetVector(d, result);
+    return true;
+}
+
 bool ArmTranslatorVisitor::asimd_VMULL(bool U, bool D, size_t sz, size_t Vn, size_t Vd, bool P, bool N, bool M, size_t Vm) {
     if (sz == 0b11) {
         return DecodeError();
@@ -893,4 +1007,26 @@ bool ArmTranslatorVisitor::asimd_VMULL(bool U, bool D, size_t sz, size_t Vn, siz
     return true;
 }
 
+bool ArmTranslatorVisitor::asimd_VQDMULL(bool D, size_t sz, size_t Vn, size_t Vd, bool N, bool M, size_t Vm) {
+    if (sz == 0b11) {
+        return DecodeError();
+    }
+
+    if (sz == 0b00 || Common::Bit<0>(Vd)) {
+        return UndefinedInstruction();
+    }
+
+    const size_t esize = 8U << sz;
+    const auto d = ToVector(true, Vd, D);
+    const auto m = ToVector(false, Vm, M);
+    const auto n = ToVector(false, Vn, N);
+
+    const auto reg_n = ir.GetVector(n);
+    const auto reg_m = ir.GetVector(m);
+    const auto result = ir.VectorSignedSaturatedDoublingMultiplyLong(esize, reg_n, reg_m);
+
+    ir.SetVector(d, result);
+    return true;
+}
+
 } // namespace Dynarmic::A32
@@ -4,6 +4,7 @@
  */
 
 #include "frontend/A32/translate/impl/translate_arm.h"
+#include "frontend/A32/translate/impl/translate_common.h"
 
 namespace Dynarmic::A32 {
 
@@ -407,20 +408,7 @@ bool ArmTranslatorVisitor::arm_SMMUL(Cond cond, Reg d, Reg m, bool R, Reg n) {
     return true;
 }
 
-// SMLAD{X}<c> <Rd>, <Rn>, <Rm>, <Ra>
-bool ArmTranslatorVisitor::arm_SMLAD(Cond cond, Reg d, Reg a, Reg m, bool M, Reg n) {
-    if (a == Reg::PC) {
-        return arm_SMUAD(cond, d, m, M, n);
-    }
-
-    if (d == Reg::PC || n == Reg::PC || m == Reg::PC) {
-        return UnpredictableInstruction();
-    }
-
-    if (!ConditionPassed(cond)) {
-        return true;
-    }
-
+void SignedDualMultiply(A32::IREmitter& ir, Reg d, Reg a, Reg m, bool M, Reg n, bool subtract) {
     const IR::U32 n32 = ir.GetRegister(n);
     const IR::U32 m32 = ir.GetRegister(m);
     const IR::U32 n_lo = ir.SignExtendHalfToWord(ir.LeastSignificantHalf(n32));
@@ -434,30 +422,26 @@ bool ArmTranslatorVisitor::arm_SMLAD(Cond cond, Reg d, Reg a, Reg m, bool M, Reg
 
     const IR::U32 product_lo = ir.Mul(n_lo, m_lo);
     const IR::U32 product_hi = ir.Mul(n_hi, m_hi);
-    const IR::U32 addend = ir.GetRegister(a);
-
-    auto result_overflow = ir.AddWithCarry(product_lo, product_hi, ir.Imm1(0));
-    ir.OrQFlag(result_overflow.overflow);
-    result_overflow = ir.AddWithCarry(result_overflow.result, addend, ir.Imm1(0));
-    ir.SetRegister(d, result_overflow.result);
-    ir.OrQFlag(result_overflow.overflow);
-    return true;
-}
 
-// SMLALD{X}<c> <RdLo>, <RdHi>, <Rn>, <Rm>
-bool ArmTranslatorVisitor::arm_SMLALD(Cond cond, Reg dHi, Reg dLo, Reg m, bool M, Reg n) {
-    if (dLo == Reg::PC || dHi == Reg::PC || n == Reg::PC || m == Reg::PC) {
-        return UnpredictableInstruction();
+    IR::U32 result;
+    if (subtract) {
+        result = ir.Sub(product_lo, product_hi);
+    } else {
+        const auto result_overflow = ir.AddWithCarry(product_lo, product_hi, ir.Imm1(0));
+        ir.OrQFlag(result_overflow.overflow);
+        result = result_overflow.result;
     }
 
-    if (dLo == dHi) {
-        return UnpredictableInstruction();
+    if (a != Reg::PC) {
+        const auto result_overflow = ir.AddWithCarry(result, ir.GetRegister(a), ir.Imm1(0));
+        ir.OrQFlag(result_overflow.overflow);
+        result = result_overflow.result;
     }
 
-    if (!ConditionPassed(cond)) {
-        return true;
-    }
+    ir.SetRegister(d, result);
+}
 
+void SignedDualMultiplyLong(A32::IREmitter& ir, Reg dHi, Reg dLo, Reg m, bool M, Reg n, bool subtract) {
     const IR::U32 n32 = ir.GetRegister(n);
     const IR::U32 m32 = ir.GetRegister(m);
     const IR::U32 n_lo = ir.SignExtendHalfToWord(ir.LeastSignificantHalf(n32));
@@ -472,17 +456,17 @@ bool ArmTranslatorVisitor::arm_SMLALD(Cond cond, Reg dHi, Reg dLo, Reg m, bool M
     const IR::U64 product_lo = ir.SignExtendWordToLong(ir.Mul(n_lo, m_lo));
     const IR::U64 product_hi = ir.SignExtendWordToLong(ir.Mul(n_hi, m_hi));
     const auto addend = ir.Pack2x32To1x64(ir.GetRegister(dLo), ir.GetRegister(dHi));
-    const auto result = ir.Add(ir.Add(product_lo, product_hi), addend);
+    const auto product = subtract ? ir.Sub(product_lo, product_hi) : ir.Add(product_lo, product_hi);
+    const auto result = ir.Add(product, addend);
 
     ir.SetRegister(dLo, ir.LeastSignificantWord(result));
     ir.SetRegister(dHi, ir.MostSignificantWord(result).result);
-    return true;
 }
 
-// SMLSD{X}<c> <Rd>, <Rn>, <Rm>, <Ra>
-bool ArmTranslatorVisitor::arm_SMLSD(Cond cond, Reg d, Reg a, Reg m, bool M, Reg n) {
+// SMLAD{X}<c> <Rd>, <Rn>, <Rm>, <Ra>
+bool ArmTranslatorVisitor::arm_SMLAD(Cond cond, Reg d, Reg a, Reg m, bool M, Reg n) {
     if (a == Reg::PC) {
-        return arm_SMUSD(cond, d, m, M, n);
+        return arm_SMUAD(cond, d, m, M, n);
     }
 
     if (d == Reg::PC || n == Reg::PC || m == Reg::PC) {
@@ -493,25 +477,43 @@ bool ArmTranslatorVisitor::arm_SMLSD(Cond cond, Reg d, Reg a, Reg m, bool M, Reg
         return true;
     }
 
-    const IR::U32 n32 = ir.GetRegister(n);
-    const IR::U32 m32 = ir.GetRegister(m);
-    const IR::U32 n_lo = ir.SignExtendHalfToWord(ir.LeastSignificantHalf(n32));
-    const IR::U32 n_hi = ir.ArithmeticShiftRight(n32, ir.Imm8(16), ir.Imm1(0)).result;
+    SignedDualMultiply(ir, d, a, m, M, n, false);
+    return true;
+}
 
-    IR::U32 m_lo = ir.SignExtendHalfToWord(ir.LeastSignificantHalf(m32));
-    IR::U32 m_hi = ir.ArithmeticShiftRight(m32, ir.Imm8(16), ir.Imm1(0)).result;
-    if (M) {
-        std::swap(m_lo, m_hi);
+// SMLALD{X}<c> <RdLo>, <RdHi>, <Rn>, <Rm>
+bool ArmTranslatorVisitor::arm_SMLALD(Cond cond, Reg dHi, Reg dLo, Reg m, bool M, Reg n) {
+    if (dLo == Reg::PC || dHi == Reg::PC || n == Reg::PC || m == Reg::PC) {
+        return UnpredictableInstruction();
     }
 
-    const IR::U32 product_lo = ir.Mul(n_lo, m_lo);
-    const IR::U32 product_hi = ir.Mul(n_hi, m_hi);
-    const IR::U32 addend = ir.GetRegister(a);
-    const IR::U32 product = ir.Sub(product_lo, product_hi);
-    auto result_overflow = ir.AddWithCarry(product, addend, ir.Imm1(0));
+    if (dLo == dHi) {
+        return UnpredictableInstruction();
+    }
 
-    ir.SetRegister(d, result_overflow.result);
-    ir.OrQFlag(result_overflow.overflow);
+    if (!ConditionPassed(cond)) {
+        return true;
+    }
+
+    SignedDualMultiplyLong(ir, dHi, dLo, m, M, n, false);
+    return true;
+}
+
+// SMLSD{X}<c> <Rd>, <Rn>, <Rm>, <Ra>
+bool ArmTranslatorVisitor::arm_SMLSD(Cond cond, Reg d, Reg a, Reg m, bool M, Reg n) {
+    if (a == Reg::PC) {
+        return arm_SMUSD(cond, d, m, M, n);
+    }
+
+    if (d == Reg::PC || n == Reg::PC || m == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+
+    if (!ConditionPassed(cond)) {
+        return true;
+    }
+
+    SignedDualMultiply(ir, d, a, m, M, n, true);
     return true;
 }
 
@@ -529,24 +531,7 @@ bool ArmTranslatorVisitor::arm_SMLSLD(Cond cond, Reg dHi, Reg dLo, Reg m, bool M
         return true;
     }
 
-    const IR::U32 n32 = ir.GetRegister(n);
-    const IR::U32 m32 = ir.GetRegister(m);
-    const IR::U32 n_lo = ir.SignExtendHalfToWord(ir.LeastSignificantHalf(n32));
-    const IR::U32 n_hi = ir.ArithmeticShiftRight(n32, ir.Imm8(16), ir.Imm1(0)).result;
-
-    IR::U32 m_lo = ir.SignExtendHalfToWord(ir.LeastSignificantHalf(m32));
-    IR::U32 m_hi = ir.ArithmeticShiftRight(m32, ir.Imm8(16), ir.Imm1(0)).result;
-    if (M) {
-        std::swap(m_lo, m_hi);
-    }
-
-    const IR::U64 product_lo = ir.SignExtendWordToLong(ir.Mul(n_lo, m_lo));
-    const IR::U64 product_hi = ir.SignExtendWordToLong(ir.Mul(n_hi, m_hi));
-    const auto addend = ir.Pack2x32To1x64(ir.GetRegister(dLo), ir.GetRegister(dHi));
-    const auto result = ir.Add(ir.Sub(product_lo, product_hi), addend);
-
-    ir.SetRegister(dLo, ir.LeastSignificantWord(result));
-    ir.SetRegister(dHi, ir.MostSignificantWord(result).result);
+    SignedDualMultiplyLong(ir, dHi, dLo, m, M, n, true);
     return true;
 }
 
@@ -560,23 +545,7 @@ bool ArmTranslatorVisitor::arm_SMUAD(Cond cond, Reg d, Reg m, bool M, Reg n) {
         return true;
     }
 
-    const IR::U32 n32 = ir.GetRegister(n);
-    const IR::U32 m32 = ir.GetRegister(m);
-    const IR::U32 n_lo = ir.SignExtendHalfToWord(ir.LeastSignificantHalf(n32));
-    const IR::U32 n_hi = ir.ArithmeticShiftRight(n32, ir.Imm8(16), ir.Imm1(0)).result;
-
-    IR::U32 m_lo = ir.SignExtendHalfToWord(ir.LeastSignificantHalf(m32));
-    IR::U32 m_hi = ir.ArithmeticShiftRight(m32, ir.Imm8(16), ir.Imm1(0)).result;
-    if (M) {
-        std::swap(m_lo, m_hi);
-    }
-
-    const IR::U32 product_lo = ir.Mul(n_lo, m_lo);
-    const IR::U32 product_hi = ir.Mul(n_hi, m_hi);
-    const auto result_overflow = ir.AddWithCarry(product_lo, product_hi, ir.Imm1(0));
-
-    ir.SetRegister(d, result_overflow.result);
-    ir.OrQFlag(result_overflow.overflow);
+    SignedDualMultiply(ir, d, Reg::PC, m, M, n, false);
     return true;
 }
 
@@ -590,21 +559,7 @@ bool ArmTranslatorVisitor::arm_SMUSD(Cond cond, Reg d, Reg m, bool M, Reg n) {
         return true;
     }
 
-    const IR::U32 n32 = ir.GetRegister(n);
-    const IR::U32 m32 = ir.GetRegister(m);
-    const IR::U32 n_lo = ir.SignExtendHalfToWord(ir.LeastSignificantHalf(n32));
-    const IR::U32 n_hi = ir.ArithmeticShiftRight(n32, ir.Imm8(16), ir.Imm1(0)).result;
-
-    IR::U32 m_lo = ir.SignExtendHalfToWord(ir.LeastSignificantHalf(m32));
-    IR::U32 m_hi = ir.ArithmeticShiftRight(m32, ir.Imm8(16), ir.Imm1(0)).result;
-    if (M) {
-        std::swap(m_lo, m_hi);
-    }
-
-    const IR::U32 product_lo = ir.Mul(n_lo, m_lo);
-    const IR::U32 product_hi = ir.Mul(n_hi, m_hi);
-    auto result = ir.Sub(product_lo, product_hi);
-    ir.SetRegister(d, result);
+    SignedDualMultiply(ir, d, Reg::PC, m, M, n, true);
     return true;
 }
 
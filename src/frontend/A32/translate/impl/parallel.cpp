@@ -4,6 +4,7 @@
  */
 
 #include "frontend/A32/translate/impl/translate_arm.h"
+#include "frontend/A32/translate/impl/translate_common.h"
 
 namespace Dynarmic::A32 {
 
@@ -167,6 +168,14 @@ bool ArmTranslatorVisitor::arm_USAX(Cond cond, Reg n, Reg d, Reg m) {
     return true;
 }
 
+void UnsignedSumOfAbsoluteDifferences(A32::IREmitter& ir, Reg d, Reg a, Reg m, Reg n) {
+    IR::U32 result = ir.PackedAbsDiffSumS8(ir.GetRegister(n), ir.GetRegister(m));
+    if (a != Reg::PC) {
+        result = ir.AddWithCarry(ir.GetRegister(a), result, ir.Imm1(0)).result;
+    }
+    ir.SetRegister(d, result);
+}
+
 // USAD8<c> <Rd>, <Rn>, <Rm>
 bool ArmTranslatorVisitor::arm_USAD8(Cond cond, Reg d, Reg m, Reg n) {
     if (d == Reg::PC || n == Reg::PC || m == Reg::PC) {
@@ -177,8 +186,7 @@ bool ArmTranslatorVisitor::arm_USAD8(Cond cond, Reg d, Reg m, Reg n) {
         return true;
     }
 
-    const auto result = ir.PackedAbsDiffSumS8(ir.GetRegister(n), ir.GetRegister(m));
-    ir.SetRegister(d, result);
+    UnsignedSumOfAbsoluteDifferences(ir, d, Reg::PC, m, n);
     return true;
 }
 
@@ -192,9 +200,7 @@ bool ArmTranslatorVisitor::arm_USADA8(Cond cond, Reg d, Reg a, Reg m, Reg n){
         return true;
     }
 
-    const auto tmp = ir.PackedAbsDiffSumS8(ir.GetRegister(n), ir.GetRegister(m));
-    const auto result = ir.AddWithCarry(ir.GetRegister(a), tmp, ir.Imm1(0));
-    ir.SetRegister(d, result.result);
+    UnsignedSumOfAbsoluteDifferences(ir, d, a, m, n);
     return true;
 }
 
@@ -4,6 +4,7 @@
  */
 
 #include "frontend/A32/translate/impl/translate_arm.h"
+#include "frontend/A32/translate/impl/translate_common.h"
 
 namespace Dynarmic::A32 {
 
@@ -186,6 +187,27 @@ bool ArmTranslatorVisitor::arm_QDSUB(Cond cond, Reg n, Reg d, Reg m) {
 
 // Parallel saturated instructions
 
+void SaturatedAddSubtractExchange(A32::IREmitter& ir, Reg n, Reg d, Reg m, bool is_signed, bool add_high) {
+    const auto extend = [&](IR::U16 half) {
+        return is_signed ? ir.SignExtendHalfToWord(half) : ir.ZeroExtendHalfToWord(half);
+    };
+    const auto saturate = [&](IR::U32 value) {
+        return is_signed ? ir.SignedSaturation(value, 16).result : ir.UnsignedSaturation(value, 16).result;
+    };
+
+    const auto Rn = ir.GetRegister(n);
+    const auto Rm = ir.GetRegister(m);
+    const auto Rn_lo = extend(ir.LeastSignificantHalf(Rn));
+    const auto Rn_hi = extend(MostSignificantHalf(ir, Rn));
+    const auto Rm_lo = extend(ir.LeastSignificantHalf(Rm));
+    const auto Rm_hi = extend(MostSignificantHalf(ir, Rm));
+    const auto lo = saturate(add_high ? ir.Sub(Rn_lo, Rm_hi) : ir.Add(Rn_lo, Rm_hi));
+    const auto hi = saturate(add_high ? ir.Add(Rn_hi, Rm_lo) : ir.Sub(Rn_hi, Rm_lo));
+    const auto result = Pack2x16To1x32(ir, lo, hi);
+
+    ir.SetRegister(d, result);
+}
+
 // QASX<c> <Rd>, <Rn>, <Rm>
 bool ArmTranslatorVisitor::arm_QASX(Cond cond, Reg n, Reg d, Reg m) {
     if (d == Reg::PC || n == Reg::PC || m == Reg::PC) {
@@ -196,17 +218,7 @@ bool ArmTranslatorVisitor::arm_QASX(Cond cond, Reg n, Reg d, Reg m) {
         return true;
     }
 
-    const auto Rn = ir.GetRegister(n);
-    const auto Rm = ir.GetRegister(m);
-    const auto Rn_lo = ir.SignExtendHalfToWord(ir.LeastSignificantHalf(Rn));
-    const auto Rn_hi = ir.SignExtendHalfToWord(MostSignificantHalf(ir, Rn));
-    const auto Rm_lo = ir.SignExtendHalfToWord(ir.LeastSignificantHalf(Rm));
-    const auto Rm_hi = ir.SignExtendHalfToWord(MostSignificantHalf(ir, Rm));
-    const auto diff = ir.SignedSaturation(ir.Sub(Rn_lo, Rm_hi), 16).result;
-    const auto sum = ir.SignedSaturation(ir.Add(Rn_hi, Rm_lo), 16).result;
-    const auto result = Pack2x16To1x32(ir, diff, sum);
-
-    ir.SetRegister(d, result);
+    SaturatedAddSubtractExchange(ir, n, d, m, true, true);
     return true;
 }
 
@@ -220,17 +232,7 @@ bool ArmTranslatorVisitor::arm_QSAX(Cond cond, Reg n, Reg d, Reg m) {
         return true;
     }
 
-    const auto Rn = ir.GetRegister(n);
-    const auto Rm = ir.GetRegister(m);
-    const auto Rn_lo = ir.SignExtendHalfToWord(ir.LeastSignificantHalf(Rn));
-    const auto Rn_hi = ir.SignExtendHalfToWord(MostSignificantHalf(ir, Rn));
-    const auto Rm_lo = ir.SignExtendHalfToWord(ir.LeastSignificantHalf(Rm));
-    const auto Rm_hi = ir.SignExtendHalfToWord(MostSignificantHalf(ir, Rm));
-    const auto sum = ir.SignedSaturation(ir.Add(Rn_lo, Rm_hi), 16).result;
-    const auto diff = ir.SignedSaturation(ir.Sub(Rn_hi, Rm_lo), 16).result;
-    const auto result = Pack2x16To1x32(ir, sum, diff);
-
-    ir.SetRegister(d, result);
+    SaturatedAddSubtractExchange(ir, n, d, m, true, false);
     return true;
 }
 
@@ -244,17 +246,7 @@ bool ArmTranslatorVisitor::arm_UQASX(Cond cond, Reg n, Reg d, Reg m) {
         return true;
     }
 
-    const auto Rn = ir.GetRegister(n);
-    const auto Rm = ir.GetRegister(m);
-    const auto Rn_lo = ir.ZeroExtendHalfToWord(ir.LeastSignificantHalf(Rn));
-    const auto Rn_hi = ir.ZeroExtendHalfToWord(MostSignificantHalf(ir, Rn));
-    const auto Rm_lo = ir.ZeroExtendHalfToWord(ir.LeastSignificantHalf(Rm));
-    const auto Rm_hi = ir.ZeroExtendHalfToWord(MostSignificantHalf(ir, Rm));
-    const auto diff = ir.UnsignedSaturation(ir.Sub(Rn_lo, Rm_hi), 16).result;
-    const auto sum = ir.UnsignedSaturation(ir.Add(Rn_hi, Rm_lo), 16).result;
-    const auto result = Pack2x16To1x32(ir, diff, sum);
-
-    ir.SetRegister(d, result);
+    SaturatedAddSubtractExchange(ir, n, d, m, false, true);
     return true;
 }
 
@@ -268,17 +260,7 @@ bool ArmTranslatorVisitor::arm_UQSAX(Cond cond, Reg n, Reg d, Reg m) {
         return true;
     }
 
-    const auto Rn = ir.GetRegister(n);
-    const auto Rm = ir.GetRegister(m);
-    const auto Rn_lo = ir.ZeroExtendHalfToWord(ir.LeastSignificantHalf(Rn));
-    const auto Rn_hi = ir.ZeroExtendHalfToWord(MostSignificantHalf(ir, Rn));
-    const auto Rm_lo = ir.ZeroExtendHalfToWord(ir.LeastSignificantHalf(Rm));
-    const auto Rm_hi = ir.ZeroExtendHalfToWord(MostSignificantHalf(ir, Rm));
-    const auto sum = ir.UnsignedSaturation(ir.Add(Rn_lo, Rm_hi), 16).result;
-    const auto diff = ir.UnsignedSaturation(ir.Sub(Rn_hi, Rm_lo), 16).result;
-    const auto result = Pack2x16To1x32(ir, sum, diff);
-
-    ir.SetRegister(d, result);
+    SaturatedAddSubtractExchange(ir, n, d, m, false, false);
     return true;
 }
 
@@ -5,9 +5,42 @@
 
 #include "common/bit_util.h"
 #include "frontend/A32/translate/impl/translate_arm.h"
+#include "frontend/A32/translate/impl/translate_common.h"
 
 namespace Dynarmic::A32 {
 
+void ReadCPSR(A32::IREmitter& ir, Reg d) {
+    ir.SetRegister(d, ir.And(ir.GetCpsr(), ir.Imm32(0xF8FF03DF)));
+}
+
+bool WriteCPSR(A32::IREmitter& ir, int mask, Reg n, LocationDescriptor next_location) {
+    const bool write_nzcvq = Common::Bit<3>(mask);
+    const bool write_g = Common::Bit<2>(mask);
+    const bool write_e = Common::Bit<1>(mask);
+    const auto value = ir.GetRegister(n);
+
+    if (!write_e) {
+        if (write_nzcvq) {
+            ir.SetCpsrNZCVQ(ir.And(value, ir.Imm32(0xF8000000)));
+        }
+
+        if (write_g) {
+            ir.SetGEFlagsCompressed(ir.And(value, ir.Imm32(0x000F0000)));
+        }
+
+        return true;
+    }
+
+    const u32 cpsr_mask = (write_nzcvq ? 0xF8000000 : 0) | (write_g ? 0x000F0000 : 0) | 0x00000200;
+    const auto old_cpsr = ir.And(ir.GetCpsr(), ir.Imm32(~cpsr_mask));
+    const auto new_cpsr = ir.And(value, ir.Imm32(cpsr_mask));
+    ir.SetCpsr(ir.Or(old_cpsr, new_cpsr));
+    ir.PushRSB(next_location);
+    ir.BranchWritePC(ir.Imm32(next_location.PC()));
+    ir.SetTerm(IR::Term::CheckHalt{IR::Term::PopRSBHint{}});
+    return false;
+}
+
 // CPS<effect> <iflags>{, #<mode>}
 // CPS #<mode>
 bool ArmTranslatorVisitor::arm_CPS() {
@@ -24,7 +57,7 @@ bool ArmTranslatorVisitor::arm_MRS(Cond cond, Reg d) {
         return true;
     }
 
-    ir.SetRegister(d, ir.GetCpsr());
+    ReadCPSR(ir, d);
     return true;
 }
 
@@ -74,31 +107,7 @@ bool ArmTranslatorVisitor::arm_MSR_reg(Cond cond, int mask, Reg n) {
         return true;
     }
 
-    const bool write_nzcvq = Common::Bit<3>(mask);
-    const bool write_g = Common::Bit<2>(mask);
-    const bool write_e = Common::Bit<1>(mask);
-    const auto value = ir.GetRegister(n);
-
-    if (!write_e) {
-        if (write_nzcvq) {
-            ir.SetCpsrNZCVQ(ir.And(value, ir.Imm32(0xF8000000)));
-        }
-
-        if (write_g) {
-            ir.SetGEFlagsCompressed(ir.And(value, ir.Imm32(0x000F0000)));
-        }
-    } else {
-        const u32 cpsr_mask = (write_nzcvq ? 0xF8000000 : 0) | (write_g ? 0x000F0000 : 0) | 0x00000200;
-        const auto old_cpsr = ir.And(ir.GetCpsr(), ir.Imm32(~cpsr_mask));
-        const auto new_cpsr = ir.And(value, ir.Imm32(cpsr_mask));
-        ir.SetCpsr(ir.Or(old_cpsr, new_cpsr));
-        ir.PushRSB(ir.current_location.AdvancePC(4));
-        ir.BranchWritePC(ir.Imm32(ir.current_location.PC() + 4));
-        ir.SetTerm(IR::Term::CheckHalt{IR::Term::PopRSBHint{}});
-        return false;
-    }
-
-    return true;
+    return WriteCPSR(ir, mask, n, ir.current_location.AdvancePC(4));
 }
 
 // RFE{<amode>} <Rn>{!}
@@ -3,38 +3,208 @@
  * SPDX-License-Identifier: 0BSD
  */
 
+#include <dynarmic/A32/config.h>
+
+#include "frontend/A32/translate/impl/translate_common.h"
 #include "frontend/A32/translate/impl/translate_thumb.h"
 
 namespace Dynarmic::A32 {
 
+static s32 BranchOffset(Imm<1> S, Imm<10> hi, Imm<1> j1, Imm<1> j2, Imm<11> lo) {
+    const Imm<1> i1{j1 == S};
+    const Imm<1> i2{j2 == S};
+    return concatenate(S, i1, i2, hi, lo, Imm<1>{0}).SignExtend<s32>();
+}
+
+static bool IsUnpredictableBranchInITBlock(const LocationDescriptor& location) {
+    return location.IT().IsInITBlock() && !location.IT().IsLastInITBlock();
+}
+
 // BL <label>
-bool ThumbTranslatorVisitor::thumb32_BL_imm(Imm<11> hi, Imm<11> lo) {
-    ir.PushRSB(ir.current_location.AdvancePC(4));
+bool ThumbTranslatorVisitor::thumb32_BL_imm(Imm<1> S, Imm<10> hi, Imm<1> j1, Imm<1> j2, Imm<11> lo) {
+    if (IsUnpredictableBranchInITBlock(ir.current_location)) {
+        return UnpredictableInstruction();
+    }
+
+    ir.PushRSB(ir.current_location.AdvancePC(4).AdvanceIT());
     ir.SetRegister(Reg::LR, ir.Imm32((ir.current_location.PC() + 4) | 1));
 
-    const s32 imm32 = static_cast<s32>((concatenate(hi, lo).SignExtend<u32>() << 1) + 4);
-    const auto new_location = ir.current_location.AdvancePC(imm32);
+    const s32 imm32 = BranchOffset(S, hi, j1, j2, lo);
+    const auto new_location = ir.current_location
+                                .AdvancePC(imm32 + 4)
+                                .AdvanceIT();
     ir.SetTerm(IR::Term::LinkBlock{new_location});
     return false;
 }
 
 // BLX <label>
-bool ThumbTranslatorVisitor::thumb32_BLX_imm(Imm<11> hi, Imm<11> lo) {
+bool ThumbTranslatorVisitor::thumb32_BLX_imm(Imm<1> S, Imm<10> hi, Imm<1> j1, Imm<1> j2, Imm<11> lo) {
     if (lo.Bit<0>()) {
         return UnpredictableInstruction();
     }
 
-    ir.PushRSB(ir.current_location.AdvancePC(4));
+    if (IsUnpredictableBranchInITBlock(ir.current_location)) {
+        return UnpredictableInstruction();
+    }
+
+    ir.PushRSB(ir.current_location.AdvancePC(4).AdvanceIT());
     ir.SetRegister(Reg::LR, ir.Imm32((ir.current_location.PC() + 4) | 1));
 
-    const s32 imm32 = static_cast<s32>(concatenate(hi, lo).SignExtend<u32>() << 1);
+    const s32 imm32 = BranchOffset(S, hi, j1, j2, lo);
     const auto new_location = ir.current_location
                                 .SetPC(ir.AlignPC(4) + imm32)
-                                .SetTFlag(false);
+                                .SetTFlag(false)
+                                .AdvanceIT();
+    ir.SetTerm(IR::Term::LinkBlock{new_location});
+    return false;
+}
+
+// B <label>
+bool ThumbTranslatorVisitor::thumb32_B(Imm<1> S, Imm<10> hi, Imm<1> j1, Imm<1> j2, Imm<11> lo) {
+    if (IsUnpredictableBranchInITBlock(ir.current_location)) {
+        return UnpredictableInstruction();
+    }
+
+    const s32 imm32 = BranchOffset(S, hi, j1, j2, lo);
+    const auto new_location = ir.current_location
+                                .AdvancePC(imm32 + 4)
+                                .AdvanceIT();
     ir.SetTerm(IR::Term::LinkBlock{new_location});
     return false;
 }
 
+// B<c> <label>
+bool ThumbTranslatorVisitor::thumb32_B_cond(Imm<1> S, Cond cond, Imm<6> hi, Imm<1> j1, Imm<1> j2, Imm<11> lo) {
+    if (cond == Cond::AL || cond == Cond::NV) {
+        // These encodings are in the miscellaneous control instruction space.
+        return thumb32_UDF();
+    }
+
+    if (ir.current_location.IT().IsInITBlock()) {
+        return UnpredictableInstruction();
+    }
+
+    // Note the swapped order of j1 and j2 compared to the unconditional branches.
+    const s32 imm32 = concatenate(S, j2, j1, hi, lo, Imm<1>{0}).SignExtend<s32>();
+    const auto then_location = ir.current_location.AdvancePC(imm32 + 4);
+    const auto else_location = ir.current_location.AdvancePC(4);
+
+    ir.SetTerm(IR::Term::If{cond, IR::Term::LinkBlock{then_location}, IR::Term::LinkBlock{else_location}});
+    return false;
+}
+
+// MSR<c> <spec_reg>, <Rn>
+bool ThumbTranslatorVisitor::thumb32_MSR_reg(Reg n, Imm<4> mask) {
+    if (mask == 0) {
+        return UnpredictableInstruction();
+    }
+
+    if (n == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+
+    // Writing E ends the block with a CPSR write, which would discard the remaining IT state.
+    const bool write_e = mask.Bit<1>();
+    if (write_e && ir.current_location.IT().IsInITBlock() && !ir.current_location.IT().IsLastInITBlock()) {
+        return InterpretThisInstruction();
+    }
+
+    return WriteCPSR(ir, mask.ZeroExtend(), n, ir.current_location.AdvancePC(4).AdvanceIT());
+}
+
+// NOP<c>.W
+bool ThumbTranslatorVisitor::thumb32_NOP() {
+    return true;
+}
+
+// YIELD<c>.W
+bool ThumbTranslatorVisitor::thumb32_YIELD() {
+    if (!options.hook_hint_instructions) {
+        return true;
+    }
+    return RaiseException(Exception::Yield);
+}
+
+// WFE<c>.W
+bool ThumbTranslatorVisitor::thumb32_WFE() {
+    if (!options.hook_hint_instructions) {
+        return true;
+    }
+    return RaiseException(Exception::WaitForEvent);
+}
+
+// WFI<c>.W
+bool ThumbTranslatorVisitor::thumb32_WFI() {
+    if (!options.hook_hint_instructions) {
+        return true;
+    }
+    return RaiseException(Exception::WaitForInterrupt);
+}
+
+// SEV<c>.W
+bool ThumbTranslatorVisitor::thumb32_SEV() {
+    if (!options.hook_hint_instructions) {
+        return true;
+    }
+    return RaiseException(Exception::SendEvent);
+}
+
+// SEVL<c>.W
+bool ThumbTranslatorVisitor::thumb32_SEVL() {
+    if (!options.hook_hint_instructions) {
+        return true;
+    }
+    return RaiseException(Exception::SendEventLocal);
+}
+
+// CPS{<effect>}{<q>} <iflags>{, #<mode>}
+// CPS{<q>} #<mode>
+// A CPS is treated as a NOP in User mode.
+bool ThumbTranslatorVisitor::thumb32_CPS() {
+    if (ir.current_location.IT().IsInITBlock()) {
+        return UnpredictableInstruction();
+    }
+
+    return true;
+}
+
+// CLREX<c>
+bool ThumbTranslatorVisitor::thumb32_CLREX() {
+    ir.ClearExclusive();
+    return true;
+}
+
+// DSB<c> <option>
+bool ThumbTranslatorVisitor::thumb32_DSB([[maybe_unused]] Imm<4> option) {
+    ir.DataSynchronizationBarrier();
+    return true;
+}
+
+// DMB<c> <option>
+bool ThumbTranslatorVisitor::thumb32_DMB([[maybe_unused]] Imm<4> option) {
+    ir.DataMemoryBarrier();
+    return true;
+}
+
+// ISB<c> <option>
+bool ThumbTranslatorVisitor::thumb32_ISB([[maybe_unused]] Imm<4> option) {
+    ir.InstructionSynchronizationBarrier();
+    ir.UpdateUpperLocationDescriptor();
+    ir.BranchWritePC(ir.Imm32(ir.current_location.PC() + 4));
+    ir.SetTerm(IR::Term::ReturnToDispatch{});
+    return false;
+}
+
+// MRS<c> <Rd>, <spec_reg>
+bool ThumbTranslatorVisitor::thumb32_MRS_reg(Reg d) {
+    if (d == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+
+    ReadCPSR(ir, d);
+    return true;
+}
+
 bool ThumbTranslatorVisitor::thumb32_UDF() {
     return thumb16_UDF();
 }
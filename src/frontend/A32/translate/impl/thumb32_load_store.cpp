@@ -0,0 +1,882 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2016 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include "common/bit_util.h"
+#include "frontend/A32/translate/impl/translate_thumb.h"
+
+namespace Dynarmic::A32 {
+
+static IR::U32 GetAddress(A32::IREmitter& ir, bool P, bool U, bool W, Reg n, IR::U32 offset) {
+    const bool index = P;
+    const bool add = U;
+    const bool wback = W;
+
+    const IR::U32 offset_addr = add ? ir.Add(ir.GetRegister(n), offset) : ir.Sub(ir.GetRegister(n), offset);
+    const IR::U32 address = index ? offset_addr : ir.GetRegister(n);
+
+    if (wback) {
+        ir.SetRegister(n, offset_addr);
+    }
+
+    return address;
+}
+
+static bool IsUnpredictablePCWriteInITBlock(const LocationDescriptor& location) {
+    return location.IT().IsInITBlock() && !location.IT().IsLastInITBlock();
+}
+
+// Load/store multiple
+
+static bool LDMHelper(A32::IREmitter& ir, bool W, Reg n, RegList list, IR::U32 start_address, IR::U32 writeback_address) {
+    auto address = start_address;
+    for (size_t i = 0; i <= 14; i++) {
+        if (Common::Bit(i, list)) {
+            ir.SetRegister(static_cast<Reg>(i), ir.ReadMemory32(address));
+            address = ir.Add(address, ir.Imm32(4));
+        }
+    }
+    if (W) {
+        ir.SetRegister(n, writeback_address);
+    }
+    if (Common::Bit<15>(list)) {
+        ir.LoadWritePC(ir.ReadMemory32(address));
+        if (n == Reg::R13) {
+            ir.SetTerm(IR::Term::PopRSBHint{});
+        } else {
+            ir.SetTerm(IR::Term::FastDispatchHint{});
+        }
+        return false;
+    }
+    return true;
+}
+
+static bool STMHelper(A32::IREmitter& ir, bool W, Reg n, RegList list, IR::U32 start_address, IR::U32 writeback_address) {
+    auto address = start_address;
+    for (size_t i = 0; i <= 14; i++) {
+        if (Common::Bit(i, list)) {
+            ir.WriteMemory32(address, ir.GetRegister(static_cast<Reg>(i)));
+            address = ir.Add(address, ir.Imm32(4));
+        }
+    }
+    if (W) {
+        ir.SetRegister(n, writeback_address);
+    }
+    return true;
+}
+
+// STMIA<c>.W <Rn>{!}, <registers>
+bool ThumbTranslatorVisitor::thumb32_STMIA(bool W, Reg n, RegList reg_list) {
+    if (n == Reg::PC || Common::BitCount(reg_list) < 2) {
+        return UnpredictableInstruction();
+    }
+    if (Common::Bit<15>(reg_list) || Common::Bit<13>(reg_list)) {
+        return UnpredictableInstruction();
+    }
+    if (W && Common::Bit(static_cast<size_t>(n), reg_list)) {
+        return UnpredictableInstruction();
+    }
+
+    const auto start_address = ir.GetRegister(n);
+    const auto writeback_address = ir.Add(start_address, ir.Imm32(u32(Common::BitCount(reg_list) * 4)));
+    return STMHelper(ir, W, n, reg_list, start_address, writeback_address);
+}
+
+// LDMIA<c>.W <Rn>{!}, <registers>
+bool ThumbTranslatorVisitor::thumb32_LDMIA(bool W, Reg n, RegList reg_list) {
+    if (n == Reg::PC || Common::BitCount(reg_list) < 2) {
+        return UnpredictableInstruction();
+    }
+    if (Common::Bit<15>(reg_list) && Common::Bit<14>(reg_list)) {
+        return UnpredictableInstruction();
+    }
+    if (Common::Bit<13>(reg_list)) {
+        return UnpredictableInstruction();
+    }
+    if (Common::Bit<15>(reg_list) && IsUnpredictablePCWriteInITBlock(ir.current_location)) {
+        return UnpredictableInstruction();
+    }
+    if (W && Common::Bit(static_cast<size_t>(n), reg_list)) {
+        return UnpredictableInstruction();
+    }
+
+    const auto start_address = ir.GetRegister(n);
+    const auto writeback_address = ir.Add(start_address, ir.Imm32(u32(Common::BitCount(reg_list) * 4)));
+    return LDMHelper(ir, W, n, reg_list, start_address, writeback_address);
+}
+
+// STMDB<c> <Rn>{!}, <registers>
+bool ThumbTranslatorVisitor::thumb32_STMDB(bool W, Reg n, RegList reg_list) {
+    if (n == Reg::PC || Common::BitCount(reg_list) < 2) {
+        return UnpredictableInstruction();
+    }
+    if (Common::Bit<15>(reg_list) || Common::Bit<13>(reg_list)) {
+        return UnpredictableInstruction();
+    }
+    if (W && Common::Bit(static_cast<size_t>(n), reg_list)) {
+        return UnpredictableInstruction();
+    }
+
+    const auto start_address = ir.Sub(ir.GetRegister(n), ir.Imm32(u32(Common::BitCount(reg_list) * 4)));
+    const auto writeback_address = start_address;
+    return STMHelper(ir, W, n, reg_list, start_address, writeback_address);
+}
+
+// LDMDB<c> <Rn>{!}, <registers>
+bool ThumbTranslatorVisitor::thumb32_LDMDB(bool W, Reg n, RegList reg_list) {
+    if (n == Reg::PC || Common::BitCount(reg_list) < 2) {
+        return UnpredictableInstruction();
+    }
+    if (Common::Bit<15>(reg_list) && Common::Bit<14>(reg_list)) {
+        return UnpredictableInstruction();
+    }
+    if (Common::Bit<13>(reg_list)) {
+        return UnpredictableInstruction();
+    }
+    if (Common::Bit<15>(reg_list) && IsUnpredictablePCWriteInITBlock(ir.current_location)) {
+        return UnpredictableInstruction();
+    }
+    if (W && Common::Bit(static_cast<size_t>(n), reg_list)) {
+        return UnpredictableInstruction();
+    }
+
+    const auto start_address = ir.Sub(ir.GetRegister(n), ir.Imm32(u32(Common::BitCount(reg_list) * 4)));
+    const auto writeback_address = start_address;
+    return LDMHelper(ir, W, n, reg_list, start_address, writeback_address);
+}
+
+// Load/store dual, load/store exclusive, table branch
+
+// STREX<c> <Rd>, <Rt>, [<Rn>{, #<imm>}]
+bool ThumbTranslatorVisitor::thumb32_STREX(Reg n, Reg t, Reg d, Imm<8> imm8) {
+    if (d == Reg::PC || t == Reg::PC || n == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+    if (d == n || d == t) {
+        return UnpredictableInstruction();
+    }
+
+    const auto address = ir.Add(ir.GetRegister(n), ir.Imm32(imm8.ZeroExtend() << 2));
+    const auto value = ir.GetRegister(t);
+    const auto passed = ir.ExclusiveWriteMemory32(address, value);
+    ir.SetRegister(d, passed);
+    return true;
+}
+
+// LDREX<c> <Rt>, [<Rn>{, #<imm>}]
+bool ThumbTranslatorVisitor::thumb32_LDREX(Reg n, Reg t, Imm<8> imm8) {
+    if (t == Reg::PC || n == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+
+    const auto address = ir.Add(ir.GetRegister(n), ir.Imm32(imm8.ZeroExtend() << 2));
+    ir.SetRegister(t, ir.ExclusiveReadMemory32(address));
+    return true;
+}
+
+// STREXB<c> <Rd>, <Rt>, [<Rn>]
+bool ThumbTranslatorVisitor::thumb32_STREXB(Reg n, Reg t, Reg d) {
+    if (d == Reg::PC || t == Reg::PC || n == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+    if (d == n || d == t) {
+        return UnpredictableInstruction();
+    }
+
+    const auto address = ir.GetRegister(n);
+    const auto value = ir.LeastSignificantByte(ir.GetRegister(t));
+    const auto passed = ir.ExclusiveWriteMemory8(address, value);
+    ir.SetRegister(d, passed);
+    return true;
+}
+
+// STREXH<c> <Rd>, <Rt>, [<Rn>]
+bool ThumbTranslatorVisitor::thumb32_STREXH(Reg n, Reg t, Reg d) {
+    if (d == Reg::PC || t == Reg::PC || n == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+    if (d == n || d == t) {
+        return UnpredictableInstruction();
+    }
+
+    const auto address = ir.GetRegister(n);
+    const auto value = ir.LeastSignificantHalf(ir.GetRegister(t));
+    const auto passed = ir.ExclusiveWriteMemory16(address, value);
+    ir.SetRegister(d, passed);
+    return true;
+}
+
+// STREXD<c> <Rd>, <Rt>, <Rt2>, [<Rn>]
+bool ThumbTranslatorVisitor::thumb32_STREXD(Reg n, Reg t, Reg t2, Reg d) {
+    if (d == Reg::PC || t == Reg::PC || t2 == Reg::PC || n == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+    if (d == n || d == t || d == t2) {
+        return UnpredictableInstruction();
+    }
+
+    const auto address = ir.GetRegister(n);
+    const auto value_lo = ir.GetRegister(t);
+    const auto value_hi = ir.GetRegister(t2);
+    const auto passed = ir.ExclusiveWriteMemory64(address, value_lo, value_hi);
+    ir.SetRegister(d, passed);
+    return true;
+}
+
+// TBB<c> [<Rn>, <Rm>]
+bool ThumbTranslatorVisitor::thumb32_TBB(Reg n, Reg m) {
+    if (m == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+    if (IsUnpredictablePCWriteInITBlock(ir.current_location)) {
+        return UnpredictableInstruction();
+    }
+
+    const auto address = ir.Add(ir.GetRegister(n), ir.GetRegister(m));
+    const auto halfwords = ir.ZeroExtendByteToWord(ir.ReadMemory8(address));
+    const auto offset = ir.LogicalShiftLeft(halfwords, ir.Imm8(1));
+
+    ir.UpdateUpperLocationDescriptor();
+    ir.BranchWritePC(ir.Add(ir.Imm32(ir.current_location.PC() + 4), offset));
+    ir.SetTerm(IR::Term::FastDispatchHint{});
+    return false;
+}
+
+// TBH<c> [<Rn>, <Rm>, LSL #1]
+bool ThumbTranslatorVisitor::thumb32_TBH(Reg n, Reg m) {
+    if (m == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+    if (IsUnpredictablePCWriteInITBlock(ir.current_location)) {
+        return UnpredictableInstruction();
+    }
+
+    const auto address = ir.Add(ir.GetRegister(n), ir.LogicalShiftLeft(ir.GetRegister(m), ir.Imm8(1)));
+    const auto halfwords = ir.ZeroExtendHalfToWord(ir.ReadMemory16(address));
+    const auto offset = ir.LogicalShiftLeft(halfwords, ir.Imm8(1));
+
+    ir.UpdateUpperLocationDescriptor();
+    ir.BranchWritePC(ir.Add(ir.Imm32(ir.current_location.PC() + 4), offset));
+    ir.SetTerm(IR::Term::FastDispatchHint{});
+    return false;
+}
+
+// LDREXB<c> <Rt>, [<Rn>]
+bool ThumbTranslatorVisitor::thumb32_LDREXB(Reg n, Reg t) {
+    if (t == Reg::PC || n == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+
+    const auto address = ir.GetRegister(n);
+    ir.SetRegister(t, ir.ZeroExtendByteToWord(ir.ExclusiveReadMemory8(address)));
+    return true;
+}
+
+// LDREXH<c> <Rt>, [<Rn>]
+bool ThumbTranslatorVisitor::thumb32_LDREXH(Reg n, Reg t) {
+    if (t == Reg::PC || n == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+
+    const auto address = ir.GetRegister(n);
+    ir.SetRegister(t, ir.ZeroExtendHalfToWord(ir.ExclusiveReadMemory16(address)));
+    return true;
+}
+
+// LDREXD<c> <Rt>, <Rt2>, [<Rn>]
+bool ThumbTranslatorVisitor::thumb32_LDREXD(Reg n, Reg t, Reg t2) {
+    if (t == Reg::PC || t2 == Reg::PC || n == Reg::PC || t == t2) {
+        return UnpredictableInstruction();
+    }
+
+    const auto address = ir.GetRegister(n);
+    const auto [lo, hi] = ir.ExclusiveReadMemory64(address);
+    // DO NOT SWAP hi AND lo IN BIG ENDIAN MODE, THIS IS CORRECT BEHAVIOUR
+    ir.SetRegister(t, lo);
+    ir.SetRegister(t2, hi);
+    return true;
+}
+
+// STRD<c> <Rt>, <Rt2>, [<Rn>{, #+/-<imm>}]
+// STRD<c> <Rt>, <Rt2>, [<Rn>], #+/-<imm>
+// STRD<c> <Rt>, <Rt2>, [<Rn>, #+/-<imm>]!
+bool ThumbTranslatorVisitor::thumb32_STRD_imm(bool P, bool U, bool W, Reg n, Reg t, Reg t2, Imm<8> imm8) {
+    if (!P && !W) {
+        return thumb32_UDF();
+    }
+    if (W && (n == t || n == t2)) {
+        return UnpredictableInstruction();
+    }
+    if (n == Reg::PC || t == Reg::PC || t == Reg::SP || t2 == Reg::PC || t2 == Reg::SP) {
+        return UnpredictableInstruction();
+    }
+
+    const auto offset = ir.Imm32(imm8.ZeroExtend() << 2);
+    const auto address_a = GetAddress(ir, P, U, W, n, offset);
+    const auto address_b = ir.Add(address_a, ir.Imm32(4));
+    const auto value_a = ir.GetRegister(t);
+    const auto value_b = ir.GetRegister(t2);
+
+    ir.WriteMemory32(address_a, value_a);
+    ir.WriteMemory32(address_b, value_b);
+    return true;
+}
+
+// LDRD<c> <Rt>, <Rt2>, [<Rn>{, #+/-<imm>}]
+// LDRD<c> <Rt>, <Rt2>, [<Rn>], #+/-<imm>
+// LDRD<c> <Rt>, <Rt2>, [<Rn>, #+/-<imm>]!
+// LDRD<c> <Rt>, <Rt2>, <label>
+bool ThumbTranslatorVisitor::thumb32_LDRD_imm(bool P, bool U, bool W, Reg n, Reg t, Reg t2, Imm<8> imm8) {
+    if (!P && !W) {
+        return thumb32_UDF();
+    }
+    if (W && (n == t || n == t2)) {
+        return UnpredictableInstruction();
+    }
+    if (t == Reg::PC || t == Reg::SP || t2 == Reg::PC || t2 == Reg::SP || t == t2) {
+        return UnpredictableInstruction();
+    }
+
+    const u32 imm32 = imm8.ZeroExtend() << 2;
+
+    IR::U32 address_a;
+    if (n == Reg::PC) {
+        if (W) {
+            return UnpredictableInstruction();
+        }
+
+        const u32 base = ir.AlignPC(4);
+        address_a = ir.Imm32(U ? base + imm32 : base - imm32);
+    } else {
+        address_a = GetAddress(ir, P, U, W, n, ir.Imm32(imm32));
+    }
+
+    const auto address_b = ir.Add(address_a, ir.Imm32(4));
+    const auto data_a = ir.ReadMemory32(address_a);
+    const auto data_b = ir.ReadMemory32(address_b);
+
+    ir.SetRegister(t, data_a);
+    ir.SetRegister(t2, data_b);
+    return true;
+}
+
+// Store single data item
+
+// STRB<c> <Rt>, [<Rn>, #-<imm8>]
+// STRB<c> <Rt>, [<Rn>], #+/-<imm8>
+// STRB<c> <Rt>, [<Rn>, #+/-<imm8>]!
+bool ThumbTranslatorVisitor::thumb32_STRB_imm_1(Reg n, Reg t, bool P, bool U, bool W, Imm<8> imm8) {
+    if (n == Reg::PC || (!P && !W)) {
+        return thumb32_UDF();
+    }
+    if (P && U && !W) {
+        // Unprivileged stores are unimplemented
+        return UndefinedInstruction();
+    }
+    if (t == Reg::PC || t == Reg::SP || (W && n == t)) {
+        return UnpredictableInstruction();
+    }
+
+    const auto address = GetAddress(ir, P, U, W, n, ir.Imm32(imm8.ZeroExtend()));
+    ir.WriteMemory8(address, ir.LeastSignificantByte(ir.GetRegister(t)));
+    return true;
+}
+
+// STRB<c>.W <Rt>, [<Rn>{, #<imm12>}]
+bool ThumbTranslatorVisitor::thumb32_STRB_imm_2(Reg n, Reg t, Imm<12> imm12) {
+    if (n == Reg::PC) {
+        return thumb32_UDF();
+    }
+    if (t == Reg::PC || t == Reg::SP) {
+        return UnpredictableInstruction();
+    }
+
+    const auto address = ir.Add(ir.GetRegister(n), ir.Imm32(imm12.ZeroExtend()));
+    ir.WriteMemory8(address, ir.LeastSignificantByte(ir.GetRegister(t)));
+    return true;
+}
+
+// STRB<c>.W <Rt>, [<Rn>, <Rm>{, LSL #<imm2>}]
+bool ThumbTranslatorVisitor::thumb32_STRB_reg(Reg n, Reg t, Imm<2> imm2, Reg m) {
+    if (n == Reg::PC) {
+        return thumb32_UDF();
+    }
+    if (t == Reg::PC || t == Reg::SP || m == Reg::PC || m == Reg::SP) {
+        return UnpredictableInstruction();
+    }
+
+    const auto offset = ir.LogicalShiftLeft(ir.GetRegister(m), ir.Imm8(imm2.ZeroExtend<u8>()));
+    const auto address = ir.Add(ir.GetRegister(n), offset);
+    ir.WriteMemory8(address, ir.LeastSignificantByte(ir.GetRegister(t)));
+    return true;
+}
+
+// STRH<c> <Rt>, [<Rn>, #-<imm8>]
+// STRH<c> <Rt>, [<Rn>], #+/-<imm8>
+// STRH<c> <Rt>, [<Rn>, #+/-<imm8>]!
+bool ThumbTranslatorVisitor::thumb32_STRH_imm_1(Reg n, Reg t, bool P, bool U, bool W, Imm<8> imm8) {
+    if (n == Reg::PC || (!P && !W)) {
+        return thumb32_UDF();
+    }
+    if (P && U && !W) {
+        // Unprivileged stores are unimplemented
+        return UndefinedInstruction();
+    }
+    if (t == Reg::PC || t == Reg::SP || (W && n == t)) {
+        return UnpredictableInstruction();
+    }
+
+    const auto address = GetAddress(ir, P, U, W, n, ir.Imm32(imm8.ZeroExtend()));
+    ir.WriteMemory16(address, ir.LeastSignificantHalf(ir.GetRegister(t)));
+    return true;
+}
+
+// STRH<c>.W <Rt>, [<Rn>{, #<imm12>}]
+bool ThumbTranslatorVisitor::thumb32_STRH_imm_2(Reg n, Reg t, Imm<12> imm12) {
+    if (n == Reg::PC) {
+        return thumb32_UDF();
+    }
+    if (t == Reg::PC || t == Reg::SP) {
+        return UnpredictableInstruction();
+    }
+
+    const auto address = ir.Add(ir.GetRegister(n), ir.Imm32(imm12.ZeroExtend()));
+    ir.WriteMemory16(address, ir.LeastSignificantHalf(ir.GetRegister(t)));
+    return true;
+}
+
+// STRH<c>.W <Rt>, [<Rn>, <Rm>{, LSL #<imm2>}]
+bool ThumbTranslatorVisitor::thumb32_STRH_reg(Reg n, Reg t, Imm<2> imm2, Reg m) {
+    if (n == Reg::PC) {
+        return thumb32_UDF();
+    }
+    if (t == Reg::PC || t == Reg::SP || m == Reg::PC || m == Reg::SP) {
+        return UnpredictableInstruction();
+    }
+
+    const auto offset = ir.LogicalShiftLeft(ir.GetRegister(m), ir.Imm8(imm2.ZeroExtend<u8>()));
+    const auto address = ir.Add(ir.GetRegister(n), offset);
+    ir.WriteMemory16(address, ir.LeastSignificantHalf(ir.GetRegister(t)));
+    return true;
+}
+
+// STR<c> <Rt>, [<Rn>, #-<imm8>]
+// STR<c> <Rt>, [<Rn>], #+/-<imm8>
+// STR<c> <Rt>, [<Rn>, #+/-<imm8>]!
+bool ThumbTranslatorVisitor::thumb32_STR_imm_1(Reg n, Reg t, bool P, bool U, bool W, Imm<8> imm8) {
+    if (n == Reg::PC || (!P && !W)) {
+        return thumb32_UDF();
+    }
+    if (P && U && !W) {
+        // Unprivileged stores are unimplemented
+        return UndefinedInstruction();
+    }
+    if (t == Reg::PC || (W && n == t)) {
+        return UnpredictableInstruction();
+    }
+
+    const auto address = GetAddress(ir, P, U, W, n, ir.Imm32(imm8.ZeroExtend()));
+    ir.WriteMemory32(address, ir.GetRegister(t));
+    return true;
+}
+
+// STR<c>.W <Rt>, [<Rn>{, #<imm12>}]
+bool ThumbTranslatorVisitor::thumb32_STR_imm_2(Reg n, Reg t, Imm<12> imm12) {
+    if (n == Reg::PC) {
+        return thumb32_UDF();
+    }
+    if (t == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+
+    const auto address = ir.Add(ir.GetRegister(n), ir.Imm32(imm12.ZeroExtend()));
+    ir.WriteMemory32(address, ir.GetRegister(t));
+    return true;
+}
+
+// STR<c>.W <Rt>, [<Rn>, <Rm>{, LSL #<imm2>}]
+bool ThumbTranslatorVisitor::thumb32_STR_reg(Reg n, Reg t, Imm<2> imm2, Reg m) {
+    if (n == Reg::PC) {
+        return thumb32_UDF();
+    }
+    if (t == Reg::PC || m == Reg::PC || m == Reg::SP) {
+        return UnpredictableInstruction();
+    }
+
+    const auto offset = ir.LogicalShiftLeft(ir.GetRegister(m), ir.Imm8(imm2.ZeroExtend<u8>()));
+    const auto address = ir.Add(ir.GetRegister(n), offset);
+    ir.WriteMemory32(address, ir.GetRegister(t));
+    return true;
+}
+
+// Load single data item and memory hints
+
+// PLD{W}<c> [<Rn>, #+/-<imm>]
+// PLD{W}<c> [<Rn>, <Rm>{, LSL #<imm2>}]
+// PLD<c> <label>
+bool ThumbTranslatorVisitor::thumb32_PLD(bool /*W*/) {
+    return true;
+}
+
+// PLI<c> [<Rn>, #+/-<imm>]
+// PLI<c> [<Rn>, <Rm>{, LSL #<imm2>}]
+// PLI<c> <label>
+bool ThumbTranslatorVisitor::thumb32_PLI() {
+    return true;
+}
+
+// LDRB<c>.W <Rt>, <label>
+bool ThumbTranslatorVisitor::thumb32_LDRB_lit(bool U, Reg t, Imm<12> imm12) {
+    if (t == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+
+    const u32 imm32 = imm12.ZeroExtend();
+    const u32 base = ir.AlignPC(4);
+    const auto address = ir.Imm32(U ? base + imm32 : base - imm32);
+    const auto data = ir.ZeroExtendByteToWord(ir.ReadMemory8(address));
+
+    ir.SetRegister(t, data);
+    return true;
+}
+
+// LDRB<c>.W <Rt>, [<Rn>, <Rm>{, LSL #<imm2>}]
+bool ThumbTranslatorVisitor::thumb32_LDRB_reg(Reg n, Reg t, Imm<2> imm2, Reg m) {
+    if (t == Reg::PC || m == Reg::PC || m == Reg::SP) {
+        return UnpredictableInstruction();
+    }
+
+    const auto offset = ir.LogicalShiftLeft(ir.GetRegister(m), ir.Imm8(imm2.ZeroExtend<u8>()));
+    const auto address = ir.Add(ir.GetRegister(n), offset);
+    const auto data = ir.ZeroExtendByteToWord(ir.ReadMemory8(address));
+
+    ir.SetRegister(t, data);
+    return true;
+}
+
+// LDRB<c> <Rt>, [<Rn>, #-<imm8>]
+// LDRB<c> <Rt>, [<Rn>], #+/-<imm8>
+// LDRB<c> <Rt>, [<Rn>, #+/-<imm8>]!
+bool ThumbTranslatorVisitor::thumb32_LDRB_imm8(Reg n, Reg t, bool P, bool U, bool W, Imm<8> imm8) {
+    if (!P && !W) {
+        return thumb32_UDF();
+    }
+    if (P && U && !W) {
+        // Unprivileged loads are unimplemented
+        return UndefinedInstruction();
+    }
+    if (t == Reg::PC || (W && n == t)) {
+        return UnpredictableInstruction();
+    }
+
+    const auto address = GetAddress(ir, P, U, W, n, ir.Imm32(imm8.ZeroExtend()));
+    const auto data = ir.ZeroExtendByteToWord(ir.ReadMemory8(address));
+
+    ir.SetRegister(t, data);
+    return true;
+}
+
+// LDRB<c>.W <Rt>, [<Rn>{, #<imm12>}]
+bool ThumbTranslatorVisitor::thumb32_LDRB_imm12(Reg n, Reg t, Imm<12> imm12) {
+    if (t == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+
+    const auto address = ir.Add(ir.GetRegister(n), ir.Imm32(imm12.ZeroExtend()));
+    const auto data = ir.ZeroExtendByteToWord(ir.ReadMemory8(address));
+
+    ir.SetRegister(t, data);
+    return true;
+}
+
+// LDRSB<c>.W <Rt>, <label>
+bool ThumbTranslatorVisitor::thumb32_LDRSB_lit(bool U, Reg t, Imm<12> imm12) {
+    if (t == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+
+    const u32 imm32 = imm12.ZeroExtend();
+    const u32 base = ir.AlignPC(4);
+    const auto address = ir.Imm32(U ? base + imm32 : base - imm32);
+    const auto data = ir.SignExtendByteToWord(ir.ReadMemory8(address));
+
+    ir.SetRegister(t, data);
+    return true;
+}
+
+// LDRSB<c>.W <Rt>, [<Rn>, <Rm>{, LSL #<imm2>}]
+bool ThumbTranslatorVisitor::thumb32_LDRSB_reg(Reg n, Reg t, Imm<2> imm2, Reg m) {
+    if (t == Reg::PC || m == Reg::PC || m == Reg::SP) {
+        return UnpredictableInstruction();
+    }
+
+    const auto offset = ir.LogicalShiftLeft(ir.GetRegister(m), ir.Imm8(imm2.ZeroExtend<u8>()));
+    const auto address = ir.Add(ir.GetRegister(n), offset);
+    const auto data = ir.SignExtendByteToWord(ir.ReadMemory8(address));
+
+    ir.SetRegister(t, data);
+    return true;
+}
+
+// LDRSB<c> <Rt>, [<Rn>, #-<imm8>]
+// LDRSB<c> <Rt>, [<Rn>], #+/-<imm8>
+// LDRSB<c> <Rt>, [<Rn>, #+/-<imm8>]!
+bool ThumbTranslatorVisitor::thumb32_LDRSB_imm8(Reg n, Reg t, bool P, bool U, bool W, Imm<8> imm8) {
+    if (!P && !W) {
+        return thumb32_UDF();
+    }
+    if (P && U && !W) {
+        // Unprivileged loads are unimplemented
+        return UndefinedInstruction();
+    }
+    if (t == Reg::PC || (W && n == t)) {
+        return UnpredictableInstruction();
+    }
+
+    const auto address = GetAddress(ir, P, U, W, n, ir.Imm32(imm8.ZeroExtend()));
+    const auto data = ir.SignExtendByteToWord(ir.ReadMemory8(address));
+
+    ir.SetRegister(t, data);
+    return true;
+}
+
+// LDRSB<c>.W <Rt>, [<Rn>{, #<imm12>}]
+bool ThumbTranslatorVisitor::thumb32_LDRSB_imm12(Reg n, Reg t, Imm<12> imm12) {
+    if (t == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+
+    const auto address = ir.Add(ir.GetRegister(n), ir.Imm32(imm12.ZeroExtend()));
+    const auto data = ir.SignExtendByteToWord(ir.ReadMemory8(address));
+
+    ir.SetRegister(t, data);
+    return true;
+}
+
+// LDRH<c>.W <Rt>, <label>
+bool ThumbTranslatorVisitor::thumb32_LDRH_lit(bool U, Reg t, Imm<12> imm12) {
+    if (t == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+
+    const u32 imm32 = imm12.ZeroExtend();
+    const u32 base = ir.AlignPC(4);
+    const auto address = ir.Imm32(U ? base + imm32 : base - imm32);
+    const auto data = ir.ZeroExtendHalfToWord(ir.ReadMemory16(address));
+
+    ir.SetRegister(t, data);
+    return true;
+}
+
+// LDRH<c>.W <Rt>, [<Rn>, <Rm>{, LSL #<imm2>}]
+bool ThumbTranslatorVisitor::thumb32_LDRH_reg(Reg n, Reg t, Imm<2> imm2, Reg m) {
+    if (t == Reg::PC || m == Reg::PC || m == Reg::SP) {
+        return UnpredictableInstruction();
+    }
+
+    const auto offset = ir.LogicalShiftLeft(ir.GetRegister(m), ir.Imm8(imm2.ZeroExtend<u8>()));
+    const auto address = ir.Add(ir.GetRegister(n), offset);
+    const auto data = ir.ZeroExtendHalfToWord(ir.ReadMemory16(address));
+
+    ir.SetRegister(t, data);
+    return true;
+}
+
+// LDRH<c> <Rt>, [<Rn>, #-<imm8>]
+// LDRH<c> <Rt>, [<Rn>], #+/-<imm8>
+// LDRH<c> <Rt>, [<Rn>, #+/-<imm8>]!
+bool ThumbTranslatorVisitor::thumb32_LDRH_imm8(Reg n, Reg t, bool P, bool U, bool W, Imm<8> imm8) {
+    if (!P && !W) {
+        return thumb32_UDF();
+    }
+    if (P && U && !W) {
+        // Unprivileged loads are unimplemented
+        return UndefinedInstruction();
+    }
+    if (t == Reg::PC || (W && n == t)) {
+        return UnpredictableInstruction();
+    }
+
+    const auto address = GetAddress(ir, P, U, W, n, ir.Imm32(imm8.ZeroExtend()));
+    const auto data = ir.ZeroExtendHalfToWord(ir.ReadMemory16(address));
+
+    ir.SetRegister(t, data);
+    return true;
+}
+
+// LDRH<c>.W <Rt>, [<Rn>{, #<imm12>}]
+bool ThumbTranslatorVisitor::thumb32_LDRH_imm12(Reg n, Reg t, Imm<12> imm12) {
+    if (t == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+
+    const auto address = ir.Add(ir.GetRegister(n), ir.Imm32(imm12.ZeroExtend()));
+    const auto data = ir.ZeroExtendHalfToWord(ir.ReadMemory16(address));
+
+    ir.SetRegister(t, data);
+    return true;
+}
+
+// LDRSH<c>.W <Rt>, <label>
+bool ThumbTranslatorVisitor::thumb32_LDRSH_lit(bool U, Reg t, Imm<12> imm12) {
+    if (t == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+
+    const u32 imm32 = imm12.ZeroExtend();
+    const u32 base = ir.AlignPC(4);
+    const auto address = ir.Imm32(U ? base + imm32 : base - imm32);
+    const auto data = ir.SignExtendHalfToWord(ir.ReadMemory16(address));
+
+    ir.SetRegister(t, data);
+    return true;
+}
+
+// LDRSH<c>.W <Rt>, [<Rn>, <Rm>{, LSL #<imm2>}]
+bool ThumbTranslatorVisitor::thumb32_LDRSH_reg(Reg n, Reg t, Imm<2> imm2, Reg m) {
+    if (t == Reg::PC || m == Reg::PC || m == Reg::SP) {
+        return UnpredictableInstruction();
+    }
+
+    const auto offset = ir.LogicalShiftLeft(ir.GetRegister(m), ir.Imm8(imm2.ZeroExtend<u8>()));
+    const auto address = ir.Add(ir.GetRegister(n), offset);
+    const auto data = ir.SignExtendHalfToWord(ir.ReadMemory16(address));
+
+    ir.SetRegister(t, data);
+    return true;
+}
+
+// LDRSH<c> <Rt>, [<Rn>, #-<imm8>]
+// LDRSH<c> <Rt>, [<Rn>], #+/-<imm8>
+// LDRSH<c> <Rt>, [<Rn>, #+/-<imm8>]!
+bool ThumbTranslatorVisitor::thumb32_LDRSH_imm8(Reg n, Reg t, bool P, bool U, bool W, Imm<8> imm8) {
+    if (!P && !W) {
+        return thumb32_UDF();
+    }
+    if (P && U && !W) {
+        // Unprivileged loads are unimplemented
+        return UndefinedInstruction();
+    }
+    if (t == Reg::PC || (W && n == t)) {
+        return UnpredictableInstruction();
+    }
+
+    const auto address = GetAddress(ir, P, U, W, n, ir.Imm32(imm8.ZeroExtend()));
+    const auto data = ir.SignExtendHalfToWord(ir.ReadMemory16(address));
+
+    ir.SetRegister(t, data);
+    return true;
+}
+
+// LDRSH<c>.W <Rt>, [<Rn>{, #<imm12>}]
+bool ThumbTranslatorVisitor::thumb32_LDRSH_imm12(Reg n, Reg t, Imm<12> imm12) {
+    if (t == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+
+    const auto address = ir.Add(ir.GetRegister(n), ir.Imm32(imm12.ZeroExtend()));
+    const auto data = ir.SignExtendHalfToWord(ir.ReadMemory16(address));
+
+    ir.SetRegister(t, data);
+    return true;
+}
+
+// LDR<c>.W <Rt>, <label>
+bool ThumbTranslatorVisitor::thumb32_LDR_lit(bool U, Reg t, Imm<12> imm12) {
+    if (t == Reg::PC && IsUnpredictablePCWriteInITBlock(ir.current_location)) {
+        return UnpredictableInstruction();
+    }
+
+    const u32 imm32 = imm12.ZeroExtend();
+    const u32 base = ir.AlignPC(4);
+    const auto address = ir.Imm32(U ? base + imm32 : base - imm32);
+    const auto data = ir.ReadMemory32(address);
+
+    if (t == Reg::PC) {
+        ir.LoadWritePC(data);
+        ir.SetTerm(IR::Term::FastDispatchHint{});
+        return false;
+    }
+
+    ir.SetRegister(t, data);
+    return true;
+}
+
+// LDR<c>.W <Rt>, [<Rn>, <Rm>{, LSL #<imm2>}]
+bool ThumbTranslatorVisitor::thumb32_LDR_reg(Reg n, Reg t, Imm<2> imm2, Reg m) {
+    if (m == Reg::PC || m == Reg::SP) {
+        return UnpredictableInstruction();
+    }
+    if (t == Reg::PC && IsUnpredictablePCWriteInITBlock(ir.current_location)) {
+        return UnpredictableInstruction();
+    }
+
+    const auto offset = ir.LogicalShiftLeft(ir.GetRegister(m), ir.Imm8(imm2.ZeroExtend<u8>()));
+    const auto address = ir.Add(ir.GetRegister(n), offset);
+    const auto data = ir.ReadMemory32(address);
+
+    if (t == Reg::PC) {
+        ir.LoadWritePC(data);
+        ir.SetTerm(IR::Term::FastDispatchHint{});
+        return false;
+    }
+
+    ir.SetRegister(t, data);
+    return true;
+}
+
+// LDR<c> <Rt>, [<Rn>, #-<imm8>]
+// LDR<c> <Rt>, [<Rn>], #+/-<imm8>
+// LDR<c> <Rt>, [<Rn>, #+/-<imm8>]!
+bool ThumbTranslatorVisitor::thumb32_LDR_imm8(Reg n, Reg t, bool P, bool U, bool W, Imm<8> imm8) {
+    if (!P && !W) {
+        return thumb32_UDF();
+    }
+    if (P && U && !W) {
+        // Unprivileged loads are unimplemented
+        return UndefinedInstruction();
+    }
+    if ((W && n == t) || (t == Reg::PC && IsUnpredictablePCWriteInITBlock(ir.current_location))) {
+        return UnpredictableInstruction();
+    }
+
+    const auto address = GetAddress(ir, P, U, W, n, ir.Imm32(imm8.ZeroExtend()));
+    const auto data = ir.ReadMemory32(address);
+
+    if (t == Reg::PC) {
+        ir.LoadWritePC(data);
+
+        if (!P && W && U && n == Reg::R13 && imm8.ZeroExtend() == 4) {
+            ir.SetTerm(IR::Term::PopRSBHint{});
+        } else {
+            ir.SetTerm(IR::Term::FastDispatchHint{});
+        }
+
+        return false;
+    }
+
+    ir.SetRegister(t, data);
+    return true;
+}
+
+// LDR<c>.W <Rt>, [<Rn>{, #<imm12>}]
+bool ThumbTranslatorVisitor::thumb32_LDR_imm12(Reg n, Reg t, Imm<12> imm12) {
+    if (t == Reg::PC && IsUnpredictablePCWriteInITBlock(ir.current_location)) {
+        return UnpredictableInstruction();
+    }
+
+    const auto address = ir.Add(ir.GetRegister(n), ir.Imm32(imm12.ZeroExtend()));
+    const auto data = ir.ReadMemory32(address);
+
+    if (t == Reg::PC) {
+        ir.LoadWritePC(data);
+        ir.SetTerm(IR::Term::FastDispatchHint{});
+        return false;
+    }
+
+    ir.SetRegister(t, data);
+    return true;
+}
+
+} // namespace Dynarmic::A32
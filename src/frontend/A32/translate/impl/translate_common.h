@@ -0,0 +1,37 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2016 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#pragma once
+
+#include "frontend/A32/ir_emitter.h"
+#include "frontend/A32/location_descriptor.h"
+#include "frontend/A32/types.h"
+
+namespace Dynarmic::A32 {
+
+// Instruction semantics shared between the Arm and Thumb translators.
+// Operand and condition checks are left to the caller, as they differ between encodings.
+
+/// SMUAD, SMUSD, SMLAD and SMLSD. a is Reg::PC for the forms without an accumulator.
+void SignedDualMultiply(A32::IREmitter& ir, Reg d, Reg a, Reg m, bool M, Reg n, bool subtract);
+
+/// SMLALD and SMLSLD.
+void SignedDualMultiplyLong(A32::IREmitter& ir, Reg dHi, Reg dLo, Reg m, bool M, Reg n, bool subtract);
+
+/// USAD8 and USADA8. a is Reg::PC for the form without an accumulator.
+void UnsignedSumOfAbsoluteDifferences(A32::IREmitter& ir, Reg d, Reg a, Reg m, Reg n);
+
+/// QASX, QSAX, UQASX and UQSAX.
+void SaturatedAddSubtractExchange(A32::IREmitter& ir, Reg n, Reg d, Reg m, bool is_signed, bool add_high);
+
+/// MRS (register), reading the CPSR. The execution state bits read as zero.
+void ReadCPSR(A32::IREmitter& ir, Reg d);
+
+/// MSR (register), writing the CPSR fields selected by mask.
+/// Returns false if the block must end because the E flag was written, in which case the terminal
+/// has been set to continue at next_location.
+bool WriteCPSR(A32::IREmitter& ir, int mask, Reg n, LocationDescriptor next_location);
+
+} // namespace Dynarmic::A32
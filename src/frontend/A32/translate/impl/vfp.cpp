@@ -6,11 +6,13 @@
 #include "frontend/A32/translate/impl/translate_arm.h"
 
 #include <array>
+#include <cstddef>
+#include <type_traits>
 
 namespace Dynarmic::A32 {
 
-template <typename FnT>
-bool ArmTranslatorVisitor::EmitVfpVectorOperation(bool sz, ExtReg d, ExtReg n, ExtReg m, const FnT& fn) {
+template <typename FnT, typename VectorFnT>
+bool ArmTranslatorVisitor::EmitVfpVectorOperation(bool sz, ExtReg d, ExtReg n, ExtReg m, const FnT& fn, const VectorFnT& vector_fn) {
     if (!ir.current_location.FPSCR().Stride()) {
         return UnpredictableInstruction();
     }
@@ -63,6 +65,43 @@ bool ArmTranslatorVisitor::EmitVfpVectorOperation(bool sz, ExtReg d, ExtReg n, E
         vector_length = 1;
     }
 
+    if constexpr (!std::is_same_v<VectorFnT, std::nullptr_t>) {
+        // When every operand covers whole quadword registers, a quadword at a time can be operated on.
+        // Aligned quadwords either coincide or are disjoint, so no element reads a register written
+        // by an earlier element of the same quadword.
+        const size_t elements_per_quad = sz ? 2 : 4;
+        const auto is_quad_aligned = [elements_per_quad](ExtReg reg) {
+            return RegNumber(reg) % elements_per_quad == 0;
+        };
+        const auto to_quad = [elements_per_quad](ExtReg reg) {
+            return ExtReg::Q0 + RegNumber(reg) / elements_per_quad;
+        };
+
+        if (vector_length > 1 && vector_stride == 1 && vector_length % elements_per_quad == 0
+                && is_quad_aligned(d) && is_quad_aligned(n) && (m_is_scalar || is_quad_aligned(m))) {
+            const size_t esize = sz ? 64 : 32;
+
+            for (size_t i = 0; i < vector_length; i += elements_per_quad) {
+                const auto reg_m = m_is_scalar ? ir.VectorBroadcast(esize, ir.GetExtendedRegister(m)) : ir.GetVector(to_quad(m));
+                if constexpr (std::is_invocable_v<VectorFnT, ExtReg, const IR::U128&>) {
+                    // Two-operand form: n is unused.
+                    ir.SetVector(to_quad(d), vector_fn(to_quad(d), reg_m));
+                } else {
+                    const auto reg_n = ir.GetVector(to_quad(n));
+                    ir.SetVector(to_quad(d), vector_fn(to_quad(d), reg_n, reg_m));
+                }
+
+                d = bank_increment(d, elements_per_quad);
+                n = bank_increment(n, elements_per_quad);
+                if (!m_is_scalar) {
+                    m = bank_increment(m, elements_per_quad);
+                }
+            }
+
+            return true;
+        }
+    }
+
     for (size_t i = 0; i < vector_length; i++) {
         fn(d, n, m);
 
@@ -76,11 +115,23 @@ bool ArmTranslatorVisitor::EmitVfpVectorOperation(bool sz, ExtReg d, ExtReg n, E
     return true;
 }
 
+template <typename FnT, typename VectorFnT>
+bool ArmTranslatorVisitor::EmitVfpVectorOperation(bool sz, ExtReg d, ExtReg m, const FnT& fn, const VectorFnT& vector_fn) {
+    return EmitVfpVectorOperation(sz, d, ExtReg::S0, m, [fn](ExtReg d, ExtReg, ExtReg m){
+        fn(d, m);
+    }, vector_fn);
+}
+
+template <typename FnT>
+bool ArmTranslatorVisitor::EmitVfpVectorOperation(bool sz, ExtReg d, ExtReg n, ExtReg m, const FnT& fn) {
+    return EmitVfpVectorOperation(sz, d, n, m, fn, nullptr);
+}
+
 template <typename FnT>
 bool ArmTranslatorVisitor::EmitVfpVectorOperation(bool sz, ExtReg d, ExtReg m, const FnT& fn) {
     return EmitVfpVectorOperation(sz, d, ExtReg::S0, m, [fn](ExtReg d, ExtReg, ExtReg m){
         fn(d, m);
-    });
+    }, nullptr);
 }
 
 // VADD<c>.F64 <Dd>, <Dn>, <Dm>
@@ -93,12 +144,15 @@ bool ArmTranslatorVisitor::vfp_VADD(Cond cond, bool D, size_t Vn, size_t Vd, boo
     const auto d = ToExtReg(sz, Vd, D);
     const auto n = ToExtReg(sz, Vn, N);
     const auto m = ToExtReg(sz, Vm, M);
+    const size_t esize = sz ? 64 : 32;
 
     return EmitVfpVectorOperation(sz, d, n, m, [this](ExtReg d, ExtReg n, ExtReg m) {
         const auto reg_n = ir.GetExtendedRegister(n);
         const auto reg_m = ir.GetExtendedRegister(m);
         const auto result = ir.FPAdd(reg_n, reg_m);
         ir.SetExtendedRegister(d, result);
+    }, [this, esize](ExtReg, const IR::U128& reg_n, const IR::U128& reg_m) {
+        return ir.FPVectorAdd(esize, reg_n, reg_m);
     });
 }
 
@@ -112,12 +166,15 @@ bool ArmTranslatorVisitor::vfp_VSUB(Cond cond, bool D, size_t Vn, size_t Vd, boo
     const auto d = ToExtReg(sz, Vd, D);
     const auto n = ToExtReg(sz, Vn, N);
     const auto m = ToExtReg(sz, Vm, M);
+    const size_t esize = sz ? 64 : 32;
 
     return EmitVfpVectorOperation(sz, d, n, m, [this](ExtReg d, ExtReg n, ExtReg m) {
         const auto reg_n = ir.GetExtendedRegister(n);
         const auto reg_m = ir.GetExtendedRegister(m);
         const auto result = ir.FPSub(reg_n, reg_m);
         ir.SetExtendedRegister(d, result);
+    }, [this, esize](ExtReg, const IR::U128& reg_n, const IR::U128& reg_m) {
+        return ir.FPVectorSub(esize, reg_n, reg_m);
     });
 }
 
@@ -131,12 +188,15 @@ bool ArmTranslatorVisitor::vfp_VMUL(Cond cond, bool D, size_t Vn, size_t Vd, boo
     const auto d = ToExtReg(sz, Vd, D);
     const auto n = ToExtReg(sz, Vn, N);
     const auto m = ToExtReg(sz, Vm, M);
+    const size_t esize = sz ? 64 : 32;
 
     return EmitVfpVectorOperation(sz, d, n, m, [this](ExtReg d, ExtReg n, ExtReg m) {
         const auto reg_n = ir.GetExtendedRegister(n);
         const auto reg_m = ir.GetExtendedRegister(m);
         const auto result = ir.FPMul(reg_n, reg_m);
         ir.SetExtendedRegister(d, result);
+    }, [this, esize](ExtReg, const IR::U128& reg_n, const IR::U128& reg_m) {
+        return ir.FPVectorMul(esize, reg_n, reg_m);
     });
 }
 
@@ -150,6 +210,7 @@ bool ArmTranslatorVisitor::vfp_VMLA(Cond cond, bool D, size_t Vn, size_t Vd, boo
     const auto d = ToExtReg(sz, Vd, D);
     const auto n = ToExtReg(sz, Vn, N);
     const auto m = ToExtReg(sz, Vm, M);
+    const size_t esize = sz ? 64 : 32;
 
     return EmitVfpVectorOperation(sz, d, n, m, [this](ExtReg d, ExtReg n, ExtReg m) {
         const auto reg_n = ir.GetExtendedRegister(n);
@@ -157,6 +218,8 @@ bool ArmTranslatorVisitor::vfp_VMLA(Cond cond, bool D, size_t Vn, size_t Vd, boo
         const auto reg_d = ir.GetExtendedRegister(d);
         const auto result = ir.FPAdd(reg_d, ir.FPMul(reg_n, reg_m));
         ir.SetExtendedRegister(d, result);
+    }, [this, esize](ExtReg d, const IR::U128& reg_n, const IR::U128& reg_m) {
+        return ir.FPVectorAdd(esize, ir.GetVector(d), ir.FPVectorMul(esize, reg_n, reg_m));
     });
 }
 
@@ -170,6 +233,7 @@ bool ArmTranslatorVisitor::vfp_VMLS(Cond cond, bool D, size_t Vn, size_t Vd, boo
     const auto d = ToExtReg(sz, Vd, D);
     const auto n = ToExtReg(sz, Vn, N);
     const auto m = ToExtReg(sz, Vm, M);
+    const size_t esize = sz ? 64 : 32;
 
     return EmitVfpVectorOperation(sz, d, n, m, [this](ExtReg d, ExtReg n, ExtReg m) {
         const auto reg_n = ir.GetExtendedRegister(n);
@@ -177,6 +241,8 @@ bool ArmTranslatorVisitor::vfp_VMLS(Cond cond, bool D, size_t Vn, size_t Vd, boo
         const auto reg_d = ir.GetExtendedRegister(d);
         const auto result = ir.FPAdd(reg_d, ir.FPNeg(ir.FPMul(reg_n, reg_m)));
         ir.SetExtendedRegister(d, result);
+    }, [this, esize](ExtReg d, const IR::U128& reg_n, const IR::U128& reg_m) {
+        return ir.FPVectorAdd(esize, ir.GetVector(d), ir.FPVectorNeg(esize, ir.FPVectorMul(esize, reg_n, reg_m)));
     });
 }
 
@@ -190,12 +256,15 @@ bool ArmTranslatorVisitor::vfp_VNMUL(Cond cond, bool D, size_t Vn, size_t Vd, bo
     const auto d = ToExtReg(sz, Vd, D);
     const auto n = ToExtReg(sz, Vn, N);
     const auto m = ToExtReg(sz, Vm, M);
+    const size_t esize = sz ? 64 : 32;
 
     return EmitVfpVectorOperation(sz, d, n, m, [this](ExtReg d, ExtReg n, ExtReg m) {
         const auto reg_n = ir.GetExtendedRegister(n);
         const auto reg_m = ir.GetExtendedRegister(m);
         const auto result = ir.FPNeg(ir.FPMul(reg_n, reg_m));
         ir.SetExtendedRegister(d, result);
+    }, [this, esize](ExtReg, const IR::U128& reg_n, const IR::U128& reg_m) {
+        return ir.FPVectorNeg(esize, ir.FPVectorMul(esize, reg_n, reg_m));
     });
 }
 
@@ -209,6 +278,7 @@ bool ArmTranslatorVisitor::vfp_VNMLA(Cond cond, bool D, size_t Vn, size_t Vd, bo
     const auto d = ToExtReg(sz, Vd, D);
     const auto n = ToExtReg(sz, Vn, N);
     const auto m = ToExtReg(sz, Vm, M);
+    const size_t esize = sz ? 64 : 32;
 
     return EmitVfpVectorOperation(sz, d, n, m, [this](ExtReg d, ExtReg n, ExtReg m) {
         const auto reg_n = ir.GetExtendedRegister(n);
@@ -216,6 +286,8 @@ bool ArmTranslatorVisitor::vfp_VNMLA(Cond cond, bool D, size_t Vn, size_t Vd, bo
         const auto reg_d = ir.GetExtendedRegister(d);
         const auto result = ir.FPAdd(ir.FPNeg(reg_d), ir.FPNeg(ir.FPMul(reg_n, reg_m)));
         ir.SetExtendedRegister(d, result);
+    }, [this, esize](ExtReg d, const IR::U128& reg_n, const IR::U128& reg_m) {
+        return ir.FPVectorAdd(esize, ir.FPVectorNeg(esize, ir.GetVector(d)), ir.FPVectorNeg(esize, ir.FPVectorMul(esize, reg_n, reg_m)));
     });
 }
 
@@ -229,6 +301,7 @@ bool ArmTranslatorVisitor::vfp_VNMLS(Cond cond, bool D, size_t Vn, size_t Vd, bo
     const auto d = ToExtReg(sz, Vd, D);
     const auto n = ToExtReg(sz, Vn, N);
     const auto m = ToExtReg(sz, Vm, M);
+    const size_t esize = sz ? 64 : 32;
 
     return EmitVfpVectorOperation(sz, d, n, m, [this](ExtReg d, ExtReg n, ExtReg m) {
         const auto reg_n = ir.GetExtendedRegister(n);
@@ -236,6 +309,8 @@ bool ArmTranslatorVisitor::vfp_VNMLS(Cond cond, bool D, size_t Vn, size_t Vd, bo
         const auto reg_d = ir.GetExtendedRegister(d);
         const auto result = ir.FPAdd(ir.FPNeg(reg_d), ir.FPMul(reg_n, reg_m));
         ir.SetExtendedRegister(d, result);
+    }, [this, esize](ExtReg d, const IR::U128& reg_n, const IR::U128& reg_m) {
+        return ir.FPVectorAdd(esize, ir.FPVectorNeg(esize, ir.GetVector(d)), ir.FPVectorMul(esize, reg_n, reg_m));
     });
 }
 
@@ -249,12 +324,15 @@ bool ArmTranslatorVisitor::vfp_VDIV(Cond cond, bool D, size_t Vn, size_t Vd, boo
     const auto d = ToExtReg(sz, Vd, D);
     const auto n = ToExtReg(sz, Vn, N);
     const auto m = ToExtReg(sz, Vm, M);
+    const size_t esize = sz ? 64 : 32;
 
     return EmitVfpVectorOperation(sz, d, n, m, [this](ExtReg d, ExtReg n, ExtReg m) {
         const auto reg_n = ir.GetExtendedRegister(n);
         const auto reg_m = ir.GetExtendedRegister(m);
         const auto result = ir.FPDiv(reg_n, reg_m);
         ir.SetExtendedRegister(d, result);
+    }, [this, esize](ExtReg, const IR::U128& reg_n, const IR::U128& reg_m) {
+        return ir.FPVectorDiv(esize, reg_n, reg_m);
     });
 }
 
@@ -268,6 +346,7 @@ bool ArmTranslatorVisitor::vfp_VFNMS(Cond cond, bool D, size_t Vn, size_t Vd, bo
     const auto d = ToExtReg(sz, Vd, D);
     const auto n = ToExtReg(sz, Vn, N);
     const auto m = ToExtReg(sz, Vm, M);
+    const size_t esize = sz ? 64 : 32;
 
     return EmitVfpVectorOperation(sz, d, n, m, [this](ExtReg d, ExtReg n, ExtReg m) {
         const auto reg_n = ir.GetExtendedRegister(n);
@@ -275,6 +354,8 @@ bool ArmTranslatorVisitor::vfp_VFNMS(Cond cond, bool D, size_t Vn, size_t Vd, bo
         const auto reg_d = ir.GetExtendedRegister(d);
         const auto result = ir.FPMulAdd(ir.FPNeg(reg_d), reg_n, reg_m);
         ir.SetExtendedRegister(d, result);
+    }, [this, esize](ExtReg d, const IR::U128& reg_n, const IR::U128& reg_m) {
+        return ir.FPVectorMulAdd(esize, ir.FPVectorNeg(esize, ir.GetVector(d)), reg_n, reg_m);
     });
 }
 
@@ -288,6 +369,7 @@ bool ArmTranslatorVisitor::vfp_VFNMA(Cond cond, bool D, size_t Vn, size_t Vd, bo
     const auto d = ToExtReg(sz, Vd, D);
     const auto n = ToExtReg(sz, Vn, N);
     const auto m = ToExtReg(sz, Vm, M);
+    const size_t esize = sz ? 64 : 32;
 
     return EmitVfpVectorOperation(sz, d, n, m, [this](ExtReg d, ExtReg n, ExtReg m) {
         const auto reg_n = ir.GetExtendedRegister(n);
@@ -295,6 +377,8 @@ bool ArmTranslatorVisitor::vfp_VFNMA(Cond cond, bool D, size_t Vn, size_t Vd, bo
         const auto reg_d = ir.GetExtendedRegister(d);
         const auto result = ir.FPMulAdd(ir.FPNeg(reg_d), ir.FPNeg(reg_n), reg_m);
         ir.SetExtendedRegister(d, result);
+    }, [this, esize](ExtReg d, const IR::U128& reg_n, const IR::U128& reg_m) {
+        return ir.FPVectorMulAdd(esize, ir.FPVectorNeg(esize, ir.GetVector(d)), ir.FPVectorNeg(esize, reg_n), reg_m);
     });
 }
 
@@ -308,6 +392,7 @@ bool ArmTranslatorVisitor::vfp_VFMA(Cond cond, bool D, size_t Vn, size_t Vd, boo
     const auto d = ToExtReg(sz, Vd, D);
     const auto n = ToExtReg(sz, Vn, N);
     const auto m = ToExtReg(sz, Vm, M);
+    const size_t esize = sz ? 64 : 32;
 
     return EmitVfpVectorOperation(sz, d, n, m, [this](ExtReg d, ExtReg n, ExtReg m) {
         const auto reg_n = ir.GetExtendedRegister(n);
@@ -315,6 +400,8 @@ bool ArmTranslatorVisitor::vfp_VFMA(Cond cond, bool D, size_t Vn, size_t Vd, boo
         const auto reg_d = ir.GetExtendedRegister(d);
         const auto result = ir.FPMulAdd(reg_d, reg_n, reg_m);
         ir.SetExtendedRegister(d, result);
+    }, [this, esize](ExtReg d, const IR::U128& reg_n, const IR::U128& reg_m) {
+        return ir.FPVectorMulAdd(esize, ir.GetVector(d), reg_n, reg_m);
     });
 }
 
@@ -328,6 +415,7 @@ bool ArmTranslatorVisitor::vfp_VFMS(Cond cond, bool D, size_t Vn, size_t Vd, boo
     const auto d = ToExtReg(sz, Vd, D);
     const auto n = ToExtReg(sz, Vn, N);
     const auto m = ToExtReg(sz, Vm, M);
+    const size_t esize = sz ? 64 : 32;
 
     return EmitVfpVectorOperation(sz, d, n, m, [this](ExtReg d, ExtReg n, ExtReg m) {
         const auto reg_n = ir.GetExtendedRegister(n);
@@ -335,6 +423,8 @@ bool ArmTranslatorVisitor::vfp_VFMS(Cond cond, bool D, size_t Vn, size_t Vd, boo
         const auto reg_d = ir.GetExtendedRegister(d);
         const auto result = ir.FPMulAdd(reg_d, ir.FPNeg(reg_n), reg_m);
         ir.SetExtendedRegister(d, result);
+    }, [this, esize](ExtReg d, const IR::U128& reg_n, const IR::U128& reg_m) {
+        return ir.FPVectorMulAdd(esize, ir.GetVector(d), ir.FPVectorNeg(esize, reg_n), reg_m);
     });
 }
 
@@ -724,6 +814,8 @@ bool ArmTranslatorVisitor::vfp_VMOV_reg(Cond cond, bool D, size_t Vd, bool sz, b
 
     return EmitVfpVectorOperation(sz, d, m, [this](ExtReg d, ExtReg m) {
         ir.SetExtendedRegister(d, ir.GetExtendedRegister(m));
+    }, [](ExtReg, const IR::U128& reg_m) {
+        return reg_m;
     });
 }
 
@@ -736,11 +828,14 @@ bool ArmTranslatorVisitor::vfp_VABS(Cond cond, bool D, size_t Vd, bool sz, bool
 
     const auto d = ToExtReg(sz, Vd, D);
     const auto m = ToExtReg(sz, Vm, M);
+    const size_t esize = sz ? 64 : 32;
 
     return EmitVfpVectorOperation(sz, d, m, [this](ExtReg d, ExtReg m) {
         const auto reg_m = ir.GetExtendedRegister(m);
         const auto result = ir.FPAbs(reg_m);
         ir.SetExtendedRegister(d, result);
+    }, [this, esize](ExtReg, const IR::U128& reg_m) {
+        return ir.FPVectorAbs(esize, reg_m);
     });
 }
 
@@ -753,11 +848,14 @@ bool ArmTranslatorVisitor::vfp_VNEG(Cond cond, bool D, size_t Vd, bool sz, bool
 
     const auto d = ToExtReg(sz, Vd, D);
     const auto m = ToExtReg(sz, Vm, M);
+    const size_t esize = sz ? 64 : 32;
 
     return EmitVfpVectorOperation(sz, d, m, [this](ExtReg d, ExtReg m) {
         const auto reg_m = ir.GetExtendedRegister(m);
         const auto result = ir.FPNeg(reg_m);
         ir.SetExtendedRegister(d, result);
+    }, [this, esize](ExtReg, const IR::U128& reg_m) {
+        return ir.FPVectorNeg(esize, reg_m);
     });
 }
 
@@ -770,11 +868,14 @@ bool ArmTranslatorVisitor::vfp_VSQRT(Cond cond, bool D, size_t Vd, bool sz, bool
 
     const auto d = ToExtReg(sz, Vd, D);
     const auto m = ToExtReg(sz, Vm, M);
+    const size_t esize = sz ? 64 : 32;
 
     return EmitVfpVectorOperation(sz, d, m, [this](ExtReg d, ExtReg m) {
         const auto reg_m = ir.GetExtendedRegister(m);
         const auto result = ir.FPSqrt(reg_m);
         ir.SetExtendedRegister(d, result);
+    }, [this, esize](ExtReg, const IR::U128& reg_m) {
+        return ir.FPVectorSqrt(esize, reg_m);
     });
 }
 
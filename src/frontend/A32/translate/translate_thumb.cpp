@@ -14,6 +14,7 @@
 #include "frontend/A32/decoder/thumb32.h"
 #include "frontend/A32/ir_emitter.h"
 #include "frontend/A32/location_descriptor.h"
+#include "frontend/A32/translate/conditional_state.h"
 #include "frontend/A32/translate/impl/translate_thumb.h"
 #include "frontend/A32/translate/translate.h"
 
@@ -25,7 +26,7 @@ enum class ThumbInstSize {
 };
 
 bool IsThumb16(u16 first_part) {
-    return (first_part & 0xF800) <= 0xE800;
+    return (first_part & 0xF800) < 0xE800;
 }
 
 std::tuple<u32, ThumbInstSize> ReadThumbInstruction(u32 arm_pc, MemoryReadCodeFuncType memory_read_code) {
@@ -52,6 +53,14 @@ std::tuple<u32, ThumbInstSize> ReadThumbInstruction(u32 arm_pc, MemoryReadCodeFu
     return std::make_tuple(static_cast<u32>((first_part << 16) | second_part), ThumbInstSize::Thumb32);
 }
 
+bool IsUnconditionalInstruction(bool is_thumb_16, u32 instruction) {
+    if (!is_thumb_16) {
+        return false;
+    }
+    // BKPT executes unconditionally even within an IT block.
+    return (instruction & 0xFF00) == 0xBE00;
+}
+
 } // local namespace
 
 IR::Block TranslateThumb(LocationDescriptor descriptor, MemoryReadCodeFuncType memory_read_code, const TranslationOptions& options) {
@@ -64,30 +73,51 @@ IR::Block TranslateThumb(LocationDescriptor descriptor, MemoryReadCodeFuncType m
     do {
         const u32 arm_pc = visitor.ir.current_location.PC();
         const auto [thumb_instruction, inst_size] = ReadThumbInstruction(arm_pc, memory_read_code);
-
-        if (inst_size == ThumbInstSize::Thumb16) {
-            if (const auto decoder = DecodeThumb16<ThumbTranslatorVisitor>(static_cast<u16>(thumb_instruction))) {
-                should_continue = decoder->get().call(visitor, static_cast<u16>(thumb_instruction));
+        const bool is_thumb_16 = inst_size == ThumbInstSize::Thumb16;
+        visitor.is_thumb_16 = is_thumb_16;
+
+        IR::Inst* const last_inst = block.empty() ? nullptr : &block.back();
+
+        if (IsUnconditionalInstruction(is_thumb_16, thumb_instruction) || visitor.ConditionPassed()) {
+            if (is_thumb_16) {
+                if (const auto decoder = DecodeThumb16<ThumbTranslatorVisitor>(static_cast<u16>(thumb_instruction))) {
+                    should_continue = decoder->get().call(visitor, static_cast<u16>(thumb_instruction));
+                } else {
+                    should_continue = visitor.thumb16_UDF();
+                }
             } else {
-                should_continue = visitor.thumb16_UDF();
-            }
-        } else {
-            if (const auto decoder = DecodeThumb32<ThumbTranslatorVisitor>(thumb_instruction)) {
-                should_continue = decoder->get().call(visitor, thumb_instruction);
-            } else {
-                should_continue = visitor.thumb32_UDF();
+                if (const auto decoder = DecodeThumb32<ThumbTranslatorVisitor>(thumb_instruction)) {
+                    should_continue = decoder->get().call(visitor, thumb_instruction);
+                } else {
+                    should_continue = visitor.thumb32_UDF();
+                }
             }
         }
 
-        const s32 advance_pc = (inst_size == ThumbInstSize::Thumb16) ? 2 : 4;
-        visitor.ir.current_location = visitor.ir.current_location.AdvancePC(advance_pc);
+        if (visitor.cond_state == ConditionalState::Predicating) {
+            should_continue = PredicateInstruction(visitor.predicate, visitor.cond_state, last_inst, should_continue, visitor.ir);
+        }
+
+        if (visitor.cond_state == ConditionalState::Break) {
+            break;
+        }
+
+        visitor.ir.current_location = visitor.ir.current_location.AdvancePC(is_thumb_16 ? 2 : 4).AdvanceIT();
         block.CycleCount()++;
-    } while (should_continue && !single_step);
+    } while (should_continue && CondCanContinue(visitor.cond_state, visitor.ir) && !single_step);
 
-    if (single_step && should_continue) {
-        visitor.ir.SetTerm(IR::Term::LinkBlock{visitor.ir.current_location});
+    if (visitor.cond_state == ConditionalState::Translating || visitor.cond_state == ConditionalState::Trailing || single_step) {
+        if (should_continue) {
+            if (single_step) {
+                visitor.ir.SetTerm(IR::Term::LinkBlock{visitor.ir.current_location});
+            } else {
+                visitor.ir.SetTerm(IR::Term::LinkBlockFast{visitor.ir.current_location});
+            }
+        }
     }
 
+    ASSERT_MSG(block.HasTerminal(), "Terminal has not been set");
+
     block.SetEndLocation(visitor.ir.current_location);
 
     return block;
@@ -97,6 +127,7 @@ bool TranslateSingleThumbInstruction(IR::Block& block, LocationDescriptor descri
     ThumbTranslatorVisitor visitor{block, descriptor, {}};
 
     const bool is_thumb_16 = IsThumb16(static_cast<u16>(thumb_instruction));
+    visitor.is_thumb_16 = is_thumb_16;
     bool should_continue = true;
     if (is_thumb_16) {
         if (const auto decoder = DecodeThumb16<ThumbTranslatorVisitor>(static_cast<u16>(thumb_instruction))) {
@@ -112,8 +143,7 @@ bool TranslateSingleThumbInstruction(IR::Block& block, LocationDescriptor descri
         }
     }
 
-    const s32 advance_pc = is_thumb_16 ? 2 : 4;
-    visitor.ir.current_location = visitor.ir.current_location.AdvancePC(advance_pc);
+    visitor.ir.current_location = visitor.ir.current_location.AdvancePC(is_thumb_16 ? 2 : 4).AdvanceIT();
     block.CycleCount()++;
 
     block.SetEndLocation(visitor.ir.current_location);
@@ -121,6 +151,10 @@ bool TranslateSingleThumbInstruction(IR::Block& block, LocationDescriptor descri
     return should_continue;
 }
 
+bool ThumbTranslatorVisitor::ConditionPassed() {
+    return IsConditionPassed(ir.current_location.IT().Cond(), cond_state, predicate, ir, is_thumb_16 ? 2 : 4);
+}
+
 bool ThumbTranslatorVisitor::InterpretThisInstruction() {
     ir.SetTerm(IR::Term::Interpret(ir.current_location));
     return false;
@@ -139,10 +173,70 @@ bool ThumbTranslatorVisitor::UndefinedInstruction() {
 }
 
 bool ThumbTranslatorVisitor::RaiseException(Exception exception) {
-    ir.BranchWritePC(ir.Imm32(ir.current_location.PC() + 2)); // TODO: T32
+    ir.UpdateUpperLocationDescriptor();
+    ir.BranchWritePC(ir.Imm32(ir.current_location.PC() + (is_thumb_16 ? 2 : 4)));
     ir.ExceptionRaised(exception);
     ir.SetTerm(IR::Term::CheckHalt{IR::Term::ReturnToDispatch{}});
     return false;
 }
 
+IR::ResultAndCarry<IR::U32> ThumbTranslatorVisitor::EmitImmShift(IR::U32 value, ShiftType type, Imm<3> imm3, Imm<2> imm2, IR::U1 carry_in) {
+    u8 imm5_value = concatenate(imm3, imm2).ZeroExtend<u8>();
+    switch (type) {
+    case ShiftType::LSL:
+        return ir.LogicalShiftLeft(value, ir.Imm8(imm5_value), carry_in);
+    case ShiftType::LSR:
+        imm5_value = imm5_value ? imm5_value : 32;
+        return ir.LogicalShiftRight(value, ir.Imm8(imm5_value), carry_in);
+    case ShiftType::ASR:
+        imm5_value = imm5_value ? imm5_value : 32;
+        return ir.ArithmeticShiftRight(value, ir.Imm8(imm5_value), carry_in);
+    case ShiftType::ROR:
+        if (imm5_value) {
+            return ir.RotateRight(value, ir.Imm8(imm5_value), carry_in);
+        } else {
+            return ir.RotateRightExtended(value, carry_in);
+        }
+    }
+    UNREACHABLE();
+}
+
+IR::ResultAndCarry<IR::U32> ThumbTranslatorVisitor::EmitRegShift(IR::U32 value, ShiftType type, IR::U8 amount, IR::U1 carry_in) {
+    switch (type) {
+    case ShiftType::LSL:
+        return ir.LogicalShiftLeft(value, amount, carry_in);
+    case ShiftType::LSR:
+        return ir.LogicalShiftRight(value, amount, carry_in);
+    case ShiftType::ASR:
+        return ir.ArithmeticShiftRight(value, amount, carry_in);
+    case ShiftType::ROR:
+        return ir.RotateRight(value, amount, carry_in);
+    }
+    UNREACHABLE();
+}
+
+void ThumbTranslatorVisitor::SetFlagsOutsideITBlock(IR::U32 result) {
+    if (ir.current_location.IT().IsInITBlock()) {
+        return;
+    }
+    ir.SetNFlag(ir.MostSignificantBit(result));
+    ir.SetZFlag(ir.IsZero(result));
+}
+
+void ThumbTranslatorVisitor::SetFlagsOutsideITBlock(IR::U32 result, IR::U1 carry) {
+    if (ir.current_location.IT().IsInITBlock()) {
+        return;
+    }
+    SetFlagsOutsideITBlock(result);
+    ir.SetCFlag(carry);
+}
+
+void ThumbTranslatorVisitor::SetFlagsOutsideITBlock(IR::U32 result, IR::U1 carry, IR::U1 overflow) {
+    if (ir.current_location.IT().IsInITBlock()) {
+        return;
+    }
+    SetFlagsOutsideITBlock(result, carry);
+    ir.SetVFlag(overflow);
+}
+
 } // namespace Dynarmic::A32
@@ -180,6 +180,42 @@ IR::U32 IREmitter::ExclusiveWriteMemory128(const IR::U64& vaddr, const IR::U128&
     return Inst<IR::U32>(Opcode::A64ExclusiveWriteMemory128, vaddr, value);
 }
 
+IR::U8 IREmitter::AtomicMemoryOperation8(const IR::U64& vaddr, const IR::U8& value, IR::MemAtomicOp op) {
+    return Inst<IR::U8>(Opcode::A64AtomicMemoryOperation8, vaddr, value, Imm8(static_cast<u8>(op)));
+}
+
+IR::U16 IREmitter::AtomicMemoryOperation16(const IR::U64& vaddr, const IR::U16& value, IR::MemAtomicOp op) {
+    return Inst<IR::U16>(Opcode::A64AtomicMemoryOperation16, vaddr, value, Imm8(static_cast<u8>(op)));
+}
+
+IR::U32 IREmitter::AtomicMemoryOperation32(const IR::U64& vaddr, const IR::U32& value, IR::MemAtomicOp op) {
+    return Inst<IR::U32>(Opcode::A64AtomicMemoryOperation32, vaddr, value, Imm8(static_cast<u8>(op)));
+}
+
+IR::U64 IREmitter::AtomicMemoryOperation64(const IR::U64& vaddr, const IR::U64& value, IR::MemAtomicOp op) {
+    return Inst<IR::U64>(Opcode::A64AtomicMemoryOperation64, vaddr, value, Imm8(static_cast<u8>(op)));
+}
+
+IR::U8 IREmitter::CompareAndSwapMemory8(const IR::U64& vaddr, const IR::U8& expected, const IR::U8& desired) {
+    return Inst<IR::U8>(Opcode::A64CompareAndSwapMemory8, vaddr, expected, desired);
+}
+
+IR::U16 IREmitter::CompareAndSwapMemory16(const IR::U64& vaddr, const IR::U16& expected, const IR::U16& desired) {
+    return Inst<IR::U16>(Opcode::A64CompareAndSwapMemory16, vaddr, expected, desired);
+}
+
+IR::U32 IREmitter::CompareAndSwapMemory32(const IR::U64& vaddr, const IR::U32& expected, const IR::U32& desired) {
+    return Inst<IR::U32>(Opcode::A64CompareAndSwapMemory32, vaddr, expected, desired);
+}
+
+IR::U64 IREmitter::CompareAndSwapMemory64(const IR::U64& vaddr, const IR::U64& expected, const IR::U64& desired) {
+    return Inst<IR::U64>(Opcode::A64CompareAndSwapMemory64, vaddr, expected, desired);
+}
+
+IR::U128 IREmitter::CompareAndSwapMemory128(const IR::U64& vaddr, const IR::U128& expected, const IR::U128& desired) {
+    return Inst<IR::U128>(Opcode::A64CompareAndSwapMemory128, vaddr, expected, desired);
+}
+
 IR::U32 IREmitter::GetW(Reg reg) {
     if (reg == Reg::ZR)
         return Imm32(0);
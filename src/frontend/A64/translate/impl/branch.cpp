@@ -63,6 +63,42 @@ bool TranslatorVisitor::RET(Reg Rn) {
     return false;
 }
 
+// With Z clear the modifier is zero and Rm must be 31; otherwise Xm (or SP) is the modifier.
+bool TranslatorVisitor::BLRA(bool Z, bool /*M*/, Reg Rn, Reg Rm) {
+    if (!Z && Rm != Reg::R31) {
+        return UnallocatedEncoding();
+    }
+
+    const auto target = StripPointerAuthenticationCode(X(64, Rn));
+
+    X(64, Reg::R30, ir.Imm64(ir.PC() + 4));
+    ir.PushRSB(ir.current_location->AdvancePC(4));
+
+    ir.SetPC(target);
+    ir.SetTerm(IR::Term::FastDispatchHint{});
+    return false;
+}
+
+bool TranslatorVisitor::BRA(bool Z, bool /*M*/, Reg Rn, Reg Rm) {
+    if (!Z && Rm != Reg::R31) {
+        return UnallocatedEncoding();
+    }
+
+    const auto target = StripPointerAuthenticationCode(X(64, Rn));
+
+    ir.SetPC(target);
+    ir.SetTerm(IR::Term::FastDispatchHint{});
+    return false;
+}
+
+bool TranslatorVisitor::RETA(bool /*M*/) {
+    const auto target = StripPointerAuthenticationCode(X(64, Reg::R30));
+
+    ir.SetPC(target);
+    ir.SetTerm(IR::Term::PopRSBHint{});
+    return false;
+}
+
 bool TranslatorVisitor::CBZ(bool sf, Imm<19> imm19, Reg Rt) {
     const size_t datasize = sf ? 64 : 32;
     const s64 offset = concatenate(imm19, Imm<2>{0}).SignExtend<s64>();
@@ -111,6 +111,67 @@ bool TranslatorVisitor::REV16_int(bool sf, Reg Rn, Reg Rd) {
     return true;
 }
 
+// Pointer authentication is not emulated: a code is never added to a pointer, and authenticating
+// a pointer only strips any code it may already carry. With Z set the modifier is zero and Rn must be 31.
+static bool AddPointerAuthenticationCode(TranslatorVisitor& v, bool Z, Reg Rn) {
+    if (Z && Rn != Reg::R31) {
+        return v.UnallocatedEncoding();
+    }
+    return true;
+}
+
+static bool AuthenticatePointer(TranslatorVisitor& v, bool Z, Reg Rn, Reg Rd) {
+    if (Z && Rn != Reg::R31) {
+        return v.UnallocatedEncoding();
+    }
+
+    v.X(64, Rd, v.StripPointerAuthenticationCode(v.X(64, Rd)));
+    return true;
+}
+
+bool TranslatorVisitor::PACIA_1(bool Z, Reg Rn, Reg /*Rd*/) {
+    return AddPointerAuthenticationCode(*this, Z, Rn);
+}
+
+bool TranslatorVisitor::PACIB_1(bool Z, Reg Rn, Reg /*Rd*/) {
+    return AddPointerAuthenticationCode(*this, Z, Rn);
+}
+
+bool TranslatorVisitor::PACDA(bool Z, Reg Rn, Reg /*Rd*/) {
+    return AddPointerAuthenticationCode(*this, Z, Rn);
+}
+
+bool TranslatorVisitor::PACDB(bool Z, Reg Rn, Reg /*Rd*/) {
+    return AddPointerAuthenticationCode(*this, Z, Rn);
+}
+
+bool TranslatorVisitor::AUTIA_1(bool Z, Reg Rn, Reg Rd) {
+    return AuthenticatePointer(*this, Z, Rn, Rd);
+}
+
+bool TranslatorVisitor::AUTIB_1(bool Z, Reg Rn, Reg Rd) {
+    return AuthenticatePointer(*this, Z, Rn, Rd);
+}
+
+bool TranslatorVisitor::AUTDA(bool Z, Reg Rn, Reg Rd) {
+    return AuthenticatePointer(*this, Z, Rn, Rd);
+}
+
+bool TranslatorVisitor::AUTDB(bool Z, Reg Rn, Reg Rd) {
+    return AuthenticatePointer(*this, Z, Rn, Rd);
+}
+
+bool TranslatorVisitor::XPAC_1(bool /*D*/, Reg Rd) {
+    X(64, Rd, StripPointerAuthenticationCode(X(64, Rd)));
+    return true;
+}
+
+// As pointer authentication is not emulated, the generic authentication code is always zero.
+bool TranslatorVisitor::PACGA(Reg /*Rm*/, Reg /*Rn*/, Reg Rd) {
+    X(64, Rd, ir.Imm64(0));
+    return true;
+}
+
 bool TranslatorVisitor::UDIV(bool sf, Reg Rm, Reg Rn, Reg Rd) {
     const size_t datasize = sf ? 64 : 32;
 
@@ -196,4 +196,13 @@ bool TranslatorVisitor::FCVTMU_float(bool sf, Imm<2> type, Vec Vn, Reg Rd) {
     return FloaingPointConvertUnsignedInteger(*this, sf, type, Vn, Rd, FP::RoundingMode::TowardsMinusInfinity);
 }
 
+bool TranslatorVisitor::FJCVTZS(Vec Vn, Reg Rd) {
+    const IR::U64 fltval = V_scalar(64, Vn);
+    const IR::U32 intval = ir.FPToFixedJS(fltval);
+
+    X(32, Rd, intval);
+    ir.SetNZCV(ir.NZCVFrom(intval));
+    return true;
+}
+
 } // namespace Dynarmic::A64
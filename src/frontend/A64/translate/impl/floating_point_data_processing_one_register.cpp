@@ -184,4 +184,34 @@ bool TranslatorVisitor::FRINTI_float(Imm<2> type, Vec Vn, Vec Vd) {
     return FloatingPointRoundToIntegral(*this, type, Vn, Vd, ir.current_location->FPCR().RMode(), false);
 }
 
+static bool FloatingPointRoundToIntegralN(TranslatorVisitor& v, Imm<2> type, Vec Vn, Vec Vd,
+                                          FP::RoundingMode rounding_mode, size_t intsize) {
+    if (type != 0b00 && type != 0b01) {
+        return v.UnallocatedEncoding();
+    }
+
+    const size_t datasize = type == 0b00 ? 32 : 64;
+
+    const IR::U32U64 operand = v.V_scalar(datasize, Vn);
+    const IR::U32U64 result = v.ir.FPRoundIntN(operand, rounding_mode, intsize);
+    v.V_scalar(datasize, Vd, result);
+    return true;
+}
+
+bool TranslatorVisitor::FRINT32X_float(Imm<2> type, Vec Vn, Vec Vd) {
+    return FloatingPointRoundToIntegralN(*this, type, Vn, Vd, ir.current_location->FPCR().RMode(), 32);
+}
+
+bool TranslatorVisitor::FRINT64X_float(Imm<2> type, Vec Vn, Vec Vd) {
+    return FloatingPointRoundToIntegralN(*this, type, Vn, Vd, ir.current_location->FPCR().RMode(), 64);
+}
+
+bool TranslatorVisitor::FRINT32Z_float(Imm<2> type, Vec Vn, Vec Vd) {
+    return FloatingPointRoundToIntegralN(*this, type, Vn, Vd, FP::RoundingMode::TowardsZero, 32);
+}
+
+bool TranslatorVisitor::FRINT64Z_float(Imm<2> type, Vec Vn, Vec Vd) {
+    return FloatingPointRoundToIntegralN(*this, type, Vn, Vd, FP::RoundingMode::TowardsZero, 64);
+}
+
 } // namespace Dynarmic::A64
@@ -289,6 +289,38 @@ IR::U32 TranslatorVisitor::ExclusiveMem(IR::U64 address, size_t bytesize, IR::Ac
     }
 }
 
+IR::UAny TranslatorVisitor::AtomicMem(IR::U64 address, size_t bytesize, IR::AccType /*acctype*/, IR::MemAtomicOp op, IR::UAny value) {
+    switch (bytesize) {
+    case 1:
+        return ir.AtomicMemoryOperation8(address, value, op);
+    case 2:
+        return ir.AtomicMemoryOperation16(address, value, op);
+    case 4:
+        return ir.AtomicMemoryOperation32(address, value, op);
+    case 8:
+        return ir.AtomicMemoryOperation64(address, value, op);
+    default:
+        ASSERT_FALSE("Invalid bytesize parameter {}", bytesize);
+    }
+}
+
+IR::UAnyU128 TranslatorVisitor::CompareAndSwapMem(IR::U64 address, size_t bytesize, IR::AccType /*acctype*/, IR::UAnyU128 expected, IR::UAnyU128 desired) {
+    switch (bytesize) {
+    case 1:
+        return ir.CompareAndSwapMemory8(address, expected, desired);
+    case 2:
+        return ir.CompareAndSwapMemory16(address, expected, desired);
+    case 4:
+        return ir.CompareAndSwapMemory32(address, expected, desired);
+    case 8:
+        return ir.CompareAndSwapMemory64(address, expected, desired);
+    case 16:
+        return ir.CompareAndSwapMemory128(address, expected, desired);
+    default:
+        ASSERT_FALSE("Invalid bytesize parameter {}", bytesize);
+    }
+}
+
 IR::U32U64 TranslatorVisitor::SignExtend(IR::UAny value, size_t to_size) {
     switch (to_size) {
     case 32:
@@ -402,4 +434,111 @@ IR::U32U64 TranslatorVisitor::ExtendReg(size_t bitsize, Reg reg, Imm<3> option,
     return ir.LogicalShiftLeft(extended, ir.Imm8(shift));
 }
 
+IR::U64 TranslatorVisitor::StripPointerAuthenticationCode(IR::U64 pointer) {
+    const u64 mask = options.pointer_authentication_strip_mask;
+    if (mask == 0) {
+        return pointer;
+    }
+
+    // Bit 55 selects between the upper and lower halves of the address space.
+    const IR::U64 extension = ir.ArithmeticShiftRight(ir.LogicalShiftLeft(pointer, ir.Imm8(8)), ir.Imm8(63));
+    return ir.Or(ir.And(pointer, ir.Imm64(~mask)), ir.And(extension, ir.Imm64(mask)));
+}
+
+namespace {
+IR::U128 VectorSelect(IREmitter& ir, const IR::U128& mask, const IR::U128& if_set, const IR::U128& if_clear) {
+    return ir.VectorOr(ir.VectorAnd(mask, if_set), ir.VectorAnd(ir.VectorNot(mask), if_clear));
+}
+
+// FMAXNM and FMINNM treat a quiet NaN as missing data when the other operand is a number.
+// Such NaNs are replaced with the infinity that loses the comparison before deferring to FPVectorMax/Min.
+IR::U128 FPHalfMinMaxNumeric(TranslatorVisitor& v, IR::U128 operand1, IR::U128 operand2, bool is_max) {
+    const IR::U128 qnan_mask = v.ir.VectorBroadcast(16, v.I(16, 0x7E00));
+    const IR::U128 abs_mask = v.ir.VectorBroadcast(16, v.I(16, 0x7FFF));
+    const IR::U128 infinity = v.ir.VectorBroadcast(16, v.I(16, 0x7C00));
+    const IR::U128 replacement = v.ir.VectorBroadcast(16, v.I(16, is_max ? 0xFC00 : 0x7C00));
+
+    const auto is_qnan = [&](const IR::U128& operand) {
+        return v.ir.VectorEqual(16, v.ir.VectorAnd(operand, qnan_mask), qnan_mask);
+    };
+    const auto is_nan = [&](const IR::U128& operand) {
+        return v.ir.VectorGreaterSigned(16, v.ir.VectorAnd(operand, abs_mask), infinity);
+    };
+
+    const IR::U128 replace1 = v.ir.VectorAnd(is_qnan(operand1), v.ir.VectorNot(is_nan(operand2)));
+    const IR::U128 replace2 = v.ir.VectorAnd(is_qnan(operand2), v.ir.VectorNot(is_nan(operand1)));
+    operand1 = VectorSelect(v.ir, replace1, replacement, operand1);
+    operand2 = VectorSelect(v.ir, replace2, replacement, operand2);
+
+    return is_max ? v.ir.FPVectorMax(16, operand1, operand2) : v.ir.FPVectorMin(16, operand1, operand2);
+}
+} // Anonymous namespace
+
+IR::U128 TranslatorVisitor::FPHalfMaxNumeric(const IR::U128& operand1, const IR::U128& operand2) {
+    return FPHalfMinMaxNumeric(*this, operand1, operand2, true);
+}
+
+IR::U128 TranslatorVisitor::FPHalfMinNumeric(const IR::U128& operand1, const IR::U128& operand2) {
+    return FPHalfMinMaxNumeric(*this, operand1, operand2, false);
+}
+
+// FMULX returns 2.0, signed like the product, for zero times infinity. Those lanes are multiplied
+// as 2.0 times 1.0 instead, so that FPVectorMul neither returns a NaN nor raises Invalid Operation.
+// Under FPCR.FZ16 a subnormal operand counts as zero.
+IR::U128 TranslatorVisitor::FPHalfMulX(const IR::U128& operand1, const IR::U128& operand2) {
+    const IR::U128 abs_mask = ir.VectorBroadcast(16, I(16, 0x7FFF));
+    const IR::U128 sign_mask = ir.VectorBroadcast(16, I(16, 0x8000));
+    const IR::U128 infinity = ir.VectorBroadcast(16, I(16, 0x7C00));
+    const IR::U128 smallest_normal = ir.VectorBroadcast(16, I(16, 0x0400));
+    const IR::U128 one = ir.VectorBroadcast(16, I(16, 0x3C00));
+    const IR::U128 two = ir.VectorBroadcast(16, I(16, 0x4000));
+    const bool flush_to_zero = ir.current_location->FPCR().FZ16();
+
+    const IR::U128 magnitude1 = ir.VectorAnd(operand1, abs_mask);
+    const IR::U128 magnitude2 = ir.VectorAnd(operand2, abs_mask);
+    const auto is_zero = [&](const IR::U128& magnitude) {
+        return flush_to_zero ? ir.VectorGreaterSigned(16, smallest_normal, magnitude) : ir.VectorEqual(16, magnitude, ir.ZeroVector());
+    };
+    const auto is_infinity = [&](const IR::U128& magnitude) {
+        return ir.VectorEqual(16, magnitude, infinity);
+    };
+
+    const IR::U128 zero_times_infinity = ir.VectorOr(ir.VectorAnd(is_zero(magnitude1), is_infinity(magnitude2)),
+                                                     ir.VectorAnd(is_infinity(magnitude1), is_zero(magnitude2)));
+    const IR::U128 replacement1 = ir.VectorOr(ir.VectorAnd(operand1, sign_mask), two);
+    const IR::U128 replacement2 = ir.VectorOr(ir.VectorAnd(operand2, sign_mask), one);
+
+    return ir.FPVectorMul(16, VectorSelect(ir, zero_times_infinity, replacement1, operand1),
+                          VectorSelect(ir, zero_times_infinity, replacement2, operand2));
+}
+
+// Computes FCMLA on pairs of half-precision (real, imaginary) lanes. Each pair of operand1 contributes
+// one of its halves to both products, while operand2's pair is swapped and negated according to rot,
+// so that every lane becomes a single fused multiply-add.
+IR::U128 TranslatorVisitor::FPHalfComplexMulAdd(const IR::U128& addend, const IR::U128& operand1, const IR::U128& operand2, size_t rot) {
+    const IR::U128 lower_half = ir.VectorBroadcast(32, I(32, 0x0000FFFF));
+    const IR::U128 upper_half = ir.VectorBroadcast(32, I(32, 0xFFFF0000));
+    const IR::U128 negate_real = ir.VectorBroadcast(32, I(32, 0x00008000));
+    const IR::U128 negate_imaginary = ir.VectorBroadcast(32, I(32, 0x80000000));
+
+    const IR::U128 multiplicand = rot % 2 == 0
+                                ? ir.VectorOr(ir.VectorAnd(operand1, lower_half), ir.VectorLogicalShiftLeft(32, operand1, 16))
+                                : ir.VectorOr(ir.VectorAnd(operand1, upper_half), ir.VectorLogicalShiftRight(32, operand1, 16));
+    const IR::U128 multiplier = [&] {
+        switch (rot) {
+        case 0b00: // 0 degrees
+            return operand2;
+        case 0b01: // 90 degrees
+            return ir.VectorEor(ir.VectorRotateLeft(32, operand2, 16), negate_real);
+        case 0b10: // 180 degrees
+            return ir.VectorEor(operand2, ir.VectorOr(negate_real, negate_imaginary));
+        case 0b11: // 270 degrees
+            return ir.VectorEor(ir.VectorRotateLeft(32, operand2, 16), negate_imaginary);
+        }
+        UNREACHABLE();
+    }();
+
+    return ir.FPVectorMulAdd(16, addend, multiplicand, multiplier);
+}
+
 } // namespace Dynarmic::A64
@@ -58,11 +58,20 @@ struct TranslatorVisitor final {
     void Mem(IR::U64 address, size_t size, IR::AccType acctype, IR::UAnyU128 value);
     IR::UAnyU128 ExclusiveMem(IR::U64 address, size_t size, IR::AccType acctype);
     IR::U32 ExclusiveMem(IR::U64 address, size_t size, IR::AccType acctype, IR::UAnyU128 value);
+    IR::UAny AtomicMem(IR::U64 address, size_t size, IR::AccType acctype, IR::MemAtomicOp op, IR::UAny value);
+    IR::UAnyU128 CompareAndSwapMem(IR::U64 address, size_t size, IR::AccType acctype, IR::UAnyU128 expected, IR::UAnyU128 desired);
 
     IR::U32U64 SignExtend(IR::UAny value, size_t to_size);
     IR::U32U64 ZeroExtend(IR::UAny value, size_t to_size);
     IR::U32U64 ShiftReg(size_t bitsize, Reg reg, Imm<2> shift, IR::U8 amount);
     IR::U32U64 ExtendReg(size_t bitsize, Reg reg, Imm<3> option, u8 shift);
+    IR::U64 StripPointerAuthenticationCode(IR::U64 pointer);
+
+    // Half-precision vector operations without an IR opcode of their own
+    IR::U128 FPHalfMaxNumeric(const IR::U128& operand1, const IR::U128& operand2);
+    IR::U128 FPHalfMinNumeric(const IR::U128& operand1, const IR::U128& operand2);
+    IR::U128 FPHalfMulX(const IR::U128& operand1, const IR::U128& operand2);
+    IR::U128 FPHalfComplexMulAdd(const IR::U128& addend, const IR::U128& operand1, const IR::U128& operand2, size_t rot);
 
     // Data processing - Immediate - PC relative addressing
     bool ADR(Imm<2> immlo, Imm<19> immhi, Reg Rd);
@@ -133,9 +142,9 @@ struct TranslatorVisitor final {
     bool PACIB_1(bool Z, Reg Rn, Reg Rd);
     bool PACIB_2();
     bool AUTIA_1(bool Z, Reg Rn, Reg Rd);
-    bool AUTIA_2();
+    bool AUTIA_2(bool CRm_1, bool op2_0);
     bool AUTIB_1(bool Z, Reg Rn, Reg Rd);
-    bool AUTIB_2();
+    bool AUTIB_2(bool CRm_1, bool op2_0);
     bool BTI(Imm<2> upper_op2);
     bool ESB();
     bool PSB();
@@ -307,16 +316,16 @@ struct TranslatorVisitor final {
     bool LDUMINH(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
     bool SWPH(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
     bool LDAPRH(Reg Rn, Reg Rt);
-    bool LDADD(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
-    bool LDCLR(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
-    bool LDEOR(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
-    bool LDSET(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
-    bool LDSMAX(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
-    bool LDSMIN(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
-    bool LDUMAX(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
-    bool LDUMIN(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
-    bool SWP(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
-    bool LDAPR(Reg Rn, Reg Rt);
+    bool LDADD(bool sz, bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
+    bool LDCLR(bool sz, bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
+    bool LDEOR(bool sz, bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
+    bool LDSET(bool sz, bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
+    bool LDSMAX(bool sz, bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
+    bool LDSMIN(bool sz, bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
+    bool LDUMAX(bool sz, bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
+    bool LDUMIN(bool sz, bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
+    bool SWP(bool sz, bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
+    bool LDAPR(bool sz, Reg Rn, Reg Rt);
 
     // Loads and stores - Load/Store register (register offset)
     bool STRx_reg(Imm<2> size, Imm<1> opc_1, Reg Rm, Imm<3> option, bool S, Reg Rn, Reg Rt);
@@ -585,9 +594,9 @@ struct TranslatorVisitor final {
     bool FMINP_pair_2(bool sz, Vec Vn, Vec Vd);
 
     // Data Processing - FP and SIMD - SIMD Scalar three different
-    bool SQDMLAL_vec_1(Imm<2> size, Reg Rm, Reg Rn, Vec Vd);
-    bool SQDMLSL_vec_1(Imm<2> size, Reg Rm, Reg Rn, Vec Vd);
-    bool SQDMULL_vec_1(Imm<2> size, Reg Rm, Reg Rn, Vec Vd);
+    bool SQDMLAL_vec_1(Imm<2> size, Vec Vm, Vec Vn, Vec Vd);
+    bool SQDMLSL_vec_1(Imm<2> size, Vec Vm, Vec Vn, Vec Vd);
+    bool SQDMULL_vec_1(Imm<2> size, Vec Vm, Vec Vn, Vec Vd);
 
     // Data Processing - FP and SIMD - SIMD Scalar three same
     bool SQADD_1(Imm<2> size, Vec Vm, Vec Vn, Vec Vd);
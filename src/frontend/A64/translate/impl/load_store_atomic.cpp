@@ -0,0 +1,183 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include "frontend/A64/translate/impl/impl.h"
+
+namespace Dynarmic::A64 {
+
+static bool AtomicSharedDecodeAndOperation(TranslatorVisitor& v, size_t size, bool A, bool R, IR::MemAtomicOp op, Reg Rs, Reg Rn, Reg Rt) {
+    // Shared Decode
+
+    const auto ldacctype = A && Rt != Reg::ZR ? IR::AccType::ORDERED : IR::AccType::ATOMIC;
+    [[maybe_unused]] const auto stacctype = R ? IR::AccType::ORDERED : IR::AccType::ATOMIC;
+    const size_t datasize = 8 << size;
+    const size_t regsize = datasize == 64 ? 64 : 32;
+
+    // Operation
+
+    const size_t dbytes = datasize / 8;
+
+    const IR::UAny value = v.X(datasize, Rs);
+
+    IR::U64 address;
+    if (Rn == Reg::SP) {
+        // TODO: Check SP Alignment
+        address = v.SP(64);
+    } else {
+        address = v.X(64, Rn);
+    }
+
+    const IR::UAny data = v.AtomicMem(address, dbytes, ldacctype, op, value);
+    v.X(regsize, Rt, v.ZeroExtend(data, regsize));
+
+    return true;
+}
+
+bool TranslatorVisitor::LDADDB(bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicSharedDecodeAndOperation(*this, 0, A, R, IR::MemAtomicOp::ADD, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDCLRB(bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicSharedDecodeAndOperation(*this, 0, A, R, IR::MemAtomicOp::BIC, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDEORB(bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicSharedDecodeAndOperation(*this, 0, A, R, IR::MemAtomicOp::EOR, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDSETB(bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicSharedDecodeAndOperation(*this, 0, A, R, IR::MemAtomicOp::ORR, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDSMAXB(bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicSharedDecodeAndOperation(*this, 0, A, R, IR::MemAtomicOp::SMAX, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDSMINB(bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicSharedDecodeAndOperation(*this, 0, A, R, IR::MemAtomicOp::SMIN, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDUMAXB(bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicSharedDecodeAndOperation(*this, 0, A, R, IR::MemAtomicOp::UMAX, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDUMINB(bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicSharedDecodeAndOperation(*this, 0, A, R, IR::MemAtomicOp::UMIN, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::SWPB(bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicSharedDecodeAndOperation(*this, 0, A, R, IR::MemAtomicOp::SWP, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDADDH(bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicSharedDecodeAndOperation(*this, 1, A, R, IR::MemAtomicOp::ADD, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDCLRH(bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicSharedDecodeAndOperation(*this, 1, A, R, IR::MemAtomicOp::BIC, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDEORH(bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicSharedDecodeAndOperation(*this, 1, A, R, IR::MemAtomicOp::EOR, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDSETH(bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicSharedDecodeAndOperation(*this, 1, A, R, IR::MemAtomicOp::ORR, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDSMAXH(bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicSharedDecodeAndOperation(*this, 1, A, R, IR::MemAtomicOp::SMAX, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDSMINH(bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicSharedDecodeAndOperation(*this, 1, A, R, IR::MemAtomicOp::SMIN, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDUMAXH(bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicSharedDecodeAndOperation(*this, 1, A, R, IR::MemAtomicOp::UMAX, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDUMINH(bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicSharedDecodeAndOperation(*this, 1, A, R, IR::MemAtomicOp::UMIN, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::SWPH(bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicSharedDecodeAndOperation(*this, 1, A, R, IR::MemAtomicOp::SWP, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDADD(bool sz, bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicSharedDecodeAndOperation(*this, sz ? 3 : 2, A, R, IR::MemAtomicOp::ADD, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDCLR(bool sz, bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicSharedDecodeAndOperation(*this, sz ? 3 : 2, A, R, IR::MemAtomicOp::BIC, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDEOR(bool sz, bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicSharedDecodeAndOperation(*this, sz ? 3 : 2, A, R, IR::MemAtomicOp::EOR, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDSET(bool sz, bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicSharedDecodeAndOperation(*this, sz ? 3 : 2, A, R, IR::MemAtomicOp::ORR, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDSMAX(bool sz, bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicSharedDecodeAndOperation(*this, sz ? 3 : 2, A, R, IR::MemAtomicOp::SMAX, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDSMIN(bool sz, bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicSharedDecodeAndOperation(*this, sz ? 3 : 2, A, R, IR::MemAtomicOp::SMIN, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDUMAX(bool sz, bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicSharedDecodeAndOperation(*this, sz ? 3 : 2, A, R, IR::MemAtomicOp::UMAX, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDUMIN(bool sz, bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicSharedDecodeAndOperation(*this, sz ? 3 : 2, A, R, IR::MemAtomicOp::UMIN, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::SWP(bool sz, bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicSharedDecodeAndOperation(*this, sz ? 3 : 2, A, R, IR::MemAtomicOp::SWP, Rs, Rn, Rt);
+}
+
+static bool LoadAcquireRCpcSharedDecodeAndOperation(TranslatorVisitor& v, size_t size, Reg Rn, Reg Rt) {
+    // Shared Decode
+
+    const auto acctype = IR::AccType::ORDERED;
+    const size_t datasize = 8 << size;
+    const size_t regsize = datasize == 64 ? 64 : 32;
+
+    // Operation
+
+    const size_t dbytes = datasize / 8;
+
+    IR::U64 address;
+    if (Rn == Reg::SP) {
+        // TODO: Check SP Alignment
+        address = v.SP(64);
+    } else {
+        address = v.X(64, Rn);
+    }
+
+    const IR::UAny data = v.Mem(address, dbytes, acctype);
+    v.X(regsize, Rt, v.ZeroExtend(data, regsize));
+
+    return true;
+}
+
+bool TranslatorVisitor::LDAPRB(Reg Rn, Reg Rt) {
+    return LoadAcquireRCpcSharedDecodeAndOperation(*this, 0, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDAPRH(Reg Rn, Reg Rt) {
+    return LoadAcquireRCpcSharedDecodeAndOperation(*this, 1, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDAPR(bool sz, Reg Rn, Reg Rt) {
+    return LoadAcquireRCpcSharedDecodeAndOperation(*this, sz ? 3 : 2, Rn, Rt);
+}
+
+} // namespace Dynarmic::A64
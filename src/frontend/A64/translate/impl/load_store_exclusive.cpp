@@ -206,4 +206,81 @@ bool TranslatorVisitor::LDAR(Imm<2> sz, Reg Rn, Reg Rt) {
     return OrderedSharedDecodeAndOperation(*this, size, L, o0, Rn, Rt);
 }
 
+static bool CompareAndSwapSharedDecodeAndOperation(TranslatorVisitor& v, bool pair, size_t size, bool L, bool o0, Reg Rs, Reg Rn, Reg Rt) {
+    // Shared Decode
+
+    if (pair && (RegNumber(Rs) % 2 != 0 || RegNumber(Rt) % 2 != 0)) {
+        return v.UnallocatedEncoding();
+    }
+
+    const auto ldacctype = L ? IR::AccType::ORDERED : IR::AccType::ATOMIC;
+    [[maybe_unused]] const auto stacctype = o0 ? IR::AccType::ORDERED : IR::AccType::ATOMIC;
+    const size_t elsize = 8 << size;
+    const size_t regsize = elsize == 64 ? 64 : 32;
+    const size_t datasize = pair ? elsize * 2 : elsize;
+
+    // Operation
+
+    const size_t dbytes = datasize / 8;
+
+    IR::U64 address;
+    if (Rn == Reg::SP) {
+        // TODO: Check SP Alignment
+        address = v.SP(64);
+    } else {
+        address = v.X(64, Rn);
+    }
+
+    IR::UAnyU128 expected;
+    IR::UAnyU128 desired;
+    if (pair && elsize == 64) {
+        expected = v.ir.Pack2x64To1x128(v.X(64, Rs), v.X(64, Rs + 1));
+        desired = v.ir.Pack2x64To1x128(v.X(64, Rt), v.X(64, Rt + 1));
+    } else if (pair && elsize == 32) {
+        expected = v.ir.Pack2x32To1x64(v.X(32, Rs), v.X(32, Rs + 1));
+        desired = v.ir.Pack2x32To1x64(v.X(32, Rt), v.X(32, Rt + 1));
+    } else {
+        expected = v.X(elsize, Rs);
+        desired = v.X(elsize, Rt);
+    }
+
+    const IR::UAnyU128 data = v.CompareAndSwapMem(address, dbytes, ldacctype, expected, desired);
+
+    if (pair && elsize == 64) {
+        v.X(64, Rs, v.ir.VectorGetElement(64, data, 0));
+        v.X(64, Rs + 1, v.ir.VectorGetElement(64, data, 1));
+    } else if (pair && elsize == 32) {
+        v.X(32, Rs, v.ir.LeastSignificantWord(data));
+        v.X(32, Rs + 1, v.ir.MostSignificantWord(data).result);
+    } else {
+        v.X(regsize, Rs, v.ZeroExtend(data, regsize));
+    }
+
+    return true;
+}
+
+bool TranslatorVisitor::CASP(bool sz, bool L, Reg Rs, bool o0, Reg Rn, Reg Rt) {
+    const bool pair = true;
+    const size_t size = sz ? 3 : 2;
+    return CompareAndSwapSharedDecodeAndOperation(*this, pair, size, L, o0, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::CASB(bool L, Reg Rs, bool o0, Reg Rn, Reg Rt) {
+    const bool pair = false;
+    const size_t size = 0;
+    return CompareAndSwapSharedDecodeAndOperation(*this, pair, size, L, o0, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::CASH(bool L, Reg Rs, bool o0, Reg Rn, Reg Rt) {
+    const bool pair = false;
+    const size_t size = 1;
+    return CompareAndSwapSharedDecodeAndOperation(*this, pair, size, L, o0, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::CAS(bool sz, bool L, Reg Rs, bool o0, Reg Rn, Reg Rt) {
+    const bool pair = false;
+    const size_t size = sz ? 3 : 2;
+    return CompareAndSwapSharedDecodeAndOperation(*this, pair, size, L, o0, Rs, Rn, Rt);
+}
+
 } // namespace Dynarmic::A64
@@ -246,4 +246,30 @@ bool TranslatorVisitor::LDUR_fpsimd(Imm<2> size, Imm<1> opc_1, Imm<9> imm9, Reg
     return LoadStoreSIMD(*this, wback, postindex, scale, offset, IR::MemOp::LOAD, Rn, Vt);
 }
 
+bool TranslatorVisitor::LDRA(bool /*M*/, bool S, Imm<9> imm9, bool W, Reg Rn, Reg Rt) {
+    const bool wback = W;
+    const u64 offset = concatenate(Imm<1>{S}, imm9, Imm<3>{0}).SignExtend<u64>();
+
+    if (wback && Rn == Rt && Rn != Reg::R31) {
+        return UnpredictableInstruction();
+    }
+
+    // TODO: Check SP alignment
+    const IR::U64 base = Rn == Reg::SP ? IR::U64(SP(64)) : IR::U64(X(64, Rn));
+    const IR::U64 address = ir.Add(StripPointerAuthenticationCode(base), ir.Imm64(offset));
+
+    const auto data = Mem(address, 8, IR::AccType::NORMAL);
+    X(64, Rt, data);
+
+    if (wback) {
+        if (Rn == Reg::SP) {
+            SP(64, address);
+        } else {
+            X(64, Rn, address);
+        }
+    }
+
+    return true;
+}
+
 } // namespace Dynarmic::A64
@@ -102,6 +102,39 @@ bool FPMinMax(TranslatorVisitor& v, bool Q, bool sz, Vec Vn, Vec Vd, MinMaxOpera
     return true;
 }
 
+bool FPHalfMinMax(TranslatorVisitor& v, bool Q, Vec Vn, Vec Vd, MinMaxOperation operation) {
+    const size_t esize = 16;
+    const size_t datasize = Q ? 128 : 64;
+
+    const auto op = [&](const IR::U128& lhs, const IR::U128& rhs) {
+        switch (operation) {
+        case MinMaxOperation::Max:
+            return v.ir.FPVectorMax(esize, lhs, rhs);
+        case MinMaxOperation::MaxNumeric:
+            return v.FPHalfMaxNumeric(lhs, rhs);
+        case MinMaxOperation::Min:
+            return v.ir.FPVectorMin(esize, lhs, rhs);
+        case MinMaxOperation::MinNumeric:
+            return v.FPHalfMinNumeric(lhs, rhs);
+        default:
+            UNREACHABLE();
+        }
+    };
+
+    // Pairing even and odd lanes at each step matches the pseudocode's Reduce(), which combines the
+    // lower and upper halves of each sub-range in that order. Lanes past the end are zero and raise no
+    // exceptions.
+    const IR::U128 zero = v.ir.ZeroVector();
+    IR::U128 result = v.V(datasize, Vn);
+    for (size_t elements = datasize / esize; elements > 1; elements /= 2) {
+        result = op(v.ir.VectorDeinterleaveEven(esize, result, zero),
+                    v.ir.VectorDeinterleaveOdd(esize, result, zero));
+    }
+
+    v.V_scalar(esize, Vd, v.ir.VectorGetElement(esize, result, 0));
+    return true;
+}
+
 enum class ScalarMinMaxOperation {
     Max,
     Min,
@@ -196,18 +229,34 @@ bool TranslatorVisitor::ADDV(bool Q, Imm<2> size, Vec Vn, Vec Vd) {
     return true;
 }
 
+bool TranslatorVisitor::FMAXNMV_1(bool Q, Vec Vn, Vec Vd) {
+    return FPHalfMinMax(*this, Q, Vn, Vd, MinMaxOperation::MaxNumeric);
+}
+
 bool TranslatorVisitor::FMAXNMV_2(bool Q, bool sz, Vec Vn, Vec Vd) {
     return FPMinMax(*this, Q, sz, Vn, Vd, MinMaxOperation::MaxNumeric);
 }
 
+bool TranslatorVisitor::FMAXV_1(bool Q, Vec Vn, Vec Vd) {
+    return FPHalfMinMax(*this, Q, Vn, Vd, MinMaxOperation::Max);
+}
+
 bool TranslatorVisitor::FMAXV_2(bool Q, bool sz, Vec Vn, Vec Vd) {
     return FPMinMax(*this, Q, sz, Vn, Vd, MinMaxOperation::Max);
 }
 
+bool TranslatorVisitor::FMINNMV_1(bool Q, Vec Vn, Vec Vd) {
+    return FPHalfMinMax(*this, Q, Vn, Vd, MinMaxOperation::MinNumeric);
+}
+
 bool TranslatorVisitor::FMINNMV_2(bool Q, bool sz, Vec Vn, Vec Vd) {
     return FPMinMax(*this, Q, sz, Vn, Vd, MinMaxOperation::MinNumeric);
 }
 
+bool TranslatorVisitor::FMINV_1(bool Q, Vec Vn, Vec Vd) {
+    return FPHalfMinMax(*this, Q, Vn, Vd, MinMaxOperation::Min);
+}
+
 bool TranslatorVisitor::FMINV_2(bool Q, bool sz, Vec Vn, Vec Vd) {
     return FPMinMax(*this, Q, sz, Vn, Vd, MinMaxOperation::Min);
 }
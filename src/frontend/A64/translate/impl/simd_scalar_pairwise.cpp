@@ -38,6 +38,32 @@ bool FPPairwiseMinMax(TranslatorVisitor& v, bool sz, Vec Vn, Vec Vd, MinMaxOpera
     v.V(128, Vd, v.ir.ZeroExtendToQuad(result));
     return true;
 }
+
+bool FPHalfPairwiseMinMax(TranslatorVisitor& v, Vec Vn, Vec Vd, MinMaxOperation operation) {
+    const size_t esize = 16;
+
+    // Each element is computed on its own in lane 0 of a zero-extended vector.
+    const IR::U128 operand = v.V(128, Vn);
+    const IR::U128 element1 = v.ir.ZeroExtendToQuad(v.ir.VectorGetElement(esize, operand, 0));
+    const IR::U128 element2 = v.ir.ZeroExtendToQuad(v.ir.VectorGetElement(esize, operand, 1));
+    const IR::U128 result = [&] {
+        switch (operation) {
+        case MinMaxOperation::Max:
+            return v.ir.FPVectorMax(esize, element1, element2);
+        case MinMaxOperation::MaxNumeric:
+            return v.FPHalfMaxNumeric(element1, element2);
+        case MinMaxOperation::Min:
+            return v.ir.FPVectorMin(esize, element1, element2);
+        case MinMaxOperation::MinNumeric:
+            return v.FPHalfMinNumeric(element1, element2);
+        default:
+            UNREACHABLE();
+        }
+    }();
+
+    v.V(128, Vd, v.ir.ZeroExtendToQuad(v.ir.VectorGetElement(esize, result, 0)));
+    return true;
+}
 } // Anonymous namespace
 
 bool TranslatorVisitor::ADDP_pair(Imm<2> size, Vec Vn, Vec Vd) {
@@ -52,6 +78,17 @@ bool TranslatorVisitor::ADDP_pair(Imm<2> size, Vec Vn, Vec Vd) {
     return true;
 }
 
+bool TranslatorVisitor::FADDP_pair_1(Vec Vn, Vec Vd) {
+    const size_t esize = 16;
+
+    const IR::U128 operand1 = ir.ZeroExtendToQuad(ir.VectorGetElement(esize, V(128, Vn), 0));
+    const IR::U128 operand2 = ir.ZeroExtendToQuad(ir.VectorGetElement(esize, V(128, Vn), 1));
+    const IR::U128 sum = ir.FPVectorAdd(esize, operand1, operand2);
+    const IR::U128 result = ir.ZeroExtendToQuad(ir.VectorGetElement(esize, sum, 0));
+    V(128, Vd, result);
+    return true;
+}
+
 bool TranslatorVisitor::FADDP_pair_2(bool size, Vec Vn, Vec Vd) {
     const size_t esize = size ? 64 : 32;
 
@@ -62,18 +99,34 @@ bool TranslatorVisitor::FADDP_pair_2(bool size, Vec Vn, Vec Vd) {
     return true;
 }
 
+bool TranslatorVisitor::FMAXNMP_pair_1(Vec Vn, Vec Vd) {
+    return FPHalfPairwiseMinMax(*this, Vn, Vd, MinMaxOperation::MaxNumeric);
+}
+
 bool TranslatorVisitor::FMAXNMP_pair_2(bool sz, Vec Vn, Vec Vd) {
     return FPPairwiseMinMax(*this, sz, Vn, Vd, MinMaxOperation::MaxNumeric);
 }
 
+bool TranslatorVisitor::FMAXP_pair_1(Vec Vn, Vec Vd) {
+    return FPHalfPairwiseMinMax(*this, Vn, Vd, MinMaxOperation::Max);
+}
+
 bool TranslatorVisitor::FMAXP_pair_2(bool sz, Vec Vn, Vec Vd) {
     return FPPairwiseMinMax(*this, sz, Vn, Vd, MinMaxOperation::Max);
 }
 
+bool TranslatorVisitor::FMINNMP_pair_1(Vec Vn, Vec Vd) {
+    return FPHalfPairwiseMinMax(*this, Vn, Vd, MinMaxOperation::MinNumeric);
+}
+
 bool TranslatorVisitor::FMINNMP_pair_2(bool sz, Vec Vn, Vec Vd) {
     return FPPairwiseMinMax(*this, sz, Vn, Vd, MinMaxOperation::MinNumeric);
 }
 
+bool TranslatorVisitor::FMINP_pair_1(Vec Vn, Vec Vd) {
+    return FPHalfPairwiseMinMax(*this, Vn, Vd, MinMaxOperation::Min);
+}
+
 bool TranslatorVisitor::FMINP_pair_2(bool sz, Vec Vn, Vec Vd) {
     return FPPairwiseMinMax(*this, sz, Vn, Vd, MinMaxOperation::Min);
 }
@@ -0,0 +1,36 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include "frontend/A64/translate/impl/impl.h"
+
+namespace Dynarmic::A64 {
+namespace {
+bool SaturatingRoundingDoublingMultiplyAccumulate(TranslatorVisitor& v, Imm<2> size, Vec Vm, Vec Vn, Vec Vd, bool subtract) {
+    if (size == 0b00 || size == 0b11) {
+        return v.ReservedValue();
+    }
+
+    const size_t esize = 8 << size.ZeroExtend();
+
+    const IR::U128 operand1 = v.ir.ZeroExtendToQuad(v.ir.VectorGetElement(esize, v.V(128, Vn), 0));
+    const IR::U128 operand2 = v.ir.ZeroExtendToQuad(v.ir.VectorGetElement(esize, v.V(128, Vm), 0));
+    const IR::U128 operand3 = v.ir.ZeroExtendToQuad(v.ir.VectorGetElement(esize, v.V(128, Vd), 0));
+    const IR::U128 result = subtract ? v.ir.VectorSignedSaturatedRoundingDoublingMultiplySubtract(esize, operand3, operand1, operand2)
+                                     : v.ir.VectorSignedSaturatedRoundingDoublingMultiplyAccumulate(esize, operand3, operand1, operand2);
+
+    v.V_scalar(esize, Vd, v.ir.VectorGetElement(esize, result, 0));
+    return true;
+}
+} // Anonymous namespace
+
+bool TranslatorVisitor::SQRDMLAH_vec_1(Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return SaturatingRoundingDoublingMultiplyAccumulate(*this, size, Vm, Vn, Vd, false);
+}
+
+bool TranslatorVisitor::SQRDMLSH_vec_1(Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return SaturatingRoundingDoublingMultiplyAccumulate(*this, size, Vm, Vn, Vd, true);
+}
+
+} // namespace Dynarmic::A64
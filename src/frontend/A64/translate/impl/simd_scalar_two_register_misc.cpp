@@ -20,11 +20,11 @@ enum class Signedness {
     Unsigned
 };
 
-bool ScalarFPCompareAgainstZero(TranslatorVisitor& v, bool sz, Vec Vn, Vec Vd, ComparisonType type) {
-    const size_t esize = sz ? 64 : 32;
+bool ScalarFPCompareAgainstZero(TranslatorVisitor& v, size_t esize, Vec Vn, Vec Vd, ComparisonType type) {
     const size_t datasize = esize;
 
-    const IR::U128 operand = v.V(datasize, Vn);
+    // There are no 16-bit vector registers to read, so half-precision operands are zero-extended instead.
+    const IR::U128 operand = esize == 16 ? v.ir.ZeroExtendToQuad(v.V_scalar(esize, Vn)) : v.V(datasize, Vn);
     const IR::U128 zero = v.ir.ZeroVector();
     const IR::U128 result = [&] {
         switch (type) {
@@ -68,6 +68,31 @@ bool ScalarFPConvertWithRound(TranslatorVisitor& v, bool sz, Vec Vn, Vec Vd,
     return true;
 }
 
+bool ScalarFPHalfConvertWithRound(TranslatorVisitor& v, Vec Vn, Vec Vd, FP::RoundingMode rmode, Signedness sign) {
+    const size_t esize = 16;
+
+    const IR::U128 operand = v.ir.ZeroExtendToQuad(v.V_scalar(esize, Vn));
+    const IR::U128 result = sign == Signedness::Signed
+                          ? v.ir.FPVectorToSignedFixed(esize, operand, 0, rmode)
+                          : v.ir.FPVectorToUnsignedFixed(esize, operand, 0, rmode);
+
+    v.V_scalar(esize, Vd, v.ir.VectorGetElement(esize, result, 0));
+    return true;
+}
+
+bool ScalarIntegerConvertToHalf(TranslatorVisitor& v, Vec Vn, Vec Vd, Signedness sign) {
+    const size_t esize = 16;
+    const FP::RoundingMode rounding_mode = v.ir.current_location->FPCR().RMode();
+
+    const IR::U128 operand = v.ir.ZeroExtendToQuad(v.V_scalar(esize, Vn));
+    const IR::U128 result = sign == Signedness::Signed
+                          ? v.ir.FPVectorFromSignedFixed(esize, operand, 0, rounding_mode)
+                          : v.ir.FPVectorFromUnsignedFixed(esize, operand, 0, rounding_mode);
+
+    v.V_scalar(esize, Vd, v.ir.VectorGetElement(esize, result, 0));
+    return true;
+}
+
 using NarrowingFn = IR::U128 (IR::IREmitter::*)(size_t, const IR::U128&);
 
 bool SaturatedNarrow(TranslatorVisitor& v, Imm<2> size, Vec Vn, Vec Vd, NarrowingFn fn) {
@@ -99,62 +124,105 @@ bool TranslatorVisitor::ABS_1(Imm<2> size, Vec Vn, Vec Vd) {
 }
 
 bool TranslatorVisitor::FCMEQ_zero_1(Vec Vn, Vec Vd) {
-    const IR::U128 operand = ir.ZeroExtendToQuad(V_scalar(16, Vn));
-    const IR::U128 zero = ir.ZeroVector();
-    const IR::U128 result = ir.FPVectorEqual(16, operand, zero);
-
-    V_scalar(16, Vd, ir.VectorGetElement(16, result, 0));
-    return true;
+    return ScalarFPCompareAgainstZero(*this, 16, Vn, Vd, ComparisonType::EQ);
 }
 
 bool TranslatorVisitor::FCMEQ_zero_2(bool sz, Vec Vn, Vec Vd) {
-    return ScalarFPCompareAgainstZero(*this, sz, Vn, Vd, ComparisonType::EQ);
+    return ScalarFPCompareAgainstZero(*this, sz ? 64 : 32, Vn, Vd, ComparisonType::EQ);
+}
+
+bool TranslatorVisitor::FCMGE_zero_1(Vec Vn, Vec Vd) {
+    return ScalarFPCompareAgainstZero(*this, 16, Vn, Vd, ComparisonType::GE);
 }
 
 bool TranslatorVisitor::FCMGE_zero_2(bool sz, Vec Vn, Vec Vd) {
-    return ScalarFPCompareAgainstZero(*this, sz, Vn, Vd, ComparisonType::GE);
+    return ScalarFPCompareAgainstZero(*this, sz ? 64 : 32, Vn, Vd, ComparisonType::GE);
+}
+
+bool TranslatorVisitor::FCMGT_zero_1(Vec Vn, Vec Vd) {
+    return ScalarFPCompareAgainstZero(*this, 16, Vn, Vd, ComparisonType::GT);
 }
 
 bool TranslatorVisitor::FCMGT_zero_2(bool sz, Vec Vn, Vec Vd) {
-    return ScalarFPCompareAgainstZero(*this, sz, Vn, Vd, ComparisonType::GT);
+    return ScalarFPCompareAgainstZero(*this, sz ? 64 : 32, Vn, Vd, ComparisonType::GT);
+}
+
+bool TranslatorVisitor::FCMLE_1(Vec Vn, Vec Vd) {
+    return ScalarFPCompareAgainstZero(*this, 16, Vn, Vd, ComparisonType::LE);
 }
 
 bool TranslatorVisitor::FCMLE_2(bool sz, Vec Vn, Vec Vd) {
-    return ScalarFPCompareAgainstZero(*this, sz, Vn, Vd, ComparisonType::LE);
+    return ScalarFPCompareAgainstZero(*this, sz ? 64 : 32, Vn, Vd, ComparisonType::LE);
+}
+
+bool TranslatorVisitor::FCMLT_1(Vec Vn, Vec Vd) {
+    return ScalarFPCompareAgainstZero(*this, 16, Vn, Vd, ComparisonType::LT);
 }
 
 bool TranslatorVisitor::FCMLT_2(bool sz, Vec Vn, Vec Vd) {
-    return ScalarFPCompareAgainstZero(*this, sz, Vn, Vd, ComparisonType::LT);
+    return ScalarFPCompareAgainstZero(*this, sz ? 64 : 32, Vn, Vd, ComparisonType::LT);
+}
+
+bool TranslatorVisitor::FCVTAS_1(Vec Vn, Vec Vd) {
+    return ScalarFPHalfConvertWithRound(*this, Vn, Vd, FP::RoundingMode::ToNearest_TieAwayFromZero, Signedness::Signed);
 }
 
 bool TranslatorVisitor::FCVTAS_2(bool sz, Vec Vn, Vec Vd) {
     return ScalarFPConvertWithRound(*this, sz, Vn, Vd, FP::RoundingMode::ToNearest_TieAwayFromZero, Signedness::Signed);
 }
 
+bool TranslatorVisitor::FCVTAU_1(Vec Vn, Vec Vd) {
+    return ScalarFPHalfConvertWithRound(*this, Vn, Vd, FP::RoundingMode::ToNearest_TieAwayFromZero, Signedness::Unsigned);
+}
+
 bool TranslatorVisitor::FCVTAU_2(bool sz, Vec Vn, Vec Vd) {
     return ScalarFPConvertWithRound(*this, sz, Vn, Vd, FP::RoundingMode::ToNearest_TieAwayFromZero, Signedness::Unsigned);
 }
 
+bool TranslatorVisitor::FCVTMS_1(Vec Vn, Vec Vd) {
+    return ScalarFPHalfConvertWithRound(*this, Vn, Vd, FP::RoundingMode::TowardsMinusInfinity, Signedness::Signed);
+}
+
 bool TranslatorVisitor::FCVTMS_2(bool sz, Vec Vn, Vec Vd) {
     return ScalarFPConvertWithRound(*this, sz, Vn, Vd, FP::RoundingMode::TowardsMinusInfinity, Signedness::Signed);
 }
 
+bool TranslatorVisitor::FCVTMU_1(Vec Vn, Vec Vd) {
+    return ScalarFPHalfConvertWithRound(*this, Vn, Vd, FP::RoundingMode::TowardsMinusInfinity, Signedness::Unsigned);
+}
+
 bool TranslatorVisitor::FCVTMU_2(bool sz, Vec Vn, Vec Vd) {
     return ScalarFPConvertWithRound(*this, sz, Vn, Vd, FP::RoundingMode::TowardsMinusInfinity, Signedness::Unsigned);
 }
 
+bool TranslatorVisitor::FCVTNS_1(Vec Vn, Vec Vd) {
+    return ScalarFPHalfConvertWithRound(*this, Vn, Vd, FP::RoundingMode::ToNearest_TieEven, Signedness::Signed);
+}
+
 bool TranslatorVisitor::FCVTNS_2(bool sz, Vec Vn, Vec Vd) {
     return ScalarFPConvertWithRound(*this, sz, Vn, Vd, FP::RoundingMode::ToNearest_TieEven, Signedness::Signed);
 }
 
+bool TranslatorVisitor::FCVTNU_1(Vec Vn, Vec Vd) {
+    return ScalarFPHalfConvertWithRound(*this, Vn, Vd, FP::RoundingMode::ToNearest_TieEven, Signedness::Unsigned);
+}
+
 bool TranslatorVisitor::FCVTNU_2(bool sz, Vec Vn, Vec Vd) {
     return ScalarFPConvertWithRound(*this, sz, Vn, Vd, FP::RoundingMode::ToNearest_TieEven, Signedness::Unsigned);
 }
 
+bool TranslatorVisitor::FCVTPS_1(Vec Vn, Vec Vd) {
+    return ScalarFPHalfConvertWithRound(*this, Vn, Vd, FP::RoundingMode::TowardsPlusInfinity, Signedness::Signed);
+}
+
 bool TranslatorVisitor::FCVTPS_2(bool sz, Vec Vn, Vec Vd) {
     return ScalarFPConvertWithRound(*this, sz, Vn, Vd, FP::RoundingMode::TowardsPlusInfinity, Signedness::Signed);
 }
 
+bool TranslatorVisitor::FCVTPU_1(Vec Vn, Vec Vd) {
+    return ScalarFPHalfConvertWithRound(*this, Vn, Vd, FP::RoundingMode::TowardsPlusInfinity, Signedness::Unsigned);
+}
+
 bool TranslatorVisitor::FCVTPU_2(bool sz, Vec Vn, Vec Vd) {
     return ScalarFPConvertWithRound(*this, sz, Vn, Vd, FP::RoundingMode::TowardsPlusInfinity, Signedness::Unsigned);
 }
@@ -171,10 +239,18 @@ bool TranslatorVisitor::FCVTXN_1(bool sz, Vec Vn, Vec Vd) {
     return true;
 }
 
+bool TranslatorVisitor::FCVTZS_int_1(Vec Vn, Vec Vd) {
+    return ScalarFPHalfConvertWithRound(*this, Vn, Vd, FP::RoundingMode::TowardsZero, Signedness::Signed);
+}
+
 bool TranslatorVisitor::FCVTZS_int_2(bool sz, Vec Vn, Vec Vd) {
     return ScalarFPConvertWithRound(*this, sz, Vn, Vd, FP::RoundingMode::TowardsZero, Signedness::Signed);
 }
 
+bool TranslatorVisitor::FCVTZU_int_1(Vec Vn, Vec Vd) {
+    return ScalarFPHalfConvertWithRound(*this, Vn, Vd, FP::RoundingMode::TowardsZero, Signedness::Unsigned);
+}
+
 bool TranslatorVisitor::FCVTZU_int_2(bool sz, Vec Vn, Vec Vd) {
     return ScalarFPConvertWithRound(*this, sz, Vn, Vd, FP::RoundingMode::TowardsZero, Signedness::Unsigned);
 }
@@ -249,6 +325,10 @@ bool TranslatorVisitor::NEG_1(Imm<2> size, Vec Vn, Vec Vd) {
     return true;
 }
 
+bool TranslatorVisitor::SCVTF_int_1(Vec Vn, Vec Vd) {
+    return ScalarIntegerConvertToHalf(*this, Vn, Vd, Signedness::Signed);
+}
+
 bool TranslatorVisitor::SCVTF_int_2(bool sz, Vec Vn, Vec Vd) {
     const auto esize = sz ? 64 : 32;
 
@@ -301,6 +381,10 @@ bool TranslatorVisitor::SUQADD_1(Imm<2> size, Vec Vn, Vec Vd) {
     return true;
 }
 
+bool TranslatorVisitor::UCVTF_int_1(Vec Vn, Vec Vd) {
+    return ScalarIntegerConvertToHalf(*this, Vn, Vd, Signedness::Unsigned);
+}
+
 bool TranslatorVisitor::UCVTF_int_2(bool sz, Vec Vn, Vec Vd) {
     const auto esize = sz ? 64 : 32;
 
@@ -69,15 +69,14 @@ bool MultiplyByElementHalfPrecision(TranslatorVisitor& v, Imm<1> L, Imm<1> M, Im
     const IR::U16 result = [&]() -> IR::U16 {
         IR::U16 operand1 = v.V_scalar(esize, Vn);
 
-        // TODO: Currently we don't implement half-precision paths
-        //       for regular multiplication and extended multiplication.
-
-        if (extra_behavior == ExtraBehavior::None) {
-            ASSERT_FALSE("half-precision option unimplemented");
-        }
-
-        if (extra_behavior == ExtraBehavior::MultiplyExtended) {
-            ASSERT_FALSE("half-precision option unimplemented");
+        // Plain and extended multiplies only exist as vector operations for half-precision.
+        if (extra_behavior == ExtraBehavior::None || extra_behavior == ExtraBehavior::MultiplyExtended) {
+            const IR::U128 vector1 = v.ir.ZeroExtendToQuad(operand1);
+            const IR::U128 vector2 = v.ir.ZeroExtendToQuad(element);
+            const IR::U128 product = extra_behavior == ExtraBehavior::None
+                                   ? v.ir.FPVectorMul(esize, vector1, vector2)
+                                   : v.FPHalfMulX(vector1, vector2);
+            return v.ir.VectorGetElement(esize, product, 0);
         }
 
         if (extra_behavior == ExtraBehavior::Subtract) {
@@ -91,6 +90,57 @@ bool MultiplyByElementHalfPrecision(TranslatorVisitor& v, Imm<1> L, Imm<1> M, Im
     v.V_scalar(esize, Vd, result);
     return true;
 }
+bool SaturatingDoublingMultiplyLong(TranslatorVisitor& v, Imm<2> size, Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm<1> H,
+                                    Vec Vn, Vec Vd, ExtraBehavior extra_behavior) {
+    if (size == 0b00 || size == 0b11) {
+        return v.ReservedValue();
+    }
+
+    const size_t esize = 8 << size.ZeroExtend();
+    const auto [index, Vm] = Combine(size, H, L, M, Vmlo);
+
+    const IR::U128 operand1 = v.ir.ZeroExtendToQuad(v.ir.VectorGetElement(esize, v.V(128, Vn), 0));
+    const IR::UAny operand2 = v.ir.VectorGetElement(esize, v.V(128, Vm), index);
+    const IR::U128 broadcast = v.ir.VectorBroadcast(esize, operand2);
+    const IR::U128 product = v.ir.VectorSignedSaturatedDoublingMultiplyLong(esize, operand1, broadcast);
+
+    const IR::U128 result = [&] {
+        if (extra_behavior == ExtraBehavior::None) {
+            return product;
+        }
+
+        const IR::U128 operand3 = v.ir.ZeroExtendToQuad(v.ir.VectorGetElement(2 * esize, v.V(128, Vd), 0));
+        if (extra_behavior == ExtraBehavior::Accumulate) {
+            return v.ir.VectorSignedSaturatedAdd(2 * esize, operand3, product);
+        }
+
+        return v.ir.VectorSignedSaturatedSub(2 * esize, operand3, product);
+    }();
+
+    v.V(128, Vd, result);
+    return true;
+}
+
+bool SaturatingRoundingDoublingMultiplyAccumulate(TranslatorVisitor& v, Imm<2> size, Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm<1> H,
+                                                  Vec Vn, Vec Vd, ExtraBehavior extra_behavior) {
+    if (size == 0b00 || size == 0b11) {
+        return v.ReservedValue();
+    }
+
+    const size_t esize = 8 << size.ZeroExtend();
+    const auto [index, Vm] = Combine(size, H, L, M, Vmlo);
+
+    const IR::U128 operand1 = v.ir.ZeroExtendToQuad(v.ir.VectorGetElement(esize, v.V(128, Vn), 0));
+    const IR::UAny operand2 = v.ir.VectorGetElement(esize, v.V(128, Vm), index);
+    const IR::U128 operand3 = v.ir.ZeroExtendToQuad(v.ir.VectorGetElement(esize, v.V(128, Vd), 0));
+    const IR::U128 broadcast = v.ir.VectorBroadcast(esize, operand2);
+    const IR::U128 result = extra_behavior == ExtraBehavior::Accumulate
+                                ? v.ir.VectorSignedSaturatedRoundingDoublingMultiplyAccumulate(esize, operand3, operand1, broadcast)
+                                : v.ir.VectorSignedSaturatedRoundingDoublingMultiplySubtract(esize, operand3, operand1, broadcast);
+
+    v.V(128, Vd, result);
+    return true;
+}
 } // Anonymous namespace
 
 bool TranslatorVisitor::FMLA_elt_1(Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm<1> H, Vec Vn, Vec Vd) {
@@ -109,10 +159,18 @@ bool TranslatorVisitor::FMLS_elt_2(bool sz, Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm
     return MultiplyByElement(*this, sz, L, M, Vmlo, H, Vn, Vd, ExtraBehavior::Subtract);
 }
 
+bool TranslatorVisitor::FMUL_elt_1(Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm<1> H, Vec Vn, Vec Vd) {
+    return MultiplyByElementHalfPrecision(*this, L, M, Vmlo, H, Vn, Vd, ExtraBehavior::None);
+}
+
 bool TranslatorVisitor::FMUL_elt_2(bool sz, Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm<1> H, Vec Vn, Vec Vd) {
     return MultiplyByElement(*this, sz, L, M, Vmlo, H, Vn, Vd, ExtraBehavior::None);
 }
 
+bool TranslatorVisitor::FMULX_elt_1(Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm<1> H, Vec Vn, Vec Vd) {
+    return MultiplyByElementHalfPrecision(*this, L, M, Vmlo, H, Vn, Vd, ExtraBehavior::MultiplyExtended);
+}
+
 bool TranslatorVisitor::FMULX_elt_2(bool sz, Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm<1> H, Vec Vn, Vec Vd) {
     return MultiplyByElement(*this, sz, L, M, Vmlo, H, Vn, Vd, ExtraBehavior::MultiplyExtended);
 }
@@ -153,21 +211,24 @@ bool TranslatorVisitor::SQRDMULH_elt_1(Imm<2> size, Imm<1> L, Imm<1> M, Imm<4> V
     return true;
 }
 
-bool TranslatorVisitor::SQDMULL_elt_1(Imm<2> size, Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm<1> H, Vec Vn, Vec Vd) {
-    if (size == 0b00 || size == 0b11) {
-        return ReservedValue();
-    }
+bool TranslatorVisitor::SQDMLAL_elt_1(Imm<2> size, Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm<1> H, Vec Vn, Vec Vd) {
+    return SaturatingDoublingMultiplyLong(*this, size, L, M, Vmlo, H, Vn, Vd, ExtraBehavior::Accumulate);
+}
 
-    const size_t esize = 8 << size.ZeroExtend();
-    const auto [index, Vm] = Combine(size, H, L, M, Vmlo);
+bool TranslatorVisitor::SQDMLSL_elt_1(Imm<2> size, Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm<1> H, Vec Vn, Vec Vd) {
+    return SaturatingDoublingMultiplyLong(*this, size, L, M, Vmlo, H, Vn, Vd, ExtraBehavior::Subtract);
+}
 
-    const IR::U128 operand1 = ir.ZeroExtendToQuad(ir.VectorGetElement(esize, V(128, Vn), 0));
-    const IR::UAny operand2 = ir.VectorGetElement(esize, V(128, Vm), index);
-    const IR::U128 broadcast = ir.VectorBroadcast(esize, operand2);
-    const IR::U128 result = ir.VectorSignedSaturatedDoublingMultiplyLong(esize, operand1, broadcast);
+bool TranslatorVisitor::SQDMULL_elt_1(Imm<2> size, Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm<1> H, Vec Vn, Vec Vd) {
+    return SaturatingDoublingMultiplyLong(*this, size, L, M, Vmlo, H, Vn, Vd, ExtraBehavior::None);
+}
 
-    V(128, Vd, result);
-    return true;
+bool TranslatorVisitor::SQRDMLAH_elt_1(Imm<2> size, Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm<1> H, Vec Vn, Vec Vd) {
+    return SaturatingRoundingDoublingMultiplyAccumulate(*this, size, L, M, Vmlo, H, Vn, Vd, ExtraBehavior::Accumulate);
+}
+
+bool TranslatorVisitor::SQRDMLSH_elt_1(Imm<2> size, Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm<1> H, Vec Vn, Vec Vd) {
+    return SaturatingRoundingDoublingMultiplyAccumulate(*this, size, L, M, Vmlo, H, Vn, Vd, ExtraBehavior::Subtract);
 }
 
 } // namespace Dynarmic::A64
@@ -158,6 +158,29 @@ bool WideOperation(TranslatorVisitor& v, bool Q, Imm<2> size, Vec Vm, Vec Vn, Ve
     v.V(128, Vd, result);
     return true;
 }
+bool SaturatingDoublingMultiplyLong(TranslatorVisitor& v, bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd,
+                                    MultiplyLongBehavior behavior) {
+    if (size == 0b00 || size == 0b11) {
+        return v.ReservedValue();
+    }
+
+    const size_t esize = 8 << size.ZeroExtend();
+    const size_t part = Q ? 1 : 0;
+
+    const IR::U128 operand1 = v.Vpart(64, Vn, part);
+    const IR::U128 operand2 = v.Vpart(64, Vm, part);
+    IR::U128 result = v.ir.VectorSignedSaturatedDoublingMultiplyLong(esize, operand1, operand2);
+
+    if (behavior == MultiplyLongBehavior::Accumulate) {
+        result = v.ir.VectorSignedSaturatedAdd(2 * esize, v.V(128, Vd), result);
+    } else if (behavior == MultiplyLongBehavior::Subtract) {
+        result = v.ir.VectorSignedSaturatedSub(2 * esize, v.V(128, Vd), result);
+    }
+
+    v.V(128, Vd, result);
+    return true;
+}
+
 } // Anonymous namespace
 
 bool TranslatorVisitor::PMULL(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
@@ -248,20 +271,16 @@ bool TranslatorVisitor::USUBL(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
     return LongOperation(*this, Q, size, Vm, Vn, Vd, LongOperationBehavior::Subtraction, Signedness::Unsigned);
 }
 
-bool TranslatorVisitor::SQDMULL_vec_2(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
-    if (size == 0b00 || size == 0b11) {
-        return ReservedValue();
-    }
-
-    const size_t esize = 8 << size.ZeroExtend();
-    const size_t part = Q ? 1 : 0;
+bool TranslatorVisitor::SQDMLAL_vec_2(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return SaturatingDoublingMultiplyLong(*this, Q, size, Vm, Vn, Vd, MultiplyLongBehavior::Accumulate);
+}
 
-    const IR::U128 operand1 = Vpart(64, Vn, part);
-    const IR::U128 operand2 = Vpart(64, Vm, part);
-    const IR::U128 result = ir.VectorSignedSaturatedDoublingMultiplyLong(esize, operand1, operand2);
+bool TranslatorVisitor::SQDMLSL_vec_2(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return SaturatingDoublingMultiplyLong(*this, Q, size, Vm, Vn, Vd, MultiplyLongBehavior::Subtract);
+}
 
-    V(128, Vd, result);
-    return true;
+bool TranslatorVisitor::SQDMULL_vec_2(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return SaturatingDoublingMultiplyLong(*this, Q, size, Vm, Vn, Vd, MultiplyLongBehavior::None);
 }
 
 } // namespace Dynarmic::A64
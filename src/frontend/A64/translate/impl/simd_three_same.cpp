@@ -131,6 +131,27 @@ enum class ComparisonType {
     AbsoluteGT
 };
 
+IR::U128 FPCompare(TranslatorVisitor& v, size_t esize, const IR::U128& operand1, const IR::U128& operand2, ComparisonType type) {
+    switch (type) {
+    case ComparisonType::EQ:
+        return v.ir.FPVectorEqual(esize, operand1, operand2);
+    case ComparisonType::GE:
+        return v.ir.FPVectorGreaterEqual(esize, operand1, operand2);
+    case ComparisonType::AbsoluteGE:
+        return v.ir.FPVectorGreaterEqual(esize,
+                                         v.ir.FPVectorAbs(esize, operand1),
+                                         v.ir.FPVectorAbs(esize, operand2));
+    case ComparisonType::GT:
+        return v.ir.FPVectorGreater(esize, operand1, operand2);
+    case ComparisonType::AbsoluteGT:
+        return v.ir.FPVectorGreater(esize,
+                                    v.ir.FPVectorAbs(esize, operand1),
+                                    v.ir.FPVectorAbs(esize, operand2));
+    }
+
+    UNREACHABLE();
+}
+
 bool FPCompareRegister(TranslatorVisitor& v, bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd, ComparisonType type) {
     if (sz && !Q) {
         return v.ReservedValue();
@@ -141,26 +162,18 @@ bool FPCompareRegister(TranslatorVisitor& v, bool Q, bool sz, Vec Vm, Vec Vn, Ve
 
     const IR::U128 operand1 = v.V(datasize, Vn);
     const IR::U128 operand2 = v.V(datasize, Vm);
-    const IR::U128 result = [&] {
-        switch (type) {
-        case ComparisonType::EQ:
-            return v.ir.FPVectorEqual(esize, operand1, operand2);
-        case ComparisonType::GE:
-            return v.ir.FPVectorGreaterEqual(esize, operand1, operand2);
-        case ComparisonType::AbsoluteGE:
-            return v.ir.FPVectorGreaterEqual(esize,
-                                             v.ir.FPVectorAbs(esize, operand1),
-                                             v.ir.FPVectorAbs(esize, operand2));
-        case ComparisonType::GT:
-            return v.ir.FPVectorGreater(esize, operand1, operand2);
-        case ComparisonType::AbsoluteGT:
-            return v.ir.FPVectorGreater(esize,
-                                        v.ir.FPVectorAbs(esize, operand1),
-                                        v.ir.FPVectorAbs(esize, operand2));
-        }
+    const IR::U128 result = FPCompare(v, esize, operand1, operand2, type);
 
-        UNREACHABLE();
-    }();
+    v.V(datasize, Vd, result);
+    return true;
+}
+
+bool FPCompareRegisterHalfPrecision(TranslatorVisitor& v, bool Q, Vec Vm, Vec Vn, Vec Vd, ComparisonType type) {
+    const size_t datasize = Q ? 128 : 64;
+
+    const IR::U128 operand1 = v.V(datasize, Vn);
+    const IR::U128 operand2 = v.V(datasize, Vm);
+    const IR::U128 result = FPCompare(v, 16, operand1, operand2, type);
 
     v.V(datasize, Vd, result);
     return true;
@@ -323,6 +336,55 @@ bool FPPairedMinMax(TranslatorVisitor& v, bool Q, bool sz, Vec Vm, Vec Vn, Vec V
     return true;
 }
 
+template<typename Function>
+bool FPHalfPairedOperation(TranslatorVisitor& v, bool Q, Vec Vm, Vec Vn, Vec Vd, Function fn) {
+    const size_t datasize = Q ? 128 : 64;
+
+    const IR::U128 operand1 = v.V(datasize, Vn);
+    const IR::U128 operand2 = v.V(datasize, Vm);
+    const IR::U128 even = Q ? v.ir.VectorDeinterleaveEven(16, operand1, operand2)
+                            : v.ir.VectorDeinterleaveEvenLower(16, operand1, operand2);
+    const IR::U128 odd = Q ? v.ir.VectorDeinterleaveOdd(16, operand1, operand2)
+                           : v.ir.VectorDeinterleaveOddLower(16, operand1, operand2);
+    const IR::U128 result = fn(even, odd);
+
+    v.V(datasize, Vd, result);
+    return true;
+}
+
+enum class MultiplyLongBehavior {
+    Accumulate,
+    Subtract,
+};
+
+bool FPMultiplyAddLong(TranslatorVisitor& v, bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd, size_t part, MultiplyLongBehavior behavior) {
+    if (sz) {
+        return v.UnallocatedEncoding();
+    }
+
+    const size_t datasize = Q ? 128 : 64;
+    const size_t esize = 32;
+
+    // Only the lower datasize / 2 bits of the selected part are widened.
+    const auto get_part = [&](Vec vec) {
+        if (Q) {
+            return v.Vpart(64, vec, part);
+        }
+        return v.ir.ZeroExtendToQuad(v.ir.VectorGetElement(32, v.ir.GetQ(vec), part));
+    };
+
+    IR::U128 operand1 = get_part(Vn);
+    if (behavior == MultiplyLongBehavior::Subtract) {
+        operand1 = v.ir.FPVectorNeg(16, operand1);
+    }
+    const IR::U128 operand2 = get_part(Vm);
+    const IR::U128 operand3 = v.V(datasize, Vd);
+    const IR::U128 result = v.ir.FPVectorMulAddLong(esize, operand3, operand1, operand2);
+
+    v.V(datasize, Vd, result);
+    return true;
+}
+
 bool SaturatingArithmeticOperation(TranslatorVisitor& v, bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd,
                                    Operation op, Signedness sign) {
     if (size == 0b11 && !Q) {
@@ -377,6 +439,28 @@ bool SaturatingShiftLeft(TranslatorVisitor& v, bool Q, Imm<2> size, Vec Vm, Vec
     return true;
 }
 
+bool SaturatingRoundingShiftLeft(TranslatorVisitor& v, bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd, Signedness sign) {
+    if (size == 0b11 && !Q) {
+        return v.ReservedValue();
+    }
+
+    const size_t esize = 8 << size.ZeroExtend();
+    const size_t datasize = Q ? 128 : 64;
+
+    const IR::U128 operand1 = v.V(datasize, Vn);
+    const IR::U128 operand2 = v.V(datasize, Vm);
+    const IR::U128 result = [&] {
+        if (sign == Signedness::Signed) {
+            return v.ir.VectorSignedSaturatedRoundingShiftLeft(esize, operand1, operand2);
+        }
+
+        return v.ir.VectorUnsignedSaturatedRoundingShiftLeft(esize, operand1, operand2);
+    }();
+
+    v.V(datasize, Vd, result);
+    return true;
+}
+
 } // Anonymous namespace
 
 bool TranslatorVisitor::CMGT_reg_2(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
@@ -639,6 +723,18 @@ bool TranslatorVisitor::ADDP_vec(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
     return true;
 }
 
+bool TranslatorVisitor::FABD_3(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    const size_t datasize = Q ? 128 : 64;
+    const size_t esize = 16;
+
+    const IR::U128 operand1 = V(datasize, Vn);
+    const IR::U128 operand2 = V(datasize, Vm);
+    const IR::U128 result = ir.FPVectorAbs(esize, ir.FPVectorSub(esize, operand1, operand2));
+
+    V(datasize, Vd, result);
+    return true;
+}
+
 bool TranslatorVisitor::FABD_4(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
     if (sz && !Q) {
         return ReservedValue();
@@ -655,14 +751,34 @@ bool TranslatorVisitor::FABD_4(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
     return true;
 }
 
+bool TranslatorVisitor::FACGE_3(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    return FPCompareRegisterHalfPrecision(*this, Q, Vm, Vn, Vd, ComparisonType::AbsoluteGE);
+}
+
 bool TranslatorVisitor::FACGE_4(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
     return FPCompareRegister(*this, Q, sz, Vm, Vn, Vd, ComparisonType::AbsoluteGE);
 }
 
+bool TranslatorVisitor::FACGT_3(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    return FPCompareRegisterHalfPrecision(*this, Q, Vm, Vn, Vd, ComparisonType::AbsoluteGT);
+}
+
 bool TranslatorVisitor::FACGT_4(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
     return FPCompareRegister(*this, Q, sz, Vm, Vn, Vd, ComparisonType::AbsoluteGT);
 }
 
+bool TranslatorVisitor::FADD_1(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    const size_t datasize = Q ? 128 : 64;
+    const size_t esize = 16;
+
+    const IR::U128 operand1 = V(datasize, Vn);
+    const IR::U128 operand2 = V(datasize, Vm);
+    const IR::U128 result = ir.FPVectorAdd(esize, operand1, operand2);
+
+    V(datasize, Vd, result);
+    return true;
+}
+
 bool TranslatorVisitor::FADD_2(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
     if (sz && !Q) {
         return ReservedValue();
@@ -739,6 +855,22 @@ bool TranslatorVisitor::FMLS_vec_2(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
     return true;
 }
 
+bool TranslatorVisitor::FMLAL_vec_1(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
+    return FPMultiplyAddLong(*this, Q, sz, Vm, Vn, Vd, 0, MultiplyLongBehavior::Accumulate);
+}
+
+bool TranslatorVisitor::FMLAL_vec_2(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
+    return FPMultiplyAddLong(*this, Q, sz, Vm, Vn, Vd, 1, MultiplyLongBehavior::Accumulate);
+}
+
+bool TranslatorVisitor::FMLSL_vec_1(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
+    return FPMultiplyAddLong(*this, Q, sz, Vm, Vn, Vd, 0, MultiplyLongBehavior::Subtract);
+}
+
+bool TranslatorVisitor::FMLSL_vec_2(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
+    return FPMultiplyAddLong(*this, Q, sz, Vm, Vn, Vd, 1, MultiplyLongBehavior::Subtract);
+}
+
 bool TranslatorVisitor::FCMEQ_reg_3(bool Q, Vec Vm, Vec Vn, Vec Vd) {
     const size_t datasize = Q ? 128 : 64;
 
@@ -750,6 +882,14 @@ bool TranslatorVisitor::FCMEQ_reg_3(bool Q, Vec Vm, Vec Vn, Vec Vd) {
     return true;
 }
 
+bool TranslatorVisitor::FCMGE_reg_3(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    return FPCompareRegisterHalfPrecision(*this, Q, Vm, Vn, Vd, ComparisonType::GE);
+}
+
+bool TranslatorVisitor::FCMGT_reg_3(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    return FPCompareRegisterHalfPrecision(*this, Q, Vm, Vn, Vd, ComparisonType::GT);
+}
+
 bool TranslatorVisitor::FCMEQ_reg_4(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
     return FPCompareRegister(*this, Q, sz, Vm, Vn, Vd, ComparisonType::EQ);
 }
@@ -840,6 +980,10 @@ bool TranslatorVisitor::CMTST_2(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
     return true;
 }
 
+bool TranslatorVisitor::SQRSHL_2(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return SaturatingRoundingShiftLeft(*this, Q, size, Vm, Vn, Vd, Signedness::Signed);
+}
+
 bool TranslatorVisitor::SQSHL_reg_2(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
     return SaturatingShiftLeft(*this, Q, size, Vm, Vn, Vd, Signedness::Signed);
 }
@@ -864,6 +1008,10 @@ bool TranslatorVisitor::SSHL_2(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
     return true;
 }
 
+bool TranslatorVisitor::UQRSHL_2(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return SaturatingRoundingShiftLeft(*this, Q, size, Vm, Vn, Vd, Signedness::Unsigned);
+}
+
 bool TranslatorVisitor::UQSHL_reg_2(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
     return SaturatingShiftLeft(*this, Q, size, Vm, Vn, Vd, Signedness::Unsigned);
 }
@@ -939,6 +1087,18 @@ bool TranslatorVisitor::UMINP(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
     return PairedMinMaxOperation(*this, Q, size, Vm, Vn, Vd, MinMaxOperation::Min, Signedness::Unsigned);
 }
 
+bool TranslatorVisitor::FSUB_1(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    const size_t datasize = Q ? 128 : 64;
+    const size_t esize = 16;
+
+    const IR::U128 operand1 = V(datasize, Vn);
+    const IR::U128 operand2 = V(datasize, Vm);
+    const IR::U128 result = ir.FPVectorSub(esize, operand1, operand2);
+
+    V(datasize, Vd, result);
+    return true;
+}
+
 bool TranslatorVisitor::FSUB_2(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
     if (sz && !Q) {
         return ReservedValue();
@@ -1117,38 +1277,112 @@ bool TranslatorVisitor::EOR_asimd(bool Q, Vec Vm, Vec Vn, Vec Vd) {
     return true;
 }
 
+bool TranslatorVisitor::FMAX_1(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    const size_t datasize = Q ? 128 : 64;
+
+    const IR::U128 operand1 = V(datasize, Vn);
+    const IR::U128 operand2 = V(datasize, Vm);
+    const IR::U128 result = ir.FPVectorMax(16, operand1, operand2);
+
+    V(datasize, Vd, result);
+    return true;
+}
+
 bool TranslatorVisitor::FMAX_2(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
     return FPMinMaxOperation(*this, Q, sz, Vm, Vn, Vd, MinMaxOperation::Max);
 }
 
+bool TranslatorVisitor::FMAXNM_1(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    const size_t datasize = Q ? 128 : 64;
+
+    const IR::U128 operand1 = V(datasize, Vn);
+    const IR::U128 operand2 = V(datasize, Vm);
+    const IR::U128 result = FPHalfMaxNumeric(operand1, operand2);
+
+    V(datasize, Vd, result);
+    return true;
+}
+
 bool TranslatorVisitor::FMAXNM_2(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
     return FPMinMaxNumericOperation(*this, Q, sz, Vm, Vn, Vd, &IREmitter::FPMaxNumeric);
 }
 
+bool TranslatorVisitor::FMAXNMP_vec_1(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    return FPHalfPairedOperation(*this, Q, Vm, Vn, Vd, [this](const IR::U128& even, const IR::U128& odd) {
+        return FPHalfMaxNumeric(even, odd);
+    });
+}
+
 bool TranslatorVisitor::FMAXNMP_vec_2(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
     return FPPairedMinMax(*this, Q, sz, Vm, Vn, Vd, &IREmitter::FPMaxNumeric);
 }
 
+bool TranslatorVisitor::FMAXP_vec_1(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    return FPHalfPairedOperation(*this, Q, Vm, Vn, Vd, [this](const IR::U128& even, const IR::U128& odd) {
+        return ir.FPVectorMax(16, even, odd);
+    });
+}
+
 bool TranslatorVisitor::FMAXP_vec_2(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
     return FPPairedMinMax(*this, Q, sz, Vm, Vn, Vd, &IREmitter::FPMax);
 }
 
+bool TranslatorVisitor::FMIN_1(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    const size_t datasize = Q ? 128 : 64;
+
+    const IR::U128 operand1 = V(datasize, Vn);
+    const IR::U128 operand2 = V(datasize, Vm);
+    const IR::U128 result = ir.FPVectorMin(16, operand1, operand2);
+
+    V(datasize, Vd, result);
+    return true;
+}
+
 bool TranslatorVisitor::FMIN_2(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
     return FPMinMaxOperation(*this, Q, sz, Vm, Vn, Vd, MinMaxOperation::Min);
 }
 
+bool TranslatorVisitor::FMINNM_1(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    const size_t datasize = Q ? 128 : 64;
+
+    const IR::U128 operand1 = V(datasize, Vn);
+    const IR::U128 operand2 = V(datasize, Vm);
+    const IR::U128 result = FPHalfMinNumeric(operand1, operand2);
+
+    V(datasize, Vd, result);
+    return true;
+}
+
 bool TranslatorVisitor::FMINNM_2(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
     return FPMinMaxNumericOperation(*this, Q, sz, Vm, Vn, Vd, &IREmitter::FPMinNumeric);
 }
 
+bool TranslatorVisitor::FMINNMP_vec_1(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    return FPHalfPairedOperation(*this, Q, Vm, Vn, Vd, [this](const IR::U128& even, const IR::U128& odd) {
+        return FPHalfMinNumeric(even, odd);
+    });
+}
+
 bool TranslatorVisitor::FMINNMP_vec_2(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
     return FPPairedMinMax(*this, Q, sz, Vm, Vn, Vd, &IREmitter::FPMinNumeric);
 }
 
+bool TranslatorVisitor::FMINP_vec_1(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    return FPHalfPairedOperation(*this, Q, Vm, Vn, Vd, [this](const IR::U128& even, const IR::U128& odd) {
+        return ir.FPVectorMin(16, even, odd);
+    });
+}
+
 bool TranslatorVisitor::FMINP_vec_2(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
     return FPPairedMinMax(*this, Q, sz, Vm, Vn, Vd, &IREmitter::FPMin);
 }
 
+bool TranslatorVisitor::FADDP_vec_1(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    return FPHalfPairedOperation(*this, Q, Vm, Vn, Vd, [this](const IR::U128& even, const IR::U128& odd) {
+        return ir.FPVectorAdd(16, even, odd);
+    });
+}
+
 bool TranslatorVisitor::FADDP_vec_2(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
     if (sz && !Q) {
         return ReservedValue();
@@ -1164,6 +1398,18 @@ bool TranslatorVisitor::FADDP_vec_2(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
     return true;
 }
 
+bool TranslatorVisitor::FMUL_vec_1(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    const size_t datasize = Q ? 128 : 64;
+    const size_t esize = 16;
+
+    const IR::U128 operand1 = V(datasize, Vn);
+    const IR::U128 operand2 = V(datasize, Vm);
+    const IR::U128 result = ir.FPVectorMul(esize, operand1, operand2);
+
+    V(datasize, Vd, result);
+    return true;
+}
+
 bool TranslatorVisitor::FMUL_vec_2(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
     if (sz && !Q) {
         return ReservedValue();
@@ -1180,6 +1426,17 @@ bool TranslatorVisitor::FMUL_vec_2(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
     return true;
 }
 
+bool TranslatorVisitor::FMULX_vec_3(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    const size_t datasize = Q ? 128 : 64;
+
+    const IR::U128 operand1 = V(datasize, Vn);
+    const IR::U128 operand2 = V(datasize, Vm);
+    const IR::U128 result = FPHalfMulX(operand1, operand2);
+
+    V(datasize, Vd, result);
+    return true;
+}
+
 bool TranslatorVisitor::FMULX_vec_4(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
     if (sz && !Q) {
         return ReservedValue();
@@ -1196,6 +1453,18 @@ bool TranslatorVisitor::FMULX_vec_4(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
     return true;
 }
 
+bool TranslatorVisitor::FDIV_1(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    const size_t datasize = Q ? 128 : 64;
+    const size_t esize = 16;
+
+    const IR::U128 operand1 = V(datasize, Vn);
+    const IR::U128 operand2 = V(datasize, Vm);
+    const IR::U128 result = ir.FPVectorDiv(esize, operand1, operand2);
+
+    V(datasize, Vd, result);
+    return true;
+}
+
 bool TranslatorVisitor::FDIV_2(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
     if (sz && !Q) {
         return ReservedValue();
@@ -42,6 +42,25 @@ bool DotProduct(TranslatorVisitor& v, bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec V
     return true;
 }
 
+bool SaturatingRoundingDoublingMultiplyAccumulate(TranslatorVisitor& v, bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd,
+                                                  bool subtract) {
+    if (size == 0b00 || size == 0b11) {
+        return v.ReservedValue();
+    }
+
+    const size_t esize = 8 << size.ZeroExtend();
+    const size_t datasize = Q ? 128 : 64;
+
+    const IR::U128 operand1 = v.V(datasize, Vn);
+    const IR::U128 operand2 = v.V(datasize, Vm);
+    const IR::U128 operand3 = v.V(datasize, Vd);
+    const IR::U128 result = subtract ? v.ir.VectorSignedSaturatedRoundingDoublingMultiplySubtract(esize, operand3, operand1, operand2)
+                                     : v.ir.VectorSignedSaturatedRoundingDoublingMultiplyAccumulate(esize, operand3, operand1, operand2);
+
+    v.V(datasize, Vd, result);
+    return true;
+}
+
 } // Anonymous namespace
 
 bool TranslatorVisitor::SDOT_vec(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
@@ -52,6 +71,14 @@ bool TranslatorVisitor::UDOT_vec(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
     return DotProduct(*this, Q, size, Vm, Vn, Vd, &IREmitter::ZeroExtendToWord);
 }
 
+bool TranslatorVisitor::SQRDMLAH_vec_2(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return SaturatingRoundingDoublingMultiplyAccumulate(*this, Q, size, Vm, Vn, Vd, false);
+}
+
+bool TranslatorVisitor::SQRDMLSH_vec_2(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return SaturatingRoundingDoublingMultiplyAccumulate(*this, Q, size, Vm, Vn, Vd, true);
+}
+
 bool TranslatorVisitor::FCMLA_vec(bool Q, Imm<2> size, Vec Vm, Imm<2> rot, Vec Vn, Vec Vd) {
     if (size == 0) {
         return ReservedValue();
@@ -62,12 +89,6 @@ bool TranslatorVisitor::FCMLA_vec(bool Q, Imm<2> size, Vec Vm, Imm<2> rot, Vec V
     }
 
     const size_t esize = 8U << size.ZeroExtend();
-
-    // TODO: Currently we don't support half-precision floating point
-    if (esize == 16) {
-        return InterpretThisInstruction();
-    }
-
     const size_t datasize = Q ? 128 : 64;
     const size_t num_elements = datasize / esize;
     const size_t num_iterations = num_elements / 2;
@@ -75,6 +96,12 @@ bool TranslatorVisitor::FCMLA_vec(bool Q, Imm<2> size, Vec Vm, Imm<2> rot, Vec V
     const IR::U128 operand1 = V(datasize, Vn);
     const IR::U128 operand2 = V(datasize, Vm);
     const IR::U128 operand3 = V(datasize, Vd);
+
+    if (esize == 16) {
+        V(datasize, Vd, FPHalfComplexMulAdd(operand3, operand1, operand2, rot.ZeroExtend()));
+        return true;
+    }
+
     IR::U128 result = ir.ZeroVector();
 
     IR::U32U64 element1;
@@ -133,18 +160,21 @@ bool TranslatorVisitor::FCADD_vec(bool Q, Imm<2> size, Vec Vm, Imm<1> rot, Vec V
     }
 
     const size_t esize = 8U << size.ZeroExtend();
-
-    // TODO: Currently we don't support half-precision floating point
-    if (esize == 16) {
-        return InterpretThisInstruction();
-    }
-
     const size_t datasize = Q ? 128 : 64;
     const size_t num_elements = datasize / esize;
     const size_t num_iterations = num_elements / 2;
 
     const IR::U128 operand1 = V(datasize, Vn);
     const IR::U128 operand2 = V(datasize, Vm);
+
+    if (esize == 16) {
+        // Swap each (real, imaginary) pair of operand2 and negate the half that is subtracted.
+        const IR::U128 swapped = ir.VectorRotateLeft(32, operand2, 16);
+        const IR::U128 negate = ir.VectorBroadcast(32, I(32, rot == 0 ? 0x00008000 : 0x80000000));
+        V(datasize, Vd, ir.FPVectorAdd(esize, operand1, ir.VectorEor(swapped, negate)));
+        return true;
+    }
+
     IR::U128 result = ir.ZeroVector();
 
     IR::U32U64 element1;
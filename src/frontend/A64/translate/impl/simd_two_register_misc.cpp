@@ -50,13 +50,7 @@ bool CompareAgainstZero(TranslatorVisitor& v, bool Q, Imm<2> size, Vec Vn, Vec V
     return true;
 }
 
-bool FPCompareAgainstZero(TranslatorVisitor& v, bool Q, bool sz, Vec Vn, Vec Vd, ComparisonType type) {
-    if (sz && !Q) {
-        return v.ReservedValue();
-    }
-
-    const size_t esize = sz ? 64 : 32;
-    const size_t datasize = Q ? 128 : 64;
+bool FPCompareElementsAgainstZero(TranslatorVisitor& v, size_t esize, size_t datasize, Vec Vn, Vec Vd, ComparisonType type) {
 
     const IR::U128 operand = v.V(datasize, Vn);
     const IR::U128 zero = v.ir.ZeroVector();
@@ -81,6 +75,21 @@ bool FPCompareAgainstZero(TranslatorVisitor& v, bool Q, bool sz, Vec Vn, Vec Vd,
     return true;
 }
 
+bool FPCompareAgainstZero(TranslatorVisitor& v, bool Q, bool sz, Vec Vn, Vec Vd, ComparisonType type) {
+    if (sz && !Q) {
+        return v.ReservedValue();
+    }
+
+    const size_t esize = sz ? 64 : 32;
+    const size_t datasize = Q ? 128 : 64;
+
+    return FPCompareElementsAgainstZero(v, esize, datasize, Vn, Vd, type);
+}
+
+bool FPCompareAgainstZeroHalfPrecision(TranslatorVisitor& v, bool Q, Vec Vn, Vec Vd, ComparisonType type) {
+    return FPCompareElementsAgainstZero(v, 16, Q ? 128 : 64, Vn, Vd, type);
+}
+
 enum class Signedness {
     Signed,
     Unsigned
@@ -104,6 +113,20 @@ bool IntegerConvertToFloat(TranslatorVisitor& v, bool Q, bool sz, Vec Vn, Vec Vd
     return true;
 }
 
+bool IntegerConvertToFloatHalfPrecision(TranslatorVisitor& v, bool Q, Vec Vn, Vec Vd, Signedness signedness) {
+    const size_t datasize = Q ? 128 : 64;
+    const size_t esize = 16;
+    const FP::RoundingMode rounding_mode = v.ir.current_location->FPCR().RMode();
+
+    const IR::U128 operand = v.V(datasize, Vn);
+    const IR::U128 result = signedness == Signedness::Signed
+                          ? v.ir.FPVectorFromSignedFixed(esize, operand, 0, rounding_mode)
+                          : v.ir.FPVectorFromUnsignedFixed(esize, operand, 0, rounding_mode);
+
+    v.V(datasize, Vd, result);
+    return true;
+}
+
 bool FloatConvertToInteger(TranslatorVisitor& v, bool Q, bool sz, Vec Vn, Vec Vd, Signedness signedness, FP::RoundingMode rounding_mode) {
     if (sz && !Q) {
         return v.ReservedValue();
@@ -121,6 +144,19 @@ bool FloatConvertToInteger(TranslatorVisitor& v, bool Q, bool sz, Vec Vn, Vec Vd
     return true;
 }
 
+bool FloatConvertToIntegerHalfPrecision(TranslatorVisitor& v, bool Q, Vec Vn, Vec Vd, Signedness signedness, FP::RoundingMode rounding_mode) {
+    const size_t datasize = Q ? 128 : 64;
+    const size_t esize = 16;
+
+    const IR::U128 operand = v.V(datasize, Vn);
+    const IR::U128 result = signedness == Signedness::Signed
+                          ? v.ir.FPVectorToSignedFixed(esize, operand, 0, rounding_mode)
+                          : v.ir.FPVectorToUnsignedFixed(esize, operand, 0, rounding_mode);
+
+    v.V(datasize, Vd, result);
+    return true;
+}
+
 bool FloatRoundToIntegral(TranslatorVisitor& v, bool Q, bool sz, Vec Vn, Vec Vd, FP::RoundingMode rounding_mode, bool exact) {
     if (sz && !Q) {
         return v.ReservedValue();
@@ -147,6 +183,21 @@ bool FloatRoundToIntegralHalfPrecision(TranslatorVisitor& v, bool Q, Vec Vn, Vec
     return true;
 }
 
+bool FloatRoundToIntegralN(TranslatorVisitor& v, bool Q, bool sz, Vec Vn, Vec Vd, FP::RoundingMode rounding_mode, size_t intsize) {
+    if (sz && !Q) {
+        return v.ReservedValue();
+    }
+
+    const size_t datasize = Q ? 128 : 64;
+    const size_t esize = sz ? 64 : 32;
+
+    const IR::U128 operand = v.V(datasize, Vn);
+    const IR::U128 result = v.ir.FPVectorRoundIntN(esize, operand, rounding_mode, intsize);
+
+    v.V(datasize, Vd, result);
+    return true;
+}
+
 bool SaturatedNarrow(TranslatorVisitor& v, bool Q, Imm<2> size, Vec Vn, Vec Vd, IR::U128 (IR::IREmitter::*fn)(size_t, const IR::U128&)) {
     if (size == 0b11) {
         return v.ReservedValue();
@@ -341,6 +392,22 @@ bool TranslatorVisitor::FCMEQ_zero_3(bool Q, Vec Vn, Vec Vd) {
     return true;
 }
 
+bool TranslatorVisitor::FCMGE_zero_3(bool Q, Vec Vn, Vec Vd) {
+    return FPCompareAgainstZeroHalfPrecision(*this, Q, Vn, Vd, ComparisonType::GE);
+}
+
+bool TranslatorVisitor::FCMGT_zero_3(bool Q, Vec Vn, Vec Vd) {
+    return FPCompareAgainstZeroHalfPrecision(*this, Q, Vn, Vd, ComparisonType::GT);
+}
+
+bool TranslatorVisitor::FCMLE_3(bool Q, Vec Vn, Vec Vd) {
+    return FPCompareAgainstZeroHalfPrecision(*this, Q, Vn, Vd, ComparisonType::LE);
+}
+
+bool TranslatorVisitor::FCMLT_3(bool Q, Vec Vn, Vec Vd) {
+    return FPCompareAgainstZeroHalfPrecision(*this, Q, Vn, Vd, ComparisonType::LT);
+}
+
 bool TranslatorVisitor::FCMEQ_zero_4(bool Q, bool sz, Vec Vn, Vec Vd) {
     return FPCompareAgainstZero(*this, Q, sz, Vn, Vd, ComparisonType::EQ);
 }
@@ -411,18 +478,34 @@ bool TranslatorVisitor::FCVTN(bool Q, bool sz, Vec Vn, Vec Vd) {
     return true;
 }
 
+bool TranslatorVisitor::FCVTNS_3(bool Q, Vec Vn, Vec Vd) {
+    return FloatConvertToIntegerHalfPrecision(*this, Q, Vn, Vd, Signedness::Signed, FP::RoundingMode::ToNearest_TieEven);
+}
+
 bool TranslatorVisitor::FCVTNS_4(bool Q, bool sz, Vec Vn, Vec Vd) {
     return FloatConvertToInteger(*this, Q, sz, Vn, Vd, Signedness::Signed, FP::RoundingMode::ToNearest_TieEven);
 }
 
+bool TranslatorVisitor::FCVTMS_3(bool Q, Vec Vn, Vec Vd) {
+    return FloatConvertToIntegerHalfPrecision(*this, Q, Vn, Vd, Signedness::Signed, FP::RoundingMode::TowardsMinusInfinity);
+}
+
 bool TranslatorVisitor::FCVTMS_4(bool Q, bool sz, Vec Vn, Vec Vd) {
     return FloatConvertToInteger(*this, Q, sz, Vn, Vd, Signedness::Signed, FP::RoundingMode::TowardsMinusInfinity);
 }
 
+bool TranslatorVisitor::FCVTAS_3(bool Q, Vec Vn, Vec Vd) {
+    return FloatConvertToIntegerHalfPrecision(*this, Q, Vn, Vd, Signedness::Signed, FP::RoundingMode::ToNearest_TieAwayFromZero);
+}
+
 bool TranslatorVisitor::FCVTAS_4(bool Q, bool sz, Vec Vn, Vec Vd) {
     return FloatConvertToInteger(*this, Q, sz, Vn, Vd, Signedness::Signed, FP::RoundingMode::ToNearest_TieAwayFromZero);
 }
 
+bool TranslatorVisitor::FCVTPS_3(bool Q, Vec Vn, Vec Vd) {
+    return FloatConvertToIntegerHalfPrecision(*this, Q, Vn, Vd, Signedness::Signed, FP::RoundingMode::TowardsPlusInfinity);
+}
+
 bool TranslatorVisitor::FCVTPS_4(bool Q, bool sz, Vec Vn, Vec Vd) {
     return FloatConvertToInteger(*this, Q, sz, Vn, Vd, Signedness::Signed, FP::RoundingMode::TowardsPlusInfinity);
 }
@@ -447,26 +530,50 @@ bool TranslatorVisitor::FCVTXN_2(bool Q, bool sz, Vec Vn, Vec Vd) {
     return true;
 }
 
+bool TranslatorVisitor::FCVTZS_int_3(bool Q, Vec Vn, Vec Vd) {
+    return FloatConvertToIntegerHalfPrecision(*this, Q, Vn, Vd, Signedness::Signed, FP::RoundingMode::TowardsZero);
+}
+
 bool TranslatorVisitor::FCVTZS_int_4(bool Q, bool sz, Vec Vn, Vec Vd) {
     return FloatConvertToInteger(*this, Q, sz, Vn, Vd, Signedness::Signed, FP::RoundingMode::TowardsZero);
 }
 
+bool TranslatorVisitor::FCVTNU_3(bool Q, Vec Vn, Vec Vd) {
+    return FloatConvertToIntegerHalfPrecision(*this, Q, Vn, Vd, Signedness::Unsigned, FP::RoundingMode::ToNearest_TieEven);
+}
+
 bool TranslatorVisitor::FCVTNU_4(bool Q, bool sz, Vec Vn, Vec Vd) {
     return FloatConvertToInteger(*this, Q, sz, Vn, Vd, Signedness::Unsigned, FP::RoundingMode::ToNearest_TieEven);
 }
 
+bool TranslatorVisitor::FCVTMU_3(bool Q, Vec Vn, Vec Vd) {
+    return FloatConvertToIntegerHalfPrecision(*this, Q, Vn, Vd, Signedness::Unsigned, FP::RoundingMode::TowardsMinusInfinity);
+}
+
 bool TranslatorVisitor::FCVTMU_4(bool Q, bool sz, Vec Vn, Vec Vd) {
     return FloatConvertToInteger(*this, Q, sz, Vn, Vd, Signedness::Unsigned, FP::RoundingMode::TowardsMinusInfinity);
 }
 
+bool TranslatorVisitor::FCVTAU_3(bool Q, Vec Vn, Vec Vd) {
+    return FloatConvertToIntegerHalfPrecision(*this, Q, Vn, Vd, Signedness::Unsigned, FP::RoundingMode::ToNearest_TieAwayFromZero);
+}
+
 bool TranslatorVisitor::FCVTAU_4(bool Q, bool sz, Vec Vn, Vec Vd) {
     return FloatConvertToInteger(*this, Q, sz, Vn, Vd, Signedness::Unsigned, FP::RoundingMode::ToNearest_TieAwayFromZero);
 }
 
+bool TranslatorVisitor::FCVTPU_3(bool Q, Vec Vn, Vec Vd) {
+    return FloatConvertToIntegerHalfPrecision(*this, Q, Vn, Vd, Signedness::Unsigned, FP::RoundingMode::TowardsPlusInfinity);
+}
+
 bool TranslatorVisitor::FCVTPU_4(bool Q, bool sz, Vec Vn, Vec Vd) {
     return FloatConvertToInteger(*this, Q, sz, Vn, Vd, Signedness::Unsigned, FP::RoundingMode::TowardsPlusInfinity);
 }
 
+bool TranslatorVisitor::FCVTZU_int_3(bool Q, Vec Vn, Vec Vd) {
+    return FloatConvertToIntegerHalfPrecision(*this, Q, Vn, Vd, Signedness::Unsigned, FP::RoundingMode::TowardsZero);
+}
+
 bool TranslatorVisitor::FCVTZU_int_4(bool Q, bool sz, Vec Vn, Vec Vd) {
     return FloatConvertToInteger(*this, Q, sz, Vn, Vd, Signedness::Unsigned, FP::RoundingMode::TowardsZero);
 }
@@ -527,6 +634,22 @@ bool TranslatorVisitor::FRINTI_2(bool Q, bool sz, Vec Vn, Vec Vd) {
     return FloatRoundToIntegral(*this, Q, sz, Vn, Vd,ir.current_location->FPCR().RMode(), false);
 }
 
+bool TranslatorVisitor::FRINT32X_1(bool Q, bool sz, Vec Vn, Vec Vd) {
+    return FloatRoundToIntegralN(*this, Q, sz, Vn, Vd, ir.current_location->FPCR().RMode(), 32);
+}
+
+bool TranslatorVisitor::FRINT64X_1(bool Q, bool sz, Vec Vn, Vec Vd) {
+    return FloatRoundToIntegralN(*this, Q, sz, Vn, Vd, ir.current_location->FPCR().RMode(), 64);
+}
+
+bool TranslatorVisitor::FRINT32Z_1(bool Q, bool sz, Vec Vn, Vec Vd) {
+    return FloatRoundToIntegralN(*this, Q, sz, Vn, Vd, FP::RoundingMode::TowardsZero, 32);
+}
+
+bool TranslatorVisitor::FRINT64Z_1(bool Q, bool sz, Vec Vn, Vec Vd) {
+    return FloatRoundToIntegralN(*this, Q, sz, Vn, Vd, FP::RoundingMode::TowardsZero, 64);
+}
+
 bool TranslatorVisitor::FRECPE_3(bool Q, Vec Vn, Vec Vd) {
     const size_t datasize = Q ? 128 : 64;
     const size_t esize = 16;
@@ -553,6 +676,17 @@ bool TranslatorVisitor::FRECPE_4(bool Q, bool sz, Vec Vn, Vec Vd) {
     return true;
 }
 
+bool TranslatorVisitor::FSQRT_1(bool Q, Vec Vn, Vec Vd) {
+    const size_t datasize = Q ? 128 : 64;
+    const size_t esize = 16;
+
+    const IR::U128 operand = V(datasize, Vn);
+    const IR::U128 result = ir.FPVectorSqrt(esize, operand);
+
+    V(datasize, Vd, result);
+    return true;
+}
+
 bool TranslatorVisitor::FSQRT_2(bool Q, bool sz, Vec Vn, Vec Vd) {
     if (sz && !Q) {
         return ReservedValue();
@@ -860,10 +994,18 @@ bool TranslatorVisitor::URSQRTE(bool Q, bool sz, Vec Vn, Vec Vd) {
     return true;
 }
 
+bool TranslatorVisitor::SCVTF_int_3(bool Q, Vec Vn, Vec Vd) {
+    return IntegerConvertToFloatHalfPrecision(*this, Q, Vn, Vd, Signedness::Signed);
+}
+
 bool TranslatorVisitor::SCVTF_int_4(bool Q, bool sz, Vec Vn, Vec Vd) {
     return IntegerConvertToFloat(*this, Q, sz, Vn, Vd, Signedness::Signed);
 }
 
+bool TranslatorVisitor::UCVTF_int_3(bool Q, Vec Vn, Vec Vd) {
+    return IntegerConvertToFloatHalfPrecision(*this, Q, Vn, Vd, Signedness::Unsigned);
+}
+
 bool TranslatorVisitor::UCVTF_int_4(bool Q, bool sz, Vec Vn, Vec Vd) {
     return IntegerConvertToFloat(*this, Q, sz, Vn, Vd, Signedness::Unsigned);
 }
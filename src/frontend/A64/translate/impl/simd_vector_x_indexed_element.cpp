@@ -100,14 +100,12 @@ bool FPMultiplyByElementHalfPrecision(TranslatorVisitor& v, bool Q, Imm<1> L, Im
     const IR::U128 operand2 = Q ? v.ir.VectorBroadcast(esize, element2) : v.ir.VectorBroadcastLower(esize, element2);
     const IR::U128 operand3 = v.V(datasize, Vd);
 
-    // TODO: We currently don't implement half-precision paths for
-    //       regular multiplies and extended multiplies.
     const IR::U128 result = [&]{
         switch (extra_behavior) {
         case ExtraBehavior::None:
-            break;
+            return v.ir.FPVectorMul(esize, operand1, operand2);
         case ExtraBehavior::Extended:
-            break;
+            return v.FPHalfMulX(operand1, operand2);
         case ExtraBehavior::Accumulate:
             return v.ir.FPVectorMulAdd(esize, operand3, operand1, operand2);
         case ExtraBehavior::Subtract:
@@ -119,6 +117,35 @@ bool FPMultiplyByElementHalfPrecision(TranslatorVisitor& v, bool Q, Imm<1> L, Im
     return true;
 }
 
+bool FPMultiplyAddLongByElement(TranslatorVisitor& v, bool Q, bool sz, Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm<1> H,
+                                Vec Vn, Vec Vd, size_t part, ExtraBehavior extra_behavior) {
+    if (sz) {
+        return v.UnallocatedEncoding();
+    }
+
+    const size_t index = concatenate(H, L, M).ZeroExtend();
+    const Vec Vm = Vmlo.ZeroExtend<Vec>();
+    const size_t esize = 32;
+    const size_t datasize = Q ? 128 : 64;
+
+    // Only the lower datasize / 2 bits of the selected part are widened.
+    const IR::U16 element2 = v.ir.VectorGetElement(16, v.ir.GetQ(Vm), index);
+    IR::U128 operand1 = Q ? v.Vpart(64, Vn, part)
+                          : v.ir.ZeroExtendToQuad(v.ir.VectorGetElement(32, v.ir.GetQ(Vn), part));
+    const IR::U128 operand2 = Q ? v.ir.VectorBroadcastLower(16, element2)
+                                : v.ir.ZeroExtendToQuad(v.ir.VectorGetElement(32, v.ir.VectorBroadcastLower(16, element2), 0));
+    const IR::U128 operand3 = v.V(datasize, Vd);
+
+    if (extra_behavior == ExtraBehavior::Subtract) {
+        operand1 = v.ir.FPVectorNeg(16, operand1);
+    }
+
+    const IR::U128 result = v.ir.FPVectorMulAddLong(esize, operand3, operand1, operand2);
+
+    v.V(datasize, Vd, result);
+    return true;
+}
+
 using ExtensionFunction = IR::U32 (IREmitter::*)(const IR::UAny&);
 
 bool DotProduct(TranslatorVisitor& v, bool Q, Imm<2> size, Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm<1> H,
@@ -203,6 +230,63 @@ bool MultiplyLong(TranslatorVisitor& v, bool Q, Imm<2> size, Imm<1> L, Imm<1> M,
     v.V(2 * datasize, Vd, result);
     return true;
 }
+
+bool SaturatingDoublingMultiplyLongByElement(TranslatorVisitor& v, bool Q, Imm<2> size, Imm<1> L, Imm<1> M, Imm<4> Vmlo,
+                                             Imm<1> H, Vec Vn, Vec Vd, ExtraBehavior extra_behavior) {
+    if (size == 0b00 || size == 0b11) {
+        return v.ReservedValue();
+    }
+
+    const size_t part = Q ? 1 : 0;
+    const size_t idxsize = H == 1 ? 128 : 64;
+    const size_t esize = 8 << size.ZeroExtend();
+    const size_t datasize = 64;
+    const auto [index, Vm] = Combine(size, H, L, M, Vmlo);
+
+    const IR::U128 operand1 = v.Vpart(datasize, Vn, part);
+    const IR::U128 operand2 = v.V(idxsize, Vm);
+    const IR::U128 index_vector = v.ir.VectorBroadcast(esize, v.ir.VectorGetElement(esize, operand2, index));
+    const IR::U128 product = v.ir.VectorSignedSaturatedDoublingMultiplyLong(esize, operand1, index_vector);
+
+    const IR::U128 result = [&] {
+        if (extra_behavior == ExtraBehavior::None) {
+            return product;
+        }
+
+        const IR::U128 operand3 = v.V(2 * datasize, Vd);
+        if (extra_behavior == ExtraBehavior::Accumulate) {
+            return v.ir.VectorSignedSaturatedAdd(2 * esize, operand3, product);
+        }
+
+        return v.ir.VectorSignedSaturatedSub(2 * esize, operand3, product);
+    }();
+
+    v.V(2 * datasize, Vd, result);
+    return true;
+}
+
+bool SaturatingRoundingDoublingMultiplyAccumulateByElement(TranslatorVisitor& v, bool Q, Imm<2> size, Imm<1> L, Imm<1> M, Imm<4> Vmlo,
+                                                           Imm<1> H, Vec Vn, Vec Vd, ExtraBehavior extra_behavior) {
+    if (size == 0b00 || size == 0b11) {
+        return v.ReservedValue();
+    }
+
+    const size_t idxsize = H == 1 ? 128 : 64;
+    const size_t esize = 8 << size.ZeroExtend();
+    const size_t datasize = Q ? 128 : 64;
+    const auto [index, Vm] = Combine(size, H, L, M, Vmlo);
+
+    const IR::U128 operand1 = v.V(datasize, Vn);
+    const IR::U128 operand2 = v.V(idxsize, Vm);
+    const IR::U128 operand3 = v.V(datasize, Vd);
+    const IR::U128 index_vector = v.ir.VectorBroadcast(esize, v.ir.VectorGetElement(esize, operand2, index));
+    const IR::U128 result = extra_behavior == ExtraBehavior::Accumulate
+                                ? v.ir.VectorSignedSaturatedRoundingDoublingMultiplyAccumulate(esize, operand3, operand1, index_vector)
+                                : v.ir.VectorSignedSaturatedRoundingDoublingMultiplySubtract(esize, operand3, operand1, index_vector);
+
+    v.V(datasize, Vd, result);
+    return true;
+}
 } // Anonymous namespace
 
 bool TranslatorVisitor::MLA_elt(bool Q, Imm<2> size, Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm<1> H, Vec Vn, Vec Vd) {
@@ -232,11 +316,6 @@ bool TranslatorVisitor::FCMLA_elt(bool Q, Imm<2> size, Imm<1> L, Imm<1> M, Imm<4
 
     const size_t esize = 8U << size.ZeroExtend();
 
-    // TODO: We don't support the half-precision floating point variant yet.
-    if (esize == 16) {
-        return InterpretThisInstruction();
-    }
-
     const size_t index = [=] {
         if (size == 0b01) {
             return concatenate(H, L).ZeroExtend();
@@ -253,6 +332,15 @@ bool TranslatorVisitor::FCMLA_elt(bool Q, Imm<2> size, Imm<1> L, Imm<1> M, Imm<4
     const IR::U128 operand1 = V(datasize, Vn);
     const IR::U128 operand2 = V(datasize, Vm);
     const IR::U128 operand3 = V(datasize, Vd);
+
+    if (esize == 16) {
+        // The indexed complex pair is a single 32-bit element, broadcast to every pair.
+        const IR::U32 pair = ir.VectorGetElement(32, operand2, index);
+        const IR::U128 broadcast = Q ? ir.VectorBroadcast(32, pair) : ir.VectorBroadcastLower(32, pair);
+        V(datasize, Vd, FPHalfComplexMulAdd(operand3, operand1, broadcast, rot.ZeroExtend()));
+        return true;
+    }
+
     IR::U128 result = ir.ZeroVector();
 
     IR::U32U64 element1;
@@ -320,10 +408,34 @@ bool TranslatorVisitor::FMLS_elt_4(bool Q, bool sz, Imm<1> L, Imm<1> M, Imm<4> V
     return FPMultiplyByElement(*this, Q, sz, L, M, Vmlo, H, Vn, Vd, ExtraBehavior::Subtract);
 }
 
+bool TranslatorVisitor::FMLAL_elt_1(bool Q, bool sz, Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm<1> H, Vec Vn, Vec Vd) {
+    return FPMultiplyAddLongByElement(*this, Q, sz, L, M, Vmlo, H, Vn, Vd, 0, ExtraBehavior::Accumulate);
+}
+
+bool TranslatorVisitor::FMLAL_elt_2(bool Q, bool sz, Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm<1> H, Vec Vn, Vec Vd) {
+    return FPMultiplyAddLongByElement(*this, Q, sz, L, M, Vmlo, H, Vn, Vd, 1, ExtraBehavior::Accumulate);
+}
+
+bool TranslatorVisitor::FMLSL_elt_1(bool Q, bool sz, Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm<1> H, Vec Vn, Vec Vd) {
+    return FPMultiplyAddLongByElement(*this, Q, sz, L, M, Vmlo, H, Vn, Vd, 0, ExtraBehavior::Subtract);
+}
+
+bool TranslatorVisitor::FMLSL_elt_2(bool Q, bool sz, Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm<1> H, Vec Vn, Vec Vd) {
+    return FPMultiplyAddLongByElement(*this, Q, sz, L, M, Vmlo, H, Vn, Vd, 1, ExtraBehavior::Subtract);
+}
+
+bool TranslatorVisitor::FMUL_elt_3(bool Q, Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm<1> H, Vec Vn, Vec Vd) {
+    return FPMultiplyByElementHalfPrecision(*this, Q, L, M, Vmlo, H, Vn, Vd, ExtraBehavior::None);
+}
+
 bool TranslatorVisitor::FMUL_elt_4(bool Q, bool sz, Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm<1> H, Vec Vn, Vec Vd) {
     return FPMultiplyByElement(*this, Q, sz, L, M, Vmlo, H, Vn, Vd, ExtraBehavior::None);
 }
 
+bool TranslatorVisitor::FMULX_elt_3(bool Q, Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm<1> H, Vec Vn, Vec Vd) {
+    return FPMultiplyByElementHalfPrecision(*this, Q, L, M, Vmlo, H, Vn, Vd, ExtraBehavior::Extended);
+}
+
 bool TranslatorVisitor::FMULX_elt_4(bool Q, bool sz, Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm<1> H, Vec Vn, Vec Vd) {
     return FPMultiplyByElement(*this, Q, sz, L, M, Vmlo, H, Vn, Vd, ExtraBehavior::Extended);
 }
@@ -340,24 +452,16 @@ bool TranslatorVisitor::SMULL_elt(bool Q, Imm<2> size, Imm<1> L, Imm<1> M, Imm<4
     return MultiplyLong(*this, Q, size, L, M, Vmlo, H, Vn, Vd, ExtraBehavior::None, Signedness::Signed);
 }
 
-bool TranslatorVisitor::SQDMULL_elt_2(bool Q, Imm<2> size, Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm<1> H, Vec Vn, Vec Vd) {
-    if (size == 0b00 || size == 0b11) {
-        return ReservedValue();
-    }
-
-    const size_t part = Q ? 1 : 0;
-    const size_t idxsize = H == 1 ? 128 : 64;
-    const size_t esize = 8 << size.ZeroExtend();
-    const size_t datasize = 64;
-    const auto [index, Vm] = Combine(size, H, L, M, Vmlo);
+bool TranslatorVisitor::SQDMLAL_elt_2(bool Q, Imm<2> size, Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm<1> H, Vec Vn, Vec Vd) {
+    return SaturatingDoublingMultiplyLongByElement(*this, Q, size, L, M, Vmlo, H, Vn, Vd, ExtraBehavior::Accumulate);
+}
 
-    const IR::U128 operand1 = Vpart(datasize, Vn, part);
-    const IR::U128 operand2 = V(idxsize, Vm);
-    const IR::U128 index_vector = ir.VectorBroadcast(esize, ir.VectorGetElement(esize, operand2, index));
-    const IR::U128 result = ir.VectorSignedSaturatedDoublingMultiplyLong(esize, operand1, index_vector);
+bool TranslatorVisitor::SQDMLSL_elt_2(bool Q, Imm<2> size, Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm<1> H, Vec Vn, Vec Vd) {
+    return SaturatingDoublingMultiplyLongByElement(*this, Q, size, L, M, Vmlo, H, Vn, Vd, ExtraBehavior::Subtract);
+}
 
-    V(128, Vd, result);
-    return true;
+bool TranslatorVisitor::SQDMULL_elt_2(bool Q, Imm<2> size, Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm<1> H, Vec Vn, Vec Vd) {
+    return SaturatingDoublingMultiplyLongByElement(*this, Q, size, L, M, Vmlo, H, Vn, Vd, ExtraBehavior::None);
 }
 
 bool TranslatorVisitor::SQDMULH_elt_2(bool Q, Imm<2> size, Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm<1> H, Vec Vn, Vec Vd) {
@@ -399,6 +503,14 @@ bool TranslatorVisitor::SQRDMULH_elt_2(bool Q, Imm<2> size, Imm<1> L, Imm<1> M,
     return true;
 }
 
+bool TranslatorVisitor::SQRDMLAH_elt_2(bool Q, Imm<2> size, Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm<1> H, Vec Vn, Vec Vd) {
+    return SaturatingRoundingDoublingMultiplyAccumulateByElement(*this, Q, size, L, M, Vmlo, H, Vn, Vd, ExtraBehavior::Accumulate);
+}
+
+bool TranslatorVisitor::SQRDMLSH_elt_2(bool Q, Imm<2> size, Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm<1> H, Vec Vn, Vec Vd) {
+    return SaturatingRoundingDoublingMultiplyAccumulateByElement(*this, Q, size, L, M, Vmlo, H, Vn, Vd, ExtraBehavior::Subtract);
+}
+
 bool TranslatorVisitor::SDOT_elt(bool Q, Imm<2> size, Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm<1> H, Vec Vn, Vec Vd) {
     return DotProduct(*this, Q, size, L, M, Vmlo, H, Vn, Vd, &IREmitter::SignExtendToWord);
 }
@@ -17,6 +17,8 @@ enum class SystemRegisterEncoding : u32 {
     CTR_EL0 = 0b11'011'0000'0000'001,
     // Data Cache Zero ID register
     DCZID_EL0 = 0b11'011'0000'0000'111,
+    // Condition Flags
+    NZCV = 0b11'011'0100'0010'000,
     // Floating-point Control Register
     FPCR = 0b11'011'0100'0100'000,
     // Floating-point Status Register
@@ -70,6 +72,43 @@ bool TranslatorVisitor::SEVL() {
     return RaiseException(Exception::SendEventLocal);
 }
 
+bool TranslatorVisitor::XPAC_2() {
+    X(64, Reg::R30, StripPointerAuthenticationCode(X(64, Reg::R30)));
+    return true;
+}
+
+bool TranslatorVisitor::PACIA_2() {
+    return true;
+}
+
+bool TranslatorVisitor::PACIB_2() {
+    return true;
+}
+
+// CRm<1> selects between AUTI*1716 (X17) and AUTI*SP/AUTI*Z (X30).
+// The remaining encodings in this space are unallocated hints.
+static bool AuthenticateInstructionAddressHint(TranslatorVisitor& v, bool CRm_1, bool op2_0) {
+    if (!CRm_1 && op2_0) {
+        return true;
+    }
+
+    const Reg reg = CRm_1 ? Reg::R30 : Reg::R17;
+    v.X(64, reg, v.StripPointerAuthenticationCode(v.X(64, reg)));
+    return true;
+}
+
+bool TranslatorVisitor::AUTIA_2(bool CRm_1, bool op2_0) {
+    return AuthenticateInstructionAddressHint(*this, CRm_1, op2_0);
+}
+
+bool TranslatorVisitor::AUTIB_2(bool CRm_1, bool op2_0) {
+    return AuthenticateInstructionAddressHint(*this, CRm_1, op2_0);
+}
+
+bool TranslatorVisitor::BTI(Imm<2> /*upper_op2*/) {
+    return true;
+}
+
 bool TranslatorVisitor::CLREX(Imm<4> /*CRm*/) {
     ir.ClearExclusive();
     return true;
@@ -92,9 +131,17 @@ bool TranslatorVisitor::ISB(Imm<4> /*CRm*/) {
     return false;
 }
 
+bool TranslatorVisitor::SB() {
+    // Speculation barrier: translated code does not execute speculatively.
+    return true;
+}
+
 bool TranslatorVisitor::MSR_reg(Imm<1> o0, Imm<3> op1, Imm<4> CRn, Imm<4> CRm, Imm<3> op2, Reg Rt) {
     const auto sys_reg = concatenate(Imm<1>{1}, o0, op1, CRn, CRm, op2).ZeroExtend<SystemRegisterEncoding>();
     switch (sys_reg) {
+    case SystemRegisterEncoding::NZCV:
+        ir.SetNZCVRaw(X(32, Rt));
+        return true;
     case SystemRegisterEncoding::FPCR:
         ir.SetFPCR(X(32, Rt));
         ir.SetPC(ir.Imm64(ir.current_location->PC() + 4));
@@ -133,6 +180,9 @@ bool TranslatorVisitor::MRS(Imm<1> o0, Imm<3> op1, Imm<4> CRn, Imm<4> CRm, Imm<3
     case SystemRegisterEncoding::DCZID_EL0:
         X(32, Rt, ir.GetDCZID());
         return true;
+    case SystemRegisterEncoding::NZCV:
+        X(32, Rt, ir.GetNZCVRaw());
+        return true;
     case SystemRegisterEncoding::FPCR:
         X(32, Rt, ir.GetFPCR());
         return true;
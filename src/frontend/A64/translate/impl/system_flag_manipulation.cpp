@@ -59,4 +59,31 @@ bool TranslatorVisitor::RMIF(Imm<6> lsb, Reg Rn, Imm<4> mask) {
     return true;
 }
 
+static bool SetFlagsFromLowBits(TranslatorVisitor& v, Reg Rn, size_t size) {
+    const IR::U32 value = v.X(32, Rn);
+    const u32 mask = (1U << size) - 1;
+
+    // N is bit (size - 1) and V is bit size XOR bit (size - 1).
+    const IR::U32 n = v.ir.And(v.ir.LogicalShiftLeft(value, v.ir.Imm8(static_cast<u8>(32 - size))), v.ir.Imm32(0x80000000));
+    const IR::U32 sign_change = v.ir.Eor(value, v.ir.LogicalShiftLeft(value, v.ir.Imm8(1)));
+    const IR::U32 overflow = v.ir.And(v.ir.LogicalShiftLeft(sign_change, v.ir.Imm8(static_cast<u8>(28 - size))), v.ir.Imm32(0x10000000));
+
+    // The low bits are at most 0xFFFF, so subtracting one only sets bit 31 if they are zero.
+    const IR::U32 low_bits_minus_one = v.ir.Sub(v.ir.And(value, v.ir.Imm32(mask)), v.ir.Imm32(1));
+    const IR::U32 z = v.ir.And(v.ir.LogicalShiftRight(low_bits_minus_one, v.ir.Imm8(1)), v.ir.Imm32(0x40000000));
+
+    const IR::U32 c = v.ir.And(v.ir.GetNZCVRaw(), v.ir.Imm32(0x20000000));
+
+    v.ir.SetNZCVRaw(v.ir.Or(v.ir.Or(n, z), v.ir.Or(c, overflow)));
+    return true;
+}
+
+bool TranslatorVisitor::SETF8(Reg Rn) {
+    return SetFlagsFromLowBits(*this, Rn, 8);
+}
+
+bool TranslatorVisitor::SETF16(Reg Rn) {
+    return SetFlagsFromLowBits(*this, Rn, 16);
+}
+
 } // namespace Dynarmic::A64
@@ -34,6 +34,10 @@ struct TranslationOptions {
     /// If this is false, we treat the instruction as a NOP.
     /// If this is true, we emit an ExceptionRaised instruction.
     bool hook_hint_instructions = true;
+
+    /// Authenticating or stripping a pointer replaces the bits selected by this mask
+    /// with copies of bit 55. Adding a pointer authentication code is a NOP.
+    u64 pointer_authentication_strip_mask = 0;
 };
 
 /**
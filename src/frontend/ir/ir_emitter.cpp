@@ -111,6 +111,10 @@ U1 IREmitter::TestBit(const U32U64& value, const U8& bit) {
     }
 }
 
+U1 IREmitter::ConditionalSelect(Cond cond, const U1& a, const U1& b) {
+    return Inst<U1>(Opcode::ConditionalSelect1, Value{cond}, a, b);
+}
+
 U32 IREmitter::ConditionalSelect(Cond cond, const U32& a, const U32& b) {
     return Inst<U32>(Opcode::ConditionalSelect32, Value{cond}, a, b);
 }
@@ -903,8 +907,40 @@ U128 IREmitter::AESMixColumns(const U128& a) {
     return Inst<U128>(Opcode::AESMixColumns, a);
 }
 
-U8 IREmitter::SM4AccessSubstitutionBox(const U8& a) {
-    return Inst<U8>(Opcode::SM4AccessSubstitutionBox, a);
+U128 IREmitter::SHA1HashUpdateChoose(const U128& x, const U128& y, const U128& w) {
+    return Inst<U128>(Opcode::SHA1HashUpdateChoose, x, y, w);
+}
+
+U128 IREmitter::SHA1HashUpdateMajority(const U128& x, const U128& y, const U128& w) {
+    return Inst<U128>(Opcode::SHA1HashUpdateMajority, x, y, w);
+}
+
+U128 IREmitter::SHA1HashUpdateParity(const U128& x, const U128& y, const U128& w) {
+    return Inst<U128>(Opcode::SHA1HashUpdateParity, x, y, w);
+}
+
+U128 IREmitter::SHA256HashPart1(const U128& x, const U128& y, const U128& w) {
+    return Inst<U128>(Opcode::SHA256HashPart1, x, y, w);
+}
+
+U128 IREmitter::SHA256HashPart2(const U128& x, const U128& y, const U128& w) {
+    return Inst<U128>(Opcode::SHA256HashPart2, x, y, w);
+}
+
+U128 IREmitter::SHA256MessageSchedule0(const U128& d, const U128& n) {
+    return Inst<U128>(Opcode::SHA256MessageSchedule0, d, n);
+}
+
+U128 IREmitter::SHA256MessageSchedule1(const U128& d, const U128& n, const U128& m) {
+    return Inst<U128>(Opcode::SHA256MessageSchedule1, d, n, m);
+}
+
+U128 IREmitter::SM4EncryptFourRounds(const U128& state, const U128& round_keys) {
+    return Inst<U128>(Opcode::SM4EncryptFourRounds, state, round_keys);
+}
+
+U128 IREmitter::SM4ExpandKeyFourRounds(const U128& state, const U128& constants) {
+    return Inst<U128>(Opcode::SM4ExpandKeyFourRounds, state, constants);
 }
 
 UAny IREmitter::VectorGetElement(size_t esize, const U128& a, size_t index) {
@@ -1725,6 +1761,40 @@ U128 IREmitter::VectorSignedSaturatedNeg(size_t esize, const U128& a) {
     UNREACHABLE();
 }
 
+U128 IREmitter::VectorSignedSaturatedRoundingDoublingMultiplyAccumulate(size_t esize, const U128& addend, const U128& a, const U128& b) {
+    switch (esize) {
+    case 16:
+        return Inst<U128>(Opcode::VectorSignedSaturatedRoundingDoublingMulAdd16, addend, a, b);
+    case 32:
+        return Inst<U128>(Opcode::VectorSignedSaturatedRoundingDoublingMulAdd32, addend, a, b);
+    }
+    UNREACHABLE();
+}
+
+U128 IREmitter::VectorSignedSaturatedRoundingDoublingMultiplySubtract(size_t esize, const U128& addend, const U128& a, const U128& b) {
+    switch (esize) {
+    case 16:
+        return Inst<U128>(Opcode::VectorSignedSaturatedRoundingDoublingMulSub16, addend, a, b);
+    case 32:
+        return Inst<U128>(Opcode::VectorSignedSaturatedRoundingDoublingMulSub32, addend, a, b);
+    }
+    UNREACHABLE();
+}
+
+U128 IREmitter::VectorSignedSaturatedRoundingShiftLeft(size_t esize, const U128& a, const U128& b) {
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorSignedSaturatedRoundingShiftLeft8, a, b);
+    case 16:
+        return Inst<U128>(Opcode::VectorSignedSaturatedRoundingShiftLeft16, a, b);
+    case 32:
+        return Inst<U128>(Opcode::VectorSignedSaturatedRoundingShiftLeft32, a, b);
+    case 64:
+        return Inst<U128>(Opcode::VectorSignedSaturatedRoundingShiftLeft64, a, b);
+    }
+    UNREACHABLE();
+}
+
 U128 IREmitter::VectorSignedSaturatedShiftLeft(size_t esize, const U128& a, const U128& b) {
     switch (esize) {
     case 8:
@@ -1849,6 +1919,20 @@ U128 IREmitter::VectorUnsignedSaturatedNarrow(size_t esize, const U128& a) {
     UNREACHABLE();
 }
 
+U128 IREmitter::VectorUnsignedSaturatedRoundingShiftLeft(size_t esize, const U128& a, const U128& b) {
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorUnsignedSaturatedRoundingShiftLeft8, a, b);
+    case 16:
+        return Inst<U128>(Opcode::VectorUnsignedSaturatedRoundingShiftLeft16, a, b);
+    case 32:
+        return Inst<U128>(Opcode::VectorUnsignedSaturatedRoundingShiftLeft32, a, b);
+    case 64:
+        return Inst<U128>(Opcode::VectorUnsignedSaturatedRoundingShiftLeft64, a, b);
+    }
+    UNREACHABLE();
+}
+
 U128 IREmitter::VectorUnsignedSaturatedShiftLeft(size_t esize, const U128& a, const U128& b) {
     switch (esize) {
     case 8:
@@ -2102,6 +2186,22 @@ U16U32U64 IREmitter::FPRoundInt(const U16U32U64& a, FP::RoundingMode rounding, b
     }
 }
 
+U32U64 IREmitter::FPRoundIntN(const U32U64& a, FP::RoundingMode rounding, size_t intsize) {
+    ASSERT(intsize == 32 || intsize == 64);
+
+    const u8 rounding_value = static_cast<u8>(rounding);
+    const u8 intsize_value = static_cast<u8>(intsize);
+
+    switch (a.GetType()) {
+    case Type::U32:
+        return Inst<U32>(Opcode::FPRoundIntN32, a, rounding_value, intsize_value);
+    case Type::U64:
+        return Inst<U64>(Opcode::FPRoundIntN64, a, rounding_value, intsize_value);
+    default:
+        UNREACHABLE();
+    }
+}
+
 U16U32U64 IREmitter::FPRSqrtEstimate(const U16U32U64& a) {
     switch (a.GetType()) {
     case Type::U16:
@@ -2286,6 +2386,10 @@ U64 IREmitter::FPToFixedU64(const U16U32U64& a, size_t fbits, FP::RoundingMode r
     }
 }
 
+U32 IREmitter::FPToFixedJS(const U64& a) {
+    return Inst<U32>(Opcode::FPDoubleToFixedJS, a);
+}
+
 U32 IREmitter::FPSignedFixedToSingle(const U16U32U64& a, size_t fbits, FP::RoundingMode rounding) {
     ASSERT(fbits <= (a.GetType() == Type::U16 ? 16 : (a.GetType() == Type::U32 ? 32 : 64)));
 
@@ -2372,6 +2476,8 @@ U128 IREmitter::FPVectorAbs(size_t esize, const U128& a) {
 
 U128 IREmitter::FPVectorAdd(size_t esize, const U128& a, const U128& b, bool fpcr_controlled) {
     switch (esize) {
+    case 16:
+        return Inst<U128>(Opcode::FPVectorAdd16, a, b, Imm1(fpcr_controlled));
     case 32:
         return Inst<U128>(Opcode::FPVectorAdd32, a, b, Imm1(fpcr_controlled));
     case 64:
@@ -2382,6 +2488,8 @@ U128 IREmitter::FPVectorAdd(size_t esize, const U128& a, const U128& b, bool fpc
 
 U128 IREmitter::FPVectorDiv(size_t esize, const U128& a, const U128& b, bool fpcr_controlled) {
     switch (esize) {
+    case 16:
+        return Inst<U128>(Opcode::FPVectorDiv16, a, b, Imm1(fpcr_controlled));
     case 32:
         return Inst<U128>(Opcode::FPVectorDiv32, a, b, Imm1(fpcr_controlled));
     case 64:
@@ -2405,6 +2513,8 @@ U128 IREmitter::FPVectorEqual(size_t esize, const U128& a, const U128& b, bool f
 U128 IREmitter::FPVectorFromSignedFixed(size_t esize, const U128& a, size_t fbits, FP::RoundingMode rounding, bool fpcr_controlled) {
     ASSERT(fbits <= esize);
     switch (esize) {
+    case 16:
+        return Inst<U128>(Opcode::FPVectorFromSignedFixed16, a, Imm8(static_cast<u8>(fbits)), Imm8(static_cast<u8>(rounding)), Imm1(fpcr_controlled));
     case 32:
         return Inst<U128>(Opcode::FPVectorFromSignedFixed32, a, Imm8(static_cast<u8>(fbits)), Imm8(static_cast<u8>(rounding)), Imm1(fpcr_controlled));
     case 64:
@@ -2416,6 +2526,8 @@ U128 IREmitter::FPVectorFromSignedFixed(size_t esize, const U128& a, size_t fbit
 U128 IREmitter::FPVectorFromUnsignedFixed(size_t esize, const U128& a, size_t fbits, FP::RoundingMode rounding, bool fpcr_controlled) {
     ASSERT(fbits <= esize);
     switch (esize) {
+    case 16:
+        return Inst<U128>(Opcode::FPVectorFromUnsignedFixed16, a, Imm8(static_cast<u8>(fbits)), Imm8(static_cast<u8>(rounding)), Imm1(fpcr_controlled));
     case 32:
         return Inst<U128>(Opcode::FPVectorFromUnsignedFixed32, a, Imm8(static_cast<u8>(fbits)), Imm8(static_cast<u8>(rounding)), Imm1(fpcr_controlled));
     case 64:
@@ -2426,6 +2538,8 @@ U128 IREmitter::FPVectorFromUnsignedFixed(size_t esize, const U128& a, size_t fb
 
 U128 IREmitter::FPVectorGreater(size_t esize, const U128& a, const U128& b, bool fpcr_controlled) {
     switch (esize) {
+    case 16:
+        return Inst<U128>(Opcode::FPVectorGreater16, a, b, Imm1(fpcr_controlled));
     case 32:
         return Inst<U128>(Opcode::FPVectorGreater32, a, b, Imm1(fpcr_controlled));
     case 64:
@@ -2436,6 +2550,8 @@ U128 IREmitter::FPVectorGreater(size_t esize, const U128& a, const U128& b, bool
 
 U128 IREmitter::FPVectorGreaterEqual(size_t esize, const U128& a, const U128& b, bool fpcr_controlled) {
     switch (esize) {
+    case 16:
+        return Inst<U128>(Opcode::FPVectorGreaterEqual16, a, b, Imm1(fpcr_controlled));
     case 32:
         return Inst<U128>(Opcode::FPVectorGreaterEqual32, a, b, Imm1(fpcr_controlled));
     case 64:
@@ -2446,6 +2562,8 @@ U128 IREmitter::FPVectorGreaterEqual(size_t esize, const U128& a, const U128& b,
 
 U128 IREmitter::FPVectorMax(size_t esize, const U128& a, const U128& b, bool fpcr_controlled) {
     switch (esize) {
+    case 16:
+        return Inst<U128>(Opcode::FPVectorMax16, a, b, Imm1(fpcr_controlled));
     case 32:
         return Inst<U128>(Opcode::FPVectorMax32, a, b, Imm1(fpcr_controlled));
     case 64:
@@ -2456,6 +2574,8 @@ U128 IREmitter::FPVectorMax(size_t esize, const U128& a, const U128& b, bool fpc
 
 U128 IREmitter::FPVectorMin(size_t esize, const U128& a, const U128& b, bool fpcr_controlled) {
     switch (esize) {
+    case 16:
+        return Inst<U128>(Opcode::FPVectorMin16, a, b, Imm1(fpcr_controlled));
     case 32:
         return Inst<U128>(Opcode::FPVectorMin32, a, b, Imm1(fpcr_controlled));
     case 64:
@@ -2466,6 +2586,8 @@ U128 IREmitter::FPVectorMin(size_t esize, const U128& a, const U128& b, bool fpc
 
 U128 IREmitter::FPVectorMul(size_t esize, const U128& a, const U128& b, bool fpcr_controlled) {
     switch (esize) {
+    case 16:
+        return Inst<U128>(Opcode::FPVectorMul16, a, b, Imm1(fpcr_controlled));
     case 32:
         return Inst<U128>(Opcode::FPVectorMul32, a, b, Imm1(fpcr_controlled));
     case 64:
@@ -2486,6 +2608,14 @@ U128 IREmitter::FPVectorMulAdd(size_t esize, const U128& a, const U128& b, const
     UNREACHABLE();
 }
 
+U128 IREmitter::FPVectorMulAddLong(size_t esize, const U128& a, const U128& b, const U128& c, bool fpcr_controlled) {
+    switch (esize) {
+    case 32:
+        return Inst<U128>(Opcode::FPVectorMulAddLong32, a, b, c, Imm1(fpcr_controlled));
+    }
+    UNREACHABLE();
+}
+
 U128 IREmitter::FPVectorMulX(size_t esize, const U128& a, const U128& b, bool fpcr_controlled) {
     switch (esize) {
     case 32:
@@ -2567,6 +2697,21 @@ U128 IREmitter::FPVectorRoundInt(size_t esize, const U128& operand, FP::Rounding
     UNREACHABLE();
 }
 
+U128 IREmitter::FPVectorRoundIntN(size_t esize, const U128& operand, FP::RoundingMode rounding, size_t intsize, bool fpcr_controlled) {
+    ASSERT(intsize == 32 || intsize == 64);
+
+    const IR::U8 rounding_imm = Imm8(static_cast<u8>(rounding));
+    const IR::U8 intsize_imm = Imm8(static_cast<u8>(intsize));
+
+    switch (esize) {
+    case 32:
+        return Inst<U128>(Opcode::FPVectorRoundIntN32, operand, rounding_imm, intsize_imm, Imm1(fpcr_controlled));
+    case 64:
+        return Inst<U128>(Opcode::FPVectorRoundIntN64, operand, rounding_imm, intsize_imm, Imm1(fpcr_controlled));
+    }
+    UNREACHABLE();
+}
+
 U128 IREmitter::FPVectorRSqrtEstimate(size_t esize, const U128& a, bool fpcr_controlled) {
     switch (esize) {
     case 16:
@@ -2593,6 +2738,8 @@ U128 IREmitter::FPVectorRSqrtStepFused(size_t esize, const U128& a, const U128&
 
 U128 IREmitter::FPVectorSqrt(size_t esize, const U128& a, bool fpcr_controlled) {
     switch (esize) {
+    case 16:
+        return Inst<U128>(Opcode::FPVectorSqrt16, a, Imm1(fpcr_controlled));
     case 32:
         return Inst<U128>(Opcode::FPVectorSqrt32, a, Imm1(fpcr_controlled));
     case 64:
@@ -2603,6 +2750,8 @@ U128 IREmitter::FPVectorSqrt(size_t esize, const U128& a, bool fpcr_controlled)
 
 U128 IREmitter::FPVectorSub(size_t esize, const U128& a, const U128& b, bool fpcr_controlled) {
     switch (esize) {
+    case 16:
+        return Inst<U128>(Opcode::FPVectorSub16, a, b, Imm1(fpcr_controlled));
     case 32:
         return Inst<U128>(Opcode::FPVectorSub32, a, b, Imm1(fpcr_controlled));
     case 64:
@@ -66,6 +66,10 @@ enum class MemOp {
     LOAD, STORE, PREFETCH,
 };
 
+enum class MemAtomicOp {
+    ADD, BIC, EOR, ORR, SMAX, SMIN, UMAX, UMIN, SWP,
+};
+
 /**
  * Convenience class to construct a basic block of the intermediate representation.
  * `block` is the resulting block.
@@ -97,6 +101,7 @@ public:
     U1 IsZero(const U64& value);
     U1 IsZero(const U32U64& value);
     U1 TestBit(const U32U64& value, const U8& bit);
+    U1 ConditionalSelect(Cond cond, const U1& a, const U1& b);
     U32 ConditionalSelect(Cond cond, const U32& a, const U32& b);
     U64 ConditionalSelect(Cond cond, const U64& a, const U64& b);
     NZCV ConditionalSelect(Cond cond, const NZCV& a, const NZCV& b);
@@ -220,7 +225,16 @@ public:
     U128 AESInverseMixColumns(const U128& a);
     U128 AESMixColumns(const U128& a);
 
-    U8 SM4AccessSubstitutionBox(const U8& a);
+    U128 SHA1HashUpdateChoose(const U128& x, const U128& y, const U128& w);
+    U128 SHA1HashUpdateMajority(const U128& x, const U128& y, const U128& w);
+    U128 SHA1HashUpdateParity(const U128& x, const U128& y, const U128& w);
+    U128 SHA256HashPart1(const U128& x, const U128& y, const U128& w);
+    U128 SHA256HashPart2(const U128& x, const U128& y, const U128& w);
+    U128 SHA256MessageSchedule0(const U128& d, const U128& n);
+    U128 SHA256MessageSchedule1(const U128& d, const U128& n, const U128& m);
+
+    U128 SM4EncryptFourRounds(const U128& state, const U128& round_keys);
+    U128 SM4ExpandKeyFourRounds(const U128& state, const U128& constants);
 
     UAny VectorGetElement(size_t esize, const U128& a, size_t index);
     U128 VectorSetElement(size_t esize, const U128& a, size_t index, const UAny& elem);
@@ -296,6 +310,9 @@ public:
     U128 VectorSignedSaturatedNarrowToSigned(size_t original_esize, const U128& a);
     U128 VectorSignedSaturatedNarrowToUnsigned(size_t original_esize, const U128& a);
     U128 VectorSignedSaturatedNeg(size_t esize, const U128& a);
+    U128 VectorSignedSaturatedRoundingDoublingMultiplyAccumulate(size_t esize, const U128& addend, const U128& a, const U128& b);
+    U128 VectorSignedSaturatedRoundingDoublingMultiplySubtract(size_t esize, const U128& addend, const U128& a, const U128& b);
+    U128 VectorSignedSaturatedRoundingShiftLeft(size_t esize, const U128& a, const U128& b);
     U128 VectorSignedSaturatedShiftLeft(size_t esize, const U128& a, const U128& b);
     U128 VectorSignedSaturatedShiftLeftUnsigned(size_t esize, const U128& a, const U128& b);
     U128 VectorSub(size_t esize, const U128& a, const U128& b);
@@ -309,6 +326,7 @@ public:
     U128 VectorUnsignedRecipSqrtEstimate(const U128& a);
     U128 VectorUnsignedSaturatedAccumulateSigned(size_t esize, const U128& a, const U128& b);
     U128 VectorUnsignedSaturatedNarrow(size_t esize, const U128& a);
+    U128 VectorUnsignedSaturatedRoundingShiftLeft(size_t esize, const U128& a, const U128& b);
     U128 VectorUnsignedSaturatedShiftLeft(size_t esize, const U128& a, const U128& b);
     U128 VectorZeroExtend(size_t original_esize, const U128& a);
     U128 VectorZeroUpper(const U128& a);
@@ -330,6 +348,7 @@ public:
     U16U32U64 FPRecipExponent(const U16U32U64& a);
     U16U32U64 FPRecipStepFused(const U16U32U64& a, const U16U32U64& b);
     U16U32U64 FPRoundInt(const U16U32U64& a, FP::RoundingMode rounding, bool exact);
+    U32U64 FPRoundIntN(const U32U64& a, FP::RoundingMode rounding, size_t intsize);
     U16U32U64 FPRSqrtEstimate(const U16U32U64& a);
     U16U32U64 FPRSqrtStepFused(const U16U32U64& a, const U16U32U64& b);
     U32U64 FPSqrt(const U32U64& a);
@@ -346,6 +365,7 @@ public:
     U16 FPToFixedU16(const U16U32U64& a, size_t fbits, FP::RoundingMode rounding);
     U32 FPToFixedU32(const U16U32U64& a, size_t fbits, FP::RoundingMode rounding);
     U64 FPToFixedU64(const U16U32U64& a, size_t fbits, FP::RoundingMode rounding);
+    U32 FPToFixedJS(const U64& a);
     U32 FPSignedFixedToSingle(const U16U32U64& a, size_t fbits, FP::RoundingMode rounding);
     U32 FPUnsignedFixedToSingle(const U16U32U64& a, size_t fbits, FP::RoundingMode rounding);
     U64 FPSignedFixedToDouble(const U16U32U64& a, size_t fbits, FP::RoundingMode rounding);
@@ -363,6 +383,7 @@ public:
     U128 FPVectorMin(size_t esize, const U128& a, const U128& b, bool fpcr_controlled = true);
     U128 FPVectorMul(size_t esize, const U128& a, const U128& b, bool fpcr_controlled = true);
     U128 FPVectorMulAdd(size_t esize, const U128& addend, const U128& op1, const U128& op2, bool fpcr_controlled = true);
+    U128 FPVectorMulAddLong(size_t esize, const U128& addend, const U128& op1, const U128& op2, bool fpcr_controlled = true);
     U128 FPVectorMulX(size_t esize, const U128& a, const U128& b, bool fpcr_controlled = true);
     U128 FPVectorNeg(size_t esize, const U128& a);
     U128 FPVectorPairedAdd(size_t esize, const U128& a, const U128& b, bool fpcr_controlled = true);
@@ -370,6 +391,7 @@ public:
     U128 FPVectorRecipEstimate(size_t esize, const U128& a, bool fpcr_controlled = true);
     U128 FPVectorRecipStepFused(size_t esize, const U128& a, const U128& b, bool fpcr_controlled = true);
     U128 FPVectorRoundInt(size_t esize, const U128& operand, FP::RoundingMode rounding, bool exact, bool fpcr_controlled = true);
+    U128 FPVectorRoundIntN(size_t esize, const U128& operand, FP::RoundingMode rounding, size_t intsize, bool fpcr_controlled = true);
     U128 FPVectorRSqrtEstimate(size_t esize, const U128& a, bool fpcr_controlled = true);
     U128 FPVectorRSqrtStepFused(size_t esize, const U128& a, const U128& b, bool fpcr_controlled = true);
     U128 FPVectorSqrt(size_t esize, const U128& a, bool fpcr_controlled = true);
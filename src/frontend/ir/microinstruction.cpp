@@ -8,6 +8,7 @@
 #include <fmt/ostream.h>
 
 #include "common/assert.h"
+#include "frontend/ir/cond.h"
 #include "frontend/ir/microinstruction.h"
 #include "frontend/ir/opcodes.h"
 #include "frontend/ir/type.h"
@@ -65,11 +66,14 @@ bool Inst::IsSharedMemoryRead() const {
     case Opcode::A32ReadMemory16:
     case Opcode::A32ReadMemory32:
     case Opcode::A32ReadMemory64:
+    case Opcode::A32ReadMemoryPair32:
     case Opcode::A64ReadMemory8:
     case Opcode::A64ReadMemory16:
     case Opcode::A64ReadMemory32:
     case Opcode::A64ReadMemory64:
     case Opcode::A64ReadMemory128:
+    case Opcode::A64ReadMemoryPair32:
+    case Opcode::A64ReadMemoryPair64:
         return true;
 
     default:
@@ -83,11 +87,14 @@ bool Inst::IsSharedMemoryWrite() const {
     case Opcode::A32WriteMemory16:
     case Opcode::A32WriteMemory32:
     case Opcode::A32WriteMemory64:
+    case Opcode::A32WriteMemoryPair32:
     case Opcode::A64WriteMemory8:
     case Opcode::A64WriteMemory16:
     case Opcode::A64WriteMemory32:
     case Opcode::A64WriteMemory64:
     case Opcode::A64WriteMemory128:
+    case Opcode::A64WriteMemoryPair32:
+    case Opcode::A64WriteMemoryPair64:
         return true;
 
     default:
@@ -135,12 +142,30 @@ bool Inst::IsExclusiveMemoryWrite() const {
     }
 }
 
+bool Inst::IsAtomicMemoryReadModifyWrite() const {
+    switch (op) {
+    case Opcode::A64AtomicMemoryOperation8:
+    case Opcode::A64AtomicMemoryOperation16:
+    case Opcode::A64AtomicMemoryOperation32:
+    case Opcode::A64AtomicMemoryOperation64:
+    case Opcode::A64CompareAndSwapMemory8:
+    case Opcode::A64CompareAndSwapMemory16:
+    case Opcode::A64CompareAndSwapMemory32:
+    case Opcode::A64CompareAndSwapMemory64:
+    case Opcode::A64CompareAndSwapMemory128:
+        return true;
+
+    default:
+        return false;
+    }
+}
+
 bool Inst::IsMemoryRead() const {
-    return IsSharedMemoryRead() || IsExclusiveMemoryRead();
+    return IsSharedMemoryRead() || IsExclusiveMemoryRead() || IsAtomicMemoryReadModifyWrite();
 }
 
 bool Inst::IsMemoryWrite() const {
-    return IsSharedMemoryWrite() || IsExclusiveMemoryWrite();
+    return IsSharedMemoryWrite() || IsExclusiveMemoryWrite() || IsAtomicMemoryReadModifyWrite();
 }
 
 bool Inst::IsMemoryReadOrWrite() const {
@@ -157,11 +182,25 @@ bool Inst::ReadsFromCPSR() const {
     case Opcode::A32GetGEFlags:
     case Opcode::A64GetCFlag:
     case Opcode::A64GetNZCVRaw:
+    case Opcode::ConditionalSelect1:
     case Opcode::ConditionalSelect32:
     case Opcode::ConditionalSelect64:
     case Opcode::ConditionalSelectNZCV:
         return true;
 
+    case Opcode::A32ReadMemory8:
+    case Opcode::A32ReadMemory16:
+    case Opcode::A32ReadMemory32:
+    case Opcode::A32ReadMemory64:
+    case Opcode::A32ReadMemoryPair32:
+    case Opcode::A32WriteMemory8:
+    case Opcode::A32WriteMemory16:
+    case Opcode::A32WriteMemory32:
+    case Opcode::A32WriteMemory64:
+    case Opcode::A32WriteMemoryPair32:
+        // Predicated accesses are only performed if their condition passes.
+        return args[NumArgs() - 1].GetCond() != Cond::AL;
+
     default:
         return false;
     }
@@ -319,6 +358,8 @@ bool Inst::ReadsFromAndWritesToFPSRCumulativeExceptionBits() const {
     case Opcode::FPRoundInt16:
     case Opcode::FPRoundInt32:
     case Opcode::FPRoundInt64:
+    case Opcode::FPRoundIntN32:
+    case Opcode::FPRoundIntN64:
     case Opcode::FPRSqrtEstimate16:
     case Opcode::FPRSqrtEstimate32:
     case Opcode::FPRSqrtEstimate64:
@@ -339,6 +380,7 @@ bool Inst::ReadsFromAndWritesToFPSRCumulativeExceptionBits() const {
     case Opcode::FPDoubleToFixedS64:
     case Opcode::FPDoubleToFixedU32:
     case Opcode::FPDoubleToFixedU64:
+    case Opcode::FPDoubleToFixedJS:
     case Opcode::FPHalfToFixedS32:
     case Opcode::FPHalfToFixedS64:
     case Opcode::FPHalfToFixedU32:
@@ -355,26 +397,34 @@ bool Inst::ReadsFromAndWritesToFPSRCumulativeExceptionBits() const {
     case Opcode::FPFixedS32ToDouble:
     case Opcode::FPFixedS64ToDouble:
     case Opcode::FPFixedS64ToSingle:
+    case Opcode::FPVectorAdd16:
     case Opcode::FPVectorAdd32:
     case Opcode::FPVectorAdd64:
+    case Opcode::FPVectorDiv16:
     case Opcode::FPVectorDiv32:
     case Opcode::FPVectorDiv64:
     case Opcode::FPVectorEqual16:
     case Opcode::FPVectorEqual32:
     case Opcode::FPVectorEqual64:
+    case Opcode::FPVectorFromSignedFixed16:
     case Opcode::FPVectorFromSignedFixed32:
     case Opcode::FPVectorFromSignedFixed64:
+    case Opcode::FPVectorFromUnsignedFixed16:
     case Opcode::FPVectorFromUnsignedFixed32:
     case Opcode::FPVectorFromUnsignedFixed64:
+    case Opcode::FPVectorGreater16:
     case Opcode::FPVectorGreater32:
     case Opcode::FPVectorGreater64:
+    case Opcode::FPVectorGreaterEqual16:
     case Opcode::FPVectorGreaterEqual32:
     case Opcode::FPVectorGreaterEqual64:
+    case Opcode::FPVectorMul16:
     case Opcode::FPVectorMul32:
     case Opcode::FPVectorMul64:
     case Opcode::FPVectorMulAdd16:
     case Opcode::FPVectorMulAdd32:
     case Opcode::FPVectorMulAdd64:
+    case Opcode::FPVectorMulAddLong32:
     case Opcode::FPVectorPairedAddLower32:
     case Opcode::FPVectorPairedAddLower64:
     case Opcode::FPVectorPairedAdd32:
@@ -388,14 +438,18 @@ bool Inst::ReadsFromAndWritesToFPSRCumulativeExceptionBits() const {
     case Opcode::FPVectorRoundInt16:
     case Opcode::FPVectorRoundInt32:
     case Opcode::FPVectorRoundInt64:
+    case Opcode::FPVectorRoundIntN32:
+    case Opcode::FPVectorRoundIntN64:
     case Opcode::FPVectorRSqrtEstimate16:
     case Opcode::FPVectorRSqrtEstimate32:
     case Opcode::FPVectorRSqrtEstimate64:
     case Opcode::FPVectorRSqrtStepFused16:
     case Opcode::FPVectorRSqrtStepFused32:
     case Opcode::FPVectorRSqrtStepFused64:
+    case Opcode::FPVectorSqrt16:
     case Opcode::FPVectorSqrt32:
     case Opcode::FPVectorSqrt64:
+    case Opcode::FPVectorSub16:
     case Opcode::FPVectorSub32:
     case Opcode::FPVectorSub64:
     case Opcode::FPVectorToSignedFixed16:
@@ -444,6 +498,14 @@ bool Inst::WritesToFPSRCumulativeSaturationBit() const {
     case Opcode::VectorSignedSaturatedNeg16:
     case Opcode::VectorSignedSaturatedNeg32:
     case Opcode::VectorSignedSaturatedNeg64:
+    case Opcode::VectorSignedSaturatedRoundingDoublingMulAdd16:
+    case Opcode::VectorSignedSaturatedRoundingDoublingMulAdd32:
+    case Opcode::VectorSignedSaturatedRoundingDoublingMulSub16:
+    case Opcode::VectorSignedSaturatedRoundingDoublingMulSub32:
+    case Opcode::VectorSignedSaturatedRoundingShiftLeft8:
+    case Opcode::VectorSignedSaturatedRoundingShiftLeft16:
+    case Opcode::VectorSignedSaturatedRoundingShiftLeft32:
+    case Opcode::VectorSignedSaturatedRoundingShiftLeft64:
     case Opcode::VectorSignedSaturatedShiftLeft8:
     case Opcode::VectorSignedSaturatedShiftLeft16:
     case Opcode::VectorSignedSaturatedShiftLeft32:
@@ -467,6 +529,10 @@ bool Inst::WritesToFPSRCumulativeSaturationBit() const {
     case Opcode::VectorUnsignedSaturatedNarrow16:
     case Opcode::VectorUnsignedSaturatedNarrow32:
     case Opcode::VectorUnsignedSaturatedNarrow64:
+    case Opcode::VectorUnsignedSaturatedRoundingShiftLeft8:
+    case Opcode::VectorUnsignedSaturatedRoundingShiftLeft16:
+    case Opcode::VectorUnsignedSaturatedRoundingShiftLeft32:
+    case Opcode::VectorUnsignedSaturatedRoundingShiftLeft64:
     case Opcode::VectorUnsignedSaturatedShiftLeft8:
     case Opcode::VectorUnsignedSaturatedShiftLeft16:
     case Opcode::VectorUnsignedSaturatedShiftLeft32:
@@ -519,18 +585,19 @@ bool Inst::IsSetCheckBitOperation() const {
 }
 
 bool Inst::MayHaveSideEffects() const {
-    return op == Opcode::PushRSB                        ||
-           op == Opcode::A64DataCacheOperationRaised    ||
-           IsSetCheckBitOperation()                     ||
-           IsBarrier()                                  ||
-           CausesCPUException()                         ||
-           WritesToCoreRegister()                       ||
-           WritesToSystemRegister()                     ||
-           WritesToCPSR()                               ||
-           WritesToFPCR()                               ||
-           WritesToFPSR()                               ||
-           AltersExclusiveState()                       ||
-           IsMemoryWrite()                              ||
+    return op == Opcode::PushRSB                          ||
+           op == Opcode::A32UpdateUpperLocationDescriptor ||
+           op == Opcode::A64DataCacheOperationRaised      ||
+           IsSetCheckBitOperation()                       ||
+           IsBarrier()                                    ||
+           CausesCPUException()                           ||
+           WritesToCoreRegister()                         ||
+           WritesToSystemRegister()                       ||
+           WritesToCPSR()                                 ||
+           WritesToFPCR()                                 ||
+           WritesToFPSR()                                 ||
+           AltersExclusiveState()                         ||
+           IsMemoryWrite()                                ||
            IsCoprocessorInstruction();
 }
 
@@ -563,6 +630,7 @@ bool Inst::MayGetNZCVFromOp() const {
     case Opcode::Or64:
     case Opcode::Not32:
     case Opcode::Not64:
+    case Opcode::FPDoubleToFixedJS:
         return true;
 
     default:
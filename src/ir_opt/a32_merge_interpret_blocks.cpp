@@ -4,13 +4,13 @@
  * General Public License version 2 or any later version.
  */
 
-#include <array>
+#include <algorithm>
+#include <tuple>
 
 #include <boost/variant/get.hpp>
 
 #include "common/assert.h"
 #include "common/common_types.h"
-#include "dynarmic/A32/config.h"
 #include "frontend/A32/location_descriptor.h"
 #include "frontend/A32/translate/translate.h"
 #include "frontend/ir/basic_block.h"
@@ -18,23 +18,47 @@
 
 namespace Dynarmic::Optimization {
 
-void A32MergeInterpretBlocksPass(IR::Block& block, A32::UserCallbacks* cb) {
-    const auto is_interpret_instruction = [cb](A32::LocationDescriptor location) {
-        const u32 instruction = cb->MemoryReadCode(location.PC());
+namespace {
 
-        IR::Block new_block{location};
-        A32::TranslateSingleInstruction(new_block, location, instruction);
+enum class InstructionKind {
+    /// Instruction is handed to UserCallbacks::InterpreterFallback.
+    Interpret,
+    /// Instruction has an IR translation and does not end a block.
+    Translatable,
+    /// Instruction ends a block or has effects which must not be moved into the interpreter.
+    Other,
+};
 
-        if (!new_block.Instructions().empty())
-            return false;
+/// Classifies the instruction at location, and returns the location of the instruction after it.
+/// This must translate exactly as the Jit does, or translatable instructions could be interpreted.
+std::tuple<InstructionKind, A32::LocationDescriptor> ClassifyInstruction(A32::LocationDescriptor location, const std::function<u32(u32)>& memory_read_code, const A32::TranslationOptions& options) {
+    const IR::Block block = A32::Translate(location.SetSingleStepping(true), memory_read_code, options);
+    const A32::LocationDescriptor next = A32::LocationDescriptor{block.EndLocation()}.SetSingleStepping(false);
+    const IR::Terminal terminal = block.GetTerminal();
 
-        const IR::Terminal terminal = new_block.GetTerminal();
-        if (auto term = boost::get<IR::Term::Interpret>(&terminal)) {
-            return term->next == location;
+    if (auto term = boost::get<IR::Term::Interpret>(&terminal)) {
+        const bool is_interpret = block.Instructions().empty() && A32::LocationDescriptor{term->next}.SetSingleStepping(false) == location;
+        return {is_interpret ? InstructionKind::Interpret : InstructionKind::Other, next};
+    }
+
+    if (auto term = boost::get<IR::Term::LinkBlock>(&terminal)) {
+        const bool has_effects = std::any_of(block.begin(), block.end(), [](const IR::Inst& inst) {
+            return inst.CausesCPUException() || inst.IsCoprocessorInstruction() || inst.IsBarrier();
+        });
+        if (!has_effects && A32::LocationDescriptor{term->next}.SetSingleStepping(false) == next) {
+            return {InstructionKind::Translatable, next};
         }
+    }
+
+    return {InstructionKind::Other, next};
+}
+
+} // anonymous namespace
 
-        return false;
-    };
+void A32MergeInterpretBlocksPass(IR::Block& block, const std::function<u32(u32)>& memory_read_code, const A32::TranslationOptions& options) {
+    // Up to this many translatable instructions may be handed to the interpreter along with the
+    // instructions around them, if that saves a round trip through the dispatcher.
+    constexpr size_t max_bridged_instructions = 4;
 
     IR::Terminal terminal = block.GetTerminal();
     auto term = boost::get<IR::Term::Interpret>(&terminal);
@@ -42,12 +66,28 @@ void A32MergeInterpretBlocksPass(IR::Block& block, A32::UserCallbacks* cb) {
         return;
 
     A32::LocationDescriptor location{term->next};
-    size_t num_instructions = 1;
+    if (location.SingleStepping())
+        return;
+
+    size_t num_instructions = 0;
+    size_t num_bridged = 0;
 
-    while (is_interpret_instruction(location.AdvancePC(static_cast<int>(num_instructions * 4)))) {
-        num_instructions++;
+    while (true) {
+        const auto [kind, next] = ClassifyInstruction(location, memory_read_code, options);
+        if (kind == InstructionKind::Interpret) {
+            num_instructions += num_bridged + 1;
+            num_bridged = 0;
+        } else if (kind == InstructionKind::Translatable && num_instructions > 0 && num_bridged < max_bridged_instructions) {
+            num_bridged++;
+        } else {
+            break;
+        }
+        location = next;
     }
 
+    if (num_instructions <= 1)
+        return;
+
     term->num_instructions = num_instructions;
     block.ReplaceTerminal(terminal);
     block.CycleCount() += num_instructions - 1;
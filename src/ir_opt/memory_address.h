@@ -0,0 +1,134 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#pragma once
+
+#include <optional>
+
+#include "common/common_types.h"
+#include "frontend/ir/cond.h"
+#include "frontend/ir/microinstruction.h"
+#include "frontend/ir/opcodes.h"
+#include "frontend/ir/type.h"
+#include "frontend/ir/value.h"
+
+namespace Dynarmic::Optimization {
+
+/// A memory address expressed as base + offset, where base is either an instruction
+/// or (when nullptr) the constant zero. Offsets are kept modulo the address width.
+struct MemoryAddress {
+    IR::Inst* base;
+    u64 offset;
+    u64 mask;
+};
+
+/// Number of bytes accessed by a non-exclusive memory access instruction.
+inline std::optional<size_t> MemoryAccessSize(IR::Opcode op) {
+    switch (op) {
+    case IR::Opcode::A32ReadMemory8:
+    case IR::Opcode::A32WriteMemory8:
+    case IR::Opcode::A64ReadMemory8:
+    case IR::Opcode::A64WriteMemory8:
+        return 1;
+    case IR::Opcode::A32ReadMemory16:
+    case IR::Opcode::A32WriteMemory16:
+    case IR::Opcode::A64ReadMemory16:
+    case IR::Opcode::A64WriteMemory16:
+        return 2;
+    case IR::Opcode::A32ReadMemory32:
+    case IR::Opcode::A32WriteMemory32:
+    case IR::Opcode::A64ReadMemory32:
+    case IR::Opcode::A64WriteMemory32:
+        return 4;
+    case IR::Opcode::A32ReadMemory64:
+    case IR::Opcode::A32WriteMemory64:
+    case IR::Opcode::A32ReadMemoryPair32:
+    case IR::Opcode::A32WriteMemoryPair32:
+    case IR::Opcode::A64ReadMemory64:
+    case IR::Opcode::A64WriteMemory64:
+    case IR::Opcode::A64ReadMemoryPair32:
+    case IR::Opcode::A64WriteMemoryPair32:
+        return 8;
+    case IR::Opcode::A64ReadMemory128:
+    case IR::Opcode::A64WriteMemory128:
+    case IR::Opcode::A64ReadMemoryPair64:
+    case IR::Opcode::A64WriteMemoryPair64:
+        return 16;
+    default:
+        return std::nullopt;
+    }
+}
+
+/// Condition under which a non-exclusive memory access instruction is performed.
+/// A32 accesses of predicated instructions carry it as their last argument.
+inline IR::Cond MemoryAccessCond(const IR::Inst& inst) {
+    const IR::Value cond = inst.GetArg(inst.NumArgs() - 1);
+    return cond.GetType() == IR::Type::Cond ? cond.GetCond() : IR::Cond::AL;
+}
+
+inline MemoryAddress DecomposeMemoryAddress(IR::Value value, u64 mask) {
+    if (value.IsImmediate()) {
+        return {nullptr, value.GetImmediateAsU64() & mask, mask};
+    }
+
+    IR::Inst* inst = value.GetInstRecursive();
+    switch (inst->GetOpcode()) {
+    case IR::Opcode::Add32:
+    case IR::Opcode::Add64: {
+        if (!inst->GetArg(2).IsZero()) {
+            break;
+        }
+        if (inst->GetArg(1).IsImmediate()) {
+            const MemoryAddress base = DecomposeMemoryAddress(inst->GetArg(0), mask);
+            return {base.base, (base.offset + inst->GetArg(1).GetImmediateAsU64()) & mask, mask};
+        }
+        if (inst->GetArg(0).IsImmediate()) {
+            const MemoryAddress base = DecomposeMemoryAddress(inst->GetArg(1), mask);
+            return {base.base, (base.offset + inst->GetArg(0).GetImmediateAsU64()) & mask, mask};
+        }
+        break;
+    }
+    case IR::Opcode::Sub32:
+    case IR::Opcode::Sub64: {
+        if (!inst->GetArg(2).IsUnsignedImmediate(1) || !inst->GetArg(1).IsImmediate()) {
+            break;
+        }
+        const MemoryAddress base = DecomposeMemoryAddress(inst->GetArg(0), mask);
+        return {base.base, (base.offset - inst->GetArg(1).GetImmediateAsU64()) & mask, mask};
+    }
+    default:
+        break;
+    }
+
+    return {inst, 0, mask};
+}
+
+/// Decomposes the address operand (argument 0) of a memory access instruction.
+inline MemoryAddress DecomposeMemoryAddress(const IR::Inst& inst) {
+    const IR::Value vaddr = inst.GetArg(0);
+    const u64 mask = vaddr.GetType() == IR::Type::U32 ? 0xFFFFFFFF : 0xFFFFFFFFFFFFFFFF;
+    return DecomposeMemoryAddress(vaddr, mask);
+}
+
+/// Determines if two accesses may touch the same byte. Accesses from unrelated bases may alias.
+inline bool MayOverlap(const MemoryAddress& a, size_t a_size, const MemoryAddress& b, size_t b_size) {
+    if (a.base != b.base) {
+        return true;
+    }
+    return ((b.offset - a.offset) & a.mask) < a_size || ((a.offset - b.offset) & a.mask) < b_size;
+}
+
+/// Determines if this instruction ends a window in which memory contents may be assumed
+/// to only be modified by the memory access instructions of this block.
+inline bool EndsMemoryWindow(const IR::Inst& inst) {
+    return inst.IsBarrier()
+        || inst.CausesCPUException()
+        || inst.AltersExclusiveState()
+        || inst.IsAtomicMemoryReadModifyWrite()
+        || inst.IsCoprocessorInstruction()
+        || inst.GetOpcode() == IR::Opcode::A64DataCacheOperationRaised;
+}
+
+} // namespace Dynarmic::Optimization
@@ -0,0 +1,75 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include "common/assert.h"
+#include "common/common_types.h"
+#include "frontend/ir/basic_block.h"
+#include "frontend/ir/value.h"
+#include "ir_opt/memory_address.h"
+#include "ir_opt/passes.h"
+
+namespace Dynarmic::Optimization {
+
+namespace {
+
+/// A range of memory whose contents are known to be equal to value.
+struct KnownValue {
+    MemoryAddress address;
+    size_t size;
+    IR::Value value;
+};
+
+bool IsSameAccess(const MemoryAddress& a, size_t a_size, const MemoryAddress& b, size_t b_size) {
+    return a.base == b.base && a.offset == b.offset && a_size == b_size;
+}
+
+} // anonymous namespace
+
+void MemoryForwardingPass(IR::Block& block) {
+    std::vector<KnownValue> known_values;
+
+    for (auto& inst : block) {
+        if (EndsMemoryWindow(inst)) {
+            known_values.clear();
+            continue;
+        }
+
+        const auto size = MemoryAccessSize(inst.GetOpcode());
+        if (!size) {
+            continue;
+        }
+
+        const MemoryAddress address = DecomposeMemoryAddress(inst);
+        // Predicated accesses may not happen, so they tell us nothing about memory afterwards.
+        const bool is_predicated = MemoryAccessCond(inst) != IR::Cond::AL;
+
+        if (inst.IsSharedMemoryRead()) {
+            const auto iter = std::find_if(known_values.begin(), known_values.end(), [&](const KnownValue& known) {
+                return IsSameAccess(known.address, known.size, address, *size);
+            });
+
+            if (iter != known_values.end()) {
+                inst.ReplaceUsesWith(iter->value);
+            } else if (!is_predicated) {
+                known_values.push_back({address, *size, IR::Value{&inst}});
+            }
+            continue;
+        }
+
+        ASSERT(inst.IsSharedMemoryWrite());
+
+        known_values.erase(std::remove_if(known_values.begin(), known_values.end(), [&](const KnownValue& known) {
+            return MayOverlap(known.address, known.size, address, *size);
+        }), known_values.end());
+        if (!is_predicated) {
+            known_values.push_back({address, *size, inst.GetArg(1)});
+        }
+    }
+}
+
+} // namespace Dynarmic::Optimization
@@ -0,0 +1,113 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include <optional>
+
+#include "common/common_types.h"
+#include "frontend/ir/basic_block.h"
+#include "frontend/ir/opcodes.h"
+#include "frontend/ir/value.h"
+#include "ir_opt/memory_address.h"
+#include "ir_opt/passes.h"
+
+namespace Dynarmic::Optimization {
+
+namespace {
+
+std::optional<IR::Opcode> PairedOpcode(IR::Opcode op) {
+    switch (op) {
+    case IR::Opcode::A32ReadMemory32:
+        return IR::Opcode::A32ReadMemoryPair32;
+    case IR::Opcode::A32WriteMemory32:
+        return IR::Opcode::A32WriteMemoryPair32;
+    case IR::Opcode::A64ReadMemory32:
+        return IR::Opcode::A64ReadMemoryPair32;
+    case IR::Opcode::A64ReadMemory64:
+        return IR::Opcode::A64ReadMemoryPair64;
+    case IR::Opcode::A64WriteMemory32:
+        return IR::Opcode::A64WriteMemoryPair32;
+    case IR::Opcode::A64WriteMemory64:
+        return IR::Opcode::A64WriteMemoryPair64;
+    default:
+        return std::nullopt;
+    }
+}
+
+/// Replaces two adjacent reads with a single paired read at the position of the first.
+void PairReads(IR::Block& block, IR::Inst& lo, IR::Inst& hi, IR::Opcode pair_op, size_t size) {
+    const IR::Block::iterator insertion_point{lo};
+    const IR::Value pair{&*(lo.NumArgs() == 1
+                             ? block.PrependNewInst(insertion_point, pair_op, {lo.GetArg(0)})
+                             : block.PrependNewInst(insertion_point, pair_op, {lo.GetArg(0), lo.GetArg(1)}))};
+
+    if (size == 4) {
+        lo.ReplaceUsesWith(IR::Value{&*block.PrependNewInst(insertion_point, IR::Opcode::LeastSignificantWord, {pair})});
+        hi.ReplaceUsesWith(IR::Value{&*block.PrependNewInst(insertion_point, IR::Opcode::MostSignificantWord, {pair})});
+    } else {
+        lo.ReplaceUsesWith(IR::Value{&*block.PrependNewInst(insertion_point, IR::Opcode::VectorGetElement64, {pair, IR::Value{u8(0)}})});
+        hi.ReplaceUsesWith(IR::Value{&*block.PrependNewInst(insertion_point, IR::Opcode::VectorGetElement64, {pair, IR::Value{u8(1)}})});
+    }
+}
+
+/// Replaces two adjacent writes with a single paired write at the position of the second.
+void PairWrites(IR::Block& block, IR::Inst& lo, IR::Inst& hi, IR::Opcode pair_op, size_t size) {
+    const IR::Block::iterator insertion_point{hi};
+    const IR::Opcode pack_op = size == 4 ? IR::Opcode::Pack2x32To1x64 : IR::Opcode::Pack2x64To1x128;
+    const IR::Value value{&*block.PrependNewInst(insertion_point, pack_op, {lo.GetArg(1), hi.GetArg(1)})};
+
+    if (lo.NumArgs() == 2) {
+        block.PrependNewInst(insertion_point, pair_op, {lo.GetArg(0), value});
+    } else {
+        block.PrependNewInst(insertion_point, pair_op, {lo.GetArg(0), value, lo.GetArg(2)});
+    }
+
+    lo.Invalidate();
+    hi.Invalidate();
+}
+
+} // anonymous namespace
+
+void MemoryPairingPass(IR::Block& block) {
+    IR::Inst* pending = nullptr;
+    MemoryAddress pending_address{};
+
+    for (auto& inst : block) {
+        const auto pair_op = PairedOpcode(inst.GetOpcode());
+        if (!pair_op) {
+            if (inst.IsMemoryReadOrWrite() || EndsMemoryWindow(inst)) {
+                pending = nullptr;
+            }
+            // The condition of a predicated access must be evaluated against the same flags.
+            if (pending && inst.WritesToCPSR() && MemoryAccessCond(*pending) != IR::Cond::AL) {
+                pending = nullptr;
+            }
+            continue;
+        }
+
+        const size_t size = *MemoryAccessSize(inst.GetOpcode());
+        const MemoryAddress address = DecomposeMemoryAddress(inst);
+
+        const bool is_adjacent = pending
+                              && pending->GetOpcode() == inst.GetOpcode()
+                              && MemoryAccessCond(*pending) == MemoryAccessCond(inst)
+                              && pending_address.base == address.base
+                              && ((address.offset - pending_address.offset) & address.mask) == size;
+
+        if (!is_adjacent) {
+            pending = &inst;
+            pending_address = address;
+            continue;
+        }
+
+        if (inst.IsSharedMemoryRead()) {
+            PairReads(block, *pending, inst, *pair_op, size);
+        } else {
+            PairWrites(block, *pending, inst, *pair_op, size);
+        }
+        pending = nullptr;
+    }
+}
+
+} // namespace Dynarmic::Optimization
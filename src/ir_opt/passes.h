@@ -5,7 +5,12 @@
 
 #pragma once
 
+#include <functional>
+
+#include "common/common_types.h"
+
 namespace Dynarmic::A32 {
+struct TranslationOptions;
 struct UserCallbacks;
 }
 
@@ -22,12 +27,14 @@ namespace Dynarmic::Optimization {
 
 void A32ConstantMemoryReads(IR::Block& block, A32::UserCallbacks* cb);
 void A32GetSetElimination(IR::Block& block);
-void A32MergeInterpretBlocksPass(IR::Block& block, A32::UserCallbacks* cb);
+void A32MergeInterpretBlocksPass(IR::Block& block, const std::function<u32(u32)>& memory_read_code, const A32::TranslationOptions& options);
 void A64CallbackConfigPass(IR::Block& block, const A64::UserConfig& conf);
 void A64GetSetElimination(IR::Block& block);
 void A64MergeInterpretBlocksPass(IR::Block& block, A64::UserCallbacks* cb);
 void ConstantPropagation(IR::Block& block);
 void DeadCodeElimination(IR::Block& block);
+void MemoryForwardingPass(IR::Block& block);
+void MemoryPairingPass(IR::Block& block);
 void IdentityRemovalPass(IR::Block& block);
 void VerificationPass(const IR::Block& block);
 
@@ -78,6 +78,45 @@ private:
     std::function<bool(u16)> is_valid;
 };
 
+struct Thumb32InstGen final {
+public:
+    Thumb32InstGen(const char* format, std::function<bool(u32)> is_valid = [](u32){ return true; }) : is_valid(is_valid) {
+        REQUIRE(strlen(format) == 32);
+
+        for (int i = 0; i < 32; i++) {
+            const u32 bit = 1U << (31 - i);
+            switch (format[i]) {
+            case '0':
+                mask |= bit;
+                break;
+            case '1':
+                bits |= bit;
+                mask |= bit;
+                break;
+            default:
+                // Do nothing
+                break;
+            }
+        }
+    }
+    u32 Generate() const {
+        u32 inst;
+
+        do {
+            const u32 random = RandInt<u32>(0, 0xFFFFFFFF);
+            inst = bits | (random & ~mask);
+        } while (!is_valid(inst));
+
+        ASSERT((inst & mask) == bits);
+
+        return inst;
+    }
+private:
+    u32 bits = 0;
+    u32 mask = 0;
+    std::function<bool(u32)> is_valid;
+};
+
 static bool DoesBehaviorMatch(const A32Unicorn<ThumbTestEnv>& uni, const A32::Jit& jit,
                               const WriteRecords& interp_write_records, const WriteRecords& jit_write_records) {
     const auto interp_regs = uni.GetRegisters();
@@ -201,6 +240,32 @@ void FuzzJitThumb(const size_t instruction_count, const size_t instructions_to_e
     }
 }
 
+void FuzzJitThumb32(const size_t instruction_count, const size_t instructions_to_execute_count, const size_t run_count, const std::function<u32()> instruction_generator) {
+    ThumbTestEnv test_env;
+
+    // Prepare memory.
+    test_env.code_mem.resize(instruction_count * 2 + 1);
+    test_env.code_mem.back() = 0xE7FE; // b +#0
+
+    // Prepare test subjects
+    A32Unicorn uni{test_env};
+    A32::Jit jit{GetUserConfig(&test_env)};
+
+    for (size_t run_number = 0; run_number < run_count; run_number++) {
+        ThumbTestEnv::RegisterArray initial_regs;
+        std::generate_n(initial_regs.begin(), initial_regs.size() - 1, []{ return RandInt<u32>(0, 0xFFFFFFFF); });
+        initial_regs[15] = 0;
+
+        for (size_t i = 0; i < instruction_count; i++) {
+            const u32 inst = instruction_generator();
+            test_env.code_mem[i * 2 + 0] = static_cast<u16>(inst >> 16);
+            test_env.code_mem[i * 2 + 1] = static_cast<u16>(inst & 0xFFFF);
+        }
+
+        RunInstance(run_number, test_env, uni, jit, initial_regs, instruction_count * 2, instructions_to_execute_count);
+    }
+}
+
 TEST_CASE("Fuzz Thumb instructions set 1", "[JitX64][JitA64][Thumb]") {
     const std::array instructions = {
         ThumbInstGen("00000xxxxxxxxxxx"), // LSL <Rd>, <Rm>, #<imm5>
@@ -312,6 +377,90 @@ TEST_CASE("Fuzz Thumb instructions set 2 (affects PC)", "[JitX64][JitA64][Thumb]
     FuzzJitThumb(1, 1, 10000, instruction_select);
 }
 
+// Rejects encodings that name SP or PC in any of the given four-bit register fields,
+// since those are UNPREDICTABLE or select a different instruction.
+static bool NoSPOrPC(u32 inst, std::initializer_list<size_t> fields) {
+    return std::all_of(fields.begin(), fields.end(), [inst](size_t lsb) {
+        const u32 reg = Common::Bits(lsb, lsb + 3, inst);
+        return reg != 13 && reg != 15;
+    });
+}
+
+TEST_CASE("Fuzz Thumb32 instructions set", "[JitX64][JitA64][Thumb][Thumb32]") {
+    const std::array instructions = {
+        Thumb32InstGen("11101010ooosnnnn0iiiddddiittmmmm", // Data processing (shifted register), logical
+                       [](u32 inst) {
+                           const u32 op = Common::Bits<21, 23>(inst);
+                           return op != 0b101 && op != 0b110 && op != 0b111 && NoSPOrPC(inst, {0, 8, 16});
+                       }),
+        Thumb32InstGen("11101011ooosnnnn0iiiddddiittmmmm", // Data processing (shifted register), arithmetic
+                       [](u32 inst) {
+                           const u32 op = Common::Bits<21, 23>(inst);
+                           return op != 0b001 && op != 0b100 && op != 0b111 && NoSPOrPC(inst, {0, 8, 16});
+                       }),
+        Thumb32InstGen("11110i0ooooxnnnn0iiiddddiiiiiiii", // Data processing (modified immediate)
+                       [](u32 inst) {
+                           const u32 op = Common::Bits<21, 24>(inst);
+                           const bool valid_op = op != 0b0101 && op != 0b0110 && op != 0b0111 && op != 0b1001 &&
+                                                 op != 0b1100 && op != 0b1111;
+                           return valid_op && NoSPOrPC(inst, {8, 16});
+                       }),
+        Thumb32InstGen("11110i100100iiii0iiiddddiiiiiiii", // MOVW
+                       [](u32 inst) { return NoSPOrPC(inst, {8}); }),
+        Thumb32InstGen("11110i101100iiii0iiiddddiiiiiiii", // MOVT
+                       [](u32 inst) { return NoSPOrPC(inst, {8}); }),
+        Thumb32InstGen("111100111100nnnn0iiiddddii0wwwww", // UBFX
+                       [](u32 inst) {
+                           const u32 lsb = (Common::Bits<12, 14>(inst) << 2) | Common::Bits<6, 7>(inst);
+                           const u32 widthm1 = Common::Bits<0, 4>(inst);
+                           return lsb + widthm1 < 32 && NoSPOrPC(inst, {8, 16});
+                       }),
+        Thumb32InstGen("111110100ooxnnnn1111dddd0000mmmm", // LSL/LSR/ASR/ROR (reg)
+                       [](u32 inst) { return NoSPOrPC(inst, {0, 8, 16}); }),
+        Thumb32InstGen("111110110000nnnnaaaadddd000ommmm", // MLA/MLS
+                       [](u32 inst) { return NoSPOrPC(inst, {0, 8, 12, 16}); }),
+        Thumb32InstGen("1111101110o0nnnnllllhhhh0000mmmm", // SMULL/UMULL
+                       [](u32 inst) {
+                           return Common::Bits<8, 11>(inst) != Common::Bits<12, 15>(inst) && NoSPOrPC(inst, {0, 8, 12, 16});
+                       }),
+        Thumb32InstGen("111110101ooonnnn1111dddd0pppmmmm", // Parallel add/subtract
+                       [](u32 inst) {
+                           const u32 op1 = Common::Bits<20, 22>(inst);
+                           const u32 op2 = Common::Bits<4, 6>(inst);
+                           return op1 != 0b011 && op1 != 0b111 && op2 != 0b011 && op2 != 0b111 && NoSPOrPC(inst, {0, 8, 16});
+                       }),
+        Thumb32InstGen("111110110oo0nnnnaaaadddd000Mmmmm", // SMLAD/SMLSD/SMUAD/SMUSD
+                       [](u32 inst) {
+                           const u32 op = Common::Bits<21, 22>(inst);
+                           return (op == 0b01 || op == 0b10) && Common::Bits<12, 15>(inst) != 13 && NoSPOrPC(inst, {0, 8, 16});
+                       }),
+        Thumb32InstGen("111110110111nnnnaaaadddd0000mmmm", // USAD8/USADA8
+                       [](u32 inst) { return Common::Bits<12, 15>(inst) != 13 && NoSPOrPC(inst, {0, 8, 16}); }),
+        Thumb32InstGen("11111011110onnnnllllhhhh110Mmmmm", // SMLALD/SMLSLD
+                       [](u32 inst) {
+                           return Common::Bits<8, 11>(inst) != Common::Bits<12, 15>(inst) && NoSPOrPC(inst, {0, 8, 12, 16});
+                       }),
+        Thumb32InstGen("111100111000nnnn1000mm0000000000", // MSR (reg), APSR_nzcvq/APSR_g
+                       [](u32 inst) { return Common::Bits<10, 11>(inst) != 0 && NoSPOrPC(inst, {16}); }),
+        Thumb32InstGen("11110011111011111000dddd00000000", // MRS (reg)
+                       [](u32 inst) { return NoSPOrPC(inst, {8}); }),
+    };
+
+    const auto instruction_select = [&]() -> u32 {
+        size_t inst_index = RandInt<size_t>(0, instructions.size() - 1);
+
+        return instructions[inst_index].Generate();
+    };
+
+    SECTION("single instructions") {
+        FuzzJitThumb32(1, 2, 10000, instruction_select);
+    }
+
+    SECTION("short blocks") {
+        FuzzJitThumb32(5, 6, 3000, instruction_select);
+    }
+}
+
 TEST_CASE("Verify fix for off by one error in MemoryRead32 worked", "[Thumb]") {
     ThumbTestEnv test_env;
 
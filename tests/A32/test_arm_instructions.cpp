@@ -3,11 +3,23 @@
  * SPDX-License-Identifier: 0BSD
  */
 
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
 #include <catch.hpp>
 #include <dynarmic/A32/a32.h>
 
 #include "A32/testenv.h"
+#include "frontend/A32/FPSCR.h"
 #include "frontend/A32/location_descriptor.h"
+#include "frontend/A32/PSR.h"
+#include "frontend/A32/translate/translate.h"
+#include "frontend/ir/basic_block.h"
 
 using namespace Dynarmic;
 
@@ -510,6 +522,43 @@ TEST_CASE("arm: vcvt.s16.f64", "[arm][A32]") {
 }
 */
 
+TEST_CASE("arm: vshr.s8", "[arm][A32]") {
+    ArmTestEnv test_env;
+    A32::Jit jit{GetUserConfig(&test_env)};
+    test_env.code_mem = {
+        0xf28f0070, // vshr.s8 q0, q8, #1
+        0xf28e2070, // vshr.s8 q1, q8, #2
+        0xf28d4070, // vshr.s8 q2, q8, #3
+        0xf28c6070, // vshr.s8 q3, q8, #4
+        0xf28b8070, // vshr.s8 q4, q8, #5
+        0xf28aa070, // vshr.s8 q5, q8, #6
+        0xf289c070, // vshr.s8 q6, q8, #7
+        0xf288e070, // vshr.s8 q7, q8, #8
+        0xeafffffe, // b +#0
+    };
+
+    // Hosts with GFNI lower these to a single affine transform per shift amount.
+    const std::array<u32, 4> input{0x807F0100, 0x40C0FF81, 0x12EDA55A, 0x7E8201FE};
+    for (size_t i = 0; i < input.size(); i++) {
+        jit.ExtRegs()[32 + i] = input[i];
+    }
+    jit.Regs()[15] = 0;
+    jit.SetCpsr(0x000001d0); // User-mode
+
+    test_env.ticks_left = 8;
+    jit.Run();
+
+    for (size_t shift = 1; shift <= 8; shift++) {
+        for (size_t i = 0; i < 16; i++) {
+            const s8 element = static_cast<s8>(input[i / 4] >> (i % 4 * 8));
+            const u8 expected = static_cast<u8>(element >> shift);
+            const u32 result = jit.ExtRegs()[(shift - 1) * 4 + i / 4];
+            INFO("shift " << shift << ", element " << i);
+            REQUIRE(static_cast<u8>(result >> (i % 4 * 8)) == expected);
+        }
+    }
+}
+
 TEST_CASE("arm: Cleared Q flag", "[arm][A32][JitA64]") {
     ArmTestEnv test_env;
     A32::Jit jit{GetUserConfig(&test_env)};
@@ -581,3 +630,725 @@ TEST_CASE("arm: Cleared Q flag 2", "[arm][A32][JitA64]") {
 
     REQUIRE((jit.Cpsr() & (1 << 27)) == 0);
 }
+
+TEST_CASE("arm: LDM/STM through page_table", "[arm][A32]") {
+    ArmTestEnv test_env;
+
+    std::array<u8, 4096> page1{};
+    auto page_table = std::make_unique<std::array<u8*, A32::UserConfig::NUM_PAGE_TABLE_ENTRIES>>();
+    page_table->fill(nullptr);
+    (*page_table)[1] = page1.data();
+
+    A32::UserConfig config = GetUserConfig(&test_env);
+    config.page_table = page_table.get();
+    A32::Jit jit{config};
+
+    test_env.code_mem = {
+        0xe880001e, // stm r0, {r1, r2, r3, r4}
+        0xe89001e0, // ldm r0, {r5, r6, r7, r8}
+        0xe8890006, // stm r9, {r1, r2}
+        0xe8990c00, // ldm r9, {r10, r11}
+        0xeafffffe, // b +#0
+    };
+
+    jit.Regs()[0] = 0x1100;
+    jit.Regs()[1] = 0x11111111;
+    jit.Regs()[2] = 0x22222222;
+    jit.Regs()[3] = 0x33333333;
+    jit.Regs()[4] = 0x44444444;
+    jit.Regs()[9] = 0x1ffc;
+    jit.SetCpsr(0x000001d0); // User-mode
+
+    test_env.ticks_left = 5;
+    jit.Run();
+
+    std::array<u32, 4> stored;
+    std::memcpy(stored.data(), page1.data() + 0x100, sizeof(stored));
+    REQUIRE(stored == std::array<u32, 4>{0x11111111, 0x22222222, 0x33333333, 0x44444444});
+
+    REQUIRE(jit.Regs()[5] == 0x11111111);
+    REQUIRE(jit.Regs()[6] == 0x22222222);
+    REQUIRE(jit.Regs()[7] == 0x33333333);
+    REQUIRE(jit.Regs()[8] == 0x44444444);
+    REQUIRE(jit.Regs()[10] == 0x11111111);
+    REQUIRE(jit.Regs()[11] == 0x22222222);
+    REQUIRE(jit.Regs()[15] == 16);
+}
+
+TEST_CASE("arm: Page-straddling accesses through page_table", "[arm][A32]") {
+    ArmTestEnv test_env;
+
+    std::array<u8, 4096> page1{};
+    std::array<u8, 4096> page2{};
+    auto page_table = std::make_unique<std::array<u8*, A32::UserConfig::NUM_PAGE_TABLE_ENTRIES>>();
+    page_table->fill(nullptr);
+    (*page_table)[1] = page1.data();
+    (*page_table)[2] = page2.data();
+
+    A32::UserConfig config = GetUserConfig(&test_env);
+    config.page_table = page_table.get();
+    config.detect_misaligned_access_via_page_table = 16 | 32 | 64;
+    config.only_detect_misalignment_via_page_table_on_page_boundary = true;
+    A32::Jit jit{config};
+
+    test_env.code_mem = {
+        0xe5801000, // str r1, [r0]
+        0xe5902000, // ldr r2, [r0]
+        0xe1d430b0, // ldrh r3, [r4]
+        0xe5865000, // str r5, [r6]
+        0xeafffffe, // b +#0
+    };
+
+    jit.Regs()[0] = 0x1ffe;
+    jit.Regs()[1] = 0x11223344;
+    jit.Regs()[4] = 0x1fff;
+    jit.Regs()[5] = 0x55667788;
+    jit.Regs()[6] = 0x2ffe;
+    jit.SetCpsr(0x000001d0); // User-mode
+
+    test_env.ticks_left = 5;
+    jit.Run();
+
+    REQUIRE(page1[0xffe] == 0x44);
+    REQUIRE(page1[0xfff] == 0x33);
+    REQUIRE(page2[0] == 0x22);
+    REQUIRE(page2[1] == 0x11);
+    REQUIRE(test_env.modified_memory.count(0x1ffe) == 0);
+
+    REQUIRE(jit.Regs()[2] == 0x11223344);
+    REQUIRE(jit.Regs()[3] == 0x2233);
+
+    // Page 3 is unmapped, so the whole store goes through the memory callbacks.
+    REQUIRE(page2[0xffe] == 0);
+    REQUIRE(test_env.modified_memory[0x2ffe] == 0x88);
+    REQUIRE(test_env.modified_memory[0x3001] == 0x55);
+    REQUIRE(jit.Regs()[15] == 16);
+}
+
+TEST_CASE("arm: Interleaved VFP and ASIMD floating-point", "[arm][A32]") {
+    ArmTestEnv test_env;
+    A32::Jit jit{GetUserConfig(&test_env)};
+    test_env.code_mem = {
+        0xf2020d44, // vadd.f32 q0, q1, q2
+        0xee328a04, // vadd.f32 s16, s4, s8
+        0xf202ad44, // vadd.f32 q5, q1, q2
+        0xee728aa4, // vadd.f32 s17, s5, s9
+        0xf302cd54, // vmul.f32 q6, q1, q2
+        0xeafffffe, // b +#0
+    };
+
+    jit.ExtRegs()[4] = 0x3f800000;
+    jit.ExtRegs()[5] = 0x00000001;
+    jit.ExtRegs()[6] = 0x40400000;
+    jit.ExtRegs()[7] = 0x00000000;
+    jit.ExtRegs()[8] = 0x33c00000;
+    jit.ExtRegs()[9] = 0x00000000;
+    jit.ExtRegs()[10] = 0x3f000000;
+    jit.ExtRegs()[11] = 0x00000000;
+
+    jit.SetCpsr(0x000001d0); // User-mode
+    jit.SetFpscr(0x00c00000); // Round towards zero, FZ clear
+
+    test_env.ticks_left = 6;
+    jit.Run();
+
+    // ASIMD operations use the standard FPSCR value (round to nearest, flush-to-zero),
+    // whereas VFP operations use FPSCR.
+    const std::array<u32, 4> asimd_sum{0x3f800001, 0x00000000, 0x40600000, 0x00000000};
+    for (size_t i = 0; i < 4; i++) {
+        REQUIRE(jit.ExtRegs()[0 + i] == asimd_sum[i]);
+        REQUIRE(jit.ExtRegs()[20 + i] == asimd_sum[i]);
+    }
+    REQUIRE(jit.ExtRegs()[16] == 0x3f800000);
+    REQUIRE(jit.ExtRegs()[17] == 0x00000001);
+    REQUIRE(jit.ExtRegs()[24] == 0x33c00000);
+    REQUIRE(jit.ExtRegs()[25] == 0x00000000);
+    REQUIRE(jit.ExtRegs()[26] == 0x3fc00000);
+    REQUIRE(jit.ExtRegs()[27] == 0x00000000);
+
+    // The JIT does not track FPSCR.IDC.
+    REQUIRE((jit.Fpscr() & ~u32(0x80)) == 0x00c00010);
+}
+
+TEST_CASE("arm: VFP short vectors", "[arm][A32]") {
+    ArmTestEnv test_env;
+    A32::Jit jit{GetUserConfig(&test_env)};
+    test_env.code_mem = {
+        0xee384a0c, // vadd.f32 s8, s16, s24
+        0xee286a00, // vmul.f32 s12, s16, s0
+        0xee08aa0c, // vmla.f32 s20, s16, s24
+        0xee784bac, // vadd.f64 d20, d24, d28
+        0xee6c8ba0, // vmul.f64 d24, d28, d16
+        0xeeb1ea48, // vneg.f32 s28, s16
+        0xeafffffe, // b +#0
+    };
+
+    const auto f32 = [](float value) { u32 result; std::memcpy(&result, &value, sizeof(result)); return result; };
+    const auto set_f64 = [&jit](size_t reg, double value) {
+        u64 bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        jit.ExtRegs()[reg * 2 + 0] = static_cast<u32>(bits);
+        jit.ExtRegs()[reg * 2 + 1] = static_cast<u32>(bits >> 32);
+    };
+    const auto get_f64 = [&jit](size_t reg) {
+        const u64 bits = u64{jit.ExtRegs()[reg * 2 + 1]} << 32 | jit.ExtRegs()[reg * 2 + 0];
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    };
+
+    jit.ExtRegs()[0] = f32(0.5f);
+    for (size_t i = 0; i < 4; i++) {
+        jit.ExtRegs()[16 + i] = f32(float(i + 1));
+        jit.ExtRegs()[20 + i] = f32(float(i + 1) * 100.0f);
+        jit.ExtRegs()[24 + i] = f32(float(i + 1) * 10.0f);
+        set_f64(24 + i, double(i + 1));
+        set_f64(28 + i, double(i + 5));
+    }
+    set_f64(16, 2.0);
+
+    jit.SetCpsr(0x000001d0); // User-mode
+    jit.SetFpscr(0x00030000); // Len = 4, Stride = 1
+
+    test_env.ticks_left = 7;
+    jit.Run();
+
+    for (size_t i = 0; i < 4; i++) {
+        const float x = float(i + 1);
+        REQUIRE(jit.ExtRegs()[8 + i] == f32(x + x * 10.0f));
+        REQUIRE(jit.ExtRegs()[12 + i] == f32(x * 0.5f));
+        REQUIRE(jit.ExtRegs()[20 + i] == f32(x * 100.0f + x * x * 10.0f));
+        REQUIRE(jit.ExtRegs()[28 + i] == f32(-x));
+        REQUIRE(get_f64(20 + i) == double(i + 1) + double(i + 5));
+        REQUIRE(get_f64(24 + i) == double(i + 5) * 2.0);
+    }
+    REQUIRE(jit.ExtRegs()[0] == f32(0.5f));
+    REQUIRE(get_f64(16) == 2.0);
+}
+
+TEST_CASE("arm: ASIMD high-narrowing and saturating operations", "[arm][A32]") {
+    ArmTestEnv test_env;
+    A32::Jit jit{GetUserConfig(&test_env)};
+    test_env.code_mem = {
+        0xf294a3ce, // vqdmlal.s16 q5, d20, d6[1]
+        0xf2a4e7e7, // vqdmlsl.s32 q7, d20, d7[1]
+        0xf29004a2, // vaddhn.i32 d0, q8, q9
+        0xf38014a2, // vraddhn.i16 d1, q8, q9
+        0xf2a026a2, // vsubhn.i64 d2, q8, q9
+        0xf39036a2, // vrsubhn.i32 d3, q8, q9
+        0xf2944da5, // vqdmull.s16 q2, d20, d21
+        0xf2a469a5, // vqdmlal.s32 q3, d20, d21
+        0xf2948ba5, // vqdmlsl.s16 q4, d20, d21
+        0xf207c5b6, // vqrshl.s8 d12, d22, d23
+        0xf327d5b6, // vqrshl.u32 d13, d22, d23
+        0xeafffffe, // b +#0
+    };
+
+    jit.ExtRegs()[12] = 0x80000001;
+    jit.ExtRegs()[13] = 0x00020003;
+    jit.ExtRegs()[14] = 0x11111111;
+    jit.ExtRegs()[15] = 0x80000000;
+    jit.ExtRegs()[16] = 0x12345678;
+    jit.ExtRegs()[17] = 0x9abcdef0;
+    jit.ExtRegs()[18] = 0x7fffffff;
+    jit.ExtRegs()[19] = 0x80000000;
+    jit.ExtRegs()[20] = 0x7fffffff;
+    jit.ExtRegs()[21] = 0x00000001;
+    jit.ExtRegs()[22] = 0x80000000;
+    jit.ExtRegs()[23] = 0xffffffff;
+    jit.ExtRegs()[28] = 0x00000000;
+    jit.ExtRegs()[29] = 0x80000000;
+    jit.ExtRegs()[30] = 0xffffffff;
+    jit.ExtRegs()[31] = 0x7fffffff;
+    jit.ExtRegs()[32] = 0x12345678;
+    jit.ExtRegs()[33] = 0x9abcdef0;
+    jit.ExtRegs()[34] = 0x00008000;
+    jit.ExtRegs()[35] = 0xfedc8080;
+    jit.ExtRegs()[36] = 0x0fedcba9;
+    jit.ExtRegs()[37] = 0x87654321;
+    jit.ExtRegs()[38] = 0x00007fff;
+    jit.ExtRegs()[39] = 0x01230180;
+    jit.ExtRegs()[40] = 0x80007fff;
+    jit.ExtRegs()[41] = 0x12348000;
+    jit.ExtRegs()[42] = 0x8000fffe;
+    jit.ExtRegs()[43] = 0x7fff0003;
+    jit.ExtRegs()[44] = 0x807f0181;
+    jit.ExtRegs()[45] = 0xff7f1001;
+    jit.ExtRegs()[46] = 0xf901ff07;
+    jit.ExtRegs()[47] = 0x800402fd;
+
+    jit.SetCpsr(0x000001d0); // User-mode
+    jit.SetFpscr(0x00000000);
+
+    test_env.ticks_left = 12;
+    jit.Run();
+
+    REQUIRE(jit.ExtRegs()[0] == 0x22222222);
+    REQUIRE(jit.ExtRegs()[1] == 0xffff0000);
+    REQUIRE(jit.ExtRegs()[2] == 0x22222222);
+    REQUIRE(jit.ExtRegs()[3] == 0x00820000);
+    REQUIRE(jit.ExtRegs()[4] == 0x13579bcf);
+    REQUIRE(jit.ExtRegs()[5] == 0xfdb97f00);
+    REQUIRE(jit.ExtRegs()[6] == 0x13580247);
+    REQUIRE(jit.ExtRegs()[7] == 0xfdb90000);
+    REQUIRE(jit.ExtRegs()[8] == 0xfffe0004);
+    REQUIRE(jit.ExtRegs()[9] == 0x7fffffff);
+    REQUIRE(jit.ExtRegs()[10] == 0xfffd0000);
+    REQUIRE(jit.ExtRegs()[11] == 0x1233db98);
+    REQUIRE(jit.ExtRegs()[12] == 0xffffffff);
+    REQUIRE(jit.ExtRegs()[13] == 0x7fffffff);
+    REQUIRE(jit.ExtRegs()[14] == 0x7e4c1111);
+    REQUIRE(jit.ExtRegs()[15] == 0x92345b97);
+    REQUIRE(jit.ExtRegs()[16] == 0x12365674);
+    REQUIRE(jit.ExtRegs()[17] == 0x80000000);
+    REQUIRE(jit.ExtRegs()[18] == 0x7fffffff);
+    REQUIRE(jit.ExtRegs()[19] == 0x80000000);
+    REQUIRE(jit.ExtRegs()[20] == 0x0000ffff);
+    REQUIRE(jit.ExtRegs()[21] == 0x7fffffff);
+    REQUIRE(jit.ExtRegs()[22] == 0xffffffff);
+    REQUIRE(jit.ExtRegs()[23] == 0xedcbffff);
+    REQUIRE(jit.ExtRegs()[24] == 0xff7f0180);
+    REQUIRE(jit.ExtRegs()[25] == 0x007f4000);
+    REQUIRE(jit.ExtRegs()[26] == 0xffffffff);
+    REQUIRE(jit.ExtRegs()[27] == 0x1fefe200);
+    REQUIRE(jit.ExtRegs()[28] == 0x00000000);
+    REQUIRE(jit.ExtRegs()[29] == 0x80000000);
+    REQUIRE(jit.ExtRegs()[30] == 0xffffffff);
+    REQUIRE(jit.ExtRegs()[31] == 0x7fffffff);
+}
+
+TEST_CASE("arm: Interpreter tier", "[arm][A32]") {
+    const std::array<u32, 13> code{
+        0xe3a00000, // mov r0, #0
+        0xe3a0100a, // mov r1, #10
+        0xe0800081, // loop: add r0, r0, r1, lsl #1
+        0xe0020190, // mul r2, r0, r1
+        0xe02243e2, // eor r4, r2, r2, ror #7
+        0xe5a54004, // str r4, [r5, #4]!
+        0xe5956000, // ldr r6, [r5]
+        0xe2511001, // subs r1, r1, #1
+        0x1afffff8, // bne loop
+        0x01a07000, // moveq r7, r0
+        0x12877001, // addne r7, r7, #1
+        0xe2903102, // adds r3, r0, #0x80000000
+        0xeafffffe, // b .
+    };
+
+    struct State {
+        std::array<u32, 16> regs;
+        u32 cpsr;
+        std::map<u32, u8> memory;
+    };
+
+    const auto run = [&](size_t threshold, bool step) {
+        ArmTestEnv test_env;
+        A32::UserConfig conf = GetUserConfig(&test_env);
+        conf.interpreter_tier_threshold = threshold;
+        A32::Jit jit{conf};
+
+        test_env.code_mem.assign(code.begin(), code.end());
+        jit.Regs()[5] = 0x1000;
+        jit.Regs()[15] = 0;
+        jit.SetCpsr(0x000001d0); // User-mode
+
+        if (step) {
+            for (size_t i = 0; i < 90; i++) {
+                test_env.ticks_left = 1;
+                jit.Step();
+            }
+        } else {
+            test_env.ticks_left = 200;
+            jit.Run();
+        }
+
+        return State{jit.Regs(), jit.Cpsr(), test_env.modified_memory};
+    };
+
+    const State expected = run(0, false);
+    REQUIRE(expected.regs[0] == 110);
+    REQUIRE(expected.regs[3] == 0x8000006e);
+    REQUIRE(expected.regs[7] == 110);
+    REQUIRE(expected.regs[15] == 48);
+
+    for (const size_t threshold : {1, 2, 1000}) {
+        INFO("threshold " << threshold);
+
+        const State actual = run(threshold, false);
+        REQUIRE(actual.regs == expected.regs);
+        REQUIRE(actual.cpsr == expected.cpsr);
+        REQUIRE(actual.memory == expected.memory);
+
+        const State stepped = run(threshold, true);
+        REQUIRE(stepped.regs == expected.regs);
+        REQUIRE(stepped.cpsr == expected.cpsr);
+        REQUIRE(stepped.memory == expected.memory);
+    }
+}
+
+TEST_CASE("arm: Interpreter tier with VFP", "[arm][A32]") {
+    const std::array<u32, 23> code{
+        0xe3a0100a, // mov r1, #10
+        0xee001a10, // loop: vmov s0, r1
+        0xeeb81bc0, // vcvt.f64.s32 d1, s0
+        0xeeb12bc1, // vsqrt.f64 d2, d1
+        0xee823b01, // vdiv.f64 d3, d2, d1
+        0xee234b02, // vmul.f64 d4, d3, d2
+        0xee034b01, // vmla.f64 d4, d3, d1
+        0xeea35b01, // vfma.f64 d5, d3, d1
+        0xee344b43, // vsub.f64 d4, d4, d3
+        0xee306a00, // vadd.f32 s12, s0, s0
+        0xeeb77ac6, // vcvt.f64.f32 d7, s12
+        0xeebd8bc4, // vcvt.s32.f64 s16, d4
+        0xeefb8ace, // vcvt.f32.u32 s17, s17, #4
+        0xeeb0abc4, // vabs.f64 d10, d4
+        0xeeb1ba68, // vneg.f32 s22, s17
+        0xeeb44b43, // vcmp.f64 d4, d3
+        0xeef1fa10, // vmrs APSR_nzcv, fpscr
+        0xc3a02001, // movgt r2, #1
+        0xee2c1b10, // vmov.32 d12[1], r1
+        0xeefc3b10, // vmov.u8 r3, d12[4]
+        0xe2511001, // subs r1, r1, #1
+        0x1affffea, // bne loop
+        0xeafffffe, // b .
+    };
+
+    struct State {
+        std::array<u32, 16> regs;
+        std::array<u32, 64> ext_regs;
+        u32 cpsr;
+        u32 fpscr;
+    };
+
+    const auto run = [&](size_t threshold, bool step, u32 fpscr) {
+        ArmTestEnv test_env;
+        A32::UserConfig conf = GetUserConfig(&test_env);
+        conf.interpreter_tier_threshold = threshold;
+        A32::Jit jit{conf};
+
+        test_env.code_mem.assign(code.begin(), code.end());
+        jit.Regs()[15] = 0;
+        jit.SetCpsr(0x000001d0); // User-mode
+        jit.SetFpscr(fpscr);
+
+        if (step) {
+            for (size_t i = 0; i < 220; i++) {
+                test_env.ticks_left = 1;
+                jit.Step();
+            }
+        } else {
+            test_env.ticks_left = 300;
+            jit.Run();
+        }
+
+        return State{jit.Regs(), jit.ExtRegs(), jit.Cpsr(), jit.Fpscr()};
+    };
+
+    // Round to nearest, and round towards minus infinity with flush-to-zero.
+    for (const u32 fpscr : {0x00000000u, 0x01800000u}) {
+        INFO("fpscr " << fpscr);
+
+        const State expected = run(0, false, fpscr);
+        REQUIRE(expected.regs[1] == 0);
+        REQUIRE(expected.regs[15] == 88);
+
+        for (const auto& [threshold, step] : {std::make_pair(1000, false), std::make_pair(0, true), std::make_pair(1000, true)}) {
+            INFO("threshold " << threshold << " step " << step);
+
+            const State actual = run(threshold, step, fpscr);
+            REQUIRE(actual.regs == expected.regs);
+            REQUIRE(actual.ext_regs == expected.ext_regs);
+            REQUIRE(actual.cpsr == expected.cpsr);
+            // Compiled code does not report input denormals (IDC) for operations run on the host FPU.
+            REQUIRE((actual.fpscr & ~0x80) == (expected.fpscr & ~0x80));
+        }
+    }
+}
+
+TEST_CASE("arm: Merge interpret blocks", "[arm][A32]") {
+    // Records fallback calls, and skips over the instructions handed to it.
+    struct FallbackTestEnv final : public A32::UserCallbacks {
+        A32::Jit* jit = nullptr;
+        u64 ticks_left = 0;
+        std::vector<u32> code_mem;
+        std::vector<std::pair<u32, size_t>> fallback_calls;
+        bool use_code_page = false;
+
+        u32 MemoryReadCode(u32 vaddr) override {
+            if (use_code_page) {
+                return 0xeafffffe; // B .: code must only be read from the code page
+            }
+            return vaddr / 4 < code_mem.size() ? code_mem[vaddr / 4] : 0xEAFFFFFE; // B .
+        }
+
+        const void* GetCodePagePointer(u32 vaddr) override {
+            return use_code_page && vaddr == 0 ? code_mem.data() : nullptr;
+        }
+
+        u8 MemoryRead8(u32) override { return 0; }
+        u16 MemoryRead16(u32) override { return 0; }
+        u32 MemoryRead32(u32) override { return 0; }
+        u64 MemoryRead64(u32) override { return 0; }
+
+        void MemoryWrite8(u32, u8) override {}
+        void MemoryWrite16(u32, u16) override {}
+        void MemoryWrite32(u32, u32) override {}
+        void MemoryWrite64(u32, u64) override {}
+
+        void InterpreterFallback(u32 pc, size_t num_instructions) override {
+            fallback_calls.emplace_back(pc, num_instructions);
+            jit->Regs()[15] = pc + static_cast<u32>(num_instructions * 4);
+        }
+
+        void CallSVC(u32 swi) override { FAIL("CallSVC(" << swi << ")"); }
+        void ExceptionRaised(u32 pc, A32::Exception) override { FAIL("ExceptionRaised(" << pc << ")"); }
+
+        void AddTicks(u64 ticks) override { ticks_left -= std::min(ticks, ticks_left); }
+        u64 GetTicksRemaining() override { return ticks_left; }
+    };
+
+    const std::array<u32, 10> code{
+        0xf1080080, // cpsie i
+        0xf1080080, // cpsie i
+        0xe3a00001, // mov r0, #1
+        0xe2800001, // add r0, r0, #1
+        0xf1080080, // cpsie i
+        0xe3a01002, // mov r1, #2
+        0xea000000, // b +#0
+        0xf1080080, // cpsie i
+        0xf1080080, // cpsie i
+        0xeafffffe, // b .
+    };
+
+    const auto run = [&](bool merge, bool use_code_page) {
+        FallbackTestEnv test_env;
+        test_env.use_code_page = use_code_page;
+        A32::UserConfig conf;
+        conf.callbacks = &test_env;
+        if (!merge) {
+            conf.optimizations &= ~OptimizationFlag::MiscIROpt;
+        }
+        A32::Jit jit{conf};
+        test_env.jit = &jit;
+
+        test_env.code_mem.assign(code.begin(), code.end());
+        test_env.code_mem.resize(1024, 0xeafffffe);
+        jit.Regs()[15] = 0;
+        jit.SetCpsr(0x000001d0); // User-mode
+
+        test_env.ticks_left = 20;
+        jit.Run();
+
+        REQUIRE(jit.Regs()[1] == 2);
+        REQUIRE(jit.Regs()[15] == 36);
+        return test_env.fallback_calls;
+    };
+
+    const std::vector<std::pair<u32, size_t>> unmerged{{0, 1}, {4, 1}, {16, 1}, {32, 1}};
+    REQUIRE(run(false, false) == unmerged);
+
+    // Translatable instructions between interpreted ones are interpreted too, halving dispatcher exits.
+    const std::vector<std::pair<u32, size_t>> merged{{0, 5}, {32, 1}};
+    REQUIRE(run(true, false) == merged);
+
+    // Merging classifies instructions from the same code as the translation does.
+    REQUIRE(run(true, true) == merged);
+}
+
+TEST_CASE("arm: Predicated conditional instructions", "[arm][A32]") {
+    const std::array<u32, 9> code{
+        0xe3500000, // cmp r0, #0
+        0x03a01001, // moveq r1, #1
+        0x13a01002, // movne r1, #2
+        0x12822003, // addne r2, r2, #3
+        0x1e002a10, // vmovne s0, r2
+        0x15832000, // strne r2, [r3]
+        0x02524001, // subseq r4, r2, #1
+        0x42855001, // addmi r5, r5, #1
+        0xeafffffe, // b .
+    };
+
+    struct State {
+        std::array<u32, 16> regs;
+        u32 s0;
+        u32 cpsr;
+        std::map<u32, u8> memory;
+    };
+
+    const auto run = [&](u32 r0, bool step) {
+        ArmTestEnv test_env;
+        A32::Jit jit{GetUserConfig(&test_env)};
+
+        test_env.code_mem.assign(code.begin(), code.end());
+        jit.Regs()[0] = r0;
+        jit.Regs()[2] = r0 * 3;
+        jit.Regs()[3] = 0x1000;
+        jit.Regs()[4] = 0xAAAA;
+        jit.Regs()[5] = 0x20;
+        jit.Regs()[15] = 0;
+        jit.ExtRegs()[0] = 0x1234;
+        jit.SetCpsr(0x000001d0); // User-mode
+
+        if (step) {
+            for (size_t i = 0; i < code.size(); i++) {
+                test_env.ticks_left = 1;
+                jit.Step();
+            }
+        } else {
+            test_env.ticks_left = code.size();
+            jit.Run();
+        }
+
+        return State{jit.Regs(), jit.ExtRegs()[0], jit.Cpsr(), test_env.modified_memory};
+    };
+
+    for (const u32 r0 : {0, 1}) {
+        INFO("r0 " << r0);
+
+        const State actual = run(r0, false);
+        const State stepped = run(r0, true);
+        REQUIRE(actual.regs == stepped.regs);
+        REQUIRE(actual.s0 == stepped.s0);
+        REQUIRE(actual.cpsr == stepped.cpsr);
+        REQUIRE(actual.memory == stepped.memory);
+
+        REQUIRE(actual.regs[15] == 32);
+        if (r0 == 0) {
+            REQUIRE(actual.regs[1] == 1);
+            REQUIRE(actual.regs[2] == 0);
+            REQUIRE(actual.regs[4] == 0xFFFFFFFF);
+            REQUIRE(actual.regs[5] == 0x21);
+            REQUIRE(actual.s0 == 0x1234);
+            REQUIRE(actual.memory.empty());
+        } else {
+            REQUIRE(actual.regs[1] == 2);
+            REQUIRE(actual.regs[2] == 6);
+            REQUIRE(actual.regs[4] == 0xAAAA);
+            REQUIRE(actual.regs[5] == 0x20);
+            REQUIRE(actual.s0 == 6);
+            REQUIRE(actual.memory.size() == 4);
+        }
+    }
+}
+
+TEST_CASE("arm: Predicated memory accesses and flag writes", "[arm][A32]") {
+    const std::array<u32, 11> code{
+        0xe3500000, // cmp r0, #0
+        0x15931000, // ldrne r1, [r3]
+        0x05931004, // ldreq r1, [r3, #4]
+        0x15830008, // strne r0, [r3, #8]
+        0x0583200c, // streq r2, [r3, #12]
+        0x11c361d0, // ldrdne r6, r7, [r3, #16]
+        0x01c341f8, // strdeq r4, r5, [r3, #24]
+        0x12928001, // addsne r8, r2, #1
+        0x010a905a, // qaddeq r9, r10, r10
+        0x15f3b001, // ldrbne r11, [r3, #1]!
+        0xeafffffe, // b .
+    };
+
+    // The conditional instructions are predicated instead of ending the block.
+    const IR::Block block = A32::Translate(A32::LocationDescriptor{0, A32::PSR{0x000001d0}, A32::FPSCR{}}, [&](u32 vaddr) {
+        return code.at(vaddr / 4);
+    }, {});
+    REQUIRE(block.CycleCount() == code.size());
+
+    struct State {
+        std::array<u32, 16> regs;
+        u32 cpsr;
+        std::map<u32, u8> memory;
+    };
+
+    const auto run = [&](u32 r0, bool use_page_table, bool step) {
+        ArmTestEnv test_env;
+
+        // Page 1 holds the same bytes the test environment returns for unmapped memory.
+        std::array<u8, 4096> page1;
+        for (size_t i = 0; i < page1.size(); i++) {
+            page1[i] = static_cast<u8>(i);
+        }
+        auto page_table = std::make_unique<std::array<u8*, A32::UserConfig::NUM_PAGE_TABLE_ENTRIES>>();
+        page_table->fill(nullptr);
+        (*page_table)[1] = page1.data();
+
+        A32::UserConfig config = GetUserConfig(&test_env);
+        if (use_page_table) {
+            config.page_table = page_table.get();
+        }
+        A32::Jit jit{config};
+
+        test_env.code_mem.assign(code.begin(), code.end());
+        jit.Regs().fill(0xCCCCCCCC);
+        jit.Regs()[0] = r0;
+        jit.Regs()[2] = 0x100 + r0;
+        jit.Regs()[3] = 0x1100;
+        jit.Regs()[4] = 0x44444444;
+        jit.Regs()[5] = 0x55555555;
+        jit.Regs()[10] = 0x7FFFFFFF;
+        jit.Regs()[15] = 0;
+        jit.SetCpsr(0x000001d0); // User-mode
+
+        if (step) {
+            for (size_t i = 0; i < code.size(); i++) {
+                test_env.ticks_left = 1;
+                jit.Step();
+            }
+        } else {
+            test_env.ticks_left = code.size();
+            jit.Run();
+        }
+
+        std::map<u32, u8> memory = test_env.modified_memory;
+        for (size_t i = 0; i < page1.size(); i++) {
+            if (page1[i] != static_cast<u8>(i)) {
+                memory[static_cast<u32>(0x1000 + i)] = page1[i];
+            }
+        }
+        return State{jit.Regs(), jit.Cpsr(), memory};
+    };
+
+    const auto read32 = [](const std::map<u32, u8>& memory, u32 vaddr) {
+        u32 value = 0;
+        for (u32 i = 0; i < 4; i++) {
+            value |= u32(memory.at(vaddr + i)) << (i * 8);
+        }
+        return value;
+    };
+
+    for (const bool use_page_table : {false, true}) {
+        for (const u32 r0 : {0, 1}) {
+            INFO("page_table " << use_page_table << " r0 " << r0);
+
+            const State actual = run(r0, use_page_table, false);
+            const State stepped = run(r0, use_page_table, true);
+            REQUIRE(actual.regs == stepped.regs);
+            REQUIRE(actual.cpsr == stepped.cpsr);
+            REQUIRE(actual.memory == stepped.memory);
+
+            REQUIRE(actual.regs[15] == 40);
+            if (r0 == 0) {
+                REQUIRE(actual.regs[1] == 0x07060504);
+                REQUIRE(actual.regs[3] == 0x1100);
+                REQUIRE(actual.regs[6] == 0xCCCCCCCC);
+                REQUIRE(actual.regs[7] == 0xCCCCCCCC);
+                REQUIRE(actual.regs[8] == 0xCCCCCCCC);
+                REQUIRE(actual.regs[9] == 0x7FFFFFFF);
+                REQUIRE(actual.regs[11] == 0xCCCCCCCC);
+                REQUIRE(actual.cpsr == 0x680001d0);
+                REQUIRE(actual.memory.size() == 12);
+                REQUIRE(read32(actual.memory, 0x110c) == 0x100);
+                REQUIRE(read32(actual.memory, 0x1118) == 0x44444444);
+                REQUIRE(read32(actual.memory, 0x111c) == 0x55555555);
+            } else {
+                REQUIRE(actual.regs[1] == 0x03020100);
+                REQUIRE(actual.regs[3] == 0x1101);
+                REQUIRE(actual.regs[6] == 0x13121110);
+                REQUIRE(actual.regs[7] == 0x17161514);
+                REQUIRE(actual.regs[8] == 0x102);
+                REQUIRE(actual.regs[9] == 0xCCCCCCCC);
+                REQUIRE(actual.regs[11] == 0x01);
+                REQUIRE(actual.cpsr == 0x000001d0);
+                REQUIRE(actual.memory.size() == 4);
+                REQUIRE(read32(actual.memory, 0x1108) == 1);
+            }
+        }
+    }
+}
@@ -3,11 +3,14 @@
  * SPDX-License-Identifier: 0BSD
  */
 
+#include <array>
+
 #include <catch.hpp>
 
 #include <dynarmic/A32/a32.h>
 
 #include "common/common_types.h"
+#include "rand_int.h"
 #include "testenv.h"
 
 static Dynarmic::A32::UserConfig GetUserConfig(ThumbTestEnv* testenv) {
@@ -157,3 +160,371 @@ TEST_CASE("thumb: bl -#42", "[thumb]") {
     REQUIRE(jit.Regs()[15] == 0xFFFFFFD6);
     REQUIRE(jit.Cpsr() == 0x00000030); // Thumb, User-mode
 }
+
+TEST_CASE("thumb: itte eq (condition passes)", "[thumb]") {
+    ThumbTestEnv test_env;
+    Dynarmic::A32::Jit jit{GetUserConfig(&test_env)};
+    test_env.code_mem = {
+        0xBF06, // itte eq
+        0x2001, // moveq r0, #1
+        0x2102, // moveq r1, #2
+        0x2203, // movne r2, #3
+        0xE7FE, // b +#0
+    };
+
+    jit.Regs()[15] = 0; // PC = 0
+    jit.SetCpsr(0x40000030); // Z, Thumb, User-mode
+
+    test_env.ticks_left = 4;
+    jit.Run();
+
+    REQUIRE(jit.Regs()[0] == 1);
+    REQUIRE(jit.Regs()[1] == 2);
+    REQUIRE(jit.Regs()[2] == 0);
+    REQUIRE(jit.Regs()[15] == 8);
+    REQUIRE(jit.Cpsr() == 0x40000030); // Z, Thumb, User-mode
+}
+
+TEST_CASE("thumb: itte eq (condition fails)", "[thumb]") {
+    ThumbTestEnv test_env;
+    Dynarmic::A32::Jit jit{GetUserConfig(&test_env)};
+    test_env.code_mem = {
+        0xBF06, // itte eq
+        0x2001, // moveq r0, #1
+        0x2102, // moveq r1, #2
+        0x2203, // movne r2, #3
+        0xE7FE, // b +#0
+    };
+
+    jit.Regs()[15] = 0; // PC = 0
+    jit.SetCpsr(0x00000030); // Thumb, User-mode
+
+    test_env.ticks_left = 4;
+    jit.Run();
+
+    REQUIRE(jit.Regs()[0] == 0);
+    REQUIRE(jit.Regs()[1] == 0);
+    REQUIRE(jit.Regs()[2] == 3);
+    REQUIRE(jit.Regs()[15] == 8);
+    REQUIRE(jit.Cpsr() == 0x00000030); // Thumb, User-mode
+}
+
+TEST_CASE("thumb: add.w r0, r1, #0x12001200", "[thumb]") {
+    ThumbTestEnv test_env;
+    Dynarmic::A32::Jit jit{GetUserConfig(&test_env)};
+    test_env.code_mem = {
+        0xF101, 0x2012, // add.w r0, r1, #0x12001200
+        0xE7FE,         // b +#0
+    };
+
+    jit.Regs()[1] = 0x00340034;
+    jit.Regs()[15] = 0; // PC = 0
+    jit.SetCpsr(0x00000030); // Thumb, User-mode
+
+    test_env.ticks_left = 1;
+    jit.Run();
+
+    REQUIRE(jit.Regs()[0] == 0x12341234);
+    REQUIRE(jit.Regs()[15] == 4);
+    REQUIRE(jit.Cpsr() == 0x00000030); // Thumb, User-mode
+}
+
+TEST_CASE("thumb: adds.w r0, r1, r2, lsl #4", "[thumb]") {
+    ThumbTestEnv test_env;
+    Dynarmic::A32::Jit jit{GetUserConfig(&test_env)};
+    test_env.code_mem = {
+        0xEB11, 0x1002, // adds.w r0, r1, r2, lsl #4
+        0xE7FE,         // b +#0
+    };
+
+    jit.Regs()[1] = 0x80000000;
+    jit.Regs()[2] = 0x08000000;
+    jit.Regs()[15] = 0; // PC = 0
+    jit.SetCpsr(0x00000030); // Thumb, User-mode
+
+    test_env.ticks_left = 1;
+    jit.Run();
+
+    REQUIRE(jit.Regs()[0] == 0);
+    REQUIRE(jit.Regs()[15] == 4);
+    REQUIRE(jit.Cpsr() == 0x70000030); // Z, C, V flags, Thumb, User-mode
+}
+
+TEST_CASE("thumb: mla r0, r1, r2, r3", "[thumb]") {
+    ThumbTestEnv test_env;
+    Dynarmic::A32::Jit jit{GetUserConfig(&test_env)};
+    test_env.code_mem = {
+        0xFB01, 0x3002, // mla r0, r1, r2, r3
+        0xE7FE,         // b +#0
+    };
+
+    jit.Regs()[1] = 7;
+    jit.Regs()[2] = 6;
+    jit.Regs()[3] = 100;
+    jit.Regs()[15] = 0; // PC = 0
+    jit.SetCpsr(0x00000030); // Thumb, User-mode
+
+    test_env.ticks_left = 1;
+    jit.Run();
+
+    REQUIRE(jit.Regs()[0] == 142);
+    REQUIRE(jit.Regs()[15] == 4);
+    REQUIRE(jit.Cpsr() == 0x00000030); // Thumb, User-mode
+}
+
+TEST_CASE("thumb: ldr r0, [r1, #4]!", "[thumb]") {
+    ThumbTestEnv test_env;
+    Dynarmic::A32::Jit jit{GetUserConfig(&test_env)};
+    test_env.code_mem = {
+        0xF851, 0x0F04, // ldr r0, [r1, #4]!
+        0xE7FE,         // b +#0
+    };
+
+    jit.Regs()[1] = 0x12345690;
+    jit.Regs()[15] = 0; // PC = 0
+    jit.SetCpsr(0x00000030); // Thumb, User-mode
+
+    test_env.ticks_left = 1;
+    jit.Run();
+
+    REQUIRE(jit.Regs()[0] == 0x97969594); // Memory location 0x12345694
+    REQUIRE(jit.Regs()[1] == 0x12345694);
+    REQUIRE(jit.Regs()[15] == 4);
+    REQUIRE(jit.Cpsr() == 0x00000030); // Thumb, User-mode
+}
+
+TEST_CASE("thumb: ldm.w r0, {r1, r2, r3}", "[thumb]") {
+    ThumbTestEnv test_env;
+    Dynarmic::A32::Jit jit{GetUserConfig(&test_env)};
+    test_env.code_mem = {
+        0xE890, 0x000E, // ldm.w r0, {r1, r2, r3}
+        0xE7FE,         // b +#0
+    };
+
+    jit.Regs()[0] = 0x00001000;
+    jit.Regs()[15] = 0; // PC = 0
+    jit.SetCpsr(0x00000030); // Thumb, User-mode
+
+    test_env.ticks_left = 1;
+    jit.Run();
+
+    REQUIRE(jit.Regs()[0] == 0x00001000);
+    REQUIRE(jit.Regs()[1] == 0x03020100);
+    REQUIRE(jit.Regs()[2] == 0x07060504);
+    REQUIRE(jit.Regs()[3] == 0x0B0A0908);
+    REQUIRE(jit.Regs()[15] == 4);
+    REQUIRE(jit.Cpsr() == 0x00000030); // Thumb, User-mode
+}
+
+TEST_CASE("thumb: beq.w +#256", "[thumb]") {
+    ThumbTestEnv test_env;
+    Dynarmic::A32::Jit jit{GetUserConfig(&test_env)};
+    test_env.code_mem = {
+        0xF000, 0x8080, // beq.w +#256
+        0xE7FE,         // b +#0
+    };
+
+    jit.Regs()[15] = 0; // PC = 0
+    jit.SetCpsr(0x40000030); // Z, Thumb, User-mode
+
+    test_env.ticks_left = 1;
+    jit.Run();
+
+    REQUIRE(jit.Regs()[15] == 0x104);
+    REQUIRE(jit.Cpsr() == 0x40000030); // Z, Thumb, User-mode
+}
+
+TEST_CASE("thumb: udiv r0, r1, r2", "[thumb]") {
+    ThumbTestEnv test_env;
+    Dynarmic::A32::Jit jit{GetUserConfig(&test_env)};
+    test_env.code_mem = {
+        0xFBB1, 0xF0F2, // udiv r0, r1, r2
+        0xE7FE,         // b +#0
+    };
+
+    jit.Regs()[1] = 100;
+    jit.Regs()[2] = 7;
+    jit.Regs()[15] = 0; // PC = 0
+    jit.SetCpsr(0x00000030); // Thumb, User-mode
+
+    test_env.ticks_left = 1;
+    jit.Run();
+
+    REQUIRE(jit.Regs()[0] == 14);
+    REQUIRE(jit.Regs()[15] == 4);
+    REQUIRE(jit.Cpsr() == 0x00000030); // Thumb, User-mode
+}
+
+TEST_CASE("thumb: msr apsr_nzcvqg, r0", "[thumb]") {
+    ThumbTestEnv test_env;
+    Dynarmic::A32::Jit jit{GetUserConfig(&test_env)};
+    test_env.code_mem = {
+        0xF380, 0x8C00, // msr apsr_nzcvqg, r0
+        0xE7FE,         // b +#0
+    };
+
+    jit.Regs()[0] = 0xA80A0000;
+    jit.Regs()[15] = 0; // PC = 0
+    jit.SetCpsr(0x00000030); // Thumb, User-mode
+
+    test_env.ticks_left = 1;
+    jit.Run();
+
+    REQUIRE(jit.Regs()[15] == 4);
+    REQUIRE(jit.Cpsr() == 0xA80A0030); // N, C, Q, GE[3], GE[1], Thumb, User-mode
+}
+
+TEST_CASE("thumb: msr cpsr_x, r1", "[thumb]") {
+    ThumbTestEnv test_env;
+    Dynarmic::A32::Jit jit{GetUserConfig(&test_env)};
+    test_env.code_mem = {
+        0xF381, 0x8200, // msr cpsr_x, r1
+        0xE7FE,         // b +#0
+    };
+
+    jit.Regs()[1] = 0xFFFFFFFF;
+    jit.Regs()[15] = 0; // PC = 0
+    jit.SetCpsr(0x00000030); // Thumb, User-mode
+
+    test_env.ticks_left = 1;
+    jit.Run();
+
+    REQUIRE(jit.Regs()[15] == 4);
+    REQUIRE(jit.Cpsr() == 0x00000230); // E, Thumb, User-mode
+}
+
+TEST_CASE("thumb: mrs r0, apsr", "[thumb]") {
+    ThumbTestEnv test_env;
+    Dynarmic::A32::Jit jit{GetUserConfig(&test_env)};
+    test_env.code_mem = {
+        0xF3EF, 0x8000, // mrs r0, apsr
+        0xE7FE,         // b +#0
+    };
+
+    jit.Regs()[0] = 0xFFFFFFFF;
+    jit.Regs()[15] = 0; // PC = 0
+    jit.SetCpsr(0x980F0030); // N, V, Q, GE, Thumb, User-mode
+
+    test_env.ticks_left = 1;
+    jit.Run();
+
+    REQUIRE(jit.Regs()[0] == 0x980F0010); // The Thumb bit reads as zero
+    REQUIRE(jit.Regs()[15] == 4);
+    REQUIRE(jit.Cpsr() == 0x980F0030);
+}
+
+TEST_CASE("thumb: cpsie.w i", "[thumb]") {
+    ThumbTestEnv test_env;
+    Dynarmic::A32::Jit jit{GetUserConfig(&test_env)};
+    test_env.code_mem = {
+        0xF3AF, 0x8440, // cpsie.w i
+        0xE7FE,         // b +#0
+    };
+
+    jit.Regs()[15] = 0; // PC = 0
+    jit.SetCpsr(0x000000B0); // I, Thumb, User-mode
+
+    test_env.ticks_left = 1;
+    jit.Run();
+
+    REQUIRE(jit.Regs()[15] == 4);
+    REQUIRE(jit.Cpsr() == 0x000000B0); // CPS is a NOP in User-mode
+}
+
+TEST_CASE("thumb: Thumb32 parallel and dual multiply instructions match their Arm encodings", "[thumb]") {
+    struct Encodings {
+        u32 arm;
+        u16 thumb_hi;
+        u16 thumb_lo;
+    };
+    const std::array<Encodings, 50> encodings{{
+        {0xE6110F12, 0xFA91, 0xF002}, // sadd16 r0, r1, r2
+        {0xE6110F32, 0xFAA1, 0xF002}, // sasx r0, r1, r2
+        {0xE6110F52, 0xFAE1, 0xF002}, // ssax r0, r1, r2
+        {0xE6110F72, 0xFAD1, 0xF002}, // ssub16 r0, r1, r2
+        {0xE6110F92, 0xFA81, 0xF002}, // sadd8 r0, r1, r2
+        {0xE6110FF2, 0xFAC1, 0xF002}, // ssub8 r0, r1, r2
+        {0xE6210F12, 0xFA91, 0xF012}, // qadd16 r0, r1, r2
+        {0xE6210F32, 0xFAA1, 0xF012}, // qasx r0, r1, r2
+        {0xE6210F52, 0xFAE1, 0xF012}, // qsax r0, r1, r2
+        {0xE6210F72, 0xFAD1, 0xF012}, // qsub16 r0, r1, r2
+        {0xE6210F92, 0xFA81, 0xF012}, // qadd8 r0, r1, r2
+        {0xE6210FF2, 0xFAC1, 0xF012}, // qsub8 r0, r1, r2
+        {0xE6310F12, 0xFA91, 0xF022}, // shadd16 r0, r1, r2
+        {0xE6310F32, 0xFAA1, 0xF022}, // shasx r0, r1, r2
+        {0xE6310F52, 0xFAE1, 0xF022}, // shsax r0, r1, r2
+        {0xE6310F72, 0xFAD1, 0xF022}, // shsub16 r0, r1, r2
+        {0xE6310F92, 0xFA81, 0xF022}, // shadd8 r0, r1, r2
+        {0xE6310FF2, 0xFAC1, 0xF022}, // shsub8 r0, r1, r2
+        {0xE6510F12, 0xFA91, 0xF042}, // uadd16 r0, r1, r2
+        {0xE6510F32, 0xFAA1, 0xF042}, // uasx r0, r1, r2
+        {0xE6510F52, 0xFAE1, 0xF042}, // usax r0, r1, r2
+        {0xE6510F72, 0xFAD1, 0xF042}, // usub16 r0, r1, r2
+        {0xE6510F92, 0xFA81, 0xF042}, // uadd8 r0, r1, r2
+        {0xE6510FF2, 0xFAC1, 0xF042}, // usub8 r0, r1, r2
+        {0xE6610F12, 0xFA91, 0xF052}, // uqadd16 r0, r1, r2
+        {0xE6610F32, 0xFAA1, 0xF052}, // uqasx r0, r1, r2
+        {0xE6610F52, 0xFAE1, 0xF052}, // uqsax r0, r1, r2
+        {0xE6610F72, 0xFAD1, 0xF052}, // uqsub16 r0, r1, r2
+        {0xE6610F92, 0xFA81, 0xF052}, // uqadd8 r0, r1, r2
+        {0xE6610FF2, 0xFAC1, 0xF052}, // uqsub8 r0, r1, r2
+        {0xE6710F12, 0xFA91, 0xF062}, // uhadd16 r0, r1, r2
+        {0xE6710F32, 0xFAA1, 0xF062}, // uhasx r0, r1, r2
+        {0xE6710F52, 0xFAE1, 0xF062}, // uhsax r0, r1, r2
+        {0xE6710F72, 0xFAD1, 0xF062}, // uhsub16 r0, r1, r2
+        {0xE6710F92, 0xFA81, 0xF062}, // uhadd8 r0, r1, r2
+        {0xE6710FF2, 0xFAC1, 0xF062}, // uhsub8 r0, r1, r2
+        {0xE700F211, 0xFB21, 0xF002}, // smuad r0, r1, r2
+        {0xE700F231, 0xFB21, 0xF012}, // smuadx r0, r1, r2
+        {0xE7003211, 0xFB21, 0x3002}, // smlad r0, r1, r2, r3
+        {0xE7003231, 0xFB21, 0x3012}, // smladx r0, r1, r2, r3
+        {0xE700F251, 0xFB41, 0xF002}, // smusd r0, r1, r2
+        {0xE700F271, 0xFB41, 0xF012}, // smusdx r0, r1, r2
+        {0xE7003251, 0xFB41, 0x3002}, // smlsd r0, r1, r2, r3
+        {0xE7003271, 0xFB41, 0x3012}, // smlsdx r0, r1, r2, r3
+        {0xE7410312, 0xFBC2, 0x01C3}, // smlald r0, r1, r2, r3
+        {0xE7410332, 0xFBC2, 0x01D3}, // smlaldx r0, r1, r2, r3
+        {0xE7410352, 0xFBD2, 0x01C3}, // smlsld r0, r1, r2, r3
+        {0xE7410372, 0xFBD2, 0x01D3}, // smlsldx r0, r1, r2, r3
+        {0xE780F211, 0xFB71, 0xF002}, // usad8 r0, r1, r2
+        {0xE7803211, 0xFB71, 0x3002}, // usada8 r0, r1, r2, r3
+    }};
+
+    for (const auto& encoding : encodings) {
+        INFO("Arm encoding: " << std::hex << encoding.arm);
+
+        ArmTestEnv arm_env;
+        Dynarmic::A32::UserConfig arm_config;
+        arm_config.callbacks = &arm_env;
+        Dynarmic::A32::Jit arm_jit{arm_config};
+        arm_env.code_mem = {encoding.arm, 0xEAFFFFFE};
+
+        ThumbTestEnv thumb_env;
+        Dynarmic::A32::Jit thumb_jit{GetUserConfig(&thumb_env)};
+        thumb_env.code_mem = {encoding.thumb_hi, encoding.thumb_lo, 0xE7FE};
+
+        for (size_t i = 0; i < 100; i++) {
+            const u32 flags = (RandInt<u32>(0, 0x1F) << 27) | (RandInt<u32>(0, 0xF) << 16); // NZCVQ, GE
+            for (size_t reg = 0; reg < 4; reg++) {
+                const u32 value = RandInt<u32>(0, 0xFFFFFFFF);
+                arm_jit.Regs()[reg] = value;
+                thumb_jit.Regs()[reg] = value;
+            }
+            arm_jit.Regs()[15] = 0;
+            thumb_jit.Regs()[15] = 0;
+            arm_jit.SetCpsr(flags | 0x00000010); // User-mode
+            thumb_jit.SetCpsr(flags | 0x00000030); // Thumb, User-mode
+
+            arm_env.ticks_left = 1;
+            arm_jit.Run();
+            thumb_env.ticks_left = 1;
+            thumb_jit.Run();
+
+            for (size_t reg = 0; reg < 4; reg++) {
+                REQUIRE(thumb_jit.Regs()[reg] == arm_jit.Regs()[reg]);
+            }
+            REQUIRE(thumb_jit.Regs()[15] == 4);
+            REQUIRE(thumb_jit.Cpsr() == (arm_jit.Cpsr() | 0x00000020));
+        }
+    }
+}
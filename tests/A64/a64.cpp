@@ -3,11 +3,22 @@
  * SPDX-License-Identifier: 0BSD
  */
 
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <limits>
+#include <optional>
+
 #include <catch.hpp>
+#include <fmt/format.h>
 
 #include <dynarmic/exclusive_monitor.h>
 
+#include "common/fp/fpcr.h"
 #include "common/fp/fpsr.h"
+#include "common/fp/op.h"
+#include "rand_int.h"
 #include "testenv.h"
 
 using namespace Dynarmic;
@@ -634,3 +645,2156 @@ TEST_CASE("A64: Optimization failure when folding ADD", "[a64]") {
     REQUIRE(jit.GetPstate() == 0x20000000);
     REQUIRE(jit.GetVector(30) == Vector{0xf7f6f5f4, 0});
 }
+
+TEST_CASE("A64: Memory forwarding respects aliasing stores", "[a64]") {
+    A64TestEnv env;
+    A64::UserConfig conf{&env};
+    conf.memory_not_concurrently_modified = true;
+    A64::Jit jit{conf};
+
+    env.code_mem.emplace_back(0xf9000401); // STR X1, [X0, #8]
+    env.code_mem.emplace_back(0xb9000062); // STR W2, [X3]
+    env.code_mem.emplace_back(0xf9400404); // LDR X4, [X0, #8]
+    env.code_mem.emplace_back(0xf9400405); // LDR X5, [X0, #8]
+    env.code_mem.emplace_back(0xb9400066); // LDR W6, [X3]
+    env.code_mem.emplace_back(0xf9000107); // STR X7, [X8]
+    env.code_mem.emplace_back(0xf9400409); // LDR X9, [X0, #8]
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    jit.SetPC(0);
+    jit.SetRegister(0, 0x100);
+    jit.SetRegister(1, 0x1111111122222222);
+    jit.SetRegister(2, 0x33333333);
+    jit.SetRegister(3, 0x10c);
+    jit.SetRegister(7, 0x4444444455555555);
+    jit.SetRegister(8, 0x108);
+
+    env.ticks_left = 8;
+    jit.Run();
+
+    REQUIRE(jit.GetRegister(4) == 0x3333333322222222);
+    REQUIRE(jit.GetRegister(5) == 0x3333333322222222);
+    REQUIRE(jit.GetRegister(6) == 0x33333333);
+    REQUIRE(jit.GetRegister(9) == 0x4444444455555555);
+    REQUIRE(jit.GetPC() == 28);
+}
+
+TEST_CASE("A64: Code fetch from host code page", "[a64]") {
+    A64TestEnv env;
+
+    std::array<u32, 1024> code_page;
+    code_page.fill(0x91000400); // ADD X0, X0, #1
+    env.code_pages[0] = code_page.data();
+
+    env.code_mem_start_address = 0x1000;
+    env.code_mem.emplace_back(0x91000800); // ADD X0, X0, #2
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    A64::Jit jit{A64::UserConfig{&env}};
+    jit.SetPC(0xff8);
+    jit.SetRegister(0, 0);
+
+    env.ticks_left = 4;
+    jit.Run();
+
+    REQUIRE(jit.GetRegister(0) == 4);
+    REQUIRE(jit.GetPC() == 0x1004);
+}
+
+TEST_CASE("A64: Unaligned code fetch at the end of a host code page", "[a64]") {
+    A64TestEnv env;
+
+    // The word after the page would combine with the end of the page into ADD X0, X0, #1.
+    std::array<u32, 1025> code_page{};
+    code_page[1023] = 0x04000000;
+    code_page[1024] = 0x00009100;
+    env.code_pages[0] = code_page.data();
+
+    A64::Jit jit{A64::UserConfig{&env}};
+    jit.SetPC(0xffe);
+    jit.SetRegister(0, 0);
+
+    env.ticks_left = 2;
+    jit.Run();
+
+    // The fetch must go through MemoryReadCode, which returns B . here.
+    REQUIRE(jit.GetRegister(0) == 0);
+    REQUIRE(jit.GetPC() == 0xffe);
+}
+
+TEST_CASE("A64: LDP/STP through page_table", "[a64]") {
+    A64TestEnv env;
+
+    std::array<u8, 4096> page0{};
+    std::array<void*, 16> page_table{};
+    page_table[0] = page0.data();
+
+    A64::UserConfig conf{&env};
+    conf.page_table = page_table.data();
+    conf.page_table_address_space_bits = 16;
+    A64::Jit jit{conf};
+
+    env.code_mem.emplace_back(0xa9000801); // STP X1, X2, [X0]
+    env.code_mem.emplace_back(0xa9401003); // LDP X3, X4, [X0]
+    env.code_mem.emplace_back(0x290008a1); // STP W1, W2, [X5]
+    env.code_mem.emplace_back(0x29401ca6); // LDP W6, W7, [X5]
+    env.code_mem.emplace_back(0xa9402548); // LDP X8, X9, [X10]
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    jit.SetPC(0);
+    jit.SetRegister(0, 0x100);
+    jit.SetRegister(1, 0x0123456789abcdef);
+    jit.SetRegister(2, 0xfedcba9876543210);
+    jit.SetRegister(5, 0xffc);
+    jit.SetRegister(10, 0x2000);
+
+    env.ticks_left = 6;
+    jit.Run();
+
+    u64 lo, hi;
+    std::memcpy(&lo, page0.data() + 0x100, sizeof(lo));
+    std::memcpy(&hi, page0.data() + 0x108, sizeof(hi));
+    REQUIRE(lo == 0x0123456789abcdef);
+    REQUIRE(hi == 0xfedcba9876543210);
+
+    REQUIRE(jit.GetRegister(3) == 0x0123456789abcdef);
+    REQUIRE(jit.GetRegister(4) == 0xfedcba9876543210);
+    REQUIRE(jit.GetRegister(6) == 0x89abcdef);
+    REQUIRE(jit.GetRegister(7) == 0x76543210);
+    REQUIRE(jit.GetRegister(8) == 0x0706050403020100);
+    REQUIRE(jit.GetRegister(9) == 0x0f0e0d0c0b0a0908);
+    REQUIRE(jit.GetPC() == 20);
+}
+
+TEST_CASE("A64: Page-straddling accesses through page_table", "[a64]") {
+    A64TestEnv env;
+
+    std::array<u8, 4096> page1{};
+    std::array<u8, 4096> page2{};
+    std::array<void*, 16> page_table{};
+    page_table[1] = page1.data();
+    page_table[2] = page2.data();
+
+    A64::UserConfig conf{&env};
+    conf.page_table = page_table.data();
+    conf.page_table_address_space_bits = 16;
+    conf.detect_misaligned_access_via_page_table = 16 | 32 | 64 | 128;
+    conf.only_detect_misalignment_via_page_table_on_page_boundary = true;
+    A64::Jit jit{conf};
+
+    env.code_mem.emplace_back(0xf9000001); // STR X1, [X0]
+    env.code_mem.emplace_back(0xf9400003); // LDR X3, [X0]
+    env.code_mem.emplace_back(0x794000a4); // LDRH W4, [X5]
+    env.code_mem.emplace_back(0x3d8000c0); // STR Q0, [X6]
+    env.code_mem.emplace_back(0x3dc000c1); // LDR Q1, [X6]
+    env.code_mem.emplace_back(0xf9400107); // LDR X7, [X8]
+    env.code_mem.emplace_back(0xb9000149); // STR W9, [X10]
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    jit.SetPC(0);
+    jit.SetRegister(0, 0x1ffd);
+    jit.SetRegister(1, 0x0123456789abcdef);
+    jit.SetRegister(5, 0x1fff);
+    jit.SetRegister(6, 0x1ff9);
+    jit.SetVector(0, {0x0706050403020100, 0x0f0e0d0c0b0a0908});
+    jit.SetRegister(8, 0x2ffe);
+    jit.SetRegister(9, 0xdeadbeef);
+    jit.SetRegister(10, 0x2ffe);
+
+    env.ticks_left = 8;
+    jit.Run();
+
+    REQUIRE(jit.GetRegister(3) == 0x0123456789abcdef);
+    REQUIRE(jit.GetRegister(4) == 0x89ab);
+    REQUIRE(jit.GetVector(1) == Vector{0x0706050403020100, 0x0f0e0d0c0b0a0908});
+
+    // The accesses were performed directly against both pages.
+    for (size_t i = 0; i < 7; i++) {
+        REQUIRE(page1[0xff9 + i] == i);
+    }
+    for (size_t i = 0; i < 9; i++) {
+        REQUIRE(page2[i] == i + 7);
+    }
+    REQUIRE(env.modified_memory.count(0x1ffd) == 0);
+
+    // Accesses that touch an unmapped page go through the memory callbacks in their entirety.
+    REQUIRE(jit.GetRegister(7) == 0x050403020100fffe);
+    REQUIRE(page2[0xffe] == 0);
+    REQUIRE(env.modified_memory[0x2ffe] == 0xef);
+    REQUIRE(env.modified_memory[0x3001] == 0xde);
+    REQUIRE(jit.GetPC() == 28);
+}
+
+TEST_CASE("A64: LSE atomic memory operations", "[a64]") {
+    A64TestEnv env;
+
+    alignas(16) std::array<u8, 4096> page0{};
+    std::array<void*, 16> page_table{};
+    page_table[0] = page0.data();
+
+    A64::UserConfig conf{&env};
+    SECTION("through page_table") {
+        conf.page_table = page_table.data();
+        conf.page_table_address_space_bits = 16;
+    }
+    SECTION("through callbacks") {}
+    A64::Jit jit{conf};
+
+    const auto write = [&](u64 vaddr, u64 value, size_t bytes) {
+        for (size_t i = 0; i < bytes; i++) {
+            const u8 byte = static_cast<u8>(value >> (i * 8));
+            if (conf.page_table) {
+                page0[vaddr + i] = byte;
+            } else {
+                env.modified_memory[vaddr + i] = byte;
+            }
+        }
+    };
+    const auto read = [&](u64 vaddr, size_t bytes) {
+        u64 value = 0;
+        for (size_t i = 0; i < bytes; i++) {
+            const u8 byte = conf.page_table ? page0[vaddr + i] : env.MemoryRead8(vaddr + i);
+            value |= u64{byte} << (i * 8);
+        }
+        return value;
+    };
+
+    env.code_mem.emplace_back(0xf8210002); // LDADD X1, X2, [X0]
+    env.code_mem.emplace_back(0xb8e310a4); // LDCLRAL W3, W4, [X5]
+    env.code_mem.emplace_back(0x38264107); // LDSMAXB W6, W7, [X8]
+    env.code_mem.emplace_back(0x7829616a); // LDUMAXH W9, W10, [X11]
+    env.code_mem.emplace_back(0xf82c51cd); // LDSMIN X12, X13, [X14]
+    env.code_mem.emplace_back(0xb82f2230); // LDEOR W15, W16, [X17]
+    env.code_mem.emplace_back(0x38323293); // LDSETB W18, W19, [X20]
+    env.code_mem.emplace_back(0xf8f582f6); // SWPAL X21, X22, [X23]
+    env.code_mem.emplace_back(0xc8b87f59); // CAS X24, X25, [X26]
+    env.code_mem.emplace_back(0x88fbffbc); // CASAL W27, W28, [X29]
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    write(0x100, 0x10, 8);
+    write(0x108, 0xff00ff00, 4);
+    write(0x110, 0x80, 1);
+    write(0x112, 0x8000, 2);
+    write(0x118, 3, 8);
+    write(0x120, 7, 4);
+    write(0x124, 1, 1);
+    write(0x128, 0x1111, 8);
+    write(0x130, 0x1234, 8);
+    write(0x138, 9, 4);
+
+    jit.SetPC(0);
+    jit.SetRegister(0, 0x100);
+    jit.SetRegister(1, 5);
+    jit.SetRegister(3, 0x0ff00ff0);
+    jit.SetRegister(5, 0x108);
+    jit.SetRegister(6, 0x7f);
+    jit.SetRegister(8, 0x110);
+    jit.SetRegister(9, 0x7fff);
+    jit.SetRegister(11, 0x112);
+    jit.SetRegister(12, 0xfffffffffffffffb);
+    jit.SetRegister(14, 0x118);
+    jit.SetRegister(15, 3);
+    jit.SetRegister(17, 0x120);
+    jit.SetRegister(18, 0x80);
+    jit.SetRegister(20, 0x124);
+    jit.SetRegister(21, 0x2222);
+    jit.SetRegister(23, 0x128);
+    jit.SetRegister(24, 0x1234);
+    jit.SetRegister(25, 0x5678);
+    jit.SetRegister(26, 0x130);
+    jit.SetRegister(27, 8);
+    jit.SetRegister(28, 0xaa);
+    jit.SetRegister(29, 0x138);
+
+    env.ticks_left = 11;
+    jit.Run();
+
+    REQUIRE(jit.GetRegister(2) == 0x10);
+    REQUIRE(read(0x100, 8) == 0x15);
+    REQUIRE(jit.GetRegister(4) == 0xff00ff00);
+    REQUIRE(read(0x108, 4) == 0xf000f000);
+    REQUIRE(jit.GetRegister(7) == 0x80);
+    REQUIRE(read(0x110, 1) == 0x7f);
+    REQUIRE(jit.GetRegister(10) == 0x8000);
+    REQUIRE(read(0x112, 2) == 0x8000);
+    REQUIRE(jit.GetRegister(13) == 3);
+    REQUIRE(read(0x118, 8) == 0xfffffffffffffffb);
+    REQUIRE(jit.GetRegister(16) == 7);
+    REQUIRE(read(0x120, 4) == 4);
+    REQUIRE(jit.GetRegister(19) == 1);
+    REQUIRE(read(0x124, 1) == 0x81);
+    REQUIRE(jit.GetRegister(22) == 0x1111);
+    REQUIRE(read(0x128, 8) == 0x2222);
+    REQUIRE(jit.GetRegister(24) == 0x1234);
+    REQUIRE(read(0x130, 8) == 0x5678);
+    REQUIRE(jit.GetRegister(27) == 9);
+    REQUIRE(read(0x138, 4) == 9);
+    REQUIRE(jit.GetPC() == 40);
+}
+
+TEST_CASE("A64: LSE compare-and-swap pair", "[a64]") {
+    A64TestEnv env;
+
+    alignas(16) std::array<u8, 4096> page0{};
+    std::array<void*, 16> page_table{};
+    page_table[0] = page0.data();
+
+    A64::UserConfig conf{&env};
+    SECTION("through page_table") {
+        conf.page_table = page_table.data();
+        conf.page_table_address_space_bits = 16;
+    }
+    SECTION("through callbacks") {}
+    A64::Jit jit{conf};
+
+    const auto write = [&](u64 vaddr, u64 value) {
+        if (conf.page_table) {
+            std::memcpy(page0.data() + vaddr, &value, sizeof(value));
+        } else {
+            env.MemoryWrite64(vaddr, value);
+        }
+    };
+    const auto read = [&](u64 vaddr) {
+        u64 value = 0;
+        if (conf.page_table) {
+            std::memcpy(&value, page0.data() + vaddr, sizeof(value));
+        } else {
+            value = env.MemoryRead64(vaddr);
+        }
+        return value;
+    };
+
+    env.code_mem.emplace_back(0x48227c04); // CASP X2, X3, X4, X5, [X0]
+    env.code_mem.emplace_back(0x08267c28); // CASP W6, W7, W8, W9, [X1]
+    env.code_mem.emplace_back(0xf8bfc00a); // LDAPR X10, [X0]
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    write(0x200, 1);
+    write(0x208, 2);
+    write(0x300, 0x0000002000000010);
+
+    jit.SetPC(0);
+    jit.SetRegister(0, 0x200);
+    jit.SetRegister(1, 0x300);
+    jit.SetRegister(2, 1);
+    jit.SetRegister(3, 2);
+    jit.SetRegister(4, 0xaa);
+    jit.SetRegister(5, 0xbb);
+    jit.SetRegister(6, 0x10);
+    jit.SetRegister(7, 0x21);
+    jit.SetRegister(8, 0xcc);
+    jit.SetRegister(9, 0xdd);
+
+    env.ticks_left = 4;
+    jit.Run();
+
+    REQUIRE(jit.GetRegister(2) == 1);
+    REQUIRE(jit.GetRegister(3) == 2);
+    REQUIRE(read(0x200) == 0xaa);
+    REQUIRE(read(0x208) == 0xbb);
+    REQUIRE(jit.GetRegister(6) == 0x10);
+    REQUIRE(jit.GetRegister(7) == 0x20);
+    REQUIRE(read(0x300) == 0x0000002000000010);
+    REQUIRE(jit.GetRegister(10) == 0xaa);
+    REQUIRE(jit.GetPC() == 12);
+}
+
+TEST_CASE("A64: LSE atomics clear exclusive reservations", "[a64]") {
+    A64TestEnv env;
+    ExclusiveMonitor monitor{1};
+    std::array<void*, 16> page_table{};
+
+    A64::UserConfig conf{&env};
+    conf.global_monitor = &monitor;
+    SECTION("without page_table") {}
+    SECTION("with unmapped pages") {
+        conf.page_table = page_table.data();
+        conf.page_table_address_space_bits = 16;
+    }
+    A64::Jit jit{conf};
+
+    env.code_mem.emplace_back(0xc85f7c2b); // LDXR X11, [X1]
+    env.code_mem.emplace_back(0xf82c003f); // STADD X12, [X1]
+    env.code_mem.emplace_back(0xc80d7c2e); // STXR W13, X14, [X1]
+    env.code_mem.emplace_back(0xc8af7c30); // CAS X15, X16, [X1]
+    env.code_mem.emplace_back(0x48227c04); // CASP X2, X3, X4, X5, [X0]
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    env.MemoryWrite64(0x200, 1);
+    env.MemoryWrite64(0x208, 2);
+    env.MemoryWrite64(0x300, 0x10);
+
+    jit.SetPC(0);
+    jit.SetRegister(0, 0x200);
+    jit.SetRegister(1, 0x300);
+    jit.SetRegister(2, 1);
+    jit.SetRegister(3, 2);
+    jit.SetRegister(4, 0xaa);
+    jit.SetRegister(5, 0xbb);
+    jit.SetRegister(12, 1);
+    jit.SetRegister(14, 0xdeadbeef);
+    jit.SetRegister(15, 0x11);
+    jit.SetRegister(16, 0x22);
+
+    env.ticks_left = 6;
+    jit.Run();
+
+    REQUIRE(jit.GetRegister(11) == 0x10);
+    REQUIRE(jit.GetRegister(13) == 1);
+    REQUIRE(jit.GetRegister(15) == 0x11);
+    REQUIRE(env.MemoryRead64(0x300) == 0x22);
+    REQUIRE(jit.GetRegister(2) == 1);
+    REQUIRE(jit.GetRegister(3) == 2);
+    REQUIRE(env.MemoryRead128(0x200) == Vector{0xaa, 0xbb});
+    REQUIRE(jit.GetPC() == 20);
+}
+
+TEST_CASE("A64: Atomic operations clear reservations anywhere in the accessed range", "[a64]") {
+    ExclusiveMonitor monitor{2};
+
+    monitor.ReadAndMark<u64>(0, 0x108, [] { return u64{0}; });
+    monitor.ReadAndMark<u64>(1, 0x110, [] { return u64{0}; });
+    monitor.DoAtomicOperation<Vector>(0x100, [] { return Vector{}; });
+
+    REQUIRE(!monitor.DoExclusiveOperation<u64>(0, 0x108, [](u64) { return true; }));
+    REQUIRE(monitor.DoExclusiveOperation<u64>(1, 0x110, [](u64) { return true; }));
+}
+
+TEST_CASE("A64: Unsafe_InaccurateNaN only affects NaN results", "[a64]") {
+    A64TestEnv env;
+
+    A64::UserConfig accurate_conf{&env};
+    A64::Jit accurate_jit{accurate_conf};
+
+    A64::UserConfig inaccurate_conf{&env};
+    inaccurate_conf.unsafe_optimizations = true;
+    inaccurate_conf.optimizations |= OptimizationFlag::Unsafe_InaccurateNaN;
+    A64::Jit inaccurate_jit{inaccurate_conf};
+
+    env.code_mem.emplace_back(0x4e21d402); // FADD V2.4S, V0.4S, V1.4S
+    env.code_mem.emplace_back(0x6e21dc03); // FMUL V3.4S, V0.4S, V1.4S
+    env.code_mem.emplace_back(0x6e21fc04); // FDIV V4.4S, V0.4S, V1.4S
+    env.code_mem.emplace_back(0x6ea1f805); // FSQRT V5.4S, V0.4S
+    env.code_mem.emplace_back(0x1e612806); // FADD D6, D0, D1
+    env.code_mem.emplace_back(0x4e21cc07); // FMLA V7.4S, V0.4S, V1.4S
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    const auto random_float_pair = [] {
+        // Bias towards special values so that NaN and infinity inputs occur regularly.
+        const auto random_float = [] {
+            switch (RandInt(0, 7)) {
+            case 0:
+                return RandInt<u32>(0x7f800000, 0x7fffffff) | (RandInt<u32>(0, 1) << 31);
+            case 1:
+                return 0x7f800000 | (RandInt<u32>(0, 1) << 31);
+            default:
+                return RandInt<u32>(0, 0xffffffff);
+            }
+        };
+        return u64(random_float()) | u64(random_float()) << 32;
+    };
+
+    for (size_t iteration = 0; iteration < 1000; iteration++) {
+        const Vector v0{random_float_pair(), random_float_pair()};
+        const Vector v1{random_float_pair(), random_float_pair()};
+        const Vector v7{random_float_pair(), random_float_pair()};
+
+        for (A64::Jit* jit : {&accurate_jit, &inaccurate_jit}) {
+            jit->SetPC(0);
+            jit->SetVector(0, v0);
+            jit->SetVector(1, v1);
+            jit->SetVector(7, v7);
+            env.ticks_left = 7;
+            jit->Run();
+        }
+
+        const auto is_nan_32 = [](u32 x) { return (x & 0x7f800000) == 0x7f800000 && (x & 0x007fffff) != 0; };
+        const auto is_nan_64 = [](u64 x) { return (x & 0x7ff0000000000000) == 0x7ff0000000000000 && (x & 0x000fffffffffffff) != 0; };
+
+        for (size_t reg : {2, 3, 4, 5, 7}) {
+            const Vector expected = accurate_jit.GetVector(reg);
+            const Vector actual = inaccurate_jit.GetVector(reg);
+            for (size_t i = 0; i < 4; i++) {
+                const u32 expected_lane = static_cast<u32>(expected[i / 2] >> (i % 2 * 32));
+                const u32 actual_lane = static_cast<u32>(actual[i / 2] >> (i % 2 * 32));
+                if (is_nan_32(expected_lane)) {
+                    REQUIRE(is_nan_32(actual_lane));
+                } else {
+                    REQUIRE(actual_lane == expected_lane);
+                }
+            }
+        }
+
+        const u64 expected_d6 = accurate_jit.GetVector(6)[0];
+        const u64 actual_d6 = inaccurate_jit.GetVector(6)[0];
+        if (is_nan_64(expected_d6)) {
+            REQUIRE(is_nan_64(actual_d6));
+        } else {
+            REQUIRE(actual_d6 == expected_d6);
+        }
+    }
+}
+
+TEST_CASE("A64: SHA1 and SHA256 instructions", "[a64]") {
+    struct TestCase {
+        u32 instruction;
+        Vector expected;
+    };
+
+    const std::array<TestCase, 7> test_cases{{
+        {0x5E020020, {0xb8ddf7e5107e4bf1, 0x0154fab570fd9cbe}}, // SHA1C Q0, S1, V2.4S
+        {0x5E021020, {0x1228a86979c8be72, 0xe408bf8a19ccc64e}}, // SHA1P Q0, S1, V2.4S
+        {0x5E022020, {0xf43799bcd8c86340, 0x1f32d8931f345002}}, // SHA1M Q0, S1, V2.4S
+        {0x5E024020, {0x73c0cfaa6a1d48d5, 0x1f295c76c9440a43}}, // SHA256H Q0, Q1, V2.4S
+        {0x5E025020, {0xa1499418867992ef, 0x59bf4e2002dca6ec}}, // SHA256H2 Q0, Q1, V2.4S
+        {0x5E026020, {0xb94c34e4d09458f5, 0x21405beda53b4f12}}, // SHA256SU1 V0.4S, V1.4S, V2.4S
+        {0x5E282820, {0x23c5791aa92bbc5d, 0x6280a5c376d443a1}}, // SHA256SU0 V0.4S, V1.4S
+    }};
+
+    for (const auto& test_case : test_cases) {
+        A64TestEnv env;
+        A64::Jit jit{A64::UserConfig{&env}};
+
+        env.code_mem.emplace_back(test_case.instruction);
+        env.code_mem.emplace_back(0x14000000); // B .
+
+        jit.SetPC(0);
+        jit.SetVector(0, {0x0123456789ABCDEF, 0xFEDCBA9876543210});
+        jit.SetVector(1, {0x0F1E2D3C4B5A6978, 0x8796A5B4C3D2E1F0});
+        jit.SetVector(2, {0x243F6A8885A308D3, 0x13198A2E03707344});
+
+        env.ticks_left = 1;
+        jit.Run();
+
+        INFO("instruction: " << std::hex << test_case.instruction);
+        REQUIRE(jit.GetVector(0) == test_case.expected);
+        REQUIRE(jit.GetVector(1) == Vector{0x0F1E2D3C4B5A6978, 0x8796A5B4C3D2E1F0});
+        REQUIRE(jit.GetVector(2) == Vector{0x243F6A8885A308D3, 0x13198A2E03707344});
+    }
+}
+
+TEST_CASE("A64: SM4E and SM4EKEY", "[a64]") {
+    struct TestCase {
+        u32 instruction;
+        Vector expected;
+    };
+
+    const std::array<TestCase, 2> test_cases{{
+        {0xCEC08420, {0x7e5e055307695f13, 0x531e1aa547893dcd}}, // SM4E V0.4S, V1.4S
+        {0xCE62C820, {0xa1b7323f808c519c, 0xc8234ae6c3b22260}}, // SM4EKEY V0.4S, V1.4S, V2.4S
+    }};
+
+    for (const auto& test_case : test_cases) {
+        A64TestEnv env;
+        A64::Jit jit{A64::UserConfig{&env}};
+
+        env.code_mem.emplace_back(test_case.instruction);
+        env.code_mem.emplace_back(0x14000000); // B .
+
+        jit.SetPC(0);
+        jit.SetVector(0, {0x0123456789ABCDEF, 0xFEDCBA9876543210});
+        jit.SetVector(1, {0x0F1E2D3C4B5A6978, 0x8796A5B4C3D2E1F0});
+        jit.SetVector(2, {0x243F6A8885A308D3, 0x13198A2E03707344});
+
+        env.ticks_left = 1;
+        jit.Run();
+
+        INFO("instruction: " << std::hex << test_case.instruction);
+        REQUIRE(jit.GetVector(0) == test_case.expected);
+        REQUIRE(jit.GetVector(1) == Vector{0x0F1E2D3C4B5A6978, 0x8796A5B4C3D2E1F0});
+        REQUIRE(jit.GetVector(2) == Vector{0x243F6A8885A308D3, 0x13198A2E03707344});
+    }
+}
+
+namespace {
+
+template <typename T, typename Fn>
+Vector Lanewise(const Vector& a, const Vector& b, Fn fn) {
+    std::array<T, sizeof(Vector) / sizeof(T)> x, y, result;
+    std::memcpy(x.data(), a.data(), sizeof(Vector));
+    std::memcpy(y.data(), b.data(), sizeof(Vector));
+    for (size_t i = 0; i < result.size(); i++) {
+        result[i] = fn(x[i], y[i]);
+    }
+    Vector ret;
+    std::memcpy(ret.data(), result.data(), sizeof(Vector));
+    return ret;
+}
+
+template <typename T, typename Fn>
+Vector Pairwise(const Vector& a, const Vector& b, Fn fn) {
+    std::array<T, sizeof(Vector) / sizeof(T)> x, y, result;
+    std::memcpy(x.data(), a.data(), sizeof(Vector));
+    std::memcpy(y.data(), b.data(), sizeof(Vector));
+    const size_t half = result.size() / 2;
+    for (size_t i = 0; i < half; i++) {
+        result[i] = fn(x[2 * i], x[2 * i + 1]);
+        result[half + i] = fn(y[2 * i], y[2 * i + 1]);
+    }
+    Vector ret;
+    std::memcpy(ret.data(), result.data(), sizeof(Vector));
+    return ret;
+}
+
+// Shift right by amount, where amounts of at least the element size shift out every bit.
+template <typename T>
+T ShiftRightSaturatingAmount(T x, int amount) {
+    constexpr int esize = static_cast<int>(sizeof(T) * 8);
+    if (amount >= esize) {
+        return std::is_signed_v<T> && x < 0 ? T(-1) : T(0);
+    }
+    return static_cast<T>(x >> amount);
+}
+
+template <typename T>
+T ReferenceShiftLeft(T x, T y, bool rounding) {
+    using U = std::make_unsigned_t<T>;
+    constexpr int esize = static_cast<int>(sizeof(T) * 8);
+    const int amount = static_cast<s8>(static_cast<u8>(y));
+
+    if (amount >= 0) {
+        return amount >= esize ? T(0) : static_cast<T>(static_cast<U>(x) << amount);
+    }
+
+    const int n = -amount;
+    const T shifted = ShiftRightSaturatingAmount(x, n);
+    if (!rounding) {
+        return shifted;
+    }
+    // (x + 2^(n-1)) >> n == (x >> n) + bit (n - 1) of x
+    return static_cast<T>(shifted + (ShiftRightSaturatingAmount(x, n - 1) & 1));
+}
+
+template <typename T>
+Vector RandomShiftVector() {
+    constexpr int esize = static_cast<int>(sizeof(T) * 8);
+    std::array<T, sizeof(Vector) / sizeof(T)> shifts;
+    for (auto& shift : shifts) {
+        const u64 amount = RandInt(0, 3) == 0 ? RandInt<u64>(0, 255) : static_cast<u64>(RandInt(-esize - 2, esize + 2));
+        shift = static_cast<T>((RandInt<u64>(0, ~u64(0)) & ~u64(0xFF)) | (amount & 0xFF));
+    }
+    Vector ret;
+    std::memcpy(ret.data(), shifts.data(), sizeof(Vector));
+    return ret;
+}
+
+} // Anonymous namespace
+
+TEST_CASE("A64: Vector variable shifts and paired min/max", "[a64]") {
+    using ReferenceFn = Vector (*)(const Vector&, const Vector&);
+    using ShiftGenerator = Vector (*)();
+
+    struct TestCase {
+        u32 instruction;
+        ReferenceFn reference;
+        ShiftGenerator second_operand;
+    };
+
+    const auto random_vector = []() -> Vector { return {RandInt<u64>(0, ~u64(0)), RandInt<u64>(0, ~u64(0))}; };
+
+#define SHIFT_CASE(instruction, T, rounding) \
+    TestCase{instruction, [](const Vector& a, const Vector& b) { return Lanewise<T>(a, b, [](T x, T y) { return ReferenceShiftLeft<T>(x, y, rounding); }); }, RandomShiftVector<T>}
+#define PAIRWISE_CASE(instruction, T, fn) \
+    TestCase{instruction, [](const Vector& a, const Vector& b) { return Pairwise<T>(a, b, [](T x, T y) { return fn(x, y); }); }, random_vector}
+
+    const std::array test_cases{
+        SHIFT_CASE(0x4e214402, s8, false),  // SSHL V2.16B, V0.16B, V1.16B
+        SHIFT_CASE(0x6e214402, u8, false),  // USHL V2.16B, V0.16B, V1.16B
+        SHIFT_CASE(0x4e215402, s8, true),   // SRSHL V2.16B, V0.16B, V1.16B
+        SHIFT_CASE(0x6e215402, u8, true),   // URSHL V2.16B, V0.16B, V1.16B
+        SHIFT_CASE(0x4e615402, s16, true),  // SRSHL V2.8H, V0.8H, V1.8H
+        SHIFT_CASE(0x4ea15402, s32, true),  // SRSHL V2.4S, V0.4S, V1.4S
+        SHIFT_CASE(0x4ee15402, s64, true),  // SRSHL V2.2D, V0.2D, V1.2D
+        SHIFT_CASE(0x6e615402, u16, true),  // URSHL V2.8H, V0.8H, V1.8H
+        SHIFT_CASE(0x6ea15402, u32, true),  // URSHL V2.4S, V0.4S, V1.4S
+        SHIFT_CASE(0x6ee15402, u64, true),  // URSHL V2.2D, V0.2D, V1.2D
+        PAIRWISE_CASE(0x4e21a402, s8, std::max),   // SMAXP V2.16B, V0.16B, V1.16B
+        PAIRWISE_CASE(0x4e61a402, s16, std::max),  // SMAXP V2.8H, V0.8H, V1.8H
+        PAIRWISE_CASE(0x6e21a402, u8, std::max),   // UMAXP V2.16B, V0.16B, V1.16B
+        PAIRWISE_CASE(0x6e61a402, u16, std::max),  // UMAXP V2.8H, V0.8H, V1.8H
+        PAIRWISE_CASE(0x4e21ac02, s8, std::min),   // SMINP V2.16B, V0.16B, V1.16B
+        PAIRWISE_CASE(0x4e61ac02, s16, std::min),  // SMINP V2.8H, V0.8H, V1.8H
+        PAIRWISE_CASE(0x6e21ac02, u8, std::min),   // UMINP V2.16B, V0.16B, V1.16B
+        PAIRWISE_CASE(0x6e61ac02, u16, std::min),  // UMINP V2.8H, V0.8H, V1.8H
+    };
+
+#undef SHIFT_CASE
+#undef PAIRWISE_CASE
+
+    A64TestEnv env;
+    A64::Jit jit{A64::UserConfig{&env}};
+
+    for (const auto& test_case : test_cases) {
+        env.code_mem.emplace_back(test_case.instruction);
+        env.code_mem.emplace_back(0x14000000); // B .
+    }
+
+    for (size_t i = 0; i < test_cases.size(); i++) {
+        INFO("instruction: " << std::hex << test_cases[i].instruction);
+
+        for (size_t iteration = 0; iteration < 200; iteration++) {
+            const Vector a = random_vector();
+            const Vector b = test_cases[i].second_operand();
+
+            jit.SetPC(i * 8);
+            jit.SetVector(0, a);
+            jit.SetVector(1, b);
+            env.ticks_left = 2;
+            jit.Run();
+
+            INFO("a: " << std::hex << a[0] << " " << a[1] << " b: " << b[0] << " " << b[1]);
+            REQUIRE(jit.GetVector(2) == test_cases[i].reference(a, b));
+        }
+    }
+}
+
+namespace {
+
+// Returns the saturated result of shifting x by the signed low byte of y, and whether it saturated.
+template <typename T>
+std::pair<T, bool> ReferenceSaturatingShiftLeft(T x, T y, bool rounding) {
+    constexpr int esize = static_cast<int>(sizeof(T) * 8);
+    const int amount = static_cast<s8>(static_cast<u8>(y));
+
+    if (amount < 0) {
+        return {ReferenceShiftLeft<T>(x, y, rounding), false};
+    }
+
+    const T saturated = x < 0 ? std::numeric_limits<T>::min() : std::numeric_limits<T>::max();
+    if (x == 0) {
+        return {0, false};
+    }
+    if (amount >= esize || x > (std::numeric_limits<T>::max() >> amount) || x < (std::numeric_limits<T>::min() >> amount)) {
+        return {saturated, true};
+    }
+    return {ReferenceShiftLeft<T>(x, y, false), false};
+}
+
+template <typename T, bool rounding>
+std::pair<Vector, bool> SaturatingLanewise(const Vector& a, const Vector& b) {
+    std::array<T, sizeof(Vector) / sizeof(T)> x, y, result;
+    std::memcpy(x.data(), a.data(), sizeof(Vector));
+    std::memcpy(y.data(), b.data(), sizeof(Vector));
+    bool qc = false;
+    for (size_t i = 0; i < result.size(); i++) {
+        const auto [element, saturated] = ReferenceSaturatingShiftLeft<T>(x[i], y[i], rounding);
+        result[i] = element;
+        qc |= saturated;
+    }
+    Vector ret;
+    std::memcpy(ret.data(), result.data(), sizeof(Vector));
+    return {ret, qc};
+}
+
+} // Anonymous namespace
+
+TEST_CASE("A64: Vector saturating variable shifts", "[a64]") {
+    using ReferenceFn = std::pair<Vector, bool> (*)(const Vector&, const Vector&);
+    using ShiftGenerator = Vector (*)();
+
+    struct TestCase {
+        u32 instruction;
+        ReferenceFn reference;
+        ShiftGenerator second_operand;
+    };
+
+#define SATURATING_SHIFT_CASE(instruction, T, rounding) \
+    TestCase{instruction, SaturatingLanewise<T, rounding>, RandomShiftVector<T>}
+
+    const std::array test_cases{
+        SATURATING_SHIFT_CASE(0x4e214c02, s8, false),  // SQSHL V2.16B, V0.16B, V1.16B
+        SATURATING_SHIFT_CASE(0x4e614c02, s16, false), // SQSHL V2.8H, V0.8H, V1.8H
+        SATURATING_SHIFT_CASE(0x4ea14c02, s32, false), // SQSHL V2.4S, V0.4S, V1.4S
+        SATURATING_SHIFT_CASE(0x4ee14c02, s64, false), // SQSHL V2.2D, V0.2D, V1.2D
+        SATURATING_SHIFT_CASE(0x6e214c02, u8, false),  // UQSHL V2.16B, V0.16B, V1.16B
+        SATURATING_SHIFT_CASE(0x6e614c02, u16, false), // UQSHL V2.8H, V0.8H, V1.8H
+        SATURATING_SHIFT_CASE(0x6ea14c02, u32, false), // UQSHL V2.4S, V0.4S, V1.4S
+        SATURATING_SHIFT_CASE(0x6ee14c02, u64, false), // UQSHL V2.2D, V0.2D, V1.2D
+        SATURATING_SHIFT_CASE(0x4e215c02, s8, true),   // SQRSHL V2.16B, V0.16B, V1.16B
+        SATURATING_SHIFT_CASE(0x4e615c02, s16, true),  // SQRSHL V2.8H, V0.8H, V1.8H
+        SATURATING_SHIFT_CASE(0x4ea15c02, s32, true),  // SQRSHL V2.4S, V0.4S, V1.4S
+        SATURATING_SHIFT_CASE(0x4ee15c02, s64, true),  // SQRSHL V2.2D, V0.2D, V1.2D
+        SATURATING_SHIFT_CASE(0x6e215c02, u8, true),   // UQRSHL V2.16B, V0.16B, V1.16B
+        SATURATING_SHIFT_CASE(0x6e615c02, u16, true),  // UQRSHL V2.8H, V0.8H, V1.8H
+        SATURATING_SHIFT_CASE(0x6ea15c02, u32, true),  // UQRSHL V2.4S, V0.4S, V1.4S
+        SATURATING_SHIFT_CASE(0x6ee15c02, u64, true),  // UQRSHL V2.2D, V0.2D, V1.2D
+    };
+
+#undef SATURATING_SHIFT_CASE
+
+    A64TestEnv env;
+    A64::Jit jit{A64::UserConfig{&env}};
+
+    for (const auto& test_case : test_cases) {
+        env.code_mem.emplace_back(test_case.instruction);
+        env.code_mem.emplace_back(0x14000000); // B .
+    }
+
+    // Small values are included so that left shifts do not always saturate.
+    const auto random_vector = []() -> Vector {
+        const u64 mask = RandInt(0, 1) == 0 ? ~u64(0) : 0x0303030303030303;
+        return {RandInt<u64>(0, ~u64(0)) & mask, RandInt<u64>(0, ~u64(0)) & mask};
+    };
+
+    for (size_t i = 0; i < test_cases.size(); i++) {
+        INFO("instruction: " << std::hex << test_cases[i].instruction);
+
+        for (size_t iteration = 0; iteration < 200; iteration++) {
+            const Vector a = random_vector();
+            const Vector b = test_cases[i].second_operand();
+
+            jit.SetPC(i * 8);
+            jit.SetVector(0, a);
+            jit.SetVector(1, b);
+            jit.SetFpsr(0);
+            env.ticks_left = 2;
+            jit.Run();
+
+            const auto [expected, expected_qc] = test_cases[i].reference(a, b);
+            INFO("a: " << std::hex << a[0] << " " << a[1] << " b: " << b[0] << " " << b[1]);
+            REQUIRE(jit.GetVector(2) == expected);
+            REQUIRE(FP::FPSR{jit.GetFpsr()}.QC() == expected_qc);
+        }
+    }
+}
+
+// Not run by default. Reports the time per instruction of a dependent chain of vector shifts.
+TEST_CASE("A64: Vector variable shift throughput", "[.][a64][benchmark]") {
+    constexpr size_t chain_length = 16;
+    constexpr size_t iterations = 100000;
+
+    const std::array instructions{
+        std::make_pair(0x4e204c00u, "SQSHL V0.16B, V0.16B, V0.16B"),
+        std::make_pair(0x4e604c00u, "SQSHL V0.8H, V0.8H, V0.8H"),
+        std::make_pair(0x4ea04c00u, "SQSHL V0.4S, V0.4S, V0.4S"),
+        std::make_pair(0x4ee04c00u, "SQSHL V0.2D, V0.2D, V0.2D"),
+        std::make_pair(0x6e204c00u, "UQSHL V0.16B, V0.16B, V0.16B"),
+        std::make_pair(0x6e604c00u, "UQSHL V0.8H, V0.8H, V0.8H"),
+        std::make_pair(0x6ea04c00u, "UQSHL V0.4S, V0.4S, V0.4S"),
+        std::make_pair(0x6ee04c00u, "UQSHL V0.2D, V0.2D, V0.2D"),
+        std::make_pair(0x4e205c00u, "SQRSHL V0.16B, V0.16B, V0.16B"),
+        std::make_pair(0x4e605c00u, "SQRSHL V0.8H, V0.8H, V0.8H"),
+        std::make_pair(0x4ea05c00u, "SQRSHL V0.4S, V0.4S, V0.4S"),
+        std::make_pair(0x4ee05c00u, "SQRSHL V0.2D, V0.2D, V0.2D"),
+        std::make_pair(0x6e205c00u, "UQRSHL V0.16B, V0.16B, V0.16B"),
+        std::make_pair(0x6e605c00u, "UQRSHL V0.8H, V0.8H, V0.8H"),
+        std::make_pair(0x6ea05c00u, "UQRSHL V0.4S, V0.4S, V0.4S"),
+        std::make_pair(0x6ee05c00u, "UQRSHL V0.2D, V0.2D, V0.2D"),
+        std::make_pair(0x4e205400u, "SRSHL V0.16B, V0.16B, V0.16B"),
+        std::make_pair(0x6e205400u, "URSHL V0.16B, V0.16B, V0.16B"),
+    };
+
+    for (const auto& [instruction, name] : instructions) {
+        A64TestEnv env;
+        A64::Jit jit{A64::UserConfig{&env}};
+
+        env.code_mem.assign(chain_length, instruction);
+        env.code_mem.emplace_back(0x17fffff0); // B .-64
+
+        jit.SetPC(0);
+        jit.SetVector(0, {0x0102030405060708, 0xf1f2f3f4f5f6f7f8});
+        env.ticks_left = 1000;
+        jit.Run();
+
+        env.ticks_left = iterations * (chain_length + 1);
+        const auto start = std::chrono::steady_clock::now();
+        jit.Run();
+        const auto end = std::chrono::steady_clock::now();
+
+        const double ns = std::chrono::duration<double, std::nano>(end - start).count();
+        fmt::print("{}: {:.2f} ns/instruction\n", name, ns / static_cast<double>(iterations * chain_length));
+    }
+}
+
+TEST_CASE("A64: Half-precision conversions, comparisons and rounding", "[a64]") {
+    const auto random_half = []() -> u16 {
+        switch (RandInt(0, 5)) {
+        case 0:
+            return static_cast<u16>(RandInt<u16>(0x7c00, 0x7fff) | (RandInt<u16>(0, 1) << 15));
+        case 1:
+            return static_cast<u16>(RandInt<u16>(0x0000, 0x03ff) | (RandInt<u16>(0, 1) << 15));
+        default:
+            return RandInt<u16>(0, 0xffff);
+        }
+    };
+    const auto random_half_vector = [&]() -> Vector {
+        Vector result{};
+        for (size_t i = 0; i < 8; i++) {
+            result[i / 4] |= u64{random_half()} << (i % 4 * 16);
+        }
+        return result;
+    };
+    // Biased towards the range of values representable as halves, and towards special values.
+    const auto random_single = []() -> u32 {
+        const u32 sign = RandInt<u32>(0, 1) << 31;
+        switch (RandInt(0, 5)) {
+        case 0:
+            return sign | RandInt<u32>(0x7f800000, 0x7fffffff);
+        case 1:
+            return sign | RandInt<u32>(0x00000000, 0x007fffff);
+        case 2:
+        case 3:
+            return sign | (RandInt<u32>(100, 145) << 23) | RandInt<u32>(0, 0x007fffff);
+        default:
+            return RandInt<u32>(0, 0xffffffff);
+        }
+    };
+    const auto random_double = []() -> u64 {
+        const u64 sign = RandInt<u64>(0, 1) << 63;
+        switch (RandInt(0, 6)) {
+        case 0:
+            return sign | RandInt<u64>(0x7ff0000000000000, 0x7fffffffffffffff);
+        case 1:
+            return sign | RandInt<u64>(0, 0x000fffffffffffff);
+        case 2:
+            // Exactly halfway between two halves, or just either side of it.
+            return sign | (u64{RandInt<u32>(1000, 1038)} << 52) | (RandInt<u64>(0, 0x7ff) << 41) | (u64{1} << 40) | RandInt<u64>(0, 1);
+        case 3:
+        case 4:
+            return sign | (RandInt<u64>(980, 1045) << 52) | RandInt<u64>(0, 0x000fffffffffffff);
+        default:
+            return RandInt<u64>(0, ~u64(0));
+        }
+    };
+    const auto get_half = [](const Vector& v, size_t i) { return static_cast<u16>(v[i / 4] >> (i % 4 * 16)); };
+
+    A64TestEnv env;
+    A64::Jit jit{A64::UserConfig{&env}};
+
+    const std::array instructions{
+        0x1e23c002u, // FCVT H2, S0
+        0x1e63c023u, // FCVT H3, D1
+        0x1ee240a4u, // FCVT S4, H5
+        0x1ee2c0a6u, // FCVT D6, H5
+        0x4e4824a7u, // FCMEQ V7.8H, V5.8H, V8.8H
+        0x4e7988a9u, // FRINTN V9.8H, V5.8H
+        0x4ef988a9u, // FRINTP V9.8H, V5.8H
+        0x4e7998a9u, // FRINTM V9.8H, V5.8H
+        0x4ef998a9u, // FRINTZ V9.8H, V5.8H
+        0x6e7988a9u, // FRINTA V9.8H, V5.8H
+        0x6e7998a9u, // FRINTX V9.8H, V5.8H
+    };
+    for (const u32 instruction : instructions) {
+        env.code_mem.emplace_back(instruction);
+        env.code_mem.emplace_back(0x14000000); // B .
+    }
+
+    for (const u32 fpcr_value : {0x00000000u, 0x00400000u, 0x00800000u, 0x00c00000u, 0x01000000u, 0x02000000u, 0x02c00000u, 0x04000000u, 0x00080000u}) {
+        const FP::FPCR fpcr{fpcr_value};
+        jit.SetFpcr(fpcr_value);
+
+        for (size_t iteration = 0; iteration < 200; iteration++) {
+            const u32 s0 = random_single();
+            const u64 d1 = random_double();
+            const Vector v5 = random_half_vector();
+            Vector v8 = random_half_vector();
+            if (RandInt(0, 1)) {
+                v8[0] = v5[0];
+            }
+
+            for (size_t i = 0; i < instructions.size(); i++) {
+                INFO("instruction: " << std::hex << instructions[i] << " fpcr: " << fpcr_value);
+                INFO("s0: " << s0 << " d1: " << d1 << " v5: " << v5[0] << " " << v5[1] << " v8: " << v8[0] << " " << v8[1]);
+
+                jit.SetPC(i * 8);
+                jit.SetVector(0, {s0, 0});
+                jit.SetVector(1, {d1, 0});
+                jit.SetVector(5, v5);
+                jit.SetVector(8, v8);
+                jit.SetFpsr(0);
+                env.ticks_left = 2;
+                jit.Run();
+
+                FP::FPSR fpsr;
+                switch (i) {
+                case 0:
+                    REQUIRE(jit.GetVector(2)[0] == FP::FPConvert<u16>(s0, fpcr, fpcr.RMode(), fpsr));
+                    break;
+                case 1:
+                    REQUIRE(jit.GetVector(3)[0] == FP::FPConvert<u16>(d1, fpcr, fpcr.RMode(), fpsr));
+                    break;
+                case 2:
+                    REQUIRE(jit.GetVector(4)[0] == FP::FPConvert<u32>(get_half(v5, 0), fpcr, fpcr.RMode(), fpsr));
+                    break;
+                case 3:
+                    REQUIRE(jit.GetVector(6)[0] == FP::FPConvert<u64>(get_half(v5, 0), fpcr, fpcr.RMode(), fpsr));
+                    break;
+                case 4:
+                    for (size_t lane = 0; lane < 8; lane++) {
+                        const u16 expected = FP::FPCompareEQ(get_half(v5, lane), get_half(v8, lane), fpcr, fpsr) ? 0xffff : 0;
+                        REQUIRE(get_half(jit.GetVector(7), lane) == expected);
+                    }
+                    break;
+                default: {
+                    constexpr std::array rounding_modes{
+                        FP::RoundingMode::ToNearest_TieEven,
+                        FP::RoundingMode::TowardsPlusInfinity,
+                        FP::RoundingMode::TowardsMinusInfinity,
+                        FP::RoundingMode::TowardsZero,
+                        FP::RoundingMode::ToNearest_TieAwayFromZero,
+                    };
+                    const bool exact = i == 10;
+                    const FP::RoundingMode rounding_mode = exact ? fpcr.RMode() : rounding_modes[i - 5];
+                    for (size_t lane = 0; lane < 8; lane++) {
+                        const u64 expected = FP::FPRoundInt<u16>(get_half(v5, lane), fpcr, rounding_mode, exact, fpsr);
+                        REQUIRE(get_half(jit.GetVector(9), lane) == expected);
+                    }
+                    break;
+                }
+                }
+
+                // The JIT does not track input denormal (IDC) flags for flushed operands.
+                REQUIRE((jit.GetFpsr() & ~u32{0x80}) == (fpsr.Value() & ~u32{0x80}));
+            }
+        }
+    }
+}
+
+TEST_CASE("A64: Half-precision vector arithmetic", "[a64]") {
+    const auto random_half = []() -> u16 {
+        const u16 sign = static_cast<u16>(RandInt<u16>(0, 1) << 15);
+        switch (RandInt(0, 8)) {
+        case 0:
+            return static_cast<u16>(sign | RandInt<u16>(0x7c00, 0x7fff));
+        case 1:
+            return static_cast<u16>(sign | RandInt<u16>(0x0000, 0x03ff));
+        case 2:
+            return static_cast<u16>(sign | RandInt<u16>(0x0000, 0x0c00));
+        case 3:
+            return static_cast<u16>(sign | RandInt<u16>(0x7000, 0x7bff));
+        case 4:
+            return static_cast<u16>(sign | (RandInt(0, 1) ? 0x7c00 : 0x0000));
+        default:
+            return RandInt<u16>(0, 0xffff);
+        }
+    };
+    const auto random_half_vector = [&]() -> Vector {
+        Vector result{};
+        for (size_t i = 0; i < 8; i++) {
+            result[i / 4] |= u64{random_half()} << (i % 4 * 16);
+        }
+        return result;
+    };
+    const auto random_single_vector = [&]() -> Vector {
+        Vector result{};
+        for (size_t i = 0; i < 4; i++) {
+            const u32 sign = RandInt<u32>(0, 1) << 31;
+            const u32 value = RandInt(0, 3) == 0 ? sign | RandInt<u32>(0x7f800000, 0x7fffffff) : RandInt<u32>(0, 0xffffffff);
+            result[i / 2] |= u64{value} << (i % 2 * 32);
+        }
+        return result;
+    };
+
+    A64TestEnv env;
+    A64::Jit jit{A64::UserConfig{&env}};
+
+    using Reference = Vector (*)(const Vector& n, const Vector& m, const Vector& d, FP::FPCR fpcr, FP::FPSR& fpsr);
+
+    static const auto fixed_to_half = [](s32 value, FP::FPCR fpcr, FP::FPSR& fpsr) -> u16 {
+        const float single = static_cast<float>(value);
+        u32 bits;
+        std::memcpy(&bits, &single, sizeof(bits));
+        fpcr.AHP(false);
+        return FP::FPConvert<u16>(bits, fpcr, fpcr.RMode(), fpsr);
+    };
+    static const auto multiply_add_long = [](const Vector& n, const Vector& m, const Vector& d, size_t elements, size_t first, bool subtract, std::optional<size_t> index, FP::FPCR fpcr, FP::FPSR& fpsr) {
+        Vector result{};
+        for (size_t i = 0; i < elements; i++) {
+            const u16 n_elem = static_cast<u16>((n[(first + i) / 4] >> ((first + i) % 4 * 16)) ^ (subtract ? 0x8000 : 0));
+            const size_t m_index = index ? *index : first + i;
+            const u16 m_elem = static_cast<u16>(m[m_index / 4] >> (m_index % 4 * 16));
+            const u32 d_elem = static_cast<u32>(d[i / 2] >> (i % 2 * 32));
+            const u32 product = FP::FPMulAddH(d_elem, n_elem, m_elem, fpcr, fpsr);
+            result[i / 2] |= u64{product} << (i % 2 * 32);
+        }
+        return result;
+    };
+
+    static const auto half = [](const Vector& v, size_t i) {
+        return static_cast<u16>(v[i / 4] >> (i % 4 * 16));
+    };
+    static const auto from_halves = [](const std::array<u16, 8>& halves) {
+        Vector result{};
+        for (size_t i = 0; i < halves.size(); i++) {
+            result[i / 4] |= u64{halves[i]} << (i % 4 * 16);
+        }
+        return result;
+    };
+    static const auto multiply = [](u16 a, u16 b, FP::FPCR fpcr, FP::FPSR& fpsr) {
+        return FP::FPMulAdd<u16>(static_cast<u16>((a ^ b) & 0x8000), a, b, fpcr, fpsr);
+    };
+    static const auto multiply_extended = [](u16 a, u16 b, FP::FPCR fpcr, FP::FPSR& fpsr) -> u16 {
+        const auto is_zero = [&](u16 x) { return (x & 0x7c00) == 0 && ((x & 0x03ff) == 0 || fpcr.FZ16()); };
+        const auto is_infinity = [](u16 x) { return (x & 0x7fff) == 0x7c00; };
+        if ((is_zero(a) && is_infinity(b)) || (is_infinity(a) && is_zero(b))) {
+            return static_cast<u16>(((a ^ b) & 0x8000) | 0x4000);
+        }
+        return FP::FPMulAdd<u16>(static_cast<u16>((a ^ b) & 0x8000), a, b, fpcr, fpsr);
+    };
+    static const auto multiply_by_element = [](const Vector& n, const Vector& m, size_t elements, size_t index, bool extended, FP::FPCR fpcr, FP::FPSR& fpsr) {
+        std::array<u16, 8> result{};
+        for (size_t i = 0; i < elements; i++) {
+            result[i] = extended ? multiply_extended(half(n, i), half(m, index), fpcr, fpsr) : multiply(half(n, i), half(m, index), fpcr, fpsr);
+        }
+        return from_halves(result);
+    };
+    // Pairing adjacent elements at each step is equivalent to the pseudocode's recursive Reduce().
+    static const auto reduce = [](const Vector& n, size_t elements, u16 (*op)(u16, u16, FP::FPCR, FP::FPSR&), FP::FPCR fpcr, FP::FPSR& fpsr) {
+        std::array<u16, 8> values{};
+        for (size_t i = 0; i < elements; i++) {
+            values[i] = half(n, i);
+        }
+        for (; elements > 1; elements /= 2) {
+            for (size_t i = 0; i < elements / 2; i++) {
+                values[i] = op(values[2 * i], values[2 * i + 1], fpcr, fpsr);
+            }
+        }
+        return Vector{values[0], 0};
+    };
+    static const auto complex_add = [](const Vector& n, const Vector& m, size_t elements, bool rot270, FP::FPCR fpcr, FP::FPSR& fpsr) {
+        std::array<u16, 8> result{};
+        for (size_t e = 0; e < elements; e += 2) {
+            const u16 real = static_cast<u16>(half(m, e + 1) ^ (rot270 ? 0 : 0x8000));
+            const u16 imaginary = static_cast<u16>(half(m, e) ^ (rot270 ? 0x8000 : 0));
+            result[e] = FP::FPMulAdd<u16>(half(n, e), real, 0x3c00, fpcr, fpsr);
+            result[e + 1] = FP::FPMulAdd<u16>(half(n, e + 1), imaginary, 0x3c00, fpcr, fpsr);
+        }
+        return from_halves(result);
+    };
+    static const auto complex_multiply_add = [](const Vector& n, const Vector& m, const Vector& d, size_t elements, size_t rot, std::optional<size_t> index, FP::FPCR fpcr, FP::FPSR& fpsr) {
+        std::array<u16, 8> result{};
+        for (size_t e = 0; e < elements; e += 2) {
+            const size_t pair = index ? *index * 2 : e;
+            const u16 m_real = half(m, pair);
+            const u16 m_imaginary = half(m, pair + 1);
+            const u16 n_elem = half(n, rot % 2 == 0 ? e : e + 1);
+            const auto [element1, element3] = [&]() -> std::pair<u16, u16> {
+                switch (rot) {
+                case 0:
+                    return {m_real, m_imaginary};
+                case 1:
+                    return {static_cast<u16>(m_imaginary ^ 0x8000), m_real};
+                case 2:
+                    return {static_cast<u16>(m_real ^ 0x8000), static_cast<u16>(m_imaginary ^ 0x8000)};
+                default:
+                    return {m_imaginary, static_cast<u16>(m_real ^ 0x8000)};
+                }
+            }();
+            result[e] = FP::FPMulAdd<u16>(half(d, e), n_elem, element1, fpcr, fpsr);
+            result[e + 1] = FP::FPMulAdd<u16>(half(d, e + 1), n_elem, element3, fpcr, fpsr);
+        }
+        return from_halves(result);
+    };
+
+    struct TestCase {
+        u32 instruction;
+        Reference reference;
+        bool multiply_add_long;
+    };
+    const std::array test_cases{
+        TestCase{0x4e411402, [](const Vector& n, const Vector& m, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return Lanewise<u16>(n, m, [&](u16 a, u16 b) { return FP::FPMulAdd<u16>(a, b, 0x3c00, fpcr, fpsr); });
+                 }, false}, // FADD V2.8H, V0.8H, V1.8H
+        TestCase{0x4ec11402, [](const Vector& n, const Vector& m, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return Lanewise<u16>(n, m, [&](u16 a, u16 b) { return FP::FPMulAdd<u16>(a, b, 0xbc00, fpcr, fpsr); });
+                 }, false}, // FSUB V2.8H, V0.8H, V1.8H
+        TestCase{0x6e411c02, [](const Vector& n, const Vector& m, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return Lanewise<u16>(n, m, [&](u16 a, u16 b) { return FP::FPMulAdd<u16>(static_cast<u16>((a ^ b) & 0x8000), a, b, fpcr, fpsr); });
+                 }, false}, // FMUL V2.8H, V0.8H, V1.8H
+        TestCase{0x6e413c02, [](const Vector& n, const Vector& m, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return Lanewise<u16>(n, m, [&](u16 a, u16 b) { return FP::FPDiv<u16>(a, b, fpcr, fpsr); });
+                 }, false}, // FDIV V2.8H, V0.8H, V1.8H
+        TestCase{0x6ef9f802, [](const Vector& n, const Vector& m, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return Lanewise<u16>(n, m, [&](u16 a, u16) { return FP::FPSqrt<u16>(a, fpcr, fpsr); });
+                 }, false}, // FSQRT V2.8H, V0.8H
+        TestCase{0x4e413402, [](const Vector& n, const Vector& m, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return Lanewise<u16>(n, m, [&](u16 a, u16 b) { return FP::FPMax<u16>(a, b, fpcr, fpsr); });
+                 }, false}, // FMAX V2.8H, V0.8H, V1.8H
+        TestCase{0x4ec13402, [](const Vector& n, const Vector& m, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return Lanewise<u16>(n, m, [&](u16 a, u16 b) { return FP::FPMin<u16>(a, b, fpcr, fpsr); });
+                 }, false}, // FMIN V2.8H, V0.8H, V1.8H
+        TestCase{0x4e410402, [](const Vector& n, const Vector& m, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return Lanewise<u16>(n, m, [&](u16 a, u16 b) { return FP::FPMaxNumeric<u16>(a, b, fpcr, fpsr); });
+                 }, false}, // FMAXNM V2.8H, V0.8H, V1.8H
+        TestCase{0x4ec10402, [](const Vector& n, const Vector& m, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return Lanewise<u16>(n, m, [&](u16 a, u16 b) { return FP::FPMinNumeric<u16>(a, b, fpcr, fpsr); });
+                 }, false}, // FMINNM V2.8H, V0.8H, V1.8H
+        TestCase{0x6ec12402, [](const Vector& n, const Vector& m, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return Lanewise<u16>(n, m, [&](u16 a, u16 b) -> u16 { return FP::FPCompareGT<u16>(a, b, fpcr, fpsr) ? 0xffff : 0; });
+                 }, false}, // FCMGT V2.8H, V0.8H, V1.8H
+        TestCase{0x6e412402, [](const Vector& n, const Vector& m, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return Lanewise<u16>(n, m, [&](u16 a, u16 b) -> u16 { return FP::FPCompareGE<u16>(a, b, fpcr, fpsr) ? 0xffff : 0; });
+                 }, false}, // FCMGE V2.8H, V0.8H, V1.8H
+        TestCase{0x4ef8e802, [](const Vector& n, const Vector& m, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return Lanewise<u16>(n, m, [&](u16 a, u16) -> u16 { return FP::FPCompareGT<u16>(0, a, fpcr, fpsr) ? 0xffff : 0; });
+                 }, false}, // FCMLT V2.8H, V0.8H, #0.0
+        TestCase{0x6ec11402, [](const Vector& n, const Vector& m, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return Lanewise<u16>(n, m, [&](u16 a, u16 b) { return static_cast<u16>(FP::FPMulAdd<u16>(a, b, 0xbc00, fpcr, fpsr) & 0x7fff); });
+                 }, false}, // FABD V2.8H, V0.8H, V1.8H
+        TestCase{0x6e411402, [](const Vector& n, const Vector& m, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return Pairwise<u16>(n, m, [&](u16 a, u16 b) { return FP::FPMulAdd<u16>(a, b, 0x3c00, fpcr, fpsr); });
+                 }, false}, // FADDP V2.8H, V0.8H, V1.8H
+        TestCase{0x2e410402, [](const Vector& n, const Vector& m, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return Pairwise<u16>({n[0], m[0]}, {}, [&](u16 a, u16 b) { return FP::FPMaxNumeric<u16>(a, b, fpcr, fpsr); });
+                 }, false}, // FMAXNMP V2.4H, V0.4H, V1.4H
+        TestCase{0x4ef9b802, [](const Vector& n, const Vector& m, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return Lanewise<u16>(n, m, [&](u16 a, u16) { return static_cast<u16>(FP::FPToFixed<u16>(16, a, 0, false, fpcr, FP::RoundingMode::TowardsZero, fpsr)); });
+                 }, false}, // FCVTZS V2.8H, V0.8H
+        TestCase{0x6e79a802, [](const Vector& n, const Vector& m, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return Lanewise<u16>(n, m, [&](u16 a, u16) { return static_cast<u16>(FP::FPToFixed<u16>(16, a, 0, true, fpcr, FP::RoundingMode::ToNearest_TieEven, fpsr)); });
+                 }, false}, // FCVTNU V2.8H, V0.8H
+        TestCase{0x4e79c802, [](const Vector& n, const Vector& m, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return Lanewise<u16>(n, m, [&](u16 a, u16) { return static_cast<u16>(FP::FPToFixed<u16>(16, a, 0, false, fpcr, FP::RoundingMode::ToNearest_TieAwayFromZero, fpsr)); });
+                 }, false}, // FCVTAS V2.8H, V0.8H
+        TestCase{0x4e79d802, [](const Vector& n, const Vector& m, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return Lanewise<u16>(n, m, [&](u16 a, u16) { return fixed_to_half(static_cast<s16>(a), fpcr, fpsr); });
+                 }, false}, // SCVTF V2.8H, V0.8H
+        TestCase{0x6e79d802, [](const Vector& n, const Vector& m, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return Lanewise<u16>(n, m, [&](u16 a, u16) { return fixed_to_half(a, fpcr, fpsr); });
+                 }, false}, // UCVTF V2.8H, V0.8H
+        TestCase{0x4e21ec02, [](const Vector& n, const Vector& m, const Vector& d, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return multiply_add_long(n, m, d, 4, 0, false, std::nullopt, fpcr, fpsr);
+                 }, true}, // FMLAL V2.4S, V0.4H, V1.4H
+        TestCase{0x2ea1cc02, [](const Vector& n, const Vector& m, const Vector& d, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return multiply_add_long(n, m, d, 2, 2, true, std::nullopt, fpcr, fpsr);
+                 }, true}, // FMLSL2 V2.2S, V0.2H, V1.2H
+        TestCase{0x6f918802, [](const Vector& n, const Vector& m, const Vector& d, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return multiply_add_long(n, m, d, 4, 4, false, 5, fpcr, fpsr);
+                 }, true}, // FMLAL2 V2.4S, V0.4H, V1.H[5]
+        TestCase{0x0fb14002, [](const Vector& n, const Vector& m, const Vector& d, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return multiply_add_long(n, m, d, 2, 0, true, 3, fpcr, fpsr);
+                 }, true}, // FMLSL V2.2S, V0.2H, V1.H[3]
+        TestCase{0x5e411c02, [](const Vector& n, const Vector& m, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return Vector{multiply_extended(half(n, 0), half(m, 0), fpcr, fpsr), 0};
+                 }, false}, // FMULX H2, H0, H1
+        TestCase{0x7ec11402, [](const Vector& n, const Vector& m, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return Vector{static_cast<u16>(FP::FPMulAdd<u16>(half(n, 0), half(m, 0), 0xbc00, fpcr, fpsr) & 0x7fff), 0};
+                 }, false}, // FABD H2, H0, H1
+        TestCase{0x7e412c02, [](const Vector& n, const Vector& m, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return Vector{FP::FPCompareGE<u16>(half(n, 0) & 0x7fff, half(m, 0) & 0x7fff, fpcr, fpsr) ? 0xffffu : 0u, 0};
+                 }, false}, // FACGE H2, H0, H1
+        TestCase{0x7ec12c02, [](const Vector& n, const Vector& m, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return Vector{FP::FPCompareGT<u16>(half(n, 0) & 0x7fff, half(m, 0) & 0x7fff, fpcr, fpsr) ? 0xffffu : 0u, 0};
+                 }, false}, // FACGT H2, H0, H1
+        TestCase{0x7e412402, [](const Vector& n, const Vector& m, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return Vector{FP::FPCompareGE<u16>(half(n, 0), half(m, 0), fpcr, fpsr) ? 0xffffu : 0u, 0};
+                 }, false}, // FCMGE H2, H0, H1
+        TestCase{0x7ec12402, [](const Vector& n, const Vector& m, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return Vector{FP::FPCompareGT<u16>(half(n, 0), half(m, 0), fpcr, fpsr) ? 0xffffu : 0u, 0};
+                 }, false}, // FCMGT H2, H0, H1
+        TestCase{0x7ef8c802, [](const Vector& n, const Vector&, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return Vector{FP::FPCompareGE<u16>(half(n, 0), 0, fpcr, fpsr) ? 0xffffu : 0u, 0};
+                 }, false}, // FCMGE H2, H0, #0.0
+        TestCase{0x7ef8d802, [](const Vector& n, const Vector&, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return Vector{FP::FPCompareGE<u16>(0, half(n, 0), fpcr, fpsr) ? 0xffffu : 0u, 0};
+                 }, false}, // FCMLE H2, H0, #0.0
+        TestCase{0x5e79b802, [](const Vector& n, const Vector&, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return Vector{static_cast<u16>(FP::FPToFixed<u16>(16, half(n, 0), 0, false, fpcr, FP::RoundingMode::TowardsMinusInfinity, fpsr)), 0};
+                 }, false}, // FCVTMS H2, H0
+        TestCase{0x7ef9a802, [](const Vector& n, const Vector&, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return Vector{static_cast<u16>(FP::FPToFixed<u16>(16, half(n, 0), 0, true, fpcr, FP::RoundingMode::TowardsPlusInfinity, fpsr)), 0};
+                 }, false}, // FCVTPU H2, H0
+        TestCase{0x5ef9b802, [](const Vector& n, const Vector&, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return Vector{static_cast<u16>(FP::FPToFixed<u16>(16, half(n, 0), 0, false, fpcr, FP::RoundingMode::TowardsZero, fpsr)), 0};
+                 }, false}, // FCVTZS H2, H0
+        TestCase{0x7e79c802, [](const Vector& n, const Vector&, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return Vector{static_cast<u16>(FP::FPToFixed<u16>(16, half(n, 0), 0, true, fpcr, FP::RoundingMode::ToNearest_TieAwayFromZero, fpsr)), 0};
+                 }, false}, // FCVTAU H2, H0
+        TestCase{0x5e79d802, [](const Vector& n, const Vector&, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return Vector{fixed_to_half(static_cast<s16>(half(n, 0)), fpcr, fpsr), 0};
+                 }, false}, // SCVTF H2, H0
+        TestCase{0x7e79d802, [](const Vector& n, const Vector&, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return Vector{fixed_to_half(half(n, 0), fpcr, fpsr), 0};
+                 }, false}, // UCVTF H2, H0
+        TestCase{0x5e30d802, [](const Vector& n, const Vector&, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return Vector{FP::FPMulAdd<u16>(half(n, 0), half(n, 1), 0x3c00, fpcr, fpsr), 0};
+                 }, false}, // FADDP H2, V0.2H
+        TestCase{0x5e30f802, [](const Vector& n, const Vector&, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return Vector{FP::FPMax<u16>(half(n, 0), half(n, 1), fpcr, fpsr), 0};
+                 }, false}, // FMAXP H2, V0.2H
+        TestCase{0x5eb0c802, [](const Vector& n, const Vector&, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return Vector{FP::FPMinNumeric<u16>(half(n, 0), half(n, 1), fpcr, fpsr), 0};
+                 }, false}, // FMINNMP H2, V0.2H
+        TestCase{0x5f119802, [](const Vector& n, const Vector& m, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return multiply_by_element(n, m, 1, 5, false, fpcr, fpsr);
+                 }, false}, // FMUL H2, H0, V1.H[5]
+        TestCase{0x7f219002, [](const Vector& n, const Vector& m, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return multiply_by_element(n, m, 1, 2, true, fpcr, fpsr);
+                 }, false}, // FMULX H2, H0, V1.H[2]
+        TestCase{0x4e411c02, [](const Vector& n, const Vector& m, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return Lanewise<u16>(n, m, [&](u16 a, u16 b) { return multiply_extended(a, b, fpcr, fpsr); });
+                 }, false}, // FMULX V2.8H, V0.8H, V1.8H
+        TestCase{0x4f219802, [](const Vector& n, const Vector& m, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return multiply_by_element(n, m, 8, 6, false, fpcr, fpsr);
+                 }, false}, // FMUL V2.8H, V0.8H, V1.H[6]
+        TestCase{0x2f119002, [](const Vector& n, const Vector& m, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return multiply_by_element(n, m, 4, 1, true, fpcr, fpsr);
+                 }, false}, // FMULX V2.4H, V0.4H, V1.H[1]
+        TestCase{0x4e30c802, [](const Vector& n, const Vector&, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return reduce(n, 8, [](u16 a, u16 b, FP::FPCR fpcr, FP::FPSR& fpsr) { return FP::FPMaxNumeric<u16>(a, b, fpcr, fpsr); }, fpcr, fpsr);
+                 }, false}, // FMAXNMV H2, V0.8H
+        TestCase{0x4e30f802, [](const Vector& n, const Vector&, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return reduce(n, 8, [](u16 a, u16 b, FP::FPCR fpcr, FP::FPSR& fpsr) { return FP::FPMax<u16>(a, b, fpcr, fpsr); }, fpcr, fpsr);
+                 }, false}, // FMAXV H2, V0.8H
+        TestCase{0x4eb0c802, [](const Vector& n, const Vector&, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return reduce(n, 8, [](u16 a, u16 b, FP::FPCR fpcr, FP::FPSR& fpsr) { return FP::FPMinNumeric<u16>(a, b, fpcr, fpsr); }, fpcr, fpsr);
+                 }, false}, // FMINNMV H2, V0.8H
+        TestCase{0x0eb0f802, [](const Vector& n, const Vector&, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return reduce(n, 4, [](u16 a, u16 b, FP::FPCR fpcr, FP::FPSR& fpsr) { return FP::FPMin<u16>(a, b, fpcr, fpsr); }, fpcr, fpsr);
+                 }, false}, // FMINV H2, V0.4H
+        TestCase{0x6e41e402, [](const Vector& n, const Vector& m, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return complex_add(n, m, 8, false, fpcr, fpsr);
+                 }, false}, // FCADD V2.8H, V0.8H, V1.8H, #90
+        TestCase{0x2e41f402, [](const Vector& n, const Vector& m, const Vector&, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return complex_add(n, m, 4, true, fpcr, fpsr);
+                 }, false}, // FCADD V2.4H, V0.4H, V1.4H, #270
+        TestCase{0x6e41c402, [](const Vector& n, const Vector& m, const Vector& d, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return complex_multiply_add(n, m, d, 8, 0, std::nullopt, fpcr, fpsr);
+                 }, false}, // FCMLA V2.8H, V0.8H, V1.8H, #0
+        TestCase{0x6e41cc02, [](const Vector& n, const Vector& m, const Vector& d, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return complex_multiply_add(n, m, d, 8, 1, std::nullopt, fpcr, fpsr);
+                 }, false}, // FCMLA V2.8H, V0.8H, V1.8H, #90
+        TestCase{0x2e41d402, [](const Vector& n, const Vector& m, const Vector& d, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return complex_multiply_add(n, m, d, 4, 2, std::nullopt, fpcr, fpsr);
+                 }, false}, // FCMLA V2.4H, V0.4H, V1.4H, #180
+        TestCase{0x6e41dc02, [](const Vector& n, const Vector& m, const Vector& d, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return complex_multiply_add(n, m, d, 8, 3, std::nullopt, fpcr, fpsr);
+                 }, false}, // FCMLA V2.8H, V0.8H, V1.8H, #270
+        TestCase{0x6f613802, [](const Vector& n, const Vector& m, const Vector& d, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return complex_multiply_add(n, m, d, 8, 1, 3, fpcr, fpsr);
+                 }, false}, // FCMLA V2.8H, V0.8H, V1.H[3], #90
+        TestCase{0x2f615002, [](const Vector& n, const Vector& m, const Vector& d, FP::FPCR fpcr, FP::FPSR& fpsr) {
+                     return complex_multiply_add(n, m, d, 4, 2, 1, fpcr, fpsr);
+                 }, false}, // FCMLA V2.4H, V0.4H, V1.H[1], #180
+    };
+    for (const auto& test_case : test_cases) {
+        env.code_mem.emplace_back(test_case.instruction);
+        env.code_mem.emplace_back(0x14000000); // B .
+    }
+
+    for (const u32 fpcr_value : {0x00000000u, 0x00400000u, 0x00800000u, 0x00c00000u, 0x01000000u, 0x02000000u, 0x04000000u, 0x00080000u, 0x03080000u}) {
+        const FP::FPCR fpcr{fpcr_value};
+        jit.SetFpcr(fpcr_value);
+
+        for (size_t i = 0; i < test_cases.size(); i++) {
+            const TestCase& test_case = test_cases[i];
+
+            for (size_t iteration = 0; iteration < 200; iteration++) {
+                const Vector v0 = random_half_vector();
+                Vector v1 = random_half_vector();
+                if (RandInt(0, 3) == 0) {
+                    v1[0] = v0[0];
+                }
+                const Vector v2 = test_case.multiply_add_long ? random_single_vector() : random_half_vector();
+
+                INFO("instruction: " << std::hex << test_case.instruction << " fpcr: " << fpcr_value);
+                INFO("v0: " << v0[0] << " " << v0[1] << " v1: " << v1[0] << " " << v1[1] << " v2: " << v2[0] << " " << v2[1]);
+
+                jit.SetPC(i * 8);
+                jit.SetVector(0, v0);
+                jit.SetVector(1, v1);
+                jit.SetVector(2, v2);
+                jit.SetFpsr(0);
+                env.ticks_left = 2;
+                jit.Run();
+
+                FP::FPSR fpsr;
+                const Vector expected = test_case.reference(v0, v1, v2, fpcr, fpsr);
+                REQUIRE(jit.GetVector(2) == expected);
+                // The JIT does not track input denormal (IDC) flags for flushed operands.
+                REQUIRE((jit.GetFpsr() & ~u32{0x80}) == (fpsr.Value() & ~u32{0x80}));
+            }
+        }
+    }
+}
+
+TEST_CASE("A64: FRECPE and FRSQRTE", "[a64]") {
+    // Biased towards exponents that are at or near the limits of where the estimate is normal.
+    const auto random_float = [](auto bits) {
+        using T = decltype(bits);
+        constexpr size_t mantissa_width = sizeof(T) == 2 ? 10 : sizeof(T) == 4 ? 23 : 52;
+        constexpr T max_exponent = sizeof(T) == 2 ? 0x1F : sizeof(T) == 4 ? 0xFF : 0x7FF;
+        const T sign = static_cast<T>(RandInt<T>(0, 1) << (sizeof(T) * 8 - 1));
+        const T mantissa = RandInt<T>(0, static_cast<T>((T(1) << mantissa_width) - 1));
+        switch (RandInt(0, 3)) {
+        case 0:
+            return static_cast<T>(sign | (RandInt<T>(0, 3) << mantissa_width) | mantissa);
+        case 1:
+            return static_cast<T>(sign | (RandInt<T>(max_exponent - 4, max_exponent) << mantissa_width) | mantissa);
+        default:
+            return static_cast<T>(sign | (RandInt<T>(0, max_exponent) << mantissa_width) | mantissa);
+        }
+    };
+    const auto get_element = [](const Vector& v, size_t esize, size_t i) -> u64 {
+        const size_t per_word = 64 / esize;
+        const u64 mask = esize == 64 ? ~u64(0) : (u64(1) << esize) - 1;
+        return (v[i / per_word] >> (i % per_word * esize)) & mask;
+    };
+
+    A64TestEnv env;
+    A64::Jit jit{A64::UserConfig{&env}};
+
+    struct TestCase {
+        u32 instruction;
+        size_t esize;
+        size_t elements;
+        bool rsqrt;
+    };
+    const std::array test_cases{
+        TestCase{0x5ef9d802, 16, 1, false}, // FRECPE H2, H0
+        TestCase{0x5ea1d802, 32, 1, false}, // FRECPE S2, S0
+        TestCase{0x5ee1d802, 64, 1, false}, // FRECPE D2, D0
+        TestCase{0x4ea1d802, 32, 4, false}, // FRECPE V2.4S, V0.4S
+        TestCase{0x4ee1d802, 64, 2, false}, // FRECPE V2.2D, V0.2D
+        TestCase{0x7ef9d802, 16, 1, true},  // FRSQRTE H2, H0
+        TestCase{0x7ea1d802, 32, 1, true},  // FRSQRTE S2, S0
+        TestCase{0x7ee1d802, 64, 1, true},  // FRSQRTE D2, D0
+        TestCase{0x6ea1d802, 32, 4, true},  // FRSQRTE V2.4S, V0.4S
+        TestCase{0x6ee1d802, 64, 2, true},  // FRSQRTE V2.2D, V0.2D
+    };
+    for (const auto& test_case : test_cases) {
+        env.code_mem.emplace_back(test_case.instruction);
+        env.code_mem.emplace_back(0x14000000); // B .
+    }
+
+    for (const u32 fpcr_value : {0x00000000u, 0x00400000u, 0x00800000u, 0x00c00000u, 0x01000000u, 0x02000000u, 0x00080000u}) {
+        const FP::FPCR fpcr{fpcr_value};
+        jit.SetFpcr(fpcr_value);
+
+        for (size_t i = 0; i < test_cases.size(); i++) {
+            const TestCase& test_case = test_cases[i];
+
+            for (size_t iteration = 0; iteration < 200; iteration++) {
+                Vector v0{};
+                for (size_t e = 0; e < test_case.elements; e++) {
+                    u64 element;
+                    switch (test_case.esize) {
+                    case 16:
+                        element = random_float(u16{});
+                        break;
+                    case 32:
+                        element = random_float(u32{});
+                        break;
+                    default:
+                        element = random_float(u64{});
+                        break;
+                    }
+                    // Keep half of the vectors entirely within the range of positive normal estimates.
+                    if (iteration % 2 == 0 && test_case.elements > 1) {
+                        element &= ~(u64(1) << (test_case.esize - 1));
+                        element = element % (u64(1) << (test_case.esize - 2)) + (u64(1) << (test_case.esize - 3));
+                    }
+                    v0[e * test_case.esize / 64] |= element << (e * test_case.esize % 64);
+                }
+
+                INFO("instruction: " << std::hex << test_case.instruction << " fpcr: " << fpcr_value << " v0: " << v0[0] << " " << v0[1]);
+
+                jit.SetPC(i * 8);
+                jit.SetVector(0, v0);
+                jit.SetFpsr(0);
+                env.ticks_left = 2;
+                jit.Run();
+
+                FP::FPSR fpsr;
+                for (size_t e = 0; e < test_case.elements; e++) {
+                    const u64 operand = get_element(v0, test_case.esize, e);
+                    const u64 expected = [&]() -> u64 {
+                        switch (test_case.esize) {
+                        case 16:
+                            return test_case.rsqrt ? FP::FPRSqrtEstimate<u16>(static_cast<u16>(operand), fpcr, fpsr) : FP::FPRecipEstimate<u16>(static_cast<u16>(operand), fpcr, fpsr);
+                        case 32:
+                            return test_case.rsqrt ? FP::FPRSqrtEstimate<u32>(static_cast<u32>(operand), fpcr, fpsr) : FP::FPRecipEstimate<u32>(static_cast<u32>(operand), fpcr, fpsr);
+                        default:
+                            return test_case.rsqrt ? FP::FPRSqrtEstimate<u64>(operand, fpcr, fpsr) : FP::FPRecipEstimate<u64>(operand, fpcr, fpsr);
+                        }
+                    }();
+                    REQUIRE(get_element(jit.GetVector(2), test_case.esize, e) == expected);
+                }
+                REQUIRE(jit.GetFpsr() == fpsr.Value());
+            }
+        }
+    }
+}
+
+TEST_CASE("A64: Flush-to-zero comparisons and min/max", "[a64]") {
+    A64TestEnv env;
+    A64::Jit jit{A64::UserConfig{&env}};
+
+    struct TestCase {
+        u32 instruction;
+        u32 fpcr;
+        Vector v0;
+        Vector v1;
+        Vector expected;
+        u32 expected_fpsr;
+    };
+    const std::array test_cases{
+        TestCase{0x1e214802, 0x03000000, {0x00000005, 0}, {0x80000000, 0}, {0x00000000, 0}, 0},                                 // FMAX S2, S0, S1
+        TestCase{0x1e215802, 0x03000000, {0x00000005, 0}, {0x80000000, 0}, {0x80000000, 0}, 0},                                 // FMIN S2, S0, S1
+        TestCase{0x1e215802, 0x03000000, {0x80000005, 0}, {0x00000000, 0}, {0x80000000, 0}, 0},                                 // FMIN S2, S0, S1
+        TestCase{0x1e214802, 0x03000000, {0x00800000, 0}, {0x007fffff, 0}, {0x00800000, 0}, 0},                                 // FMAX S2, S0, S1
+        TestCase{0x1e214802, 0x03000000, {0x7f800001, 0}, {0x3f800000, 0}, {0x7fc00000, 0}, 0x01},                              // FMAX S2, S0, S1
+        TestCase{0x1e214802, 0x03000000, {0xffc00001, 0}, {0x3f800000, 0}, {0x7fc00000, 0}, 0},                                 // FMAX S2, S0, S1
+        TestCase{0x1e214802, 0x03800000, {0x80000005, 0}, {0x80000000, 0}, {0x80000000, 0}, 0},                                 // FMAX S2, S0, S1
+        TestCase{0x1e214802, 0x03800000, {0x00000005, 0}, {0x80000000, 0}, {0x00000000, 0}, 0},                                 // FMAX S2, S0, S1
+        TestCase{0x1e615802, 0x03000000, {0x800fffffffffffff, 0}, {0, 0}, {0x8000000000000000, 0}, 0},                          // FMIN D2, D0, D1
+        TestCase{0x1e615802, 0x01000000, {0x800fffffffffffff, 0}, {0, 0}, {0x8000000000000000, 0}, 0},                          // FMIN D2, D0, D1
+        TestCase{0x4e21e402, 0x03000000, {0x0000000100000005, 0x008000003f800000}, {0x0000000280000000, 0x000000003f800000},
+                 {0xffffffffffffffff, 0x00000000ffffffff}, 0},                                                                  // FCMEQ V2.4S, V0.4S, V1.4S
+        TestCase{0x6ea1e402, 0x03000000, {0x0000000100000005, 0x008000003f800000}, {0x0000000280000000, 0x000000003f800000},
+                 {0x0000000000000000, 0xffffffff00000000}, 0},                                                                  // FCMGT V2.4S, V0.4S, V1.4S
+        TestCase{0x6e61e402, 0x01000000, {0x000fffffffffffff, 0x0010000000000000}, {0x8000000000000001, 0x0010000000000001},
+                 {0xffffffffffffffff, 0x0000000000000000}, 0},                                                                  // FCMGE V2.2D, V0.2D, V1.2D
+    };
+    for (const auto& test_case : test_cases) {
+        env.code_mem.emplace_back(test_case.instruction);
+        env.code_mem.emplace_back(0x14000000); // B .
+    }
+
+    for (size_t i = 0; i < test_cases.size(); i++) {
+        const TestCase& test_case = test_cases[i];
+        INFO("test case " << i);
+
+        jit.SetPC(i * 8);
+        jit.SetFpcr(test_case.fpcr);
+        jit.SetFpsr(0);
+        jit.SetVector(0, test_case.v0);
+        jit.SetVector(1, test_case.v1);
+        jit.SetVector(2, {0xcccccccccccccccc, 0xcccccccccccccccc});
+        env.ticks_left = 2;
+        jit.Run();
+
+        REQUIRE(jit.GetVector(2) == test_case.expected);
+        // The JIT does not track FPSR.IDC.
+        REQUIRE((jit.GetFpsr() & ~u32(0x80)) == test_case.expected_fpsr);
+    }
+}
+
+namespace {
+
+template <typename T>
+T ReferenceRoundingDoublingMultiplyAccumulate(T addend, T a, T b, bool subtract, bool& qc) {
+    constexpr int esize = static_cast<int>(sizeof(T) * 8);
+    const s64 product = s64(a) * s64(b);
+    // (2 * product + 2^(esize - 1)) >> esize, computed without overflowing for esize == 32
+    const s64 high = ((subtract ? -product : product) + (s64(1) << (esize - 2))) >> (esize - 1);
+    const s64 sum = s64(addend) + high;
+    const s64 clamped = std::clamp<s64>(sum, std::numeric_limits<T>::min(), std::numeric_limits<T>::max());
+    qc |= clamped != sum;
+    return static_cast<T>(clamped);
+}
+
+template <typename T>
+Vector RandomSaturationVector() {
+    std::array<T, sizeof(Vector) / sizeof(T)> lanes;
+    for (auto& lane : lanes) {
+        switch (RandInt(0, 5)) {
+        case 0:
+            lane = std::numeric_limits<T>::min();
+            break;
+        case 1:
+            lane = std::numeric_limits<T>::max();
+            break;
+        case 2:
+            lane = static_cast<T>(RandInt<s64>(-2, 2));
+            break;
+        default:
+            lane = static_cast<T>(RandInt<u64>(0, ~u64(0)));
+            break;
+        }
+    }
+    Vector ret;
+    std::memcpy(ret.data(), lanes.data(), sizeof(Vector));
+    return ret;
+}
+
+template <typename T>
+Vector ReferenceRoundingDoublingMultiplyAccumulate(const Vector& d, const Vector& n, const Vector& m, bool subtract, bool& qc) {
+    std::array<T, sizeof(Vector) / sizeof(T)> addend, a, b;
+    std::memcpy(addend.data(), d.data(), sizeof(Vector));
+    std::memcpy(a.data(), n.data(), sizeof(Vector));
+    std::memcpy(b.data(), m.data(), sizeof(Vector));
+    for (size_t i = 0; i < addend.size(); i++) {
+        addend[i] = ReferenceRoundingDoublingMultiplyAccumulate<T>(addend[i], a[i], b[i], subtract, qc);
+    }
+    Vector ret;
+    std::memcpy(ret.data(), addend.data(), sizeof(Vector));
+    return ret;
+}
+
+} // Anonymous namespace
+
+TEST_CASE("A64: SQRDMLAH and SQRDMLSH (vector)", "[a64]") {
+    struct TestCase {
+        u32 instruction;
+        size_t esize;
+        bool subtract;
+    };
+
+    const std::array test_cases{
+        TestCase{0x6e418402, 16, false},  // SQRDMLAH V2.8H, V0.8H, V1.8H
+        TestCase{0x6e818402, 32, false},  // SQRDMLAH V2.4S, V0.4S, V1.4S
+        TestCase{0x6e418c02, 16, true},   // SQRDMLSH V2.8H, V0.8H, V1.8H
+        TestCase{0x6e818c02, 32, true},   // SQRDMLSH V2.4S, V0.4S, V1.4S
+    };
+
+    A64TestEnv env;
+    A64::Jit jit{A64::UserConfig{&env}};
+
+    for (const auto& test_case : test_cases) {
+        env.code_mem.emplace_back(test_case.instruction);
+        env.code_mem.emplace_back(0x14000000); // B .
+    }
+
+    for (size_t i = 0; i < test_cases.size(); i++) {
+        const auto& test_case = test_cases[i];
+        INFO("instruction: " << std::hex << test_case.instruction);
+
+        for (size_t iteration = 0; iteration < 500; iteration++) {
+            const bool is_16 = test_case.esize == 16;
+            const Vector n = is_16 ? RandomSaturationVector<s16>() : RandomSaturationVector<s32>();
+            const Vector m = is_16 ? RandomSaturationVector<s16>() : RandomSaturationVector<s32>();
+            const Vector d = is_16 ? RandomSaturationVector<s16>() : RandomSaturationVector<s32>();
+
+            bool expected_qc = false;
+            const Vector expected = is_16 ? ReferenceRoundingDoublingMultiplyAccumulate<s16>(d, n, m, test_case.subtract, expected_qc)
+                                          : ReferenceRoundingDoublingMultiplyAccumulate<s32>(d, n, m, test_case.subtract, expected_qc);
+
+            jit.SetPC(i * 8);
+            jit.SetVector(0, n);
+            jit.SetVector(1, m);
+            jit.SetVector(2, d);
+            jit.SetFpsr(0);
+            env.ticks_left = 2;
+            jit.Run();
+
+            INFO("n: " << std::hex << n[0] << " " << n[1] << " m: " << m[0] << " " << m[1] << " d: " << d[0] << " " << d[1]);
+            REQUIRE(jit.GetVector(2) == expected);
+            REQUIRE(FP::FPSR{jit.GetFpsr()}.QC() == expected_qc);
+        }
+    }
+}
+
+TEST_CASE("A64: Saturating rounding shifts and doubling multiply-accumulate", "[a64]") {
+    struct TestCase {
+        u32 instruction;
+        Vector n;
+        Vector m;
+        Vector d;
+        Vector expected;
+        bool expected_qc;
+    };
+
+    const std::array test_cases{
+        // SQRSHL V2.16B, V0.16B, V1.16B
+        TestCase{0x4e215c02, {0x0505050505050505, 0x4040404040404040}, {0xFFFFFFFFFFFFFFFF, 0x0101010101010101}, {0, 0}, {0x0303030303030303, 0x7F7F7F7F7F7F7F7F}, true},
+        // UQRSHL V2.8H, V0.8H, V1.8H
+        TestCase{0x6e615c02, {0x0003000300030003, 0x8000800080008000}, {0x00FE00FE00FE00FE, 0x0001000100010001}, {0, 0}, {0x0001000100010001, 0xFFFFFFFFFFFFFFFF}, true},
+        // SQRSHL D2, D0, D1
+        TestCase{0x5ee15c02, {0xFFFFFFFFFFFFFFFB, 0x1234}, {0x00000000000000FF, 0x55}, {0, 0}, {0xFFFFFFFFFFFFFFFE, 0}, false},
+        // SQRSHRN B2, H0, #3
+        TestCase{0x5f0d9c02, {0x00000000000003FC, 0xFFFF}, {0, 0}, {0, 0}, {0x7F, 0}, true},
+        // UQRSHRN S2, D0, #16
+        TestCase{0x7f309c02, {0x0000000012348000, 0}, {0, 0}, {0, 0}, {0x1235, 0}, false},
+        // SQRSHRUN H2, S0, #4
+        TestCase{0x7f1c8c02, {0x00000000FFFFFFF0, 0}, {0, 0}, {0, 0}, {0, 0}, true},
+        // SQDMLAL V2.4S, V0.4H, V1.4H
+        TestCase{0x0e619002, {0x8000000200030004, 0}, {0x8000000200020002, 0}, {0x0000000100000001, 0x7FFFFFFF00000001}, {0x0000000D00000011, 0x7FFFFFFF00000009}, true},
+        // SQDMLSL2 V2.2D, V0.4S, V1.4S
+        TestCase{0x4ea1b002, {0x1111111111111111, 0x0000000300000002}, {0x2222222222222222, 0xFFFFFFFF00000005}, {100, 0x8000000000000003}, {0x50, 0x8000000000000009}, false},
+        // SQDMLAL S2, H0, H1
+        TestCase{0x5e619002, {0x0000000000000100, 0}, {0x0000000000000200, 0}, {0xAAAAAAAA7FFF0000, 0x1234}, {0x7FFFFFFF, 0}, true},
+        // SQDMULL D2, S0, S1
+        TestCase{0x5ea1d002, {0x0000000080000000, 0}, {0x0000000080000000, 0}, {0, 0}, {0x7FFFFFFFFFFFFFFF, 0}, true},
+        // SQDMLAL2 V2.4S, V0.8H, V1.H[7]
+        TestCase{0x4f713802, {0, 0x0004000300020001}, {0, 0x0010000000000000}, {0, 0}, {0x0000004000000020, 0x0000008000000060}, false},
+        // SQDMLSL D2, S0, V1.S[3]
+        TestCase{0x5fa17802, {0x0000000000000003, 0}, {0, 0xFFFFFFFE00000000}, {0x10, 0x5555}, {0x1C, 0}, false},
+        // SQRDMLAH V2.4H, V0.4H, V1.H[3]
+        TestCase{0x2f71d002, {0x7FFF000140008000, 0}, {0x4000000000000000, 0}, {0x7000FFFF70000001, 0xDEAD}, {0x7FFF00007FFFC001, 0}, true},
+        // SQRDMLAH H2, H0, H1
+        TestCase{0x7e418402, {0x0000000000008000, 0}, {0x0000000000008000, 0}, {0x1111111111118000, 0x2222}, {0, 0}, false},
+        // SQRDMLSH S2, S0, V1.S[1]
+        TestCase{0x7fa1f002, {0x0000000040000000, 0}, {0x4000000000000000, 0}, {0x10, 0}, {0xE0000010, 0}, false},
+    };
+
+    A64TestEnv env;
+    A64::Jit jit{A64::UserConfig{&env}};
+
+    for (const auto& test_case : test_cases) {
+        env.code_mem.emplace_back(test_case.instruction);
+        env.code_mem.emplace_back(0x14000000); // B .
+    }
+
+    for (size_t i = 0; i < test_cases.size(); i++) {
+        const auto& test_case = test_cases[i];
+        INFO("instruction: " << std::hex << test_case.instruction);
+
+        jit.SetPC(i * 8);
+        jit.SetVector(0, test_case.n);
+        jit.SetVector(1, test_case.m);
+        jit.SetVector(2, test_case.d);
+        jit.SetFpsr(0);
+        env.ticks_left = 2;
+        jit.Run();
+
+        REQUIRE(jit.GetVector(2) == test_case.expected);
+        REQUIRE(FP::FPSR{jit.GetFpsr()}.QC() == test_case.expected_qc);
+    }
+}
+
+TEST_CASE("A64: FJCVTZS", "[a64]") {
+    A64TestEnv env;
+    A64::Jit jit{A64::UserConfig{&env}};
+
+    env.code_mem.emplace_back(0x1e7e0000); // FJCVTZS W0, D0
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    struct TestCase {
+        u64 operand;
+        u32 expected;
+        bool z;
+        u32 expected_fpsr;
+    };
+    const std::array test_cases{
+        TestCase{0x3FF0000000000000, 0x00000001, true, 0x00},  // 1.0
+        TestCase{0xBFF8000000000000, 0xFFFFFFFF, false, 0x10}, // -1.5
+        TestCase{0x400FEB851EB851EC, 0x00000003, false, 0x10}, // 3.99
+        TestCase{0x8000000000000000, 0x00000000, false, 0x00}, // -0.0
+        TestCase{0x0000000000000001, 0x00000000, false, 0x10}, // Smallest denormal
+        TestCase{0xC1E0000000000000, 0x80000000, true, 0x00},  // -2147483648.0
+        TestCase{0xC1E0000000100000, 0x80000000, false, 0x10}, // -2147483648.5
+        TestCase{0x41E0000000000000, 0x80000000, false, 0x01}, // 2147483648.0
+        TestCase{0x41F0000000500000, 0x00000005, false, 0x01}, // 4294967301.0
+        TestCase{0x433FFFFFFFFFFFFF, 0xFFFFFFFF, false, 0x01}, // 2^53 - 1
+        TestCase{0xC270000000003000, 0xFFFFFFFD, false, 0x01}, // -(2^40 + 3)
+        TestCase{0x7E37E43C8800759C, 0x00000000, false, 0x01}, // 1e300
+        TestCase{0x7FF0000000000000, 0x00000000, false, 0x01}, // +Inf
+        TestCase{0x7FF8000000000000, 0x00000000, false, 0x01}, // QNaN
+    };
+    // With FPCR.FZ set, denormal operands are flushed to zero and raise IDC.
+    const std::array flush_to_zero_test_cases{
+        TestCase{0x3FF0000000000000, 0x00000001, true, 0x00},  // 1.0
+        TestCase{0x0000000000000001, 0x00000000, true, 0x80},  // Smallest denormal
+        TestCase{0x000FFFFFFFFFFFFF, 0x00000000, true, 0x80},  // Largest denormal
+        TestCase{0x8000000000000001, 0x00000000, false, 0x80}, // Negative denormal
+        TestCase{0x0000000000000000, 0x00000000, true, 0x00},  // +0.0
+        TestCase{0x8000000000000000, 0x00000000, false, 0x00}, // -0.0
+        TestCase{0x0010000000000000, 0x00000000, false, 0x10}, // Smallest normal
+    };
+
+    const auto run_test_case = [&](const TestCase& test_case, u32 fpcr) {
+        INFO("operand: " << std::hex << test_case.operand << ", fpcr: " << fpcr);
+
+        jit.SetPC(0);
+        jit.SetVector(0, {test_case.operand, 0});
+        jit.SetRegister(0, 0xDEADBEEFDEADBEEF);
+        jit.SetPstate(0xF0000000);
+        jit.SetFpcr(fpcr);
+        jit.SetFpsr(0);
+        env.ticks_left = 2;
+        jit.Run();
+
+        REQUIRE(jit.GetRegister(0) == test_case.expected);
+        REQUIRE((jit.GetPstate() & 0xF0000000) == (test_case.z ? 0x40000000 : 0));
+        REQUIRE(jit.GetFpsr() == test_case.expected_fpsr);
+    };
+
+    for (const auto& test_case : test_cases) {
+        run_test_case(test_case, 0);
+    }
+    for (const auto& test_case : flush_to_zero_test_cases) {
+        run_test_case(test_case, 0x01000000);
+    }
+}
+
+TEST_CASE("A64: FRINT32 and FRINT64", "[a64]") {
+    A64TestEnv env;
+    A64::Jit jit{A64::UserConfig{&env}};
+
+    SECTION("Scalar") {
+        struct TestCase {
+            u32 instruction;
+            u64 operand;
+            u64 expected;
+            u32 expected_fpsr;
+        };
+        const std::array test_cases{
+            TestCase{0x1e68c002, 0x4004000000000000, 0x4000000000000000, 0x10}, // FRINT32X D2, D0: 2.5
+            TestCase{0x1e68c002, 0xBFD0000000000000, 0x8000000000000000, 0x10}, // FRINT32X D2, D0: -0.25
+            TestCase{0x1e68c002, 0x41DFFFFFFFC00000, 0x41DFFFFFFFC00000, 0x00}, // FRINT32X D2, D0: 2147483647.0
+            TestCase{0x1e68c002, 0x41DFFFFFFFE00000, 0xC1E0000000000000, 0x01}, // FRINT32X D2, D0: 2147483647.5
+            TestCase{0x1e68c002, 0xC1E00000000CCCCD, 0xC1E0000000000000, 0x10}, // FRINT32X D2, D0: -2147483648.4
+            TestCase{0x1e68c002, 0x7FF8000000000000, 0xC1E0000000000000, 0x01}, // FRINT32X D2, D0: QNaN
+            TestCase{0x1e684002, 0x41DFFFFFFFF9999A, 0x41DFFFFFFFC00000, 0x10}, // FRINT32Z D2, D0: 2147483647.9
+            TestCase{0x1e684002, 0xC1E00000001CCCCD, 0xC1E0000000000000, 0x10}, // FRINT32Z D2, D0: -2147483648.9
+            TestCase{0x1e694002, 0x40C81CE000000000, 0x40C81C8000000000, 0x10}, // FRINT64Z D2, D0: 12345.75
+            TestCase{0x1e694002, 0xC3E0000000000000, 0xC3E0000000000000, 0x00}, // FRINT64Z D2, D0: -2^63
+            TestCase{0x1e694002, 0x43E02207973F6440, 0xC3E0000000000000, 0x01}, // FRINT64Z D2, D0: 9.3e18
+            TestCase{0x1e69c002, 0xFFF0000000000000, 0xC3E0000000000000, 0x01}, // FRINT64X D2, D0: -Inf
+            TestCase{0x1e28c002, 0xBFC00000, 0xC0000000, 0x10},                 // FRINT32X S2, S0: -1.5
+            TestCase{0x1e28c002, 0x4F000000, 0xCF000000, 0x01},                 // FRINT32X S2, S0: 2^31
+            TestCase{0x1e29c002, 0x5EFFFFFF, 0x5EFFFFFF, 0x00},                 // FRINT64X S2, S0: 2^63 - 2^39
+            TestCase{0x1e29c002, 0x5F000000, 0xDF000000, 0x01},                 // FRINT64X S2, S0: 2^63
+        };
+
+        for (const auto& test_case : test_cases) {
+            env.code_mem.emplace_back(test_case.instruction);
+            env.code_mem.emplace_back(0x14000000); // B .
+        }
+
+        for (size_t i = 0; i < test_cases.size(); i++) {
+            const TestCase& test_case = test_cases[i];
+
+            INFO("instruction: " << std::hex << test_case.instruction << " operand: " << test_case.operand);
+
+            jit.SetPC(i * 8);
+            jit.SetVector(0, {test_case.operand, 0});
+            jit.SetFpcr(0);
+            jit.SetFpsr(0);
+            env.ticks_left = 2;
+            jit.Run();
+
+            REQUIRE(jit.GetVector(2) == Vector{test_case.expected, 0});
+            REQUIRE(jit.GetFpsr() == test_case.expected_fpsr);
+        }
+    }
+
+    SECTION("Randomized") {
+        // Biased towards operands close to the limits of the integer ranges.
+        const auto random_float = [](auto bits) {
+            using T = decltype(bits);
+            constexpr size_t mantissa_width = sizeof(T) == 4 ? 23 : 52;
+            constexpr T bias = sizeof(T) == 4 ? 127 : 1023;
+            const T sign = static_cast<T>(RandInt<T>(0, 1) << (sizeof(T) * 8 - 1));
+            const T mantissa = RandInt<T>(0, static_cast<T>((T(1) << mantissa_width) - 1));
+            const T exponent = RandInt(0, 3) == 0 ? RandInt<T>(0, 2 * bias + 1) : RandInt<T>(bias - 2, bias + 64);
+            return static_cast<T>(sign | (exponent << mantissa_width) | mantissa);
+        };
+
+        struct TestCase {
+            u32 instruction;
+            size_t esize;
+            size_t elements;
+            bool exact;
+            size_t intsize;
+        };
+        const std::array test_cases{
+            TestCase{0x1e68c002, 64, 1, true, 32},  // FRINT32X D2, D0
+            TestCase{0x1e69c002, 64, 1, true, 64},  // FRINT64X D2, D0
+            TestCase{0x1e684002, 64, 1, false, 32}, // FRINT32Z D2, D0
+            TestCase{0x1e694002, 64, 1, false, 64}, // FRINT64Z D2, D0
+            TestCase{0x1e28c002, 32, 1, true, 32},  // FRINT32X S2, S0
+            TestCase{0x1e29c002, 32, 1, true, 64},  // FRINT64X S2, S0
+            TestCase{0x1e284002, 32, 1, false, 32}, // FRINT32Z S2, S0
+            TestCase{0x1e294002, 32, 1, false, 64}, // FRINT64Z S2, S0
+            TestCase{0x6e21e802, 32, 4, true, 32},  // FRINT32X V2.4S, V0.4S
+            TestCase{0x4e21f802, 32, 4, false, 64}, // FRINT64Z V2.4S, V0.4S
+            TestCase{0x4e61e802, 64, 2, false, 32}, // FRINT32Z V2.2D, V0.2D
+            TestCase{0x6e61f802, 64, 2, true, 64},  // FRINT64X V2.2D, V0.2D
+        };
+        for (const auto& test_case : test_cases) {
+            env.code_mem.emplace_back(test_case.instruction);
+            env.code_mem.emplace_back(0x14000000); // B .
+        }
+
+        for (const u32 fpcr_value : {0x00000000u, 0x00400000u, 0x00800000u, 0x00c00000u}) {
+            const FP::FPCR fpcr{fpcr_value};
+            jit.SetFpcr(fpcr_value);
+
+            for (size_t i = 0; i < test_cases.size(); i++) {
+                const TestCase& test_case = test_cases[i];
+                const FP::RoundingMode rounding = test_case.exact ? fpcr.RMode() : FP::RoundingMode::TowardsZero;
+
+                for (size_t iteration = 0; iteration < 200; iteration++) {
+                    Vector v0{};
+                    for (size_t e = 0; e < test_case.elements; e++) {
+                        const u64 element = test_case.esize == 32 ? random_float(u32{}) : random_float(u64{});
+                        v0[e * test_case.esize / 64] |= element << (e * test_case.esize % 64);
+                    }
+
+                    INFO("instruction: " << std::hex << test_case.instruction << " fpcr: " << fpcr_value << " v0: " << v0[0] << " " << v0[1]);
+
+                    jit.SetPC(i * 8);
+                    jit.SetVector(0, v0);
+                    jit.SetFpsr(0);
+                    env.ticks_left = 2;
+                    jit.Run();
+
+                    FP::FPSR fpsr;
+                    Vector expected{};
+                    for (size_t e = 0; e < test_case.elements; e++) {
+                        const size_t shift = e * test_case.esize % 64;
+                        const u64 element = test_case.esize == 32
+                                          ? FP::FPRoundIntN<u32>(static_cast<u32>(v0[e * test_case.esize / 64] >> shift), fpcr, rounding, test_case.intsize, fpsr)
+                                          : FP::FPRoundIntN<u64>(v0[e], fpcr, rounding, test_case.intsize, fpsr);
+                        expected[e * test_case.esize / 64] |= element << shift;
+                    }
+                    REQUIRE(jit.GetVector(2) == expected);
+                    REQUIRE(jit.GetFpsr() == fpsr.Value());
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("A64: Pointer authentication", "[a64]") {
+    A64TestEnv env;
+    A64::UserConfig conf{&env};
+    conf.pointer_authentication_strip_mask = 0x007F000000000000;
+    A64::Jit jit{conf};
+
+    env.code_mem = {
+        0xd503233f, // PACIASP
+        0xdac10020, // PACIA X0, X1
+        0xdac11020, // AUTIA X0, X1
+        0xdac143e2, // XPACI X2
+        0xd50321df, // AUTIB1716
+        0xf8201483, // LDRAA X3, [X4, #8]
+        0xd503245f, // BTI C
+        0xd50323bf, // AUTIASP
+        0xd65f0bff, // RETAA
+    };
+    env.code_mem.resize(0x100 / 4, 0x14000000); // B .
+    env.code_mem.emplace_back(0xd63f08ff);      // BLRAAZ X7
+    env.code_mem.emplace_back(0x14000000);      // B .
+
+    env.MemoryWrite64(0x208, 0x1122334455667788);
+
+    jit.SetRegister(0, 0x0012000000001000);
+    jit.SetRegister(1, 0x0000000000000042);
+    jit.SetRegister(2, 0x00B4FFFF80001234);
+    jit.SetRegister(4, 0x0066000000000200);
+    jit.SetRegister(7, 0x002B000000000104);
+    jit.SetRegister(17, 0x0055000000002000);
+    jit.SetRegister(30, 0x0033000000000100);
+    jit.SetPC(0);
+
+    env.ticks_left = 10;
+    jit.Run();
+
+    REQUIRE(jit.GetRegister(0) == 0x0000000000001000);
+    REQUIRE(jit.GetRegister(2) == 0x00FFFFFF80001234);
+    REQUIRE(jit.GetRegister(3) == 0x1122334455667788);
+    REQUIRE(jit.GetRegister(4) == 0x0066000000000200);
+    REQUIRE(jit.GetRegister(17) == 0x0000000000002000);
+    REQUIRE(jit.GetRegister(30) == 0x0000000000000104);
+    REQUIRE(jit.GetPC() == 0x0000000000000104);
+}
+
+TEST_CASE("A64: Interpreter tier", "[a64]") {
+    const std::array<u32, 12> code{
+        0xd2800000, // MOVZ X0, #0
+        0xd2800141, // MOVZ X1, #10
+        0x8b010400, // loop: ADD X0, X0, X1, LSL #1
+        0x9b017c02, // MUL X2, X0, X1
+        0x9ac10843, // UDIV X3, X2, X1
+        0xcac21c64, // EOR X4, X3, X2, ROR #7
+        0xf8008ca4, // STR X4, [X5, #8]!
+        0xf94000a6, // LDR X6, [X5]
+        0xf1000421, // SUBS X1, X1, #1
+        0x54ffff21, // B.NE loop
+        0x9a860007, // CSEL X7, X0, X6, EQ
+        0x14000000, // B .
+    };
+
+    struct State {
+        std::array<u64, 31> regs;
+        u64 pc;
+        u32 pstate;
+        std::map<u64, u8> memory;
+    };
+
+    const auto run = [&](size_t threshold, bool step) {
+        A64TestEnv env;
+        A64::UserConfig conf{&env};
+        conf.interpreter_tier_threshold = threshold;
+        A64::Jit jit{conf};
+
+        env.code_mem.assign(code.begin(), code.end());
+        jit.SetRegister(5, 0x1000);
+        jit.SetPC(0);
+
+        if (step) {
+            for (size_t i = 0; i < 90; i++) {
+                env.ticks_left = 1;
+                jit.Step();
+            }
+        } else {
+            env.ticks_left = 200;
+            jit.Run();
+        }
+
+        return State{jit.GetRegisters(), jit.GetPC(), jit.GetPstate(), env.modified_memory};
+    };
+
+    const State expected = run(0, false);
+    REQUIRE(expected.regs[0] == 110);
+    REQUIRE(expected.regs[1] == 0);
+    REQUIRE(expected.regs[7] == 110);
+    REQUIRE(expected.pc == 44);
+
+    for (const size_t threshold : {1, 2, 1000}) {
+        INFO("threshold " << threshold);
+
+        const State actual = run(threshold, false);
+        REQUIRE(actual.regs == expected.regs);
+        REQUIRE(actual.pc == expected.pc);
+        REQUIRE(actual.pstate == expected.pstate);
+        REQUIRE(actual.memory == expected.memory);
+
+        const State stepped = run(threshold, true);
+        REQUIRE(stepped.regs == expected.regs);
+        REQUIRE(stepped.pc == expected.pc);
+        REQUIRE(stepped.pstate == expected.pstate);
+        REQUIRE(stepped.memory == expected.memory);
+    }
+}
+
+TEST_CASE("A64: Interpreter tier with floating-point", "[a64]") {
+    const std::array<u32, 28> code{
+        0xd2800141, // MOVZ X1, #10
+        0x1e6f1005, // FMOV D5, #1.5
+        0x9e620020, // loop: SCVTF D0, X1
+        0x1e03f421, // UCVTF S1, W1, #3
+        0x1e61c002, // FSQRT D2, D0
+        0x1e601843, // FDIV D3, D2, D0
+        0x1e650864, // FMUL D4, D3, D5
+        0x1f400884, // FMADD D4, D4, D0, D2
+        0x1e633884, // FSUB D4, D4, D3
+        0x1e212826, // FADD S6, S1, S1
+        0x1e22c0c7, // FCVT D7, S6
+        0x1e63c088, // FCVT H8, D4
+        0x1ee24109, // FCVT S9, H8
+        0x1e67406a, // FRINTX D10, D3
+        0x1e780082, // FCVTZS W2, D4
+        0x9e19f123, // FCVTZU X3, S9, #4
+        0x1e632080, // FCMP D4, D3
+        0x1e65cc85, // FCSEL D5, D4, D5, GT
+        0x4e181c4b, // MOV V11.D[1], X2
+        0x0e0c3d64, // MOV W4, V11.S[1]
+        0x3c8104cb, // STR Q11, [X6], #16
+        0x5ea1d82d, // FRECPE S13, S1
+        0x1e63688e, // FMAXNM D14, D4, D3
+        0x5e65ddcf, // FMULX D15, D14, D5
+        0xf1000421, // SUBS X1, X1, #1
+        0x54fffd21, // B.NE loop
+        0xd53b4428, // MRS X8, FPSR
+        0x14000000, // B .
+    };
+
+    struct State {
+        std::array<u64, 31> regs;
+        std::array<Vector, 32> vecs;
+        u64 pc;
+        u32 pstate;
+        u32 fpsr;
+        std::map<u64, u8> memory;
+    };
+
+    const auto run = [&](size_t threshold, bool step, u32 fpcr) {
+        A64TestEnv env;
+        A64::UserConfig conf{&env};
+        conf.interpreter_tier_threshold = threshold;
+        A64::Jit jit{conf};
+
+        env.code_mem.assign(code.begin(), code.end());
+        jit.SetRegister(6, 0x1000);
+        jit.SetFpcr(fpcr);
+        jit.SetPC(0);
+
+        if (step) {
+            for (size_t i = 0; i < 250; i++) {
+                env.ticks_left = 1;
+                jit.Step();
+            }
+        } else {
+            env.ticks_left = 300;
+            jit.Run();
+        }
+
+        return State{jit.GetRegisters(), jit.GetVectors(), jit.GetPC(), jit.GetPstate(), jit.GetFpsr(), env.modified_memory};
+    };
+
+    // Round to nearest, and round towards minus infinity with flush-to-zero.
+    for (const u32 fpcr : {0x00000000u, 0x01800000u}) {
+        INFO("fpcr " << fpcr);
+
+        const State expected = run(0, false, fpcr);
+        REQUIRE(expected.regs[1] == 0);
+        REQUIRE(expected.pc == 108);
+
+        for (const auto& [threshold, step] : {std::make_pair(1000, false), std::make_pair(0, true), std::make_pair(1000, true)}) {
+            INFO("threshold " << threshold << " step " << step);
+
+            const State actual = run(threshold, step, fpcr);
+            REQUIRE(actual.regs == expected.regs);
+            REQUIRE(actual.vecs == expected.vecs);
+            REQUIRE(actual.pc == expected.pc);
+            REQUIRE(actual.pstate == expected.pstate);
+            REQUIRE(actual.fpsr == expected.fpsr);
+            REQUIRE(actual.memory == expected.memory);
+        }
+    }
+}
+
+TEST_CASE("A64: SETF8, SETF16, SB and NZCV access", "[a64]") {
+    const std::array<u32, 11> code{
+        0x3a00082d, // SETF8 W1
+        0xd53b4202, // MRS X2, NZCV
+        0xd51b4203, // MSR NZCV, X3
+        0xd500403f, // XAFLAG
+        0xd53b4204, // MRS X4, NZCV
+        0xd500405f, // AXFLAG
+        0xd53b4205, // MRS X5, NZCV
+        0x3a0048cd, // SETF16 W6
+        0xd53b4207, // MRS X7, NZCV
+        0xd50330ff, // SB
+        0x14000000, // B .
+    };
+
+    const auto run = [&](size_t threshold, bool step) {
+        A64TestEnv env;
+        A64::UserConfig conf{&env};
+        conf.interpreter_tier_threshold = threshold;
+        A64::Jit jit{conf};
+
+        env.code_mem.assign(code.begin(), code.end());
+        jit.SetRegister(1, 0x180);
+        jit.SetRegister(3, 0x40000000);
+        jit.SetRegister(6, 0x8000);
+        jit.SetPstate(0x20000000);
+        jit.SetPC(0);
+
+        if (step) {
+            for (size_t i = 0; i < 10; i++) {
+                env.ticks_left = 1;
+                jit.Step();
+            }
+        } else {
+            env.ticks_left = 10;
+            jit.Run();
+        }
+
+        REQUIRE(jit.GetRegister(2) == 0xA0000000);
+        REQUIRE(jit.GetRegister(4) == 0x30000000);
+        REQUIRE(jit.GetRegister(5) == 0x40000000);
+        REQUIRE(jit.GetRegister(7) == 0x90000000);
+        REQUIRE(jit.GetPstate() == 0x90000000);
+        REQUIRE(jit.GetPC() == 40);
+
+        REQUIRE(jit.GetInterpretedInstructionCounts().empty());
+    };
+
+    SECTION("Compiled") {
+        run(0, false);
+    }
+
+    SECTION("Stepped") {
+        run(0, true);
+    }
+
+    SECTION("Interpreter tier") {
+        run(1000, false);
+    }
+}
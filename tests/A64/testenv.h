@@ -22,6 +22,7 @@ public:
     bool code_mem_modified_by_guest = false;
     u64 code_mem_start_address = 0;
     std::vector<u32> code_mem;
+    std::map<u64, const void*> code_pages;
 
     std::map<u64, u8> modified_memory;
     std::vector<std::string> interrupts;
@@ -39,6 +40,11 @@ public:
         return code_mem[index];
     }
 
+    const void* GetCodePagePointer(u64 vaddr) override {
+        const auto iter = code_pages.find(vaddr);
+        return iter != code_pages.end() ? iter->second : nullptr;
+    }
+
     std::uint8_t MemoryRead8(u64 vaddr) override {
         if (IsInCodeMem(vaddr)) {
             return reinterpret_cast<u8*>(code_mem.data())[vaddr - code_mem_start_address];